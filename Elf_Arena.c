@@ -0,0 +1,153 @@
+#include "Elf_Arena.h"
+#include "Elf_Details.h"
+#include <stdint.h>		// SIZE_MAX
+#include <stdlib.h>
+#include <string.h>
+
+
+// Purpose:	Allocate a new arena block large enough for a request
+// Input:
+//			arena - Arena the block is for
+//			minSize - Smallest acceptable data size
+// Output:	Pointer to the new block (already linked in), NULL on failure
+// Note:	Oversize blocks are linked in behind the head so the head's free space isn't abandoned
+static struct Elf_Arena_Block* add_arena_block(struct Elf_Arena* arena, size_t minSize)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Arena_Block* retVal = NULL;
+	size_t dataSize = arena->blockSize;
+	size_t headerSize = (sizeof(struct Elf_Arena_Block) + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+
+	if (minSize > dataSize)
+	{
+		dataSize = minSize;
+	}
+
+	/* ALLOCATE */
+	// One allocation holds the block header and its data
+	retVal = (struct Elf_Arena_Block*)gimme_mem(headerSize + dataSize, sizeof(unsigned char));
+	if (retVal)
+	{
+		retVal->size = dataSize;
+		retVal->used = 0;
+		retVal->data = (unsigned char*)retVal + headerSize;
+		if (dataSize > arena->blockSize && arena->head)
+		{
+			// Full as soon as it's handed out, so keep bumping out of the head
+			retVal->next = arena->head->next;
+			arena->head->next = retVal;
+		}
+		else
+		{
+			retVal->next = arena->head;
+			arena->head = retVal;
+		}
+		arena->totalSize += headerSize + dataSize;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Allocate an empty arena
+// Input:	blockSize - Size of each block (0 for ARENA_BLOCK_SIZE)
+// Output:	Pointer to the new arena, NULL on failure
+// Note:	Caller is responsible for utilizing destroy_arena() to free the arena
+struct Elf_Arena* create_arena(size_t blockSize)
+{
+	struct Elf_Arena* retVal = NULL;
+
+	retVal = (struct Elf_Arena*)gimme_mem(1, sizeof(struct Elf_Arena));
+	if (retVal)
+	{
+		retVal->blockSize = blockSize ? blockSize : ARENA_BLOCK_SIZE;
+		retVal->totalSize = sizeof(struct Elf_Arena);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Bump allocate zeroized memory out of an arena
+// Input:
+//			arena - Arena to allocate from
+//			numElem - Number of elements to allocate
+//			sizeElem - Size of each element
+// Output:	Pointer to ARENA_ALIGNMENT aligned, zeroized memory.  NULL on failure.
+// Note:	
+//			Never free() the return value.  It is released by destroy_arena().
+//			Requests larger than a block get a dedicated block, linked in behind the head
+void* arena_gimme_mem(struct Elf_Arena* arena, size_t numElem, size_t sizeElem)
+{
+	/* LOCAL VARIABLES */
+	void* retVal = NULL;
+	struct Elf_Arena_Block* currBlock = NULL;	// Block to allocate out of
+	size_t reqSize = 0;							// Aligned size of the request
+
+	/* INPUT VALIDATION */
+	if (!arena || numElem < 1 || sizeElem < 1)
+	{
+		return retVal;
+	}
+	else if (numElem > (SIZE_MAX - ARENA_ALIGNMENT) / sizeElem)
+	{
+		return retVal;
+	}
+	reqSize = ((numElem * sizeElem) + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+
+	/* FIND ROOM */
+	currBlock = arena->head;
+	if (!currBlock || (currBlock->size - currBlock->used) < reqSize)
+	{
+		currBlock = add_arena_block(arena, reqSize);
+	}
+
+	/* BUMP */
+	if (currBlock)
+	{
+		// Blocks come from gimme_mem() so this memory is already zeroized
+		retVal = currBlock->data + currBlock->used;
+		currBlock->used += reqSize;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Zeroize and free an arena and everything allocated out of it
+// Input:	Pointer to an arena pointer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Modifies the arena pointer by making it NULL
+int destroy_arena(struct Elf_Arena** arena)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Arena_Block* currBlock = NULL;	// Block being freed
+	struct Elf_Arena_Block* nextBlock = NULL;	// Block to free next
+
+	/* INPUT VALIDATION */
+	if (!arena || !(*arena))
+	{
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
+
+	/* FREE BLOCKS */
+	currBlock = (*arena)->head;
+	while (currBlock)
+	{
+		nextBlock = currBlock->next;
+		// Only the bytes actually handed out need zeroizing
+		if (should_zeroize(FALSE) == TRUE)
+		{
+			memset(currBlock->data, ZEROIZE_CHAR, currBlock->used);
+		}
+		free(currBlock);
+		currBlock = nextBlock;
+	}
+
+	/* FREE ARENA */
+	retVal = take_mem_back((void**)arena, 1, sizeof(struct Elf_Arena));
+
+	return retVal;
+}
@@ -0,0 +1,54 @@
+#ifndef __ELF_ARENA_H__
+#define __ELF_ARENA_H__
+
+#include <stddef.h>		// size_t
+
+/*
+ *	USAGE:
+ *		Start - create_arena() to build an empty arena
+ *		Step - arena_gimme_mem() to bump allocate zeroized memory out of it
+ *		Stop - destroy_arena() to release every allocation in one operation
+ */
+
+#define ARENA_BLOCK_SIZE	((size_t)4096)	// Default size of each arena block
+#define ARENA_ALIGNMENT		((size_t)16)	// Every allocation is aligned to this many bytes
+
+struct Elf_Arena_Block
+{
+	struct Elf_Arena_Block* next;	// Previously filled (or dedicated) block
+	size_t size;					// Number of bytes in data
+	size_t used;					// Number of bytes of data already handed out
+	unsigned char* data;			// Memory to hand out (immediately follows the block header)
+};
+
+struct Elf_Arena
+{
+	struct Elf_Arena_Block* head;	// Block currently being handed out
+	size_t blockSize;				// Size of each new block
+	size_t totalSize;				// Number of bytes allocated across all blocks
+};
+
+// Purpose:	Allocate an empty arena
+// Input:	blockSize - Size of each block (0 for ARENA_BLOCK_SIZE)
+// Output:	Pointer to the new arena, NULL on failure
+// Note:	Caller is responsible for utilizing destroy_arena() to free the arena
+struct Elf_Arena* create_arena(size_t blockSize);
+
+// Purpose:	Bump allocate zeroized memory out of an arena
+// Input:
+//			arena - Arena to allocate from
+//			numElem - Number of elements to allocate
+//			sizeElem - Size of each element
+// Output:	Pointer to ARENA_ALIGNMENT aligned, zeroized memory.  NULL on failure.
+// Note:	
+//			Never free() the return value.  It is released by destroy_arena().
+//			Requests larger than a block get a dedicated block, linked in behind the head
+void* arena_gimme_mem(struct Elf_Arena* arena, size_t numElem, size_t sizeElem);
+
+// Purpose:	Zeroize and free an arena and everything allocated out of it
+// Input:	Pointer to an arena pointer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Modifies the arena pointer by making it NULL
+int destroy_arena(struct Elf_Arena** arena);
+
+#endif // __ELF_ARENA_H__
@@ -0,0 +1,739 @@
+#include "Elf_Batch.h"
+#include "Elf_Cache.h"
+#include "Elf_Details.h"
+#include "Elf_Record.h"
+#include <dirent.h>		// opendir()/readdir()
+#include <fcntl.h>		// open()
+#include <limits.h>		// PATH_MAX
+#include <pthread.h>	// Worker threads
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>	// stat()/lstat()
+#include <unistd.h>		// pread()/close()/sysconf()
+
+#ifndef PATH_MAX
+#define PATH_MAX 4096
+#endif // PATH_MAX
+
+#define BATCH_QUEUE_MIN		((size_t)64)	// Initial capacity of each worker's queue
+
+/* LOCAL STRUCTS */
+// One worker's paths.  The owner pops the newest, thieves steal the oldest.
+struct Elf_Batch_Queue
+{
+	pthread_mutex_t lock;	// Held by the owner or a thief, never both
+	char** paths;			// Circular buffer of dynamically allocated paths
+	size_t capacity;		// Number of slots in paths
+	size_t head;			// Slot of the oldest path
+	size_t count;			// Number of paths queued
+};
+
+// State shared by the walker and every worker
+struct Elf_Batch
+{
+	struct Elf_Batch_Queue* queues;	// One queue per worker
+	int numWorkers;					// Number of entries in queues
+	int headerOnly;					// See: Elf_Batch_Options
+	int skipParse;					// See: Elf_Batch_Options
+	struct Elf_Cache* cache;		// See: Elf_Batch_Options
+	Elf_Batch_Callback callback;	// Called once per file
+	void* userData;					// Passed through to callback
+	int nextQueue;					// Queue the walker fills next (round robin)
+	size_t maxPending;				// Walker waits once this many paths are queued
+	size_t pending;					// Paths queued across every queue (atomic)
+	int numWaiting;					// Workers waiting for work (atomic)
+	int walkerWaiting;				// If TRUE, the walker is waiting for room (atomic)
+	int walkDone;					// If TRUE, nothing else will be queued (protected by lock)
+	pthread_mutex_t lock;			// Protects walkDone and both condition variables
+	pthread_cond_t workCond;		// Signaled when a path is queued or the walk is done
+	pthread_cond_t roomCond;		// Signaled when the queues drain below half of maxPending
+	struct Elf_Batch_Stats stats;	// Totals (atomic)
+};
+
+// Thread argument
+struct Elf_Batch_Worker
+{
+	struct Elf_Batch* batch;	// Shared state
+	int workerId;				// Index of this worker's queue
+	pthread_t thread;			// This worker
+};
+
+/* LOCAL FUNCTIONS */
+static int queue_push(struct Elf_Batch_Queue* queue, char* path);
+static char* queue_pop(struct Elf_Batch_Queue* queue, int oldest);
+static int enqueue_path(struct Elf_Batch* batch, const char* path);
+static char* take_path(struct Elf_Batch* batch, int workerId);
+static int walk_path(struct Elf_Batch* batch, const char* path, int followLinks);
+static int walk_list(struct Elf_Batch* batch, const char* listName);
+static void scan_one_file(struct Elf_Batch* batch, int workerId, char* path);
+static void* batch_worker(void* workerArg);
+
+
+// Purpose:	Parse every regular file found under a set of paths on a pool of worker threads
+// Input:
+//			paths - Array of files and directories to scan (directories are walked recursively)
+//			numPaths - Number of entries in paths
+//			options - Optional.  NULL for the defaults.
+//			callback - Called once per file with the result
+//			userData - Passed through to callback
+//			stats [out] - Optional.  Totals for the whole batch.
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			Symbolic links named in paths (or in the list file) are followed.  Symbolic links
+//				found while walking a directory are not.
+//			Files that aren't ELF files are still reported (status ERROR_ORC_FILE)
+int scan_elf_batch(char** paths, int numPaths, const struct Elf_Batch_Options* options, \
+	               Elf_Batch_Callback callback, void* userData, struct Elf_Batch_Stats* stats)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Batch batch;					// Shared state
+	struct Elf_Batch_Worker* workers = NULL;	// One per thread
+	int numStarted = 0;						// Number of threads actually started
+	int tmpRetVal = ERROR_SUCCESS;			// Holds walk_*() return values
+	int i = 0;								// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!callback || (numPaths > 0 && !paths))
+	{
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
+	else if (numPaths < 0 || (options && (options->numWorkers < 0 || options->numWorkers > BATCH_MAX_WORKERS \
+		|| (options->skipParse == TRUE && options->cache))))
+	{
+		retVal = ERROR_BAD_ARG;
+		return retVal;
+	}
+
+	/* SETUP */
+	memset(&batch, 0, sizeof(batch));
+	batch.numWorkers = options && options->numWorkers > 0 ? options->numWorkers : get_default_num_workers();
+	batch.headerOnly = options ? options->headerOnly : FALSE;
+	batch.skipParse = options ? options->skipParse : FALSE;
+	batch.cache = options ? options->cache : NULL;
+	batch.callback = callback;
+	batch.userData = userData;
+	batch.maxPending = BATCH_QUEUE_DEPTH * batch.numWorkers;
+	pthread_mutex_init(&batch.lock, NULL);
+	pthread_cond_init(&batch.workCond, NULL);
+	pthread_cond_init(&batch.roomCond, NULL);
+	batch.queues = (struct Elf_Batch_Queue*)gimme_mem(batch.numWorkers, sizeof(struct Elf_Batch_Queue));
+	workers = (struct Elf_Batch_Worker*)gimme_mem(batch.numWorkers, sizeof(struct Elf_Batch_Worker));
+	if (!batch.queues || !workers)
+	{
+		PERROR(errno);
+		retVal = ERROR_NULL_PTR;
+	}
+	for (i = 0; retVal == ERROR_SUCCESS && i < batch.numWorkers; i++)
+	{
+		pthread_mutex_init(&(batch.queues[i].lock), NULL);
+	}
+
+	/* START WORKERS */
+	for (i = 0; retVal == ERROR_SUCCESS && i < batch.numWorkers; i++)
+	{
+		workers[i].batch = &batch;
+		workers[i].workerId = i;
+		if (pthread_create(&(workers[i].thread), NULL, batch_worker, workers + i))
+		{
+			fprintf(stderr, "Unable to start worker thread %d!\n", i);
+			retVal = ERROR_BAD_ARG;
+			break;
+		}
+		numStarted++;
+	}
+
+	/* WALK */
+	// Paths are queued as they're found so workers start parsing right away
+	if (retVal == ERROR_SUCCESS && numStarted > 0)
+	{
+		for (i = 0; i < numPaths; i++)
+		{
+			tmpRetVal = walk_path(&batch, paths[i], TRUE);
+			if (tmpRetVal == ERROR_NULL_PTR)
+			{
+				retVal = tmpRetVal;
+				break;
+			}
+		}
+		if (retVal == ERROR_SUCCESS && options && options->listName)
+		{
+			retVal = walk_list(&batch, options->listName);
+		}
+	}
+
+	/* WAIT FOR THE WORKERS */
+	// Workers drain whatever is queued before they exit
+	pthread_mutex_lock(&batch.lock);
+	batch.walkDone = TRUE;
+	pthread_cond_broadcast(&batch.workCond);
+	pthread_mutex_unlock(&batch.lock);
+	for (i = 0; i < numStarted; i++)
+	{
+		pthread_join(workers[i].thread, NULL);
+	}
+
+	/* CLEAN UP */
+	if (stats)
+	{
+		*stats = batch.stats;
+	}
+	if (batch.queues)
+	{
+		for (i = 0; i < batch.numWorkers; i++)
+		{
+			// Only a failed start leaves paths behind
+			while (batch.queues[i].count > 0)
+			{
+				free(queue_pop(batch.queues + i, FALSE));
+			}
+			if (batch.queues[i].paths)
+			{
+				take_mem_back((void**)&(batch.queues[i].paths), batch.queues[i].capacity, sizeof(char*));
+			}
+			pthread_mutex_destroy(&(batch.queues[i].lock));
+		}
+		take_mem_back((void**)&(batch.queues), batch.numWorkers, sizeof(struct Elf_Batch_Queue));
+	}
+	if (workers)
+	{
+		take_mem_back((void**)&workers, batch.numWorkers, sizeof(struct Elf_Batch_Worker));
+	}
+	pthread_cond_destroy(&batch.roomCond);
+	pthread_cond_destroy(&batch.workCond);
+	pthread_mutex_destroy(&batch.lock);
+
+	return retVal;
+}
+
+
+// Purpose:	Determine the default number of worker threads
+// Input:	None
+// Output:	Number of online cores, clamped to 1 through BATCH_MAX_WORKERS
+int get_default_num_workers(void)
+{
+	long retVal = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (retVal < 1)
+	{
+		retVal = 1;
+	}
+	else if (retVal > BATCH_MAX_WORKERS)
+	{
+		retVal = BATCH_MAX_WORKERS;
+	}
+
+	return (int)retVal;
+}
+
+
+// Purpose:	Add a path to the newest end of a queue
+// Input:
+//			queue - Queue to add to
+//			path - Dynamically allocated path (the queue takes ownership)
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Doubles the circular buffer when it's full
+static int queue_push(struct Elf_Batch_Queue* queue, char* path)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	char** newPaths = NULL;		// Grown circular buffer
+	size_t newCapacity = 0;		// Number of slots in newPaths
+	size_t i = 0;				// Iterating variable
+
+	pthread_mutex_lock(&(queue->lock));
+
+	/* GROW */
+	if (queue->count == queue->capacity)
+	{
+		newCapacity = queue->capacity ? queue->capacity * 2 : BATCH_QUEUE_MIN;
+		newPaths = (char**)gimme_mem(newCapacity, sizeof(char*));
+		if (!newPaths)
+		{
+			PERROR(errno);
+			retVal = ERROR_NULL_PTR;
+		}
+		else
+		{
+			// Unwrap the old buffer so the oldest path lands in slot 0
+			for (i = 0; i < queue->count; i++)
+			{
+				newPaths[i] = queue->paths[(queue->head + i) % queue->capacity];
+			}
+			if (queue->paths)
+			{
+				take_mem_back((void**)&(queue->paths), queue->capacity, sizeof(char*));
+			}
+			queue->paths = newPaths;
+			queue->capacity = newCapacity;
+			queue->head = 0;
+		}
+	}
+
+	/* PUSH */
+	if (retVal == ERROR_SUCCESS)
+	{
+		queue->paths[(queue->head + queue->count) % queue->capacity] = path;
+		queue->count++;
+	}
+
+	pthread_mutex_unlock(&(queue->lock));
+
+	return retVal;
+}
+
+
+// Purpose:	Remove a path from a queue
+// Input:
+//			queue - Queue to remove from
+//			oldest - If TRUE, take the oldest path (stealing).  Otherwise, the newest (owner).
+// Output:	Dynamically allocated path, NULL if the queue is empty
+static char* queue_pop(struct Elf_Batch_Queue* queue, int oldest)
+{
+	/* LOCAL VARIABLES */
+	char* retVal = NULL;
+
+	pthread_mutex_lock(&(queue->lock));
+
+	if (queue->count > 0 && oldest == TRUE)
+	{
+		retVal = queue->paths[queue->head];
+		queue->head = (queue->head + 1) % queue->capacity;
+		queue->count--;
+	}
+	else if (queue->count > 0)
+	{
+		retVal = queue->paths[(queue->head + queue->count - 1) % queue->capacity];
+		queue->count--;
+	}
+
+	pthread_mutex_unlock(&(queue->lock));
+
+	return retVal;
+}
+
+
+// Purpose:	Hand a path to the workers
+// Input:
+//			batch - Shared state
+//			path - Path to copy and queue
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Waits for the workers to catch up once maxPending paths are queued
+static int enqueue_path(struct Elf_Batch* batch, const char* path)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	char* pathCopy = NULL;		// Owned by the queue once it's pushed
+	size_t pathLen = strlen(path);
+
+	/* WAIT FOR ROOM */
+	if (__atomic_load_n(&(batch->pending), __ATOMIC_SEQ_CST) >= batch->maxPending)
+	{
+		pthread_mutex_lock(&(batch->lock));
+		__atomic_store_n(&(batch->walkerWaiting), TRUE, __ATOMIC_SEQ_CST);
+		while (__atomic_load_n(&(batch->pending), __ATOMIC_SEQ_CST) >= batch->maxPending)
+		{
+			pthread_cond_wait(&(batch->roomCond), &(batch->lock));
+		}
+		__atomic_store_n(&(batch->walkerWaiting), FALSE, __ATOMIC_SEQ_CST);
+		pthread_mutex_unlock(&(batch->lock));
+	}
+
+	/* QUEUE IT */
+	pathCopy = (char*)malloc(pathLen + 1);
+	if (!pathCopy)
+	{
+		PERROR(errno);
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
+	memcpy(pathCopy, path, pathLen + 1);
+	// Count it first so pending never dips below the number of queued paths
+	__atomic_add_fetch(&(batch->pending), 1, __ATOMIC_SEQ_CST);
+	retVal = queue_push(batch->queues + batch->nextQueue, pathCopy);
+	if (retVal != ERROR_SUCCESS)
+	{
+		__atomic_sub_fetch(&(batch->pending), 1, __ATOMIC_SEQ_CST);
+		free(pathCopy);
+		return retVal;
+	}
+	batch->nextQueue = (batch->nextQueue + 1) % batch->numWorkers;
+
+	/* WAKE A WORKER */
+	if (__atomic_load_n(&(batch->numWaiting), __ATOMIC_SEQ_CST) > 0)
+	{
+		pthread_mutex_lock(&(batch->lock));
+		pthread_cond_signal(&(batch->workCond));
+		pthread_mutex_unlock(&(batch->lock));
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Find the next path for a worker
+// Input:
+//			batch - Shared state
+//			workerId - Index of the worker's own queue
+// Output:	Dynamically allocated path, NULL if every queue is empty
+// Note:	Tries the worker's own queue first, then steals from the others in turn
+static char* take_path(struct Elf_Batch* batch, int workerId)
+{
+	/* LOCAL VARIABLES */
+	char* retVal = NULL;
+	size_t newPending = 0;	// Paths still queued
+	int i = 0;				// Iterating variable
+
+	/* OWN QUEUE, THEN STEAL */
+	retVal = queue_pop(batch->queues + workerId, FALSE);
+	for (i = 1; !retVal && i < batch->numWorkers; i++)
+	{
+		retVal = queue_pop(batch->queues + ((workerId + i) % batch->numWorkers), TRUE);
+	}
+
+	/* MAKE ROOM FOR THE WALKER */
+	if (retVal)
+	{
+		newPending = __atomic_sub_fetch(&(batch->pending), 1, __ATOMIC_SEQ_CST);
+		if (newPending <= batch->maxPending / 2 && __atomic_load_n(&(batch->walkerWaiting), __ATOMIC_SEQ_CST))
+		{
+			pthread_mutex_lock(&(batch->lock));
+			pthread_cond_signal(&(batch->roomCond));
+			pthread_mutex_unlock(&(batch->lock));
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Queue a file or walk a directory
+// Input:
+//			batch - Shared state
+//			path - File or directory
+//			followLinks - If TRUE, a symbolic link is treated as what it points to
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			Only ERROR_NULL_PTR (out of memory) stops the batch.  Anything unreadable is
+//				reported to stderr and skipped.
+//			Directories are walked depth first
+static int walk_path(struct Elf_Batch* batch, const char* path, int followLinks)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct stat pathStat;			// Type of path
+	DIR* currDir = NULL;			// Open directory stream
+	struct dirent* currEntry = NULL;	// Directory entry being walked
+	char* childPath = NULL;			// path + "/" + entry name
+	size_t pathLen = strlen(path);	// Length of path
+	size_t nameLen = 0;				// Length of an entry name
+	size_t sepLen = 1;				// Length of the separator between path and entry name
+
+	/* WHAT IS IT */
+	if ((followLinks == TRUE ? stat(path, &pathStat) : lstat(path, &pathStat)))
+	{
+		fprintf(stderr, "Unable to stat %s: %s\n", path, strerror(errno));
+		errno = 0;	// Reported and skipped, so don't let it leak into later PERROR()s
+		return retVal;
+	}
+	else if (S_ISREG(pathStat.st_mode))
+	{
+		retVal = enqueue_path(batch, path);
+		return retVal;
+	}
+	else if (!S_ISDIR(pathStat.st_mode))
+	{
+		// Devices, pipes, sockets, and (while walking) symbolic links
+		if (followLinks == TRUE)
+		{
+			fprintf(stderr, "Skipping %s: Not a regular file or directory\n", path);
+		}
+		return retVal;
+	}
+
+	/* WALK THE DIRECTORY */
+	currDir = opendir(path);
+	if (!currDir)
+	{
+		fprintf(stderr, "Unable to open directory %s: %s\n", path, strerror(errno));
+		errno = 0;	// Reported and skipped, so don't let it leak into later PERROR()s
+		return retVal;
+	}
+	childPath = (char*)gimme_mem(PATH_MAX, sizeof(char));
+	if (!childPath)
+	{
+		PERROR(errno);
+		closedir(currDir);
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
+	// Don't double up the separator (e.g., walking "/")
+	while (pathLen > 1 && path[pathLen - 1] == '/')
+	{
+		pathLen--;
+	}
+	if (path[pathLen - 1] == '/')
+	{
+		sepLen = 0;
+	}
+
+	while (retVal == ERROR_SUCCESS && (currEntry = readdir(currDir)))
+	{
+		if (!strcmp(currEntry->d_name, ".") || !strcmp(currEntry->d_name, ".."))
+		{
+			continue;
+		}
+		nameLen = strlen(currEntry->d_name);
+		if (pathLen + sepLen + nameLen + 1 > PATH_MAX)
+		{
+			fprintf(stderr, "Skipping %s/%s: Path too long\n", path, currEntry->d_name);
+			continue;
+		}
+		memcpy(childPath, path, pathLen);
+		childPath[pathLen] = '/';
+		memcpy(childPath + pathLen + sepLen, currEntry->d_name, nameLen + 1);
+
+		// d_type saves a stat() per file on most filesystems
+#ifdef _DIRENT_HAVE_D_TYPE
+		if (currEntry->d_type == DT_REG)
+		{
+			retVal = enqueue_path(batch, childPath);
+			continue;
+		}
+		else if (currEntry->d_type != DT_DIR && currEntry->d_type != DT_UNKNOWN)
+		{
+			continue;
+		}
+#endif // _DIRENT_HAVE_D_TYPE
+		retVal = walk_path(batch, childPath, FALSE);
+	}
+
+	/* CLEAN UP */
+	closedir(currDir);
+	take_mem_back((void**)&childPath, PATH_MAX, sizeof(char));
+
+	return retVal;
+}
+
+
+// Purpose:	Walk every path listed in a file
+// Input:
+//			batch - Shared state
+//			listName - File with one path per line ("-" for stdin)
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Blank lines are skipped.  Listed directories are walked.
+static int walk_list(struct Elf_Batch* batch, const char* listName)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	FILE* listFile = NULL;		// Open list of paths
+	char* currLine = NULL;		// Buffer allocated by getline()
+	size_t lineSize = 0;		// Size of currLine
+	ssize_t lineLen = 0;		// Length of the line read
+
+	/* OPEN THE LIST */
+	if (!strcmp(listName, "-"))
+	{
+		listFile = stdin;
+	}
+	else
+	{
+		listFile = fopen(listName, "r");
+	}
+	if (!listFile)
+	{
+		fprintf(stderr, "Unable to open %s: %s\n", listName, strerror(errno));
+		retVal = ERROR_BAD_ARG;
+		return retVal;
+	}
+
+	/* WALK EACH LINE */
+	while (retVal != ERROR_NULL_PTR && (lineLen = getline(&currLine, &lineSize, listFile)) >= 0)
+	{
+		while (lineLen > 0 && (currLine[lineLen - 1] == '\n' || currLine[lineLen - 1] == '\r'))
+		{
+			currLine[--lineLen] = '\0';
+		}
+		if (lineLen > 0)
+		{
+			retVal = walk_path(batch, currLine, TRUE);
+		}
+	}
+
+	/* CLEAN UP */
+	free(currLine);
+	if (listFile != stdin)
+	{
+		fclose(listFile);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Parse one file and report the result
+// Input:
+//			batch - Shared state
+//			workerId - Worker doing the parsing
+//			path - File to parse
+// Output:	None
+// Note:	The first four bytes are checked with one pread() so the (common) non-ELF
+//				file is rejected before anything is allocated or mapped
+static void scan_one_file(struct Elf_Batch* batch, int workerId, char* path)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Batch_Result result;			// Reported to the callback
+	unsigned char magicNum[4] = { 0 };		// First bytes of the file
+	int elfFd = -1;							// File descriptor of path
+	ssize_t numRead = 0;					// Number of bytes pread() returned
+	struct stat fileStat;					// Identity of path, for the cache
+	struct Elf_Record record;				// Cached result
+
+	memset(&result, 0, sizeof(result));
+	result.fileName = path;
+	result.workerId = workerId;
+	result.status = ERROR_SUCCESS;
+
+	/* CHECK THE CACHE */
+	// stat() before reading so a file changed mid-read is keyed by its old identity and misses next time
+	if (batch->cache)
+	{
+		if (stat(path, &fileStat))
+		{
+			result.status = ERROR_BAD_ARG;
+			result.errnum = errno;
+		}
+		else if (lookup_elf_cache(batch->cache, &fileStat, batch->headerOnly, &record) == ERROR_SUCCESS)
+		{
+			if (record.status == RECORD_STATUS_NOT_ELF)
+			{
+				result.status = ERROR_ORC_FILE;
+				result.cached = TRUE;
+			}
+			else if (record.status == RECORD_STATUS_ELF)
+			{
+				// Parse the file instead if it can't be rebuilt
+				result.elven = record_to_elf(&record, path);
+				result.cached = result.elven ? TRUE : FALSE;
+			}
+		}
+	}
+
+	/* CHECK THE MAGIC NUMBER */
+	if (result.cached == TRUE || result.status != ERROR_SUCCESS)
+	{
+		// Already answered
+	}
+	else if ((elfFd = open(path, O_RDONLY)) < 0)
+	{
+		result.status = ERROR_BAD_ARG;
+		result.errnum = errno;
+	}
+	else
+	{
+		numRead = pread(elfFd, magicNum, sizeof(magicNum), 0);
+		if (numRead < 0)
+		{
+			result.status = ERROR_BAD_ARG;
+			result.errnum = errno;
+		}
+		else if (numRead < (ssize_t)sizeof(magicNum) || memcmp(magicNum, ELF_H_MAGIC_NUM, sizeof(magicNum)))
+		{
+			result.status = ERROR_ORC_FILE;
+		}
+		close(elfFd);
+	}
+
+	/* PARSE IT */
+	if (result.cached != TRUE && result.status == ERROR_SUCCESS && batch->skipParse != TRUE)
+	{
+		result.elven = read_elf_arena(path, batch->headerOnly);
+		if (!result.elven)
+		{
+			result.status = ERROR_NULL_PTR;
+			result.errnum = errno;
+		}
+		else if (!result.elven->decoders)
+		{
+			// Starts with the magic number but the class or data bytes are invalid
+			result.status = ERROR_ORC_FILE;
+			kill_elf_mapped(&(result.elven));
+		}
+	}
+
+	/* CACHE IT */
+	// Read errors aren't cached so they're retried next time
+	if (batch->cache && result.cached != TRUE && !result.errnum \
+		&& (result.status == ERROR_SUCCESS || result.status == ERROR_ORC_FILE))
+	{
+		add_elf_to_cache(batch->cache, &fileStat, batch->headerOnly, result.elven, path);
+	}
+
+	/* REPORT IT */
+	__atomic_add_fetch(&(batch->stats.numFiles), 1, __ATOMIC_RELAXED);
+	if (result.status == ERROR_SUCCESS)
+	{
+		__atomic_add_fetch(&(batch->stats.numElves), 1, __ATOMIC_RELAXED);
+	}
+	else if (result.errnum)
+	{
+		__atomic_add_fetch(&(batch->stats.numErrors), 1, __ATOMIC_RELAXED);
+	}
+	if (result.cached == TRUE)
+	{
+		__atomic_add_fetch(&(batch->stats.numCached), 1, __ATOMIC_RELAXED);
+	}
+	batch->callback(&result, batch->userData);
+
+	/* CLEAN UP */
+	if (result.elven)
+	{
+		kill_elf_mapped(&(result.elven));
+	}
+
+	return;
+}
+
+
+// Purpose:	Worker thread body
+// Input:	workerArg - This worker's Elf_Batch_Worker struct
+// Output:	NULL
+// Note:	Runs until the walk is done and every queue is empty
+static void* batch_worker(void* workerArg)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Batch_Worker* worker = (struct Elf_Batch_Worker*)workerArg;
+	struct Elf_Batch* batch = worker->batch;
+	char* currPath = NULL;		// Path being parsed
+	int allDone = FALSE;		// If TRUE, nothing is queued and nothing else will be
+
+	while (allDone == FALSE)
+	{
+		/* PARSE */
+		currPath = take_path(batch, worker->workerId);
+		if (currPath)
+		{
+			scan_one_file(batch, worker->workerId, currPath);
+			free(currPath);
+			continue;
+		}
+
+		/* WAIT FOR MORE */
+		// Announce the wait before checking so enqueue_path() can't miss it
+		__atomic_add_fetch(&(batch->numWaiting), 1, __ATOMIC_SEQ_CST);
+		pthread_mutex_lock(&(batch->lock));
+		while (__atomic_load_n(&(batch->pending), __ATOMIC_SEQ_CST) == 0 && batch->walkDone == FALSE)
+		{
+			pthread_cond_wait(&(batch->workCond), &(batch->lock));
+		}
+		if (__atomic_load_n(&(batch->pending), __ATOMIC_SEQ_CST) == 0 && batch->walkDone == TRUE)
+		{
+			allDone = TRUE;
+		}
+		pthread_mutex_unlock(&(batch->lock));
+		__atomic_sub_fetch(&(batch->numWaiting), 1, __ATOMIC_SEQ_CST);
+	}
+
+	return NULL;
+}
@@ -0,0 +1,76 @@
+#ifndef __ELF_BATCH_H__
+#define __ELF_BATCH_H__
+
+#include <stddef.h>		// size_t
+
+/*
+ *	USAGE:
+ *		Start - Fill in an Elf_Batch_Options struct (zeroized means defaults)
+ *		Step - scan_elf_batch() walks every path and calls the callback once per regular file
+ *	The calling thread walks directories and file lists while a pool of worker threads
+ *		parses files.  Each worker owns a queue: it takes its newest path first and steals
+ *		the oldest path from another worker's queue when its own runs dry.
+ *	The callback runs on the worker threads, so it must be thread-safe
+ */
+
+#define BATCH_QUEUE_DEPTH	((size_t)1024)	// Queued paths per worker before the walker waits
+#define BATCH_MAX_WORKERS	((int)256)		// Upper limit on Elf_Batch_Options.numWorkers
+
+struct Elf_Cache;
+struct Elf_Details;
+
+// One record per file
+struct Elf_Batch_Result
+{
+	const char* fileName;		// Path as walked (only valid during the callback)
+	int status;					// ERROR_* as specified in Elf_Details.h (ERROR_ORC_FILE for non-ELF files)
+	int errnum;					// errno if the file couldn't be opened or read, 0 otherwise
+	struct Elf_Details* elven;	// Parsed file if status is ERROR_SUCCESS (only valid during the callback)
+	int workerId;				// 0 through numWorkers - 1
+	int cached;					// If TRUE, the result came from Elf_Batch_Options.cache without opening the file
+};
+
+// Called once per file, on a worker thread
+typedef void (*Elf_Batch_Callback)(const struct Elf_Batch_Result* result, void* userData);
+
+struct Elf_Batch_Options
+{
+	int numWorkers;		// Number of worker threads (0 for one per online core)
+	int headerOnly;		// If TRUE, only read the ELF header of each file (see: read_elf_header())
+	int skipParse;		// If TRUE, only check the magic number and leave Elf_Batch_Result.elven NULL (not with cache)
+	const char* listName;	// Optional file with one path per line ("-" for stdin)
+	struct Elf_Cache* cache;	// Optional.  Unchanged files are answered from it and everything else is added to it.
+};
+
+struct Elf_Batch_Stats
+{
+	size_t numFiles;	// Number of results reported
+	size_t numElves;	// Number of results with status ERROR_SUCCESS
+	size_t numErrors;	// Number of files that couldn't be opened or read
+	size_t numCached;	// Number of results answered by Elf_Batch_Options.cache
+};
+
+
+// Purpose:	Parse every regular file found under a set of paths on a pool of worker threads
+// Input:
+//			paths - Array of files and directories to scan (directories are walked recursively)
+//			numPaths - Number of entries in paths
+//			options - Optional.  NULL for the defaults.
+//			callback - Called once per file with the result
+//			userData - Passed through to callback
+//			stats [out] - Optional.  Totals for the whole batch.
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			Symbolic links named in paths (or in the list file) are followed.  Symbolic links
+//				found while walking a directory are not.
+//			Files that aren't ELF files are still reported (status ERROR_ORC_FILE)
+//			With skipParse, the callback reads what it needs itself (e.g., read_elf_build_id())
+int scan_elf_batch(char** paths, int numPaths, const struct Elf_Batch_Options* options, \
+	               Elf_Batch_Callback callback, void* userData, struct Elf_Batch_Stats* stats);
+
+// Purpose:	Determine the default number of worker threads
+// Input:	None
+// Output:	Number of online cores, clamped to 1 through BATCH_MAX_WORKERS
+int get_default_num_workers(void);
+
+#endif // __ELF_BATCH_H__
@@ -0,0 +1,589 @@
+#include "Elf_Cache.h"
+#include "Elf_Details.h"
+#include "Elf_Output.h"
+#include "Elf_Record.h"
+#include <errno.h>
+#include <fcntl.h>		// open()
+#include <pthread.h>	// pthread_mutex_t
+#include <stdio.h>
+#include <stdlib.h>		// mkstemp()
+#include <string.h>
+#include <sys/mman.h>	// mmap()/munmap()
+#include <unistd.h>		// close()/unlink()
+
+#define CACHE_BYTE_ORDER	((uint32_t)0x01020304)	// Reads back scrambled in the other byte order
+#define CACHE_ENTRIES_MIN	((size_t)1024)			// Initial capacity of the new index
+#define CACHE_FLAG_USED		((uint32_t)0x1)			// Index entry holds a file
+#define CACHE_FLAG_HEADER	((uint32_t)0x2)			// Index entry's record is header only
+
+/* LOCAL STRUCTS */
+// Header at the start of a cache file
+struct Elf_Cache_Header
+{
+	char magic[4];			// CACHE_MAGIC
+	uint16_t version;		// CACHE_VERSION
+	uint16_t headerSize;	// CACHE_HEADER_SIZE
+	uint32_t byteOrder;		// CACHE_BYTE_ORDER
+	uint32_t entrySize;		// CACHE_ENTRY_SIZE
+	uint64_t numEntries;	// Files in the index
+	uint64_t numBuckets;	// Slots in the index (a power of two)
+	uint64_t indexOffset;	// Offset of the index
+	uint64_t dataSize;		// Bytes of records between the header and the index
+	uint64_t reserved[2];	// Zero
+};
+
+// One index slot
+struct Elf_Cache_Entry
+{
+	uint64_t dev;			// st_dev
+	uint64_t ino;			// st_ino
+	uint64_t size;			// st_size
+	int64_t mtimeSec;		// st_mtim.tv_sec
+	uint32_t mtimeNsec;		// st_mtim.tv_nsec
+	uint32_t flags;			// CACHE_FLAG_*
+	uint64_t recordOffset;	// Offset of the record from the start of the file
+};
+
+struct Elf_Cache
+{
+	// Old cache (read only)
+	const unsigned char* oldMap;	// Mapped cache file, NULL if there wasn't a usable one
+	size_t oldSize;					// Bytes in oldMap
+	const struct Elf_Cache_Entry* oldIndex;	// Index inside oldMap
+	uint64_t oldBuckets;			// Slots in oldIndex
+	// New cache (written under lock)
+	pthread_mutex_t lock;			// Protects everything below
+	char* fileName;					// Cache file
+	char* tmpName;					// New cache file until close_elf_cache() renames it
+	FILE* tmpFile;					// Stream of tmpName
+	struct Elf_Output output;		// Records are formatted into tmpFile through this
+	char* outputBuff;				// Buffer for output
+	struct Elf_Cache_Entry* entries;	// Every record written to tmpFile
+	size_t numEntries;				// Number of entries used
+	size_t capacity;				// Number of entries allocated
+	int failed;						// If TRUE, something went wrong and the old cache is kept
+	struct Elf_Cache_Stats stats;	// Counters
+};
+
+/* LOCAL FUNCTIONS */
+static void set_cache_key(struct Elf_Cache_Entry* entry, const struct stat* fileStat, int headerOnly);
+static int same_cache_key(const struct Elf_Cache_Entry* entry1, const struct Elf_Cache_Entry* entry2);
+static uint64_t hash_cache_key(const struct Elf_Cache_Entry* entry);
+static int map_old_cache(struct Elf_Cache* cache);
+static int append_cache_entry(struct Elf_Cache* cache, const struct Elf_Cache_Entry* key);
+static void release_elf_cache(struct Elf_Cache* cache);
+
+
+// Purpose:	Open a cache file
+// Input:	fileName - Cache file.  Need not exist yet.
+// Output:	A new cache, NULL on error (check errno)
+struct Elf_Cache* open_elf_cache(const char* fileName)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Cache* retVal = NULL;	// Cache to be allocated, initialized and returned
+	int tmpFd = -1;						// File descriptor of retVal->tmpName
+	size_t nameLen = 0;					// Length of fileName
+
+	/* INPUT VALIDATION */
+	if (!fileName || !(*fileName))
+	{
+		errno = EINVAL;
+		return retVal;
+	}
+
+	/* ALLOCATE */
+	nameLen = strlen(fileName);
+	retVal = (struct Elf_Cache*)gimme_mem(1, sizeof(struct Elf_Cache));
+	if (!retVal)
+	{
+		return retVal;
+	}
+	pthread_mutex_init(&(retVal->lock), NULL);
+	retVal->fileName = (char*)gimme_mem(nameLen + 1, sizeof(char));
+	// Same directory as fileName so rename() never crosses file systems
+	retVal->tmpName = (char*)gimme_mem(nameLen + sizeof(".XXXXXX"), sizeof(char));
+	retVal->outputBuff = (char*)gimme_mem(OUTPUT_BUFF_SIZE, sizeof(char));
+	if (!retVal->fileName || !retVal->tmpName || !retVal->outputBuff)
+	{
+		release_elf_cache(retVal);
+		return NULL;
+	}
+	memcpy(retVal->fileName, fileName, nameLen);
+	memcpy(retVal->tmpName, fileName, nameLen);
+	memcpy(retVal->tmpName + nameLen, ".XXXXXX", sizeof(".XXXXXX"));
+
+	/* OLD CACHE */
+	map_old_cache(retVal);
+
+	/* NEW CACHE */
+	tmpFd = mkstemp(retVal->tmpName);
+	if (tmpFd >= 0)
+	{
+		retVal->tmpFile = fdopen(tmpFd, "wb");
+		if (!retVal->tmpFile)
+		{
+			close(tmpFd);
+		}
+	}
+	if (!retVal->tmpFile)
+	{
+		fprintf(stderr, "Unable to create %s: %s\n", retVal->tmpName, strerror(errno));
+		unlink(retVal->tmpName);
+		release_elf_cache(retVal);
+		return NULL;
+	}
+	init_elf_output(&(retVal->output), retVal->tmpFile, retVal->outputBuff, OUTPUT_BUFF_SIZE);
+	// Room for the header, which is written last
+	output_repeat(&(retVal->output), '\0', CACHE_HEADER_SIZE);
+
+	return retVal;
+}
+
+
+// Purpose:	Look up a file
+// Input:
+//			cache - Cache from open_elf_cache()
+//			fileStat - stat() of the file
+//			headerOnly - If TRUE, a header-only record will do
+//			record [out] - The cached record.  Only valid until close_elf_cache().
+// Output:
+//			ERROR_SUCCESS on a hit
+//			CACHE_MISS if the file wasn't cached (or changed since)
+//			ERROR_* as specified in Elf_Details.h on error
+// Note:	The old index is only read so lookups don't take the lock until there's a hit
+int lookup_elf_cache(struct Elf_Cache* cache, const struct stat* fileStat, int headerOnly, struct Elf_Record* record)
+{
+	/* LOCAL VARIABLES */
+	int retVal = CACHE_MISS;
+	struct Elf_Cache_Entry key;					// What's being looked up
+	const struct Elf_Cache_Entry* slot = NULL;	// Slot being probed
+	struct Elf_Record_Reader reader;			// Reads the record out of the old cache
+	uint64_t bucket = 0;						// Index of slot
+	uint64_t numProbes = 0;						// Slots probed
+
+	/* INPUT VALIDATION */
+	if (!cache || !fileStat || !record)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	/* PROBE */
+	set_cache_key(&key, fileStat, headerOnly);
+	if (cache->oldIndex)
+	{
+		bucket = hash_cache_key(&key) & (cache->oldBuckets - 1);
+		for (numProbes = 0; numProbes < cache->oldBuckets; numProbes++)
+		{
+			slot = cache->oldIndex + ((bucket + numProbes) & (cache->oldBuckets - 1));
+			if (!(slot->flags & CACHE_FLAG_USED))
+			{
+				break;
+			}
+			else if (same_cache_key(slot, &key) == TRUE)
+			{
+				// Corrupt records are misses.  The file gets parsed and cached again.
+				if (slot->recordOffset >= CACHE_HEADER_SIZE && slot->recordOffset < cache->oldSize \
+					&& init_record_reader(&reader, cache->oldMap + slot->recordOffset, \
+						cache->oldSize - slot->recordOffset) == ERROR_SUCCESS \
+					&& next_elf_record(&reader, record) == ERROR_SUCCESS)
+				{
+					retVal = ERROR_SUCCESS;
+				}
+				break;
+			}
+		}
+	}
+
+	/* CARRY IT FORWARD */
+	pthread_mutex_lock(&(cache->lock));
+	if (retVal == ERROR_SUCCESS)
+	{
+		cache->stats.numHits++;
+		if (append_cache_entry(cache, &key) == ERROR_SUCCESS)
+		{
+			output_mem(&(cache->output), (const char*)record->raw, record->recordSize);
+		}
+	}
+	else
+	{
+		cache->stats.numMisses++;
+	}
+	pthread_mutex_unlock(&(cache->lock));
+
+	return retVal;
+}
+
+
+// Purpose:	Add a parsed file to the cache
+// Input:
+//			cache - Cache from open_elf_cache()
+//			fileStat - stat() of the file, taken before it was read
+//			headerOnly - If TRUE, elven_file only holds the ELF header
+//			elven_file - The parsed file.  NULL if it isn't an ELF file.
+//			fileName - Path of the file
+// Output:	ERROR_* as specified in Elf_Details.h
+int add_elf_to_cache(struct Elf_Cache* cache, const struct stat* fileStat, int headerOnly, \
+	                 struct Elf_Details* elven_file, const char* fileName)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Cache_Entry key;		// Where the record goes in the index
+
+	/* INPUT VALIDATION */
+	if (!cache || !fileStat)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	/* ADD IT */
+	set_cache_key(&key, fileStat, headerOnly);
+	pthread_mutex_lock(&(cache->lock));
+	retVal = append_cache_entry(cache, &key);
+	if (retVal == ERROR_SUCCESS)
+	{
+		if (elven_file)
+		{
+			retVal = format_elf_record(&(cache->output), elven_file);
+		}
+		else
+		{
+			retVal = format_record_unparsed(&(cache->output), fileName, 0);
+		}
+		// Nothing was written so forget the entry
+		if (retVal != ERROR_SUCCESS)
+		{
+			cache->numEntries--;
+		}
+		else
+		{
+			cache->stats.numAdded++;
+		}
+	}
+	pthread_mutex_unlock(&(cache->lock));
+
+	return retVal;
+}
+
+
+// Purpose:	Read the hit, miss, and add counters
+// Input:
+//			cache - Cache from open_elf_cache()
+//			stats [out] - Counters so far
+// Output:	ERROR_* as specified in Elf_Details.h
+int get_elf_cache_stats(struct Elf_Cache* cache, struct Elf_Cache_Stats* stats)
+{
+	if (!cache || !stats)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	pthread_mutex_lock(&(cache->lock));
+	*stats = cache->stats;
+	pthread_mutex_unlock(&(cache->lock));
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Write the new cache and release everything
+// Input:	cache - Pointer to a cache pointer from open_elf_cache()
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Modifies the cache pointer by making it NULL
+int close_elf_cache(struct Elf_Cache** cache)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Cache* oldCache = NULL;		// *cache
+	struct Elf_Cache_Header header;			// Written last
+	struct Elf_Cache_Entry* index = NULL;	// Hash index
+	uint64_t numBuckets = 1;				// Slots in index
+	uint64_t bucket = 0;					// Slot being probed
+	size_t i = 0;							// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!cache || !(*cache))
+	{
+		return ERROR_NULL_PTR;
+	}
+	oldCache = *cache;
+	*cache = NULL;
+
+	/* BUILD THE INDEX */
+	// At most half full so probes stay short
+	while (numBuckets < 2 * oldCache->numEntries || numBuckets < 2)
+	{
+		numBuckets <<= 1;
+	}
+	index = (struct Elf_Cache_Entry*)gimme_mem(numBuckets, sizeof(struct Elf_Cache_Entry));
+	if (!index)
+	{
+		oldCache->failed = TRUE;
+	}
+	for (i = 0; index && i < oldCache->numEntries; i++)
+	{
+		bucket = hash_cache_key(oldCache->entries + i) & (numBuckets - 1);
+		while (index[bucket].flags & CACHE_FLAG_USED)
+		{
+			// The same file reached twice (e.g., hard links).  The first record wins.
+			if (same_cache_key(index + bucket, oldCache->entries + i) == TRUE)
+			{
+				break;
+			}
+			bucket = (bucket + 1) & (numBuckets - 1);
+		}
+		if (!(index[bucket].flags & CACHE_FLAG_USED))
+		{
+			index[bucket] = oldCache->entries[i];
+		}
+	}
+
+	/* WRITE IT */
+	if (oldCache->failed != TRUE)
+	{
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+		header.version = CACHE_VERSION;
+		header.headerSize = CACHE_HEADER_SIZE;
+		header.byteOrder = CACHE_BYTE_ORDER;
+		header.entrySize = CACHE_ENTRY_SIZE;
+		header.numEntries = oldCache->numEntries;
+		header.numBuckets = numBuckets;
+		header.indexOffset = oldCache->output.numWritten + oldCache->output.used;
+		header.dataSize = header.indexOffset - CACHE_HEADER_SIZE;
+		output_mem(&(oldCache->output), (const char*)index, numBuckets * sizeof(struct Elf_Cache_Entry));
+		flush_elf_output(&(oldCache->output));
+		if (oldCache->output.errnum || fseek(oldCache->tmpFile, 0, SEEK_SET) \
+			|| fwrite(&header, sizeof(header), 1, oldCache->tmpFile) != 1 || fflush(oldCache->tmpFile))
+		{
+			fprintf(stderr, "Unable to write %s: %s\n", oldCache->tmpName, \
+				strerror(oldCache->output.errnum ? oldCache->output.errnum : errno));
+			oldCache->failed = TRUE;
+		}
+	}
+	if (index)
+	{
+		take_mem_back((void**)&index, numBuckets, sizeof(struct Elf_Cache_Entry));
+	}
+
+	/* REPLACE THE OLD CACHE */
+	if (fclose(oldCache->tmpFile))
+	{
+		oldCache->failed = TRUE;
+	}
+	oldCache->tmpFile = NULL;
+	if (oldCache->failed == TRUE || rename(oldCache->tmpName, oldCache->fileName))
+	{
+		if (oldCache->failed != TRUE)
+		{
+			fprintf(stderr, "Unable to replace %s: %s\n", oldCache->fileName, strerror(errno));
+		}
+		unlink(oldCache->tmpName);
+		errno = 0;	// Reported, so don't let it leak into later PERROR()s
+		retVal = ERROR_BAD_ARG;
+	}
+
+	/* CLEAN UP */
+	release_elf_cache(oldCache);
+
+	return retVal;
+}
+
+
+// Purpose:	Build the index key for a file
+// Input:
+//			entry [out] - Key to build (recordOffset is left 0)
+//			fileStat - stat() of the file
+//			headerOnly - If TRUE, the record is header only
+// Output:	None
+static void set_cache_key(struct Elf_Cache_Entry* entry, const struct stat* fileStat, int headerOnly)
+{
+	memset(entry, 0, sizeof(struct Elf_Cache_Entry));
+	entry->dev = (uint64_t)fileStat->st_dev;
+	entry->ino = (uint64_t)fileStat->st_ino;
+	entry->size = (uint64_t)fileStat->st_size;
+	entry->mtimeSec = (int64_t)fileStat->st_mtim.tv_sec;
+	entry->mtimeNsec = (uint32_t)fileStat->st_mtim.tv_nsec;
+	entry->flags = CACHE_FLAG_USED | (headerOnly == TRUE ? CACHE_FLAG_HEADER : 0);
+
+	return;
+}
+
+
+// Purpose:	Compare two index keys
+// Output:	TRUE if they're the same file, in the same state, read the same way
+static int same_cache_key(const struct Elf_Cache_Entry* entry1, const struct Elf_Cache_Entry* entry2)
+{
+	return (entry1->dev == entry2->dev && entry1->ino == entry2->ino && entry1->size == entry2->size \
+		&& entry1->mtimeSec == entry2->mtimeSec && entry1->mtimeNsec == entry2->mtimeNsec \
+		&& entry1->flags == entry2->flags) ? TRUE : FALSE;
+}
+
+
+// Purpose:	Hash an index key
+// Note:	Each field is folded in then mixed (splitmix64 finalizer) so neighboring inodes spread out
+static uint64_t hash_cache_key(const struct Elf_Cache_Entry* entry)
+{
+	uint64_t retVal = entry->dev;
+	uint64_t fields[5] = { entry->ino, entry->size, (uint64_t)entry->mtimeSec, entry->mtimeNsec, entry->flags };
+	int i = 0;
+
+	for (i = 0; i < 5; i++)
+	{
+		retVal = (retVal ^ fields[i]) + 0x9E3779B97F4A7C15ULL;
+		retVal = (retVal ^ (retVal >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		retVal = (retVal ^ (retVal >> 27)) * 0x94D049BB133111EBULL;
+		retVal ^= retVal >> 31;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Map the existing cache file and check its header
+// Input:	cache - Cache being opened
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Anything unusable leaves the old cache empty
+static int map_old_cache(struct Elf_Cache* cache)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	int cacheFd = -1;					// File descriptor of cache->fileName
+	struct stat cacheStat;				// Size of cache->fileName
+	void* cacheGuts = NULL;				// Mapped cache file
+	struct Elf_Cache_Header header;		// Copy of the header
+
+	/* MAP IT */
+	cacheFd = open(cache->fileName, O_RDONLY);
+	if (cacheFd < 0)
+	{
+		// No cache yet
+		errno = 0;	// Expected, so don't let it leak into later PERROR()s
+		return ERROR_SUCCESS;
+	}
+	if (fstat(cacheFd, &cacheStat) || !S_ISREG(cacheStat.st_mode) || cacheStat.st_size < (off_t)CACHE_HEADER_SIZE)
+	{
+		retVal = ERROR_ORC_FILE;
+	}
+	else
+	{
+		cacheGuts = mmap(NULL, (size_t)cacheStat.st_size, PROT_READ, MAP_PRIVATE, cacheFd, 0);
+		retVal = cacheGuts == MAP_FAILED ? ERROR_BAD_ARG : ERROR_SUCCESS;
+	}
+	close(cacheFd);
+
+	/* CHECK THE HEADER */
+	if (retVal == ERROR_SUCCESS)
+	{
+		memcpy(&header, cacheGuts, sizeof(header));
+		if (memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) || header.version != CACHE_VERSION \
+			|| header.headerSize != CACHE_HEADER_SIZE || header.byteOrder != CACHE_BYTE_ORDER \
+			|| header.entrySize != CACHE_ENTRY_SIZE)
+		{
+			retVal = ERROR_ORC_FILE;
+		}
+		// A power of two number of buckets that ends exactly at the end of the file
+		else if (!header.numBuckets || (header.numBuckets & (header.numBuckets - 1)) \
+			|| header.indexOffset != CACHE_HEADER_SIZE + header.dataSize \
+			|| header.indexOffset % sizeof(uint64_t) \
+			|| header.numBuckets > ((uint64_t)cacheStat.st_size - header.indexOffset) / CACHE_ENTRY_SIZE \
+			|| header.indexOffset + header.numBuckets * CACHE_ENTRY_SIZE != (uint64_t)cacheStat.st_size)
+		{
+			retVal = ERROR_BAD_OFFSET;
+		}
+		if (retVal != ERROR_SUCCESS)
+		{
+			munmap(cacheGuts, (size_t)cacheStat.st_size);
+		}
+	}
+
+	/* KEEP IT */
+	if (retVal == ERROR_SUCCESS)
+	{
+		cache->oldMap = (const unsigned char*)cacheGuts;
+		cache->oldSize = (size_t)cacheStat.st_size;
+		cache->oldIndex = (const struct Elf_Cache_Entry*)(cache->oldMap + header.indexOffset);
+		cache->oldBuckets = header.numBuckets;
+	}
+	else
+	{
+		fprintf(stderr, "Ignoring unusable cache %s\n", cache->fileName);
+		errno = 0;	// Reported, so don't let it leak into later PERROR()s
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Add a key to the new index, pointing at the next record written
+// Input:
+//			cache - Cache being written (lock held)
+//			key - Key of the record about to be written
+// Output:	ERROR_* as specified in Elf_Details.h
+static int append_cache_entry(struct Elf_Cache* cache, const struct Elf_Cache_Entry* key)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Cache_Entry* newEntries = NULL;	// Grown entries
+	size_t newCapacity = 0;						// Number of entries in newEntries
+
+	/* GROW */
+	if (cache->numEntries == cache->capacity)
+	{
+		newCapacity = cache->capacity ? cache->capacity * 2 : CACHE_ENTRIES_MIN;
+		newEntries = (struct Elf_Cache_Entry*)gimme_mem(newCapacity, sizeof(struct Elf_Cache_Entry));
+		if (!newEntries)
+		{
+			cache->failed = TRUE;
+			return ERROR_NULL_PTR;
+		}
+		if (cache->entries)
+		{
+			memcpy(newEntries, cache->entries, cache->numEntries * sizeof(struct Elf_Cache_Entry));
+			take_mem_back((void**)&(cache->entries), cache->capacity, sizeof(struct Elf_Cache_Entry));
+		}
+		cache->entries = newEntries;
+		cache->capacity = newCapacity;
+	}
+
+	/* APPEND */
+	cache->entries[cache->numEntries] = *key;
+	cache->entries[cache->numEntries].recordOffset = cache->output.numWritten + cache->output.used;
+	cache->numEntries++;
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Free everything a cache owns
+// Input:	cache - Cache to free
+// Output:	None
+static void release_elf_cache(struct Elf_Cache* cache)
+{
+	if (cache->oldMap)
+	{
+		munmap((void*)cache->oldMap, cache->oldSize);
+	}
+	if (cache->tmpFile)
+	{
+		fclose(cache->tmpFile);
+	}
+	if (cache->entries)
+	{
+		take_mem_back((void**)&(cache->entries), cache->capacity, sizeof(struct Elf_Cache_Entry));
+	}
+	if (cache->outputBuff)
+	{
+		take_mem_back((void**)&(cache->outputBuff), OUTPUT_BUFF_SIZE, sizeof(char));
+	}
+	if (cache->tmpName)
+	{
+		take_mem_back((void**)&(cache->tmpName), strlen(cache->tmpName) + 1, sizeof(char));
+	}
+	if (cache->fileName)
+	{
+		take_mem_back((void**)&(cache->fileName), strlen(cache->fileName) + 1, sizeof(char));
+	}
+	pthread_mutex_destroy(&(cache->lock));
+	take_mem_back((void**)&cache, 1, sizeof(struct Elf_Cache));
+
+	return;
+}
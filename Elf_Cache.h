@@ -0,0 +1,94 @@
+#ifndef __ELF_CACHE_H__
+#define __ELF_CACHE_H__
+
+#include <stddef.h>		// size_t
+#include <stdint.h>		// Fixed-width integers
+#include <sys/stat.h>	// struct stat
+
+/*
+ *	USAGE:
+ *		Start - open_elf_cache() maps the cache file (a missing file is an empty cache)
+ *		Step - lookup_elf_cache() with a file's stat() results.  On a miss, parse the file and
+ *			add_elf_to_cache().
+ *		Stop - close_elf_cache() writes the new cache and renames it over the old one
+ *	Files are identified by (device, inode, size, mtime) so an unchanged file is answered
+ *		without opening it.  Results are stored as Elf_Record records (see: Elf_Record.h).
+ *	LAYOUT:
+ *		Header (CACHE_HEADER_SIZE bytes), the records, then an open addressing hash index of
+ *			CACHE_ENTRY_SIZE byte entries.  Lookups hash straight to a bucket in the mapped index
+ *			so they never read more than a few entries.
+ *		Integers are in the writer's byte order.  Device and inode numbers only mean something
+ *			on the machine that wrote them anyway.
+ *	Every call is thread-safe.  Lookups only read the old mapping.  Each run writes a new
+ *		cache holding exactly the files it looked up or added, so entries for deleted files
+ *		age out on their own.
+ */
+
+#define CACHE_MAGIC			"ELFC"			// First four bytes of a cache file
+#define CACHE_VERSION		((uint16_t)1)	// Version written by close_elf_cache()
+#define CACHE_HEADER_SIZE	((size_t)64)	// Bytes in the header
+#define CACHE_ENTRY_SIZE	((size_t)48)	// Bytes in each index entry
+#define CACHE_MISS			((int)1)		// lookup_elf_cache() found nothing usable
+
+struct Elf_Cache;
+struct Elf_Details;
+struct Elf_Record;
+
+struct Elf_Cache_Stats
+{
+	size_t numHits;		// Lookups answered by the old cache
+	size_t numMisses;	// Lookups that weren't
+	size_t numAdded;	// Records added by add_elf_to_cache()
+};
+
+
+// Purpose:	Open a cache file
+// Input:	fileName - Cache file.  Need not exist yet.
+// Output:	A new cache, NULL on error (check errno)
+// Note:
+//			A cache that can't be used (e.g., corrupt, another version) is reported to stderr
+//				and treated as empty.  It's replaced by close_elf_cache().
+//			The new cache is written to a temporary file next to fileName as records arrive
+struct Elf_Cache* open_elf_cache(const char* fileName);
+
+// Purpose:	Look up a file
+// Input:
+//			cache - Cache from open_elf_cache()
+//			fileStat - stat() of the file
+//			headerOnly - If TRUE, a header-only record will do
+//			record [out] - The cached record.  Only valid until close_elf_cache().
+// Output:
+//			ERROR_SUCCESS on a hit
+//			CACHE_MISS if the file wasn't cached (or changed since)
+//			ERROR_* as specified in Elf_Details.h on error
+// Note:	A hit is carried forward into the new cache
+int lookup_elf_cache(struct Elf_Cache* cache, const struct stat* fileStat, int headerOnly, struct Elf_Record* record);
+
+// Purpose:	Add a parsed file to the cache
+// Input:
+//			cache - Cache from open_elf_cache()
+//			fileStat - stat() of the file, taken before it was read
+//			headerOnly - If TRUE, elven_file only holds the ELF header
+//			elven_file - The parsed file.  NULL if it isn't an ELF file.
+//			fileName - Path of the file
+// Output:	ERROR_* as specified in Elf_Details.h
+int add_elf_to_cache(struct Elf_Cache* cache, const struct stat* fileStat, int headerOnly, \
+	                 struct Elf_Details* elven_file, const char* fileName);
+
+// Purpose:	Read the hit, miss, and add counters
+// Input:
+//			cache - Cache from open_elf_cache()
+//			stats [out] - Counters so far
+// Output:	ERROR_* as specified in Elf_Details.h
+int get_elf_cache_stats(struct Elf_Cache* cache, struct Elf_Cache_Stats* stats);
+
+// Purpose:	Write the new cache and release everything
+// Input:	cache - Pointer to a cache pointer from open_elf_cache()
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			The new cache replaces the old one with a rename() so readers never see half of it
+//			If anything went wrong the old cache is left alone
+//			Modifies the cache pointer by making it NULL
+int close_elf_cache(struct Elf_Cache** cache);
+
+#endif // __ELF_CACHE_H__
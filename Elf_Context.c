@@ -0,0 +1,119 @@
+#include "Elf_Context.h"
+#include "Elf_Details.h"
+#include <stdarg.h>		// va_list
+#include <stdio.h>
+#include <string.h>
+
+
+// Purpose:	Initialize an Elf_Context to the defaults
+// Input:	context - Caller-owned context (e.g., on the stack)
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Defaults are no arena, whole files, and no printing
+int init_elf_context(struct Elf_Context* context)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (!context)
+	{
+		retVal = ERROR_NULL_PTR;
+	}
+	else
+	{
+		memset(context, 0, sizeof(struct Elf_Context));
+		context->arena = NULL;
+		context->headerOnly = FALSE;
+		context->verbose = FALSE;
+		context->status = ERROR_SUCCESS;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Forget the results of the last call
+// Input:	context - Context to clear
+// Output:	None
+// Note:	The options (arena, headerOnly, verbose) are left alone
+void clear_elf_context(struct Elf_Context* context)
+{
+	if (context)
+	{
+		context->status = ERROR_SUCCESS;
+		context->errnum = 0;
+		context->errBuff[0] = '\0';
+	}
+
+	return;
+}
+
+
+// Purpose:	Report a parsing diagnostic
+// Input:
+//			context - Optional.  Where the diagnostic goes.
+//			format - printf() style format string (no trailing newline)
+//			... - Format arguments
+// Output:	None
+// Note:
+//			Without a context the diagnostic is printed to stderr
+//			With one, only the first diagnostic of a call is kept in context->errBuff
+void report_elf_error(struct Elf_Context* context, const char* format, ...)
+{
+	/* LOCAL VARIABLES */
+	va_list formatArgs;		// Variable arguments for format
+
+	/* INPUT VALIDATION */
+	if (!format)
+	{
+		return;
+	}
+
+	/* KEEP IT */
+	// The first diagnostic is usually the cause.  The rest are fallout.
+	if (context && context->errBuff[0] == '\0')
+	{
+		va_start(formatArgs, format);
+		vsnprintf(context->errBuff, ELF_CTX_ERR_SIZE, format, formatArgs);
+		va_end(formatArgs);
+	}
+
+	/* PRINT IT */
+	if (!context || context->verbose == TRUE)
+	{
+		va_start(formatArgs, format);
+		vfprintf(stderr, format, formatArgs);
+		va_end(formatArgs);
+		fputc('\n', stderr);
+	}
+
+	return;
+}
+
+
+// Purpose:	Record a failed system call
+// Input:
+//			context - Optional.  Where the failure goes.
+//			errnum - errno from the failed call
+//			fileName - File the call was made on
+// Output:	None
+// Note:	Does nothing without a context
+void record_elf_errno(struct Elf_Context* context, int errnum, const char* fileName)
+{
+	/* LOCAL VARIABLES */
+	char errDesc[ELF_CTX_ERR_SIZE] = { 0 };	// Description of errnum
+
+	if (context && errnum)
+	{
+		if (!context->errnum)
+		{
+			context->errnum = errnum;
+		}
+		// strerror() shares one buffer between threads (see: Elf_Batch.c)
+		if (strerror_r(errnum, errDesc, sizeof(errDesc)))
+		{
+			snprintf(errDesc, sizeof(errDesc), "Unknown error %d", errnum);
+		}
+		report_elf_error(context, "%s: %s", fileName ? fileName : "(null)", errDesc);
+	}
+
+	return;
+}
@@ -0,0 +1,66 @@
+#ifndef __ELF_CONTEXT_H__
+#define __ELF_CONTEXT_H__
+
+#include <stddef.h>		// size_t
+
+/*
+ *	USAGE:
+ *		Start - init_elf_context() once per thread (or per request)
+ *		Step - read_elf_ctx() or parse_elf_buffer_ctx() as often as needed
+ *		Check - The return value, then context->errnum and context->errBuff for the details
+ *	Nothing in an Elf_Context is shared, so any number of threads can parse at once as long as
+ *		each one uses its own context.  The only process-wide settings (see: set_zeroize_policy()
+ *		and set_swap_isa()) are meant to be chosen once, before the threads start.
+ */
+
+#define ELF_CTX_ERR_SIZE	((size_t)256)	// Bytes in Elf_Context.errBuff (including the nul)
+
+struct Elf_Arena;
+
+struct Elf_Context
+{
+	struct Elf_Arena* arena;	// Optional.  Caller-owned arena every struct is allocated from.
+								//	NULL gives each struct its own arena.
+	int headerOnly;				// If TRUE, only read the ELF header of each file (see: read_elf_header())
+	int verbose;				// If TRUE, diagnostics are also printed to stderr
+	int status;					// ERROR_* from the last call
+	int errnum;					// errno from the last call, 0 if none
+	char errBuff[ELF_CTX_ERR_SIZE];	// First diagnostic from the last call, "" if none
+};
+
+
+// Purpose:	Initialize an Elf_Context to the defaults
+// Input:	context - Caller-owned context (e.g., on the stack)
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Defaults are no arena, whole files, and no printing
+int init_elf_context(struct Elf_Context* context);
+
+// Purpose:	Forget the results of the last call
+// Input:	context - Context to clear
+// Output:	None
+// Note:	The options (arena, headerOnly, verbose) are left alone
+void clear_elf_context(struct Elf_Context* context);
+
+// Purpose:	Report a parsing diagnostic
+// Input:
+//			context - Optional.  Where the diagnostic goes.
+//			format - printf() style format string (no trailing newline)
+//			... - Format arguments
+// Output:	None
+// Note:
+//			Without a context the diagnostic is printed to stderr, which is what the
+//				context-free functions (e.g., read_elf()) have always done
+//			With one, only the first diagnostic of a call is kept in context->errBuff.  It is
+//				only printed if context->verbose is TRUE.
+void report_elf_error(struct Elf_Context* context, const char* format, ...);
+
+// Purpose:	Record a failed system call
+// Input:
+//			context - Optional.  Where the failure goes.
+//			errnum - errno from the failed call
+//			fileName - File the call was made on
+// Output:	None
+// Note:	Does nothing without a context
+void record_elf_errno(struct Elf_Context* context, int errnum, const char* fileName);
+
+#endif // __ELF_CONTEXT_H__
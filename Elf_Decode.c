@@ -0,0 +1,137 @@
+#include "Elf_Decode.h"
+#include "Elf_Details.h"
+#include "Elf_Swap.h"
+#include <string.h>		// memcpy()
+
+
+/* FIXED-WIDTH LOADS */
+// memcpy() into a fixed-width integer compiles down to one (unaligned) load
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define FROM_LE(bits, value) __builtin_bswap##bits(value)
+#define FROM_BE(bits, value) (value)
+#else
+#define FROM_LE(bits, value) (value)
+#define FROM_BE(bits, value) __builtin_bswap##bits(value)
+#endif // __BYTE_ORDER__
+
+// Defines load_<bytes>_le() and load_<bytes>_be()
+#define DEFINE_LOADS(numBytes, bits) \
+static inline uint##bits##_t load_##numBytes##_le(const unsigned char* buff) \
+{ \
+	uint##bits##_t value; \
+	memcpy(&value, buff, sizeof(value)); \
+	return FROM_LE(bits, value); \
+} \
+static inline uint##bits##_t load_##numBytes##_be(const unsigned char* buff) \
+{ \
+	uint##bits##_t value; \
+	memcpy(&value, buff, sizeof(value)); \
+	return FROM_BE(bits, value); \
+}
+
+// Single bytes have no byte order
+static inline uint8_t load_1_le(const unsigned char* buff) { return buff[0]; }
+static inline uint8_t load_1_be(const unsigned char* buff) { return buff[0]; }
+
+DEFINE_LOADS(2, 16)
+DEFINE_LOADS(4, 32)
+DEFINE_LOADS(8, 64)
+
+// Addresses and offsets are as wide as the ELF Class
+static uint64_t load_addr_32le(const unsigned char* buff) { return load_4_le(buff); }
+static uint64_t load_addr_32be(const unsigned char* buff) { return load_4_be(buff); }
+static uint64_t load_addr_64le(const unsigned char* buff) { return load_8_le(buff); }
+static uint64_t load_addr_64be(const unsigned char* buff) { return load_8_be(buff); }
+
+
+/* BULK LOADS */
+// The host's byte order only needs a copy.  The other byte order goes through swap_*_array().
+#define DEFINE_COPY_ARRAY(bits) \
+static void copy_##bits##_array(uint##bits##_t* dst, const void* src, size_t count) \
+{ \
+	if (dst && src && (const void*)dst != src) \
+	{ \
+		memcpy(dst, src, count * sizeof(*dst)); \
+	} \
+}
+
+DEFINE_COPY_ARRAY(16)
+DEFINE_COPY_ARRAY(32)
+DEFINE_COPY_ARRAY(64)
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define BULK_LOAD_le(bits) swap_##bits##_array
+#define BULK_LOAD_be(bits) copy_##bits##_array
+#else
+#define BULK_LOAD_le(bits) copy_##bits##_array
+#define BULK_LOAD_be(bits) swap_##bits##_array
+#endif // __BYTE_ORDER__
+
+
+/* GENERATED DECODERS */
+// One X() per class and byte order.  See: ELF_*_FIELDS in Elf_Decode.h.
+#define DECODE_FIELD_32LE(member, off32, size32, off64, size64) record->member = load_##size32##_le(buff + off32);
+#define DECODE_FIELD_32BE(member, off32, size32, off64, size64) record->member = load_##size32##_be(buff + off32);
+#define DECODE_FIELD_64LE(member, off32, size32, off64, size64) record->member = load_##size64##_le(buff + off64);
+#define DECODE_FIELD_64BE(member, off32, size32, off64, size64) record->member = load_##size64##_be(buff + off64);
+
+#define DEFINE_DECODER(funcName, recordType, FIELDS, DECODE_FIELD) \
+static void funcName(recordType* record, const unsigned char* buff) \
+{ \
+	FIELDS(DECODE_FIELD) \
+}
+
+#define DEFINE_DECODERS(suffix, DECODE_FIELD) \
+	DEFINE_DECODER(decode_elf_header_##suffix, struct Elf_Hdr_Record, ELF_HDR_FIELDS, DECODE_FIELD) \
+	DEFINE_DECODER(decode_prgrm_header_##suffix, struct Elf_Prgrm_Header, ELF_PRGRM_HEADER_FIELDS, DECODE_FIELD) \
+	DEFINE_DECODER(decode_sectn_header_##suffix, struct Elf_Sectn_Header, ELF_SECTN_HEADER_FIELDS, DECODE_FIELD) \
+	DEFINE_DECODER(decode_symbol_##suffix, struct Elf_Symbol, ELF_SYMBOL_FIELDS, DECODE_FIELD)
+
+DEFINE_DECODERS(32le, DECODE_FIELD_32LE)
+DEFINE_DECODERS(32be, DECODE_FIELD_32BE)
+DEFINE_DECODERS(64le, DECODE_FIELD_64LE)
+DEFINE_DECODERS(64be, DECODE_FIELD_64BE)
+
+#define DECODER_SET(elfClass, bigEndian, endian, suffix) \
+	{ elfClass, bigEndian, load_2_##endian, load_4_##endian, load_8_##endian, load_addr_##suffix, \
+	  BULK_LOAD_##endian(16), BULK_LOAD_##endian(32), BULK_LOAD_##endian(64), \
+	  decode_elf_header_##suffix, decode_prgrm_header_##suffix, decode_sectn_header_##suffix, \
+	  decode_symbol_##suffix }
+
+static const struct Elf_Decoders elfDecoders32LE = DECODER_SET(ELF_H_CLASS_32, FALSE, le, 32le);
+static const struct Elf_Decoders elfDecoders32BE = DECODER_SET(ELF_H_CLASS_32, TRUE, be, 32be);
+static const struct Elf_Decoders elfDecoders64LE = DECODER_SET(ELF_H_CLASS_64, FALSE, le, 64le);
+static const struct Elf_Decoders elfDecoders64BE = DECODER_SET(ELF_H_CLASS_64, TRUE, be, 64be);
+
+
+// Purpose:	Choose the decoders for an ELF file
+// Input:
+//			elfClass - ELF Class byte (OFFSET: 0x04)
+//			elfData - ELF Data (endianness) byte (OFFSET: 0x05)
+// Output:	Pointer to a static set of decoders, NULL if either byte is invalid
+// Note:
+//			Do not free() the return value
+//			Decoders never bounds check.  Bounds check the whole header/entry once before decoding it.
+const struct Elf_Decoders* get_elf_decoders(int elfClass, int elfData)
+{
+	const struct Elf_Decoders* retVal = NULL;
+
+	if (elfClass == ELF_H_CLASS_32 && elfData == ELF_H_DATA_LITTLE)
+	{
+		retVal = &elfDecoders32LE;
+	}
+	else if (elfClass == ELF_H_CLASS_32 && elfData == ELF_H_DATA_BIG)
+	{
+		retVal = &elfDecoders32BE;
+	}
+	else if (elfClass == ELF_H_CLASS_64 && elfData == ELF_H_DATA_LITTLE)
+	{
+		retVal = &elfDecoders64LE;
+	}
+	else if (elfClass == ELF_H_CLASS_64 && elfData == ELF_H_DATA_BIG)
+	{
+		retVal = &elfDecoders64BE;
+	}
+
+	return retVal;
+}
@@ -0,0 +1,116 @@
+#ifndef __ELF_DECODE_H__
+#define __ELF_DECODE_H__
+
+#include <stddef.h>		// size_t
+#include <stdint.h>		// Fixed-width integers
+
+/*
+ *	USAGE:
+ *		Start - get_elf_decoders() once per file, using the ELF Class and Data bytes
+ *		Step - Call the decoders for every header, table entry, or value
+ *		Arrays of same-width values (hash tables, dynamic entries) decode in bulk (see: Elf_Swap.h)
+ *	Every decoder is generated from the field descriptions below (see: Elf_Decode.c) so
+ *		none of them branch on the ELF Class or the byte order
+ */
+
+struct Elf_Prgrm_Header;
+struct Elf_Sectn_Header;
+struct Elf_Symbol;
+
+// The ELF Header fields that follow e_ident, normalized to host endianness
+struct Elf_Hdr_Record
+{
+	uint8_t abiversion;	// Version of the ABI
+	uint16_t type;		// Object file type
+	uint16_t machine;	// Target ISA
+	uint32_t version;	// Object file version
+	uint64_t entry;		// Entry point
+	uint64_t phoff;		// Program Header Table offset
+	uint64_t shoff;		// Section Header Table offset
+	uint32_t flags;		// Processor-specific flags
+	uint16_t ehsize;	// ELF Header size
+	uint16_t phentsize;	// Program Header Table entry size
+	uint16_t phnum;		// Number of Program Header Table entries
+	uint16_t shentsize;	// Section Header Table entry size
+	uint16_t shnum;		// Number of Section Header Table entries
+	uint16_t shstrndx;	// Index of the section name string table
+};
+
+/* FIELD DESCRIPTIONS */
+// X(member, 32-bit offset, 32-bit size, 64-bit offset, 64-bit size)
+#define ELF_HDR_FIELDS(X) \
+	X(abiversion,	0x08, 1, 0x08, 1) \
+	X(type,			0x10, 2, 0x10, 2) \
+	X(machine,		0x12, 2, 0x12, 2) \
+	X(version,		0x14, 4, 0x14, 4) \
+	X(entry,		0x18, 4, 0x18, 8) \
+	X(phoff,		0x1C, 4, 0x20, 8) \
+	X(shoff,		0x20, 4, 0x28, 8) \
+	X(flags,		0x24, 4, 0x30, 4) \
+	X(ehsize,		0x28, 2, 0x34, 2) \
+	X(phentsize,	0x2A, 2, 0x36, 2) \
+	X(phnum,		0x2C, 2, 0x38, 2) \
+	X(shentsize,	0x2E, 2, 0x3A, 2) \
+	X(shnum,		0x30, 2, 0x3C, 2) \
+	X(shstrndx,		0x32, 2, 0x3E, 2)
+
+#define ELF_PRGRM_HEADER_FIELDS(X) \
+	X(type,			0x00, 4, 0x00, 4) \
+	X(offset,		0x04, 4, 0x08, 8) \
+	X(vaddr,		0x08, 4, 0x10, 8) \
+	X(paddr,		0x0C, 4, 0x18, 8) \
+	X(filesz,		0x10, 4, 0x20, 8) \
+	X(memsz,		0x14, 4, 0x28, 8) \
+	X(flags,		0x18, 4, 0x04, 4) \
+	X(align,		0x1C, 4, 0x30, 8)
+
+#define ELF_SECTN_HEADER_FIELDS(X) \
+	X(name,			0x00, 4, 0x00, 4) \
+	X(type,			0x04, 4, 0x04, 4) \
+	X(flags,		0x08, 4, 0x08, 8) \
+	X(addr,			0x0C, 4, 0x10, 8) \
+	X(offset,		0x10, 4, 0x18, 8) \
+	X(size,			0x14, 4, 0x20, 8) \
+	X(link,			0x18, 4, 0x28, 4) \
+	X(info,			0x1C, 4, 0x2C, 4) \
+	X(addralign,	0x20, 4, 0x30, 8) \
+	X(entsize,		0x24, 4, 0x38, 8)
+
+#define ELF_SYMBOL_FIELDS(X) \
+	X(name,			0x00, 4, 0x00, 4) \
+	X(info,			0x0C, 1, 0x04, 1) \
+	X(other,		0x0D, 1, 0x05, 1) \
+	X(shndx,		0x0E, 2, 0x06, 2) \
+	X(value,		0x04, 4, 0x08, 8) \
+	X(size,			0x08, 4, 0x10, 8)
+
+// One set of decoders per ELF Class and byte order
+struct Elf_Decoders
+{
+	int elfClass;		// ELF_H_CLASS_32 or ELF_H_CLASS_64
+	int bigEndian;		// If TRUE, bigEndian
+	uint16_t (*half)(const unsigned char* buff);	// Decode a 16-bit value
+	uint32_t (*word)(const unsigned char* buff);	// Decode a 32-bit value
+	uint64_t (*xword)(const unsigned char* buff);	// Decode a 64-bit value
+	uint64_t (*addr)(const unsigned char* buff);	// Decode an address or offset sized by elfClass
+	void (*halves)(uint16_t* dst, const void* src, size_t count);	// Decode an array of 16-bit values
+	void (*words)(uint32_t* dst, const void* src, size_t count);	// Decode an array of 32-bit values
+	void (*xwords)(uint64_t* dst, const void* src, size_t count);	// Decode an array of 64-bit values
+	void (*elf_header)(struct Elf_Hdr_Record* record, const unsigned char* buff);		// buff is the start of the file
+	void (*prgrm_header)(struct Elf_Prgrm_Header* record, const unsigned char* buff);	// buff is the start of the entry
+	void (*sectn_header)(struct Elf_Sectn_Header* record, const unsigned char* buff);	// buff is the start of the entry
+	void (*symbol)(struct Elf_Symbol* record, const unsigned char* buff);				// buff is the start of the entry
+};
+
+
+// Purpose:	Choose the decoders for an ELF file
+// Input:
+//			elfClass - ELF Class byte (OFFSET: 0x04)
+//			elfData - ELF Data (endianness) byte (OFFSET: 0x05)
+// Output:	Pointer to a static set of decoders, NULL if either byte is invalid
+// Note:
+//			Do not free() the return value
+//			Decoders never bounds check.  Bounds check the whole header/entry once before decoding it.
+const struct Elf_Decoders* get_elf_decoders(int elfClass, int elfData);
+
+#endif // __ELF_DECODE_H__
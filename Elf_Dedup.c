@@ -0,0 +1,1116 @@
+#include "Elf_Dedup.h"
+#include "Elf_Details.h"
+#include "Elf_Digest.h"
+#include <errno.h>
+#include <fcntl.h>		// open()
+#include <pthread.h>	// pthread_mutex_t
+#include <stdio.h>
+#include <stdlib.h>		// mkstemp()/qsort()
+#include <string.h>
+#include <sys/mman.h>	// mmap()/munmap()
+#include <sys/stat.h>	// fstat()
+#include <unistd.h>		// close()/unlink()
+
+#define DEDUP_BYTE_ORDER	((uint32_t)0x01020304)	// Reads back scrambled in the other byte order
+#define DEDUP_COPY_SIZE		((size_t)65536)			// Bytes copied at a time between files
+#define DEDUP_MAX_BUCKET_BITS	((uint32_t)24)		// Largest directory open_dedup_index() accepts
+
+/* LOCAL STRUCTS */
+// Header at the start of an index
+struct Elf_Dedup_Header
+{
+	char magic[4];				// DEDUP_MAGIC
+	uint16_t version;			// DEDUP_VERSION
+	uint16_t headerSize;		// DEDUP_HEADER_SIZE
+	uint32_t byteOrder;			// DEDUP_BYTE_ORDER
+	uint32_t entrySize;			// DEDUP_ENTRY_SIZE
+	uint32_t bucketBits;		// log2 of the number of buckets
+	uint32_t numRegions;		// Number of region names
+	uint64_t numEntries;		// Number of entries
+	uint64_t numFiles;			// Number of paths
+	uint64_t regionsOffset;		// Region names
+	uint64_t regionsSize;		// Bytes of region names
+	uint64_t pathOffsetsOffset;	// uint64_t per file
+	uint64_t pathsOffset;		// Paths
+	uint64_t pathsSize;			// Bytes of paths
+	uint64_t entriesOffset;		// Sorted entries
+	uint64_t bucketsOffset;		// uint64_t per bucket, plus one
+	uint64_t fileSize;			// Bytes in the whole index
+	uint64_t reserved[3];		// Zero
+};
+
+struct Elf_Dedup_Builder
+{
+	pthread_mutex_t lock;			// Protects everything below
+	char* indexName;				// Index file
+	struct Elf_Dedup_Entry* run;	// Entries not yet spilled
+	size_t runCapacity;				// Number of entries allocated in run
+	size_t runUsed;					// Number of entries used in run
+	FILE** runFiles;				// Sorted runs spilled so far
+	size_t numRuns;					// Number of entries used in runFiles
+	size_t runFilesCapacity;		// Number of entries allocated in runFiles
+	FILE* pathsFile;				// Paths, nul-terminated, back to back
+	uint64_t pathsSize;				// Bytes in pathsFile
+	FILE* offsetsFile;				// Offset of each path into pathsFile
+	uint64_t numFiles;				// Number of paths
+	char* regions;					// Region names, nul-terminated, back to back
+	size_t regionsSize;				// Bytes used in regions
+	size_t regionsCapacity;			// Bytes allocated in regions
+	uint32_t numRegions;			// Number of names in regions
+	int failed;						// If TRUE, an entry was lost and no index is written
+};
+
+// One run being merged
+struct Elf_Dedup_Source
+{
+	struct Elf_Dedup_Entry entry;	// Smallest entry not yet written
+	FILE* runFile;					// Where the rest come from
+};
+
+/* LOCAL FUNCTIONS */
+static int compare_dedup_entries(const void* entry1, const void* entry2);
+static FILE* open_temp_file(const char* indexName);
+static int find_region_id(const char* regions, size_t regionsSize, const char* regionName, uint32_t* regionId);
+static int add_region(struct Elf_Dedup_Builder* builder, const char* regionName, uint32_t* regionId);
+static int spill_run(struct Elf_Dedup_Builder* builder);
+static int merge_runs(FILE** inputs, size_t numInputs, FILE* output, uint64_t* bucketCounts, uint32_t bucketBits);
+static int copy_stream(FILE* input, FILE* output, uint64_t numBytes);
+static int pad_stream(FILE* output, uint64_t* offset);
+static void release_dedup_builder(struct Elf_Dedup_Builder* builder);
+static int check_range(uint64_t offset, uint64_t size, uint64_t fileSize);
+
+
+// Purpose:	Start building an index
+// Input:
+//			indexName - Index file to write
+//			runEntries - Entries held in memory before a run is spilled (0 for DEDUP_RUN_ENTRIES)
+// Output:	A new builder, NULL on error (check errno)
+struct Elf_Dedup_Builder* create_dedup_builder(const char* indexName, size_t runEntries)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Dedup_Builder* retVal = NULL;	// Builder to be allocated, initialized and returned
+
+	/* INPUT VALIDATION */
+	if (!indexName || !(*indexName))
+	{
+		errno = EINVAL;
+		return retVal;
+	}
+
+	/* ALLOCATE */
+	retVal = (struct Elf_Dedup_Builder*)gimme_mem(1, sizeof(struct Elf_Dedup_Builder));
+	if (!retVal)
+	{
+		return retVal;
+	}
+	pthread_mutex_init(&(retVal->lock), NULL);
+	retVal->runCapacity = runEntries > 0 ? runEntries : DEDUP_RUN_ENTRIES;
+	retVal->indexName = (char*)gimme_mem(strlen(indexName) + 1, sizeof(char));
+	retVal->run = (struct Elf_Dedup_Entry*)gimme_mem(retVal->runCapacity, sizeof(struct Elf_Dedup_Entry));
+	if (retVal->indexName)
+	{
+		memcpy(retVal->indexName, indexName, strlen(indexName));
+		retVal->pathsFile = open_temp_file(indexName);
+		retVal->offsetsFile = open_temp_file(indexName);
+	}
+	if (!retVal->indexName || !retVal->run || !retVal->pathsFile || !retVal->offsetsFile)
+	{
+		release_dedup_builder(retVal);
+		retVal = NULL;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Add every hashed region of one file
+// Input:
+//			builder - Builder from create_dedup_builder()
+//			fileName - Path of the file
+//			digestList - Digests with DIGEST_XXH64 (see: digest_elf_contents())
+// Output:	ERROR_* as specified in Elf_Details.h
+int add_dedup_file(struct Elf_Dedup_Builder* builder, const char* fileName, const struct Elf_Digest_List* digestList)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	const struct Elf_Digest* digest = NULL;	// Digest being added
+	const char* regionName = NULL;			// Region of digest
+	struct Elf_Dedup_Entry* entry = NULL;	// Entry being filled
+	uint32_t fileId = 0;					// ID of fileName
+	size_t i = 0;							// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!builder || !fileName || !digestList)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	pthread_mutex_lock(&(builder->lock));
+	/* FILE */
+	fileId = (uint32_t)builder->numFiles;
+	if (!(digestList->algorithms & DIGEST_XXH64))
+	{
+		// Still fails the whole index below rather than quietly leaving the file out
+		retVal = ERROR_BAD_ARG;
+	}
+	else if (builder->numFiles >= UINT32_MAX)
+	{
+		retVal = ERROR_OVERFLOW;
+	}
+	else if (fwrite(&(builder->pathsSize), sizeof(builder->pathsSize), 1, builder->offsetsFile) != 1 \
+		|| fwrite(fileName, strlen(fileName) + 1, 1, builder->pathsFile) != 1)
+	{
+		retVal = ERROR_BAD_ARG;
+	}
+	else
+	{
+		builder->pathsSize += strlen(fileName) + 1;
+		builder->numFiles++;
+	}
+
+	/* REGIONS */
+	for (i = 0; retVal == ERROR_SUCCESS && i < digestList->numDigests; i++)
+	{
+		digest = digestList->digests + i;
+		switch (digest->kind)
+		{
+			case DIGEST_KIND_FILE:
+				regionName = "file";
+				break;
+			case DIGEST_KIND_SEGMENT:
+				regionName = "load";
+				break;
+			default:
+				regionName = digest->name;
+		}
+		if (digest->status != ERROR_SUCCESS || digest->size == 0 || !regionName || !(*regionName))
+		{
+			continue;
+		}
+		if (builder->runUsed == builder->runCapacity)
+		{
+			retVal = spill_run(builder);
+			if (retVal != ERROR_SUCCESS)
+			{
+				break;
+			}
+		}
+		entry = builder->run + builder->runUsed;
+		retVal = add_region(builder, regionName, &(entry->regionId));
+		if (retVal == ERROR_SUCCESS)
+		{
+			entry->hash = digest->xxh64;
+			entry->size = digest->size;
+			entry->fileId = fileId;
+			builder->runUsed++;
+		}
+	}
+	if (retVal != ERROR_SUCCESS)
+	{
+		builder->failed = TRUE;
+	}
+	pthread_mutex_unlock(&(builder->lock));
+
+	return retVal;
+}
+
+
+// Purpose:	Merge the runs, write the index, and release the builder
+// Input:	builder - Pointer to a builder pointer from create_dedup_builder()
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Modifies the builder pointer by making it NULL
+int finish_dedup_builder(struct Elf_Dedup_Builder** builder)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Dedup_Builder* oldBuilder = NULL;	// *builder
+	struct Elf_Dedup_Header header;		// Written last
+	FILE** mergedRuns = NULL;			// Runs left after one merge pass
+	size_t numMerged = 0;				// Number of entries in mergedRuns
+	uint64_t* buckets = NULL;			// Entries per bucket, then first entry of each bucket
+	size_t numBuckets = (size_t)1 << DEDUP_BUCKET_BITS;	// Number of buckets
+	uint64_t offset = 0;				// Bytes written to the index so far
+	uint64_t numEntries = 0;			// Running total of buckets
+	char* tmpName = NULL;				// Index until it's renamed
+	int tmpFd = -1;						// File descriptor of tmpName
+	FILE* output = NULL;				// Stream of tmpName
+	size_t i = 0;						// Iterating variable
+	size_t j = 0;						// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!builder || !(*builder))
+	{
+		return ERROR_NULL_PTR;
+	}
+	oldBuilder = *builder;
+	*builder = NULL;
+
+	/* SPILL THE LAST RUN */
+	if (oldBuilder->failed != TRUE && oldBuilder->runUsed > 0)
+	{
+		retVal = spill_run(oldBuilder);
+	}
+	else if (oldBuilder->failed == TRUE)
+	{
+		retVal = ERROR_BAD_ARG;
+	}
+
+	/* MERGE DOWN TO ONE PASS */
+	// Each pass merges DEDUP_MERGE_WAYS runs at a time so open files stay bounded
+	while (retVal == ERROR_SUCCESS && oldBuilder->numRuns > DEDUP_MERGE_WAYS)
+	{
+		numMerged = (oldBuilder->numRuns + DEDUP_MERGE_WAYS - 1) / DEDUP_MERGE_WAYS;
+		mergedRuns = (FILE**)gimme_mem(numMerged, sizeof(FILE*));
+		if (!mergedRuns)
+		{
+			retVal = ERROR_NULL_PTR;
+			break;
+		}
+		for (i = 0, j = 0; retVal == ERROR_SUCCESS && i < oldBuilder->numRuns; i += DEDUP_MERGE_WAYS, j++)
+		{
+			mergedRuns[j] = open_temp_file(oldBuilder->indexName);
+			if (!mergedRuns[j])
+			{
+				retVal = ERROR_BAD_ARG;
+				break;
+			}
+			retVal = merge_runs(oldBuilder->runFiles + i, oldBuilder->numRuns - i < DEDUP_MERGE_WAYS ? \
+				oldBuilder->numRuns - i : DEDUP_MERGE_WAYS, mergedRuns[j], NULL, 0);
+		}
+		// Swap in the merged runs whether or not the pass finished so they're all closed
+		for (i = 0; i < oldBuilder->numRuns; i++)
+		{
+			fclose(oldBuilder->runFiles[i]);
+		}
+		take_mem_back((void**)&(oldBuilder->runFiles), oldBuilder->runFilesCapacity, sizeof(FILE*));
+		oldBuilder->runFiles = mergedRuns;
+		oldBuilder->runFilesCapacity = numMerged;
+		oldBuilder->numRuns = retVal == ERROR_SUCCESS ? numMerged : j;
+		mergedRuns = NULL;
+	}
+
+	/* CREATE THE INDEX */
+	if (retVal == ERROR_SUCCESS)
+	{
+		buckets = (uint64_t*)gimme_mem(numBuckets + 1, sizeof(uint64_t));
+		tmpName = (char*)gimme_mem(strlen(oldBuilder->indexName) + sizeof(".XXXXXX"), sizeof(char));
+		if (!buckets || !tmpName)
+		{
+			retVal = ERROR_NULL_PTR;
+		}
+		else
+		{
+			memcpy(tmpName, oldBuilder->indexName, strlen(oldBuilder->indexName));
+			memcpy(tmpName + strlen(oldBuilder->indexName), ".XXXXXX", sizeof(".XXXXXX"));
+			tmpFd = mkstemp(tmpName);
+			output = tmpFd >= 0 ? fdopen(tmpFd, "wb") : NULL;
+			if (!output)
+			{
+				fprintf(stderr, "Unable to create %s: %s\n", tmpName, strerror(errno));
+				if (tmpFd >= 0)
+				{
+					close(tmpFd);
+					unlink(tmpName);
+				}
+				retVal = ERROR_BAD_ARG;
+			}
+		}
+	}
+
+	/* WRITE IT */
+	if (retVal == ERROR_SUCCESS)
+	{
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, DEDUP_MAGIC, sizeof(header.magic));
+		header.version = DEDUP_VERSION;
+		header.headerSize = DEDUP_HEADER_SIZE;
+		header.byteOrder = DEDUP_BYTE_ORDER;
+		header.entrySize = DEDUP_ENTRY_SIZE;
+		header.bucketBits = DEDUP_BUCKET_BITS;
+		header.numRegions = oldBuilder->numRegions;
+		header.numFiles = oldBuilder->numFiles;
+		// Placeholder
+		fwrite(&header, sizeof(header), 1, output);
+		offset = sizeof(header);
+		// Region names
+		header.regionsOffset = offset;
+		header.regionsSize = oldBuilder->regionsSize;
+		if (oldBuilder->regionsSize > 0)
+		{
+			fwrite(oldBuilder->regions, oldBuilder->regionsSize, 1, output);
+		}
+		offset += oldBuilder->regionsSize;
+		pad_stream(output, &offset);
+		// Path offsets and paths
+		header.pathOffsetsOffset = offset;
+		retVal = copy_stream(oldBuilder->offsetsFile, output, oldBuilder->numFiles * sizeof(uint64_t));
+		offset += oldBuilder->numFiles * sizeof(uint64_t);
+		header.pathsOffset = offset;
+		header.pathsSize = oldBuilder->pathsSize;
+		if (retVal == ERROR_SUCCESS)
+		{
+			retVal = copy_stream(oldBuilder->pathsFile, output, oldBuilder->pathsSize);
+		}
+		offset += oldBuilder->pathsSize;
+		pad_stream(output, &offset);
+		// Entries, counted into buckets on the way through
+		header.entriesOffset = offset;
+		if (retVal == ERROR_SUCCESS)
+		{
+			retVal = merge_runs(oldBuilder->runFiles, oldBuilder->numRuns, output, buckets, DEDUP_BUCKET_BITS);
+		}
+		for (i = 0; i < numBuckets; i++)
+		{
+			numEntries += buckets[i];
+			buckets[i] = numEntries - buckets[i];
+		}
+		buckets[numBuckets] = numEntries;
+		header.numEntries = numEntries;
+		offset += numEntries * DEDUP_ENTRY_SIZE;
+		// Directory
+		header.bucketsOffset = offset;
+		fwrite(buckets, sizeof(uint64_t), numBuckets + 1, output);
+		offset += (numBuckets + 1) * sizeof(uint64_t);
+		header.fileSize = offset;
+		if (retVal == ERROR_SUCCESS && (fseek(output, 0, SEEK_SET) || fwrite(&header, sizeof(header), 1, output) != 1 \
+			|| fflush(output) || ferror(output)))
+		{
+			fprintf(stderr, "Unable to write %s: %s\n", tmpName, strerror(errno));
+			retVal = ERROR_BAD_ARG;
+		}
+		if (fclose(output) && retVal == ERROR_SUCCESS)
+		{
+			retVal = ERROR_BAD_ARG;
+		}
+		if (retVal != ERROR_SUCCESS || rename(tmpName, oldBuilder->indexName))
+		{
+			if (retVal == ERROR_SUCCESS)
+			{
+				fprintf(stderr, "Unable to replace %s: %s\n", oldBuilder->indexName, strerror(errno));
+				retVal = ERROR_BAD_ARG;
+			}
+			unlink(tmpName);
+		}
+	}
+
+	/* CLEAN UP */
+	if (buckets)
+	{
+		take_mem_back((void**)&buckets, numBuckets + 1, sizeof(uint64_t));
+	}
+	if (tmpName)
+	{
+		take_mem_back((void**)&tmpName, strlen(tmpName) + 1, sizeof(char));
+	}
+	release_dedup_builder(oldBuilder);
+
+	return retVal;
+}
+
+
+// Purpose:	Map an index
+// Input:
+//			index [out] - Index to set up
+//			indexName - Index file from finish_dedup_builder()
+// Output:	ERROR_* as specified in Elf_Details.h (check errno on ERROR_BAD_ARG)
+int open_dedup_index(struct Elf_Dedup_Index* index, const char* indexName)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	int indexFd = -1;					// File descriptor of indexName
+	struct stat indexStat;				// Size of indexName
+	void* indexGuts = MAP_FAILED;		// Mapped index
+	struct Elf_Dedup_Header header;		// Copy of the header
+	uint64_t numBuckets = 0;			// Number of buckets
+	uint64_t numNames = 0;				// Region names counted
+	uint64_t i = 0;						// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!index || !indexName)
+	{
+		return ERROR_NULL_PTR;
+	}
+	memset(index, 0, sizeof(struct Elf_Dedup_Index));
+
+	/* MAP IT */
+	indexFd = open(indexName, O_RDONLY);
+	if (indexFd < 0)
+	{
+		return ERROR_BAD_ARG;
+	}
+	if (fstat(indexFd, &indexStat))
+	{
+		retVal = ERROR_BAD_ARG;
+	}
+	else if (indexStat.st_size < (off_t)DEDUP_HEADER_SIZE)
+	{
+		retVal = ERROR_ORC_FILE;
+	}
+	else
+	{
+		indexGuts = mmap(NULL, (size_t)indexStat.st_size, PROT_READ, MAP_PRIVATE, indexFd, 0);
+		retVal = indexGuts == MAP_FAILED ? ERROR_BAD_ARG : ERROR_SUCCESS;
+	}
+	close(indexFd);
+	if (retVal != ERROR_SUCCESS)
+	{
+		return retVal;
+	}
+	memcpy(&header, indexGuts, sizeof(header));
+
+	/* CHECK THE HEADER */
+	if (memcmp(header.magic, DEDUP_MAGIC, sizeof(header.magic)) || header.version != DEDUP_VERSION \
+		|| header.headerSize != DEDUP_HEADER_SIZE || header.byteOrder != DEDUP_BYTE_ORDER \
+		|| header.entrySize != DEDUP_ENTRY_SIZE || header.bucketBits > DEDUP_MAX_BUCKET_BITS)
+	{
+		retVal = ERROR_ORC_FILE;
+	}
+	// Every table inside the file and every array 8 byte aligned
+	else if (header.fileSize != (uint64_t)indexStat.st_size \
+		|| check_range(header.regionsOffset, header.regionsSize, header.fileSize) != ERROR_SUCCESS \
+		|| header.numFiles > header.fileSize / sizeof(uint64_t) \
+		|| check_range(header.pathOffsetsOffset, header.numFiles * sizeof(uint64_t), header.fileSize) != ERROR_SUCCESS \
+		|| check_range(header.pathsOffset, header.pathsSize, header.fileSize) != ERROR_SUCCESS \
+		|| header.numEntries > header.fileSize / DEDUP_ENTRY_SIZE \
+		|| check_range(header.entriesOffset, header.numEntries * DEDUP_ENTRY_SIZE, header.fileSize) != ERROR_SUCCESS \
+		|| check_range(header.bucketsOffset, (((uint64_t)1 << header.bucketBits) + 1) * sizeof(uint64_t), \
+			header.fileSize) != ERROR_SUCCESS \
+		|| (header.pathOffsetsOffset | header.entriesOffset | header.bucketsOffset) % sizeof(uint64_t))
+	{
+		retVal = ERROR_BAD_OFFSET;
+	}
+	// String pools end with a nul so every name in them does
+	else if ((header.regionsSize && ((const char*)indexGuts)[header.regionsOffset + header.regionsSize - 1]) \
+		|| (header.pathsSize && ((const char*)indexGuts)[header.pathsOffset + header.pathsSize - 1]))
+	{
+		retVal = ERROR_BAD_OFFSET;
+	}
+
+	/* KEEP IT */
+	if (retVal == ERROR_SUCCESS)
+	{
+		index->map = (const unsigned char*)indexGuts;
+		index->mapSize = (size_t)indexStat.st_size;
+		index->entries = (const struct Elf_Dedup_Entry*)(index->map + header.entriesOffset);
+		index->numEntries = header.numEntries;
+		index->buckets = (const uint64_t*)(index->map + header.bucketsOffset);
+		index->bucketBits = header.bucketBits;
+		index->pathOffsets = (const uint64_t*)(index->map + header.pathOffsetsOffset);
+		index->numFiles = header.numFiles;
+		index->paths = (const char*)(index->map + header.pathsOffset);
+		index->pathsSize = header.pathsSize;
+		index->regions = (const char*)(index->map + header.regionsOffset);
+		index->regionsSize = header.regionsSize;
+		index->numRegions = header.numRegions;
+		// Buckets must climb from 0 to numEntries so a lookup stays inside entries
+		numBuckets = (uint64_t)1 << header.bucketBits;
+		if (index->buckets[0] != 0 || index->buckets[numBuckets] != index->numEntries)
+		{
+			retVal = ERROR_BAD_OFFSET;
+		}
+		for (i = 0; retVal == ERROR_SUCCESS && i < numBuckets; i++)
+		{
+			if (index->buckets[i] > index->buckets[i + 1])
+			{
+				retVal = ERROR_BAD_OFFSET;
+			}
+		}
+		for (i = 0; i < index->regionsSize; i++)
+		{
+			numNames += index->regions[i] ? 0 : 1;
+		}
+		if (numNames != index->numRegions)
+		{
+			retVal = ERROR_BAD_OFFSET;
+		}
+	}
+	if (retVal != ERROR_SUCCESS)
+	{
+		munmap(indexGuts, (size_t)indexStat.st_size);
+		memset(index, 0, sizeof(struct Elf_Dedup_Index));
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Find every file with a region of a given hash
+// Input:
+//			index - Index from open_dedup_index()
+//			regionName - Region to look in (e.g., ".text")
+//			hash - XXH64 of the region
+//			first [out] - Index into index->entries of the first match
+//			count [out] - Number of matches (0 if none)
+// Output:	ERROR_* as specified in Elf_Details.h
+int find_dedup_hash(const struct Elf_Dedup_Index* index, const char* regionName, uint64_t hash, \
+	                size_t* first, size_t* count)
+{
+	/* LOCAL VARIABLES */
+	uint32_t regionId = 0;		// ID of regionName
+	uint64_t bucket = 0;		// Bucket hash falls in
+	uint64_t low = 0;			// First candidate
+	uint64_t high = 0;			// One past the last candidate
+	uint64_t middle = 0;		// Candidate being compared
+
+	/* INPUT VALIDATION */
+	if (!index || !index->map || !regionName || !first || !count)
+	{
+		return ERROR_NULL_PTR;
+	}
+	*first = 0;
+	*count = 0;
+	if (find_region_id(index->regions, index->regionsSize, regionName, &regionId) != ERROR_SUCCESS)
+	{
+		// Nothing was ever hashed under that name
+		return ERROR_SUCCESS;
+	}
+
+	/* BUCKET */
+	bucket = index->bucketBits ? hash >> (64 - index->bucketBits) : 0;
+	low = index->buckets[bucket];
+	high = index->buckets[bucket + 1];
+
+	/* LOWER BOUND */
+	while (low < high)
+	{
+		middle = low + ((high - low) / 2);
+		if (index->entries[middle].hash < hash \
+			|| (index->entries[middle].hash == hash && index->entries[middle].regionId < regionId))
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	/* MATCHES */
+	*first = (size_t)low;
+	while (low < index->numEntries && index->entries[low].hash == hash && index->entries[low].regionId == regionId)
+	{
+		low++;
+	}
+	*count = (size_t)(low - *first);
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Find the next group of entries that share a hash, region, and size
+// Input:
+//			index - Index from open_dedup_index()
+//			cursor - Entry to start from (0 to start).  Moved past the group.
+//			first [out] - Index into index->entries of the group
+//			count [out] - Number of entries in the group (at least 2)
+// Output:
+//			ERROR_SUCCESS on success
+//			DEDUP_END if there are no more groups
+//			ERROR_* as specified in Elf_Details.h on error
+int next_dedup_group(const struct Elf_Dedup_Index* index, size_t* cursor, size_t* first, size_t* count)
+{
+	/* LOCAL VARIABLES */
+	const struct Elf_Dedup_Entry* entries = NULL;	// index->entries
+	size_t end = 0;		// One past the end of the group being considered
+
+	/* INPUT VALIDATION */
+	if (!index || !index->map || !cursor || !first || !count)
+	{
+		return ERROR_NULL_PTR;
+	}
+	else if (*cursor > index->numEntries)
+	{
+		return ERROR_BAD_ARG;
+	}
+
+	/* FIND IT */
+	// Sorted, so a group is a run of equal keys
+	entries = index->entries;
+	while (*cursor < index->numEntries)
+	{
+		end = *cursor + 1;
+		while (end < index->numEntries && entries[end].hash == entries[*cursor].hash \
+			&& entries[end].regionId == entries[*cursor].regionId && entries[end].size == entries[*cursor].size)
+		{
+			end++;
+		}
+		if (end - *cursor > 1)
+		{
+			*first = *cursor;
+			*count = end - *cursor;
+			*cursor = end;
+			return ERROR_SUCCESS;
+		}
+		*cursor = end;
+	}
+
+	return DEDUP_END;
+}
+
+
+// Purpose:	Translate a file ID
+// Input:
+//			index - Index from open_dedup_index()
+//			fileId - Elf_Dedup_Entry.fileId
+// Output:	The path, NULL if fileId is invalid
+const char* get_dedup_file(const struct Elf_Dedup_Index* index, uint32_t fileId)
+{
+	if (!index || !index->map || fileId >= index->numFiles || index->pathOffsets[fileId] >= index->pathsSize)
+	{
+		return NULL;
+	}
+
+	return index->paths + index->pathOffsets[fileId];
+}
+
+
+// Purpose:	Translate a region ID
+// Input:
+//			index - Index from open_dedup_index()
+//			regionId - Elf_Dedup_Entry.regionId
+// Output:	The region name, NULL if regionId is invalid
+const char* get_dedup_region(const struct Elf_Dedup_Index* index, uint32_t regionId)
+{
+	/* LOCAL VARIABLES */
+	const char* retVal = NULL;	// Name being considered
+	uint64_t offset = 0;		// Offset of retVal into index->regions
+
+	/* INPUT VALIDATION */
+	if (!index || !index->map || regionId >= index->numRegions)
+	{
+		return retVal;
+	}
+
+	/* WALK THE NAMES */
+	while (offset < index->regionsSize)
+	{
+		retVal = index->regions + offset;
+		if (regionId-- == 0)
+		{
+			return retVal;
+		}
+		offset += strlen(retVal) + 1;
+	}
+
+	return NULL;
+}
+
+
+// Purpose:	Release an index
+// Input:	index - Index from open_dedup_index()
+// Output:	ERROR_* as specified in Elf_Details.h
+int close_dedup_index(struct Elf_Dedup_Index* index)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (!index)
+	{
+		retVal = ERROR_NULL_PTR;
+	}
+	else
+	{
+		if (index->map && munmap((void*)index->map, index->mapSize))
+		{
+			PERROR(errno);
+			retVal = ERROR_BAD_ARG;
+		}
+		memset(index, 0, sizeof(struct Elf_Dedup_Index));
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Order entries by hash, region, size, then file (qsort() comparison)
+static int compare_dedup_entries(const void* entry1, const void* entry2)
+{
+	const struct Elf_Dedup_Entry* left = (const struct Elf_Dedup_Entry*)entry1;
+	const struct Elf_Dedup_Entry* right = (const struct Elf_Dedup_Entry*)entry2;
+
+	if (left->hash != right->hash)
+	{
+		return left->hash < right->hash ? -1 : 1;
+	}
+	else if (left->regionId != right->regionId)
+	{
+		return left->regionId < right->regionId ? -1 : 1;
+	}
+	else if (left->size != right->size)
+	{
+		return left->size < right->size ? -1 : 1;
+	}
+	else if (left->fileId != right->fileId)
+	{
+		return left->fileId < right->fileId ? -1 : 1;
+	}
+
+	return 0;
+}
+
+
+// Purpose:	Create an anonymous read/write file next to the index
+// Input:	indexName - Index being built
+// Output:	The stream, NULL on error (check errno)
+// Note:	Unlinked right away so it disappears when it's closed, even after a crash
+static FILE* open_temp_file(const char* indexName)
+{
+	/* LOCAL VARIABLES */
+	FILE* retVal = NULL;		// Stream to return
+	char* tmpName = NULL;		// Name from mkstemp()
+	size_t nameLen = strlen(indexName);	// Length of indexName
+	int tmpFd = -1;				// File descriptor of tmpName
+
+	/* CREATE IT */
+	tmpName = (char*)gimme_mem(nameLen + sizeof(".XXXXXX"), sizeof(char));
+	if (!tmpName)
+	{
+		return retVal;
+	}
+	memcpy(tmpName, indexName, nameLen);
+	memcpy(tmpName + nameLen, ".XXXXXX", sizeof(".XXXXXX"));
+	tmpFd = mkstemp(tmpName);
+	if (tmpFd >= 0)
+	{
+		unlink(tmpName);
+		retVal = fdopen(tmpFd, "w+b");
+		if (!retVal)
+		{
+			close(tmpFd);
+		}
+	}
+	if (!retVal)
+	{
+		fprintf(stderr, "Unable to create a temporary file next to %s: %s\n", indexName, strerror(errno));
+	}
+	take_mem_back((void**)&tmpName, nameLen + sizeof(".XXXXXX"), sizeof(char));
+
+	return retVal;
+}
+
+
+// Purpose:	Look up a region name in a pool of names
+// Input:
+//			regions - nul-terminated names back to back
+//			regionsSize - Bytes in regions
+//			regionName - Name to find
+//			regionId [out] - Position of regionName in regions
+// Output:	ERROR_SUCCESS if found, ERROR_BAD_ARG otherwise
+// Note:	Linear, but there are only as many names as distinct regions selected
+static int find_region_id(const char* regions, size_t regionsSize, const char* regionName, uint32_t* regionId)
+{
+	size_t offset = 0;		// Offset of the name being compared
+	uint32_t currId = 0;	// ID of the name being compared
+
+	while (offset < regionsSize)
+	{
+		if (!strcmp(regions + offset, regionName))
+		{
+			*regionId = currId;
+			return ERROR_SUCCESS;
+		}
+		offset += strlen(regions + offset) + 1;
+		currId++;
+	}
+
+	return ERROR_BAD_ARG;
+}
+
+
+// Purpose:	Find or add a region name
+// Input:
+//			builder - Builder (lock held)
+//			regionName - Name to find or add
+//			regionId [out] - ID of regionName
+// Output:	ERROR_* as specified in Elf_Details.h
+static int add_region(struct Elf_Dedup_Builder* builder, const char* regionName, uint32_t* regionId)
+{
+	/* LOCAL VARIABLES */
+	size_t nameSize = strlen(regionName) + 1;	// Bytes regionName needs
+	size_t newCapacity = 0;						// Bytes in newRegions
+	char* newRegions = NULL;					// Grown pool
+
+	/* FIND IT */
+	if (find_region_id(builder->regions, builder->regionsSize, regionName, regionId) == ERROR_SUCCESS)
+	{
+		return ERROR_SUCCESS;
+	}
+
+	/* GROW */
+	if (builder->regionsSize + nameSize > builder->regionsCapacity)
+	{
+		newCapacity = builder->regionsCapacity ? builder->regionsCapacity * 2 : 256;
+		while (newCapacity < builder->regionsSize + nameSize)
+		{
+			newCapacity *= 2;
+		}
+		newRegions = (char*)gimme_mem(newCapacity, sizeof(char));
+		if (!newRegions)
+		{
+			return ERROR_NULL_PTR;
+		}
+		if (builder->regions)
+		{
+			memcpy(newRegions, builder->regions, builder->regionsSize);
+			take_mem_back((void**)&(builder->regions), builder->regionsCapacity, sizeof(char));
+		}
+		builder->regions = newRegions;
+		builder->regionsCapacity = newCapacity;
+	}
+
+	/* ADD IT */
+	memcpy(builder->regions + builder->regionsSize, regionName, nameSize);
+	builder->regionsSize += nameSize;
+	*regionId = builder->numRegions++;
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Sort the in-memory run and write it to a temporary file
+// Input:	builder - Builder (lock held)
+// Output:	ERROR_* as specified in Elf_Details.h
+static int spill_run(struct Elf_Dedup_Builder* builder)
+{
+	/* LOCAL VARIABLES */
+	FILE* runFile = NULL;		// Where the run goes
+	FILE** newRunFiles = NULL;	// Grown runFiles
+	size_t newCapacity = 0;		// Number of entries in newRunFiles
+
+	/* GROW */
+	if (builder->numRuns == builder->runFilesCapacity)
+	{
+		newCapacity = builder->runFilesCapacity ? builder->runFilesCapacity * 2 : DEDUP_MERGE_WAYS;
+		newRunFiles = (FILE**)gimme_mem(newCapacity, sizeof(FILE*));
+		if (!newRunFiles)
+		{
+			return ERROR_NULL_PTR;
+		}
+		if (builder->runFiles)
+		{
+			memcpy(newRunFiles, builder->runFiles, builder->numRuns * sizeof(FILE*));
+			take_mem_back((void**)&(builder->runFiles), builder->runFilesCapacity, sizeof(FILE*));
+		}
+		builder->runFiles = newRunFiles;
+		builder->runFilesCapacity = newCapacity;
+	}
+
+	/* SPILL */
+	runFile = open_temp_file(builder->indexName);
+	if (!runFile)
+	{
+		return ERROR_BAD_ARG;
+	}
+	qsort(builder->run, builder->runUsed, sizeof(struct Elf_Dedup_Entry), compare_dedup_entries);
+	if (fwrite(builder->run, sizeof(struct Elf_Dedup_Entry), builder->runUsed, runFile) != builder->runUsed)
+	{
+		fclose(runFile);
+		return ERROR_BAD_ARG;
+	}
+	builder->runFiles[builder->numRuns++] = runFile;
+	builder->runUsed = 0;
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	k-way merge sorted runs
+// Input:
+//			inputs - Sorted runs (read from the start)
+//			numInputs - Number of entries in inputs (at most DEDUP_MERGE_WAYS)
+//			output - Where the merged entries go
+//			bucketCounts [out] - Optional.  Incremented once per entry in its bucket.
+//			bucketBits - log2 of the number of buckets in bucketCounts
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	A binary heap holds the smallest unwritten entry of each run
+static int merge_runs(FILE** inputs, size_t numInputs, FILE* output, uint64_t* bucketCounts, uint32_t bucketBits)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Dedup_Source heap[DEDUP_MERGE_WAYS];	// Smallest entry of each run, smallest first
+	struct Elf_Dedup_Source moving;		// Entry sifting down
+	size_t heapSize = 0;				// Number of entries in heap
+	size_t parent = 0;					// Heap position being filled
+	size_t child = 0;					// Smaller child of parent
+	size_t i = 0;						// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (numInputs > DEDUP_MERGE_WAYS)
+	{
+		return ERROR_BAD_ARG;
+	}
+
+	/* FILL THE HEAP */
+	for (i = 0; i < numInputs; i++)
+	{
+		if (fseek(inputs[i], 0, SEEK_SET))
+		{
+			return ERROR_BAD_ARG;
+		}
+		if (fread(&(moving.entry), sizeof(moving.entry), 1, inputs[i]) != 1)
+		{
+			continue;
+		}
+		moving.runFile = inputs[i];
+		// Sift up
+		child = heapSize++;
+		while (child > 0 && compare_dedup_entries(&(moving.entry), &(heap[(child - 1) / 2].entry)) < 0)
+		{
+			heap[child] = heap[(child - 1) / 2];
+			child = (child - 1) / 2;
+		}
+		heap[child] = moving;
+	}
+
+	/* MERGE */
+	while (heapSize > 0)
+	{
+		if (fwrite(&(heap[0].entry), sizeof(heap[0].entry), 1, output) != 1)
+		{
+			retVal = ERROR_BAD_ARG;
+			break;
+		}
+		if (bucketCounts)
+		{
+			bucketCounts[bucketBits ? heap[0].entry.hash >> (64 - bucketBits) : 0]++;
+		}
+		// Replace the root with the next entry from its run, or the last leaf if the run is done
+		moving.runFile = heap[0].runFile;
+		if (fread(&(moving.entry), sizeof(moving.entry), 1, moving.runFile) != 1)
+		{
+			if (ferror(moving.runFile))
+			{
+				retVal = ERROR_BAD_ARG;
+				break;
+			}
+			moving = heap[--heapSize];
+		}
+		// Sift down
+		parent = 0;
+		while ((child = (parent * 2) + 1) < heapSize)
+		{
+			if (child + 1 < heapSize && compare_dedup_entries(&(heap[child + 1].entry), &(heap[child].entry)) < 0)
+			{
+				child++;
+			}
+			if (compare_dedup_entries(&(heap[child].entry), &(moving.entry)) >= 0)
+			{
+				break;
+			}
+			heap[parent] = heap[child];
+			parent = child;
+		}
+		if (heapSize > 0)
+		{
+			heap[parent] = moving;
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Copy the start of one stream to the end of another
+// Input:
+//			input - Stream to copy from (rewound first)
+//			output - Stream to copy to
+//			numBytes - Bytes to copy
+// Output:	ERROR_* as specified in Elf_Details.h
+static int copy_stream(FILE* input, FILE* output, uint64_t numBytes)
+{
+	/* LOCAL VARIABLES */
+	char buff[DEDUP_COPY_SIZE];		// Bytes in flight
+	size_t numCopy = 0;				// Bytes this pass
+
+	/* COPY */
+	if (fseek(input, 0, SEEK_SET))
+	{
+		return ERROR_BAD_ARG;
+	}
+	while (numBytes > 0)
+	{
+		numCopy = numBytes < sizeof(buff) ? (size_t)numBytes : sizeof(buff);
+		if (fread(buff, 1, numCopy, input) != numCopy || fwrite(buff, 1, numCopy, output) != numCopy)
+		{
+			return ERROR_BAD_ARG;
+		}
+		numBytes -= numCopy;
+	}
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Pad a stream to the next multiple of 8 bytes
+// Input:
+//			output - Stream to pad
+//			offset - Bytes written to output so far.  Updated.
+// Output:	ERROR_* as specified in Elf_Details.h
+static int pad_stream(FILE* output, uint64_t* offset)
+{
+	static const char zeros[sizeof(uint64_t)] = { 0 };
+	size_t numPad = (size_t)((sizeof(uint64_t) - (*offset % sizeof(uint64_t))) % sizeof(uint64_t));
+
+	if (numPad > 0 && fwrite(zeros, 1, numPad, output) != numPad)
+	{
+		return ERROR_BAD_ARG;
+	}
+	*offset += numPad;
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Free everything a builder owns
+// Input:	builder - Builder to free
+// Output:	None
+// Note:	Temporary files were unlinked when they were created so closing them deletes them
+static void release_dedup_builder(struct Elf_Dedup_Builder* builder)
+{
+	size_t i = 0;	// Iterating variable
+
+	for (i = 0; i < builder->numRuns; i++)
+	{
+		fclose(builder->runFiles[i]);
+	}
+	if (builder->runFiles)
+	{
+		take_mem_back((void**)&(builder->runFiles), builder->runFilesCapacity, sizeof(FILE*));
+	}
+	if (builder->pathsFile)
+	{
+		fclose(builder->pathsFile);
+	}
+	if (builder->offsetsFile)
+	{
+		fclose(builder->offsetsFile);
+	}
+	if (builder->run)
+	{
+		take_mem_back((void**)&(builder->run), builder->runCapacity, sizeof(struct Elf_Dedup_Entry));
+	}
+	if (builder->regions)
+	{
+		take_mem_back((void**)&(builder->regions), builder->regionsCapacity, sizeof(char));
+	}
+	if (builder->indexName)
+	{
+		take_mem_back((void**)&(builder->indexName), strlen(builder->indexName) + 1, sizeof(char));
+	}
+	pthread_mutex_destroy(&(builder->lock));
+	take_mem_back((void**)&builder, 1, sizeof(struct Elf_Dedup_Builder));
+
+	return;
+}
+
+
+// Purpose:	Check that a table fits in the file
+// Input:
+//			offset - Offset of the table
+//			size - Bytes in the table
+//			fileSize - Bytes in the file
+// Output:	ERROR_SUCCESS if it fits, ERROR_BAD_OFFSET otherwise
+// Note:	Written so offset + size can't wrap
+static int check_range(uint64_t offset, uint64_t size, uint64_t fileSize)
+{
+	return (offset <= fileSize && size <= fileSize - offset) ? ERROR_SUCCESS : ERROR_BAD_OFFSET;
+}
@@ -0,0 +1,147 @@
+#ifndef __ELF_DEDUP_H__
+#define __ELF_DEDUP_H__
+
+#include <stddef.h>		// size_t
+#include <stdint.h>		// Fixed-width integers
+
+/*
+ *	USAGE:
+ *		Build - create_dedup_builder(), add_dedup_file() once per file (from any thread), then
+ *			finish_dedup_builder() writes the index
+ *		Query - open_dedup_index(), then find_dedup_hash() ("which files share this .text?")
+ *			or next_dedup_group() (every region held by more than one file)
+ *	Each hashed region (see: Elf_Digest.h) becomes one entry keyed by (XXH64, region, size).
+ *		Regions are "file", "load" (any PT_LOAD segment), or a section name, so files that
+ *		only share a .text or a segment still group together (near duplicates).
+ *	BOUNDED MEMORY:
+ *		Entries are collected in a fixed-size run.  Full runs are sorted and spilled to
+ *			temporary files next to the index, then merged DEDUP_MERGE_WAYS at a time.
+ *		Paths go straight to a temporary file, so memory doesn't grow with the corpus
+ *	LAYOUT:
+ *		Header (DEDUP_HEADER_SIZE bytes), region names, path offsets, paths, the sorted
+ *			entries, then a directory of 2^DEDUP_BUCKET_BITS buckets indexed by the top bits
+ *			of the hash.  A lookup binary searches one bucket of the mapped file.
+ *		Integers are in the writer's byte order
+ */
+
+#define DEDUP_MAGIC			"ELFX"				// First four bytes of an index
+#define DEDUP_VERSION		((uint16_t)1)		// Version written by finish_dedup_builder()
+#define DEDUP_HEADER_SIZE	((size_t)128)		// Bytes in the header
+#define DEDUP_ENTRY_SIZE	((size_t)24)		// Bytes in each entry
+#define DEDUP_BUCKET_BITS	((uint32_t)16)		// Directory buckets are the top 16 bits of the hash
+#define DEDUP_RUN_ENTRIES	((size_t)4194304)	// Default entries per run (96 MiB)
+#define DEDUP_MERGE_WAYS	((size_t)64)		// Runs merged at once (open files per merge)
+#define DEDUP_END			((int)1)			// next_dedup_group() ran out of groups
+#define DEDUP_DEFAULT_REGIONS	"file,load,.text,.rodata"	// Regions indexed unless told otherwise
+
+struct Elf_Dedup_Builder;
+struct Elf_Digest_List;
+
+// One hashed region of one file
+struct Elf_Dedup_Entry
+{
+	uint64_t hash;		// XXH64 of the region
+	uint64_t size;		// Bytes in the region
+	uint32_t regionId;	// See: get_dedup_region()
+	uint32_t fileId;	// See: get_dedup_file()
+};
+
+// A mapped index
+struct Elf_Dedup_Index
+{
+	const unsigned char* map;	// The whole file
+	size_t mapSize;				// Bytes in map
+	const struct Elf_Dedup_Entry* entries;	// Sorted by hash, region, size, then file
+	uint64_t numEntries;		// Number of entries
+	const uint64_t* buckets;	// First entry of each bucket, plus numEntries at the end
+	uint32_t bucketBits;		// log2 of the number of buckets
+	const uint64_t* pathOffsets;	// Offset of each file's path into paths
+	uint64_t numFiles;			// Number of files
+	const char* paths;			// nul-terminated paths back to back
+	uint64_t pathsSize;			// Bytes in paths
+	const char* regions;		// nul-terminated region names back to back
+	uint64_t regionsSize;		// Bytes in regions
+	uint32_t numRegions;		// Number of region names
+};
+
+
+// Purpose:	Start building an index
+// Input:
+//			indexName - Index file to write
+//			runEntries - Entries held in memory before a run is spilled (0 for DEDUP_RUN_ENTRIES)
+// Output:	A new builder, NULL on error (check errno)
+// Note:	Temporary files are created next to indexName
+struct Elf_Dedup_Builder* create_dedup_builder(const char* indexName, size_t runEntries);
+
+// Purpose:	Add every hashed region of one file
+// Input:
+//			builder - Builder from create_dedup_builder()
+//			fileName - Path of the file
+//			digestList - Digests with DIGEST_XXH64 (see: digest_elf_contents())
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			Thread-safe
+//			Empty regions and unnamed sections are skipped.  They'd only group unrelated files.
+//			Any error fails finish_dedup_builder() so an incomplete index never replaces indexName
+int add_dedup_file(struct Elf_Dedup_Builder* builder, const char* fileName, const struct Elf_Digest_List* digestList);
+
+// Purpose:	Merge the runs, write the index, and release the builder
+// Input:	builder - Pointer to a builder pointer from create_dedup_builder()
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			The index is written to a temporary file and renamed over indexName
+//			Modifies the builder pointer by making it NULL
+int finish_dedup_builder(struct Elf_Dedup_Builder** builder);
+
+// Purpose:	Map an index
+// Input:
+//			index [out] - Index to set up
+//			indexName - Index file from finish_dedup_builder()
+// Output:	ERROR_* as specified in Elf_Details.h (check errno on ERROR_BAD_ARG)
+// Note:	Every table is bounds checked here so queries don't have to be
+int open_dedup_index(struct Elf_Dedup_Index* index, const char* indexName);
+
+// Purpose:	Find every file with a region of a given hash
+// Input:
+//			index - Index from open_dedup_index()
+//			regionName - Region to look in (e.g., ".text")
+//			hash - XXH64 of the region
+//			first [out] - Index into index->entries of the first match
+//			count [out] - Number of matches (0 if none)
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	One bucket lookup and a binary search of the mapped entries
+int find_dedup_hash(const struct Elf_Dedup_Index* index, const char* regionName, uint64_t hash, \
+	                size_t* first, size_t* count);
+
+// Purpose:	Find the next group of entries that share a hash, region, and size
+// Input:
+//			index - Index from open_dedup_index()
+//			cursor - Entry to start from (0 to start).  Moved past the group.
+//			first [out] - Index into index->entries of the group
+//			count [out] - Number of entries in the group (at least 2)
+// Output:
+//			ERROR_SUCCESS on success
+//			DEDUP_END if there are no more groups
+//			ERROR_* as specified in Elf_Details.h on error
+int next_dedup_group(const struct Elf_Dedup_Index* index, size_t* cursor, size_t* first, size_t* count);
+
+// Purpose:	Translate a file ID
+// Input:
+//			index - Index from open_dedup_index()
+//			fileId - Elf_Dedup_Entry.fileId
+// Output:	The path, NULL if fileId is invalid
+const char* get_dedup_file(const struct Elf_Dedup_Index* index, uint32_t fileId);
+
+// Purpose:	Translate a region ID
+// Input:
+//			index - Index from open_dedup_index()
+//			regionId - Elf_Dedup_Entry.regionId
+// Output:	The region name, NULL if regionId is invalid
+const char* get_dedup_region(const struct Elf_Dedup_Index* index, uint32_t regionId);
+
+// Purpose:	Release an index
+// Input:	index - Index from open_dedup_index()
+// Output:	ERROR_* as specified in Elf_Details.h
+int close_dedup_index(struct Elf_Dedup_Index* index);
+
+#endif // __ELF_DEDUP_H__
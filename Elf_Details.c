@@ -1,29 +1,405 @@
 #include "Elf_Details.h"
+#include "Elf_Arena.h"
+#include "Elf_Decode.h"
+#include "Elf_Output.h"
 #include "Harklehash.h"
 #include <assert.h>
+#include <fcntl.h>		// open()
 #include <inttypes.h>	// Print uint64_t variables
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>	// mmap()/munmap()
+#include <sys/stat.h>	// fstat()
+#include <unistd.h>		// close()
 
 // #define SUPER_STR_ME(str) #str
 // #define EXTRA_STR_ME(str) SUPER_STR_ME(str)
 // #define STR_ME(str) EXTRA_STR_ME(str)
 
+/* LOCAL VARIABLES */
+static int zeroizePolicy = ZEROIZE_POLICY;	// See: set_zeroize_policy()
+
+/* LOCAL FUNCTIONS */
+static int release_mem(void** buff, size_t numElem, size_t sizeElem, int sensitive);
+static int parse_prgrm_headers(struct Elf_Details* elven_struct, const unsigned char* elven_buffer, size_t elven_size);
+static int parse_sectn_headers(struct Elf_Details* elven_struct, const unsigned char* elven_buffer, size_t elven_size);
+static struct Elf_Details* new_elf_details(char* elvenFilename, struct Elf_Arena* arena, struct Elf_Context* context);
+static struct Elf_Details* read_elf_into(char* elvenFilename, struct Elf_Arena* arena, struct Elf_Context* context);
+static struct Elf_Details* read_elf_mapped_into(char* elvenFilename, struct Elf_Arena* arena, struct Elf_Context* context);
+static struct Elf_Details* read_elf_header_into(char* elvenFilename, struct Elf_Arena* arena, struct Elf_Context* context);
+
+
 // Purpose: Open and parse an ELF file.  Allocate, configure and return Elf_Details pointer.
 // Input:	Filename, relative or absolute, to an ELF file
 // Output:	A dynamically allocated Elf_Details struct that contains information about elvenFilename
 // Note:	
 //			It is caller's responsibility to free the return value from this function (and all char* within)
 //			This function does all the prep work.  The actual parsing work is done by parse_elf()
+//			The file contents are retained in the struct (elfGuts/elfSize) so section names can
+//				be resolved later (see: get_section_name())
 struct Elf_Details* read_elf(char* elvenFilename)
+{
+	return read_elf_into(elvenFilename, NULL, NULL);
+}
+
+
+// Purpose: Map an ELF file read-only and parse it in place.  Allocate, configure and return Elf_Details pointer.
+// Input:	Filename, relative or absolute, to an ELF file
+// Output:	A dynamically allocated Elf_Details struct that contains information about elvenFilename
+// Note:	
+//			It is caller's responsibility to free the return value from this function by calling
+//				kill_elf_mapped()
+//			The mapping is retained in the struct (elfGuts/elfSize) so only the pages parse_elf()
+//				actually touches are ever read from disk
+//			Falls back to read_elf() if elvenFilename can not be mapped (e.g., pipes, empty files)
+struct Elf_Details* read_elf_mapped(char* elvenFilename)
+{
+	return read_elf_mapped_into(elvenFilename, NULL, NULL);
+}
+
+
+// Purpose: Read only the ELF header of a file.  Allocate, configure and return Elf_Details pointer.
+// Input:	Filename, relative or absolute, to an ELF file
+// Output:	A dynamically allocated Elf_Details struct with only the ELF header members populated
+// Note:	
+//			It is caller's responsibility to free the return value from this function by calling
+//				kill_elf()
+//			Performs one positioned read of ELF_H_SIZE_64 bytes (which covers the ELF_H_SIZE_32
+//				bytes of an ELFCLASS32 header) regardless of the size of the file
+struct Elf_Details* read_elf_header(char* elvenFilename)
+{
+	return read_elf_header_into(elvenFilename, NULL, NULL);
+}
+
+
+// Purpose: Parse an ELF file into an Elf_Details struct that lives in its own arena
+// Input:
+//			elvenFilename - Filename, relative or absolute, to an ELF file
+//			headerOnly - If TRUE, behave like read_elf_header().  Otherwise, read_elf_mapped().
+// Output:	An arena-backed Elf_Details struct that contains information about elvenFilename
+// Note:	
+//			The struct and every buffer it owns come from one Elf_Arena (see: struct->arena)
+//			kill_elf() (or kill_elf_mapped()) releases all of it in one operation
+struct Elf_Details* read_elf_arena(char* elvenFilename, int headerOnly)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Details* retVal = NULL;	// Struct to be allocated, initialized and returned
+	struct Elf_Arena* elfArena = NULL;	// Arena that will own retVal
+
+	/* INPUT VALIDATION */
+	if (!elvenFilename)
+	{
+		return retVal;
+	}
+
+	/* ALLOCATE ARENA */
+	elfArena = create_arena(ARENA_BLOCK_SIZE);
+	if (!elfArena)
+	{
+		PERROR(errno);
+		return retVal;
+	}
+
+	/* READ ELF FILE */
+	if (headerOnly == TRUE)
+	{
+		retVal = read_elf_header_into(elvenFilename, elfArena, NULL);
+	}
+	else
+	{
+		retVal = read_elf_mapped_into(elvenFilename, elfArena, NULL);
+	}
+
+	/* CLEAN UP */
+	if (!retVal)
+	{
+		destroy_arena(&elfArena);
+	}
+
+	return retVal;
+}
+
+
+// Purpose: Reentrant read_elf_arena()
+// Input:
+//			context - Caller-owned context (see: init_elf_context())
+//			elvenFilename - Filename, relative or absolute, to an ELF file
+//			elven_out [out] - Parsed struct
+// Output:	ERROR_* as specified in Elf_Details.h (also stored in context->status)
+// Note:	
+//			Nothing here touches shared state so each thread only needs its own context
+//			*elven_out is set whenever the ELF Header was parsed, even if a table it points to was
+//				rejected (e.g., ERROR_BAD_OFFSET).  Otherwise it is NULL.
+int read_elf_ctx(struct Elf_Context* context, char* elvenFilename, struct Elf_Details** elven_out)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Details* elvenStruct = NULL;	// Struct read from elvenFilename
+	struct Elf_Arena* elfArena = NULL;		// Arena that will own elvenStruct
+
+	/* INPUT VALIDATION */
+	if (!context)
+	{
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
+	clear_elf_context(context);
+	if (!elvenFilename || !elven_out)
+	{
+		retVal = ERROR_NULL_PTR;
+		context->status = retVal;
+		return retVal;
+	}
+	*elven_out = NULL;
+
+	/* CHOOSE AN ARENA */
+	if (context->arena)
+	{
+		elfArena = context->arena;
+	}
+	else
+	{
+		elfArena = create_arena(ARENA_BLOCK_SIZE);
+		if (!elfArena)
+		{
+			record_elf_errno(context, errno, elvenFilename);
+			retVal = ERROR_NULL_PTR;
+			context->status = retVal;
+			return retVal;
+		}
+	}
+
+	/* READ ELF FILE */
+	// The *_into() functions store the parse status in context->status
+	if (context->headerOnly == TRUE)
+	{
+		elvenStruct = read_elf_header_into(elvenFilename, elfArena, context);
+	}
+	else
+	{
+		elvenStruct = read_elf_mapped_into(elvenFilename, elfArena, context);
+	}
+	errno = 0;	// Recorded in context->errnum, so don't let it leak into later PERROR()s
+
+	/* SORT OUT THE STATUS */
+	if (!elvenStruct)
+	{
+		// Nothing was read (or nothing could be allocated)
+		if (context->errnum)
+		{
+			retVal = ERROR_BAD_ARG;
+		}
+		else
+		{
+			retVal = ERROR_NULL_PTR;
+		}
+		if (!context->arena)
+		{
+			destroy_arena(&elfArena);
+		}
+	}
+	else
+	{
+		elvenStruct->arenaShared = context->arena ? TRUE : FALSE;
+		retVal = context->status;
+		// Without decoders there's no ELF Header worth handing back
+		if (!elvenStruct->decoders)
+		{
+			if (retVal == ERROR_SUCCESS)
+			{
+				retVal = ERROR_ORC_FILE;
+			}
+			// Takes a private arena with it
+			kill_elf_mapped(&elvenStruct);
+		}
+	}
+
+	/* DONE */
+	*elven_out = elvenStruct;
+	context->status = retVal;
+
+	return retVal;
+}
+
+
+// Purpose:	Reentrant parse_elf_buffer()
+// Input:
+//			context - Caller-owned context (see: init_elf_context())
+//			elven_struct - Struct to store elven details
+//			elven_buffer - ELF file contents
+//			elven_size - Number of bytes in elven_buffer
+// Output:	ERROR_* as specified in Elf_Details.h (also stored in context->status)
+// Note:	Leaves elven_struct->context pointing at context for later diagnostics
+int parse_elf_buffer_ctx(struct Elf_Context* context, struct Elf_Details* elven_struct, \
+	const unsigned char* elven_buffer, size_t elven_size)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+
+	/* INPUT VALIDATION */
+	if (!context)
+	{
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
+	clear_elf_context(context);
+	if (!elven_struct)
+	{
+		retVal = ERROR_NULL_PTR;
+		context->status = retVal;
+		return retVal;
+	}
+
+	/* PARSE IT */
+	elven_struct->context = context;
+	retVal = parse_elf_buffer(elven_struct, elven_buffer, elven_size);
+	context->status = retVal;
+
+	return retVal;
+}
+
+
+// Purpose:	Allocate memory on behalf of an Elf_Details struct
+// Input:
+//			elven_struct - Struct that will own the memory
+//			numElem - Number of elements to allocate
+//			sizeElem - Size of each element
+// Output:	Pointer to zeroized memory, NULL on failure
+// Note:	
+//			Comes out of elven_struct->arena if it has one, otherwise gimme_mem()
+//			Release it with elf_take_mem_back() (or kill_elf())
+void* elf_gimme_mem(struct Elf_Details* elven_struct, size_t numElem, size_t sizeElem)
+{
+	void* retVal = NULL;
+
+	if (elven_struct && elven_struct->arena)
+	{
+		retVal = arena_gimme_mem(elven_struct->arena, numElem, sizeElem);
+	}
+	else
+	{
+		retVal = gimme_mem(numElem, sizeElem);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Release memory allocated by elf_gimme_mem()
+// Input:
+//			elven_struct - Struct that owns the memory
+//			buff - Pointer to a buffer pointer
+//			numElem - The number of things in *buff
+//			sizeElem - The size of each thing in *buff
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Arena memory is only NULL'd here.  It is released with the rest of the arena.
+//			Modifies the pointer to *buf by making it NULL
+int elf_take_mem_back(struct Elf_Details* elven_struct, void** buff, size_t numElem, size_t sizeElem)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (elven_struct && elven_struct->arena)
+	{
+		if (!buff || !(*buff))
+		{
+			retVal = ERROR_NULL_PTR;
+		}
+		else
+		{
+			*buff = NULL;
+		}
+	}
+	else
+	{
+		retVal = take_mem_back(buff, numElem, sizeElem);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Allocate an Elf_Details struct and copy the filename into it
+// Input:
+//			elvenFilename - Filename to store in the struct
+//			arena - Arena to allocate the struct from (NULL for gimme_mem())
+//			context - Optional.  Where diagnostics go (see: Elf_Context.h).
+// Output:	A newly allocated Elf_Details struct, NULL on failure
+static struct Elf_Details* new_elf_details(char* elvenFilename, struct Elf_Arena* arena, struct Elf_Context* context)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Details* retVal = NULL;	// Struct to be allocated, initialized and returned
+	char* tmpPtr = NULL;				// Holds return value from strncpy()
+
+	/* ALLOCATE STRUCT MEMORY */
+	if (arena)
+	{
+		retVal = (struct Elf_Details*)arena_gimme_mem(arena, 1, sizeof(struct Elf_Details));
+	}
+	else
+	{
+		retVal = (struct Elf_Details*)gimme_mem(1, sizeof(struct Elf_Details));
+	}
+
+	if (!retVal)
+	{
+		PERROR(errno);
+		return retVal;
+	}
+	else  // Set struct bigEndian member to something other than 0
+	{
+		retVal->arena = arena;
+		retVal->context = context;
+		// We don't want the program mistakenly thinking the architecture is little Endian
+		//	by default
+		if (ZEROIZE_VALUE != TRUE && ZEROIZE_VALUE != FALSE)
+		{
+			retVal->bigEndian = ZEROIZE_VALUE;
+		}
+		else
+		{
+			retVal->bigEndian = -1;
+		}
+	}
+
+	/* COPY FILENAME */
+	// Allocate Filename
+	retVal->fileName = elf_gimme_mem(retVal, strlen(elvenFilename) + 1, sizeof(char));
+	// Copy Filename
+	if (retVal->fileName)
+	{
+		tmpPtr = strncpy(retVal->fileName, elvenFilename, strlen(elvenFilename));
+		if(tmpPtr != retVal->fileName)
+		{
+			PERROR(errno);
+			report_elf_error(context, "ERROR: strncpy of filename into Elf_Details struct failed!");
+		}
+		else
+		{
+#ifdef DEBUGLEROAD
+			puts(retVal->fileName);  // DEBUGGING
+#endif // DEBUGLEROAD
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose: Implements read_elf() with an optional arena
+// Input:
+//			elvenFilename - Filename, relative or absolute, to an ELF file
+//			arena - Arena to allocate the struct from (NULL for gimme_mem())
+//			context - Optional.  Where diagnostics and the parse status go (see: Elf_Context.h).
+// Output:	An Elf_Details struct that contains information about elvenFilename
+static struct Elf_Details* read_elf_into(char* elvenFilename, struct Elf_Arena* arena, struct Elf_Context* context)
 {
 	/* LOCAL VARIABLES */
 	struct Elf_Details* retVal = NULL;	// Struct to be allocated, initialized and returned
 	FILE* elfFile = NULL;				// File pointer of elvenFilename
 	size_t elfSize = 0;					// Size of the file in bytes
 	char* elfGuts = NULL;				// Holds contents of binary file
-	char* tmpPtr = NULL;				// Holds return value from strstr()/strncpy()
 	int tmpRetVal = 0;					// Holds return value from parse_elf()
 
 	/* INPUT VALIDATION */
@@ -39,105 +415,226 @@ struct Elf_Details* read_elf(char* elvenFilename)
 
 	if (elfFile)
 	{
-		// GET FILE SIZE
-		elfSize = file_len(elfFile);
-		PERROR(errno);  // DEBUGGING
-
-		// ALLOCATE BUFFER
-		elfGuts = (char*)gimme_mem(elfSize + 1, sizeof(char));
-		PERROR(errno);  // DEBUGGING
+		// READ FILE
+		// Sized from file metadata when possible so the file is only read once
+		elfGuts = read_file_guts(elfFile, &elfSize);
+		// CLOSE ELF FILE
+		fclose(elfFile);
+		elfFile = NULL;
 
-		if (elfGuts)
+		if (!elfGuts)
 		{
-			// READ FILE
-			if (fread(elfGuts, sizeof(char), elfSize, elfFile) != elfSize)
+			if (context)
 			{
-				PERROR(errno);  // DEBUGGING
-				take_mem_back((void**)&elfGuts, strlen(elfGuts), sizeof(char));
-				// memset(elfGuts, 0, elfSize);
-				// free(elfGuts);
-				// elfGuts = NULL;
-				fclose(elfFile);
-				elfFile = NULL;
-				return retVal;
+				record_elf_errno(context, errno, elvenFilename);
 			}
 			else
 			{
+				PERROR(errno);  // DEBUGGING
+			}
+			return retVal;
+		}
+		else
+		{
 #ifdef DEBUGLEROAD
-				print_it(elfGuts, elfSize);  // DEBUGGING
+			print_it(elfGuts, elfSize);  // DEBUGGING
 #endif // DEBUGLEROAD
-			}			
 		}
 	}
 	else
 	{
-		PERROR(errno);  // DEBUGGING
+		if (context)
+		{
+			record_elf_errno(context, errno, elvenFilename);
+		}
+		else
+		{
+			PERROR(errno);  // DEBUGGING
+		}
 		return retVal;
 	}
 
 	/* ALLOCATE STRUCT MEMORY */
-	retVal = (struct Elf_Details*)gimme_mem(1, sizeof(struct Elf_Details));
-	if (!retVal)
+	retVal = new_elf_details(elvenFilename, arena, context);
+
+	/* PARSE ELF GUTS INTO STRUCT */
+	if (retVal)
 	{
-		PERROR(errno);
-		take_mem_back((void**)&elfGuts, elfSize, sizeof(char));
+		// Retained so section names can be resolved later.  Released by kill_elf().
+		retVal->elfGuts = elfGuts;
+		retVal->elfSize = elfSize;
+		retVal->gutsMapped = FALSE;
+		elfGuts = NULL;
+		tmpRetVal = parse_elf_buffer(retVal, (unsigned char*)retVal->elfGuts, retVal->elfSize);
+		if (context)
+		{
+			context->status = tmpRetVal;
+		}
+	}
+
+	/* FINAL CLEAN UP */
+	if (elfGuts)
+	{
+		// File contents are the only sensitive buffers (see: ZEROIZE_SENSITIVE)
+		take_sensitive_mem_back((void**)&elfGuts, elfSize + 1, sizeof(char));
 		// memset(elfGuts, 0, elfSize);
 		// free(elfGuts);
 		// elfGuts = NULL;
-		fclose(elfFile);
-		elfFile = NULL;
+	}
+
+	return retVal;
+}
+
+
+// Purpose: Implements read_elf_mapped() with an optional arena
+// Input:
+//			elvenFilename - Filename, relative or absolute, to an ELF file
+//			arena - Arena to allocate the struct from (NULL for gimme_mem())
+//			context - Optional.  Where diagnostics and the parse status go (see: Elf_Context.h).
+// Output:	An Elf_Details struct that contains information about elvenFilename
+static struct Elf_Details* read_elf_mapped_into(char* elvenFilename, struct Elf_Arena* arena, struct Elf_Context* context)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Details* retVal = NULL;	// Struct to be allocated, initialized and returned
+	int elfFd = -1;						// File descriptor of elvenFilename
+	struct stat elfStat;				// Holds the size of elvenFilename
+	void* elfGuts = MAP_FAILED;			// Read-only mapping of the binary file
+	size_t elfSize = 0;					// Size of the file in bytes
+	int tmpRetVal = 0;					// Holds return value from parse_elf()
+
+	/* INPUT VALIDATION */
+	if (!elvenFilename)
+	{
+		PERROR(errno);
 		return retVal;
 	}
-	else  // Set struct bigEndian member to something other than 0
+
+	/* MAP ELF FILE */
+	// OPEN FILE
+	elfFd = open(elvenFilename, O_RDONLY);
+	if (elfFd < 0)
 	{
-		// We don't want the program mistakenly thinking the architecture is little Endian
-		//	by default
-		if (ZEROIZE_VALUE != TRUE && ZEROIZE_VALUE != FALSE)
+		if (context)
 		{
-			retVal->bigEndian = ZEROIZE_VALUE;
+			record_elf_errno(context, errno, elvenFilename);
 		}
 		else
 		{
-			retVal->bigEndian = -1;
+			PERROR(errno);  // DEBUGGING
 		}
+		return retVal;
 	}
 
-	/* CLOSE ELF FILE */
-	if (elfFile)
+	// GET FILE SIZE
+	if (fstat(elfFd, &elfStat) || !S_ISREG(elfStat.st_mode) || elfStat.st_size < 1)
 	{
-		fclose(elfFile);
-		elfFile = NULL;
+		// Only non-empty regular files can be mapped.  Let read_elf() deal with the rest.
+		close(elfFd);
+		return read_elf_into(elvenFilename, arena, context);
+	}
+	elfSize = (size_t)elfStat.st_size;
+
+	// MAP FILE
+	elfGuts = mmap(NULL, elfSize, PROT_READ, MAP_PRIVATE, elfFd, 0);
+	// The mapping holds its own reference to the file
+	close(elfFd);
+	elfFd = -1;
+	if (elfGuts == MAP_FAILED)
+	{
+		// Not fatal, read_elf_into() gets another shot at it
+		if (!context)
+		{
+			PERROR(errno);  // DEBUGGING
+		}
+		return read_elf_into(elvenFilename, arena, context);
+	}
+
+	/* ALLOCATE STRUCT MEMORY */
+	retVal = new_elf_details(elvenFilename, arena, context);
+	if (!retVal)
+	{
+		munmap(elfGuts, elfSize);
+		return retVal;
+	}
+	retVal->elfGuts = (char*)elfGuts;
+	retVal->elfSize = elfSize;
+	retVal->gutsMapped = TRUE;
+
+	/* PARSE ELF GUTS INTO STRUCT */
+	tmpRetVal = parse_elf_buffer(retVal, (unsigned char*)retVal->elfGuts, retVal->elfSize);
+	if (context)
+	{
+		context->status = tmpRetVal;
+	}
+
+	return retVal;
+}
+
+
+// Purpose: Implements read_elf_header() with an optional arena
+// Input:
+//			elvenFilename - Filename, relative or absolute, to an ELF file
+//			arena - Arena to allocate the struct from (NULL for gimme_mem())
+//			context - Optional.  Where diagnostics and the parse status go (see: Elf_Context.h).
+// Output:	An Elf_Details struct with only the ELF header members populated
+static struct Elf_Details* read_elf_header_into(char* elvenFilename, struct Elf_Arena* arena, struct Elf_Context* context)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Details* retVal = NULL;		// Struct to be allocated, initialized and returned
+	int elfFd = -1;							// File descriptor of elvenFilename
+	char elfHdr[ELF_H_SIZE_64 + 1] = { 0 };	// Holds the ELF header (plus a nul terminator)
+	ssize_t numRead = 0;					// Number of bytes pread() returned
+	int tmpRetVal = 0;						// Holds return value from parse_elf()
+
+	/* INPUT VALIDATION */
+	if (!elvenFilename)
+	{
+		PERROR(errno);
+		return retVal;
+	}
+
+	/* READ ELF HEADER */
+	elfFd = open(elvenFilename, O_RDONLY);
+	if (elfFd < 0)
+	{
+		if (context)
+		{
+			record_elf_errno(context, errno, elvenFilename);
+		}
+		else
+		{
+			PERROR(errno);  // DEBUGGING
+		}
+		return retVal;
 	}
-
-	/* PARSE ELF GUTS INTO STRUCT */
-	// Allocate Filename
-	retVal->fileName = gimme_mem(strlen(elvenFilename) + 1, sizeof(char));
-	// Copy Filename
-	if (retVal->fileName)
+	numRead = pread(elfFd, elfHdr, ELF_H_SIZE_64, 0);
+	close(elfFd);
+	elfFd = -1;
+	if (numRead < 0)
 	{
-		tmpPtr = strncpy(retVal->fileName, elvenFilename, strlen(elvenFilename));
-		if(tmpPtr != retVal->fileName)
+		if (context)
 		{
-			PERROR(errno);
-			fprintf(stderr, "ERROR: strncpy of filename into Elf_Details struct failed!\n");
+			record_elf_errno(context, errno, elvenFilename);
 		}
 		else
 		{
-#ifdef DEBUGLEROAD
-			puts(retVal->fileName);  // DEBUGGING
-#endif // DEBUGLEROAD
+			PERROR(errno);  // DEBUGGING
 		}
+		return retVal;
 	}
-	// Initialize Remaining Struct Members
-	tmpRetVal = parse_elf(retVal, elfGuts);
+	// A short read leaves the remainder of elfHdr zeroized
 
-	/* FINAL CLEAN UP */
-	if (elfGuts)
+	/* ALLOCATE STRUCT MEMORY */
+	retVal = new_elf_details(elvenFilename, arena, context);
+
+	/* PARSE ELF HEADER INTO STRUCT */
+	if (retVal)
 	{
-		take_mem_back((void**)&elfGuts, elfSize + 1, sizeof(char));
-		// memset(elfGuts, 0, elfSize);
-		// free(elfGuts);
-		// elfGuts = NULL;
+		tmpRetVal = parse_elf_buffer(retVal, (unsigned char*)elfHdr, (size_t)numRead);
+		if (context)
+		{
+			context->status = tmpRetVal;
+		}
 	}
 
 	return retVal;
@@ -149,74 +646,114 @@ struct Elf_Details* read_elf(char* elvenFilename)
 //			elven_struct - Struct to store elven details
 //			elven_contents - ELF file contents
 // Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Wrapper around parse_elf_buffer().  Prefer calling that directly.
+//			If elven_struct->elfSize is non-zero it is taken as the number of bytes in
+//				elven_contents.  Otherwise, elven_contents is assumed to hold at least
+//				a whole ELF Header if it starts with the magic number.
 int parse_elf(struct Elf_Details* elven_struct, char* elven_contents)
 {
 	/* LOCAL VARIABLES */
 	int retVal = ERROR_SUCCESS;	// parse_elf() return value
-	char* tmpPtr = NULL;		// Holds return values from string functions
+	size_t elvenSize = 0;		// Number of bytes in elven_contents
+	size_t i = 0;				// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!elven_struct || !elven_contents)
+	{
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
+
+	/* DETERMINE THE LENGTH */
+	if (elven_struct->elfSize > 0)
+	{
+		elvenSize = elven_struct->elfSize;
+	}
+	else
+	{
+		// Compare one character at a time so a short string stops at its nul terminator
+		for (i = 0; i < strlen(ELF_H_MAGIC_NUM); i++)
+		{
+			if (elven_contents[i] != ELF_H_MAGIC_NUM[i])
+			{
+				retVal = ERROR_ORC_FILE;
+				return retVal;
+			}
+		}
+		elvenSize = ELF_H_SIZE_64;
+	}
+
+	/* PARSE IT */
+	retVal = parse_elf_buffer(elven_struct, (const unsigned char*)elven_contents, elvenSize);
+
+	return retVal;
+}
+
+
+// Purpose:	Parse an ELF file contents into an Elf_Details struct
+// Input:
+//			elven_struct - Struct to store elven details
+//			elven_buffer - ELF file contents
+//			elven_size - Number of bytes in elven_buffer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			The magic number is a fixed four byte compare at offset 0 so non-ELF input is
+//				rejected in constant time
+//			Every read is bounds checked against elven_size.  elven_buffer does not need to be
+//				nul terminated.
+int parse_elf_buffer(struct Elf_Details* elven_struct, const unsigned char* elven_buffer, size_t elven_size)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;	// parse_elf_buffer() return value
+	char* elven_contents = (char*)elven_buffer;	// convert_char_to_*() speak char*
 	int tmpInt = 0;				// Holds various temporary return values
-	unsigned int tmpUint = 0;	// Holds calculated values from convert_char_to_int()
-	uint32_t tmpUint32 = 0;		// Holds memory addresses on a 32-bit system
 	uint64_t tmpUint64 = 0;		// Holds memory addresses on a 64-bit system
 	int dataOffset = 0;			// Used to offset into elven_contents
 	// char* tmpBuff = NULL;		// Temporary buffer used to assist in slicing up elven_contents
-	struct HarkleDict* elfHdrClassDict = NULL;
-	struct HarkleDict* elfHdrEndianDict = NULL;
-	struct HarkleDict* elfHdrTargetOSDict = NULL;
-	struct HarkleDict* elfHdrElfTypeDict = NULL;
-	struct HarkleDict* elfHdrISADict = NULL;
-	struct HarkleDict* elfHdrObjVerDict = NULL;
-	struct HarkleDict* tmpNode = NULL;	// Holds return values from lookup_* functions
+	const char* tmpName = NULL;	// Holds return values from get_elf_header_*_name() functions
+	struct Elf_Hdr_Record hdrRecord;	// Decoded ELF Header fields
 
 	/* INPUT VALIDATION */
-	if (!elven_struct || !elven_contents)
+	if (!elven_struct || !elven_buffer)
 	{
 		retVal = ERROR_NULL_PTR;
 		return retVal;
 	}
-	else if (strlen(elven_contents) == 0)
+	else if (elven_size < strlen(ELF_H_MAGIC_NUM))
 	{
 		retVal = ERROR_ORC_FILE;
 		return retVal;
 	}
 
 	/* PARSE ELF FILE CONTENTS */
-	// 1. Find the beginning of the ELF Header (OFFSET: 0x00)
-	tmpPtr = strstr(elven_contents, ELF_H_MAGIC_NUM);
-	// printf("elven_contents:\t%p\nMagic Num:\t%p\n", elven_contents, tmpPtr);  // DEBUGGING
-	if (tmpPtr != elven_contents)
+	// 1. Verify the ELF Header starts at the beginning (OFFSET: 0x00)
+	// Fixed size compare so non-ELF files are rejected without scanning them
+	if (memcmp(elven_buffer, ELF_H_MAGIC_NUM, strlen(ELF_H_MAGIC_NUM)))
 	{
-		PERROR(errno);
-		// fprintf(stderr, "This is not an ELF formatted file.\nStart:\t%p\n%s:\t%p\n", elven_contents, ELF_H_MAGIC_NUM, tmpPtr);
 		retVal = ERROR_ORC_FILE;
 		return retVal;
 	}
 	else
 	{
-		elven_struct->magicNum = gimme_mem(strlen(ELF_H_MAGIC_NUM), sizeof(char));
-		if (elven_struct->magicNum)
-		{
-			if (strncpy(elven_struct->magicNum, elven_contents, 4) != elven_struct->magicNum)
-			{
-				fprintf(stderr, "Error copying into Elf Struct magicNum!\n");
-			}
-		}
-		else
-		{
-			fprintf(stderr, "Error allocating memory for Elf Struct magicNum!\n");
-		}
+		// Points at the static magic number it just matched
+		elven_struct->magicNum = ELF_H_MAGIC_NUM;
 	}
 
-	/* PREPARE DYNAMICALLY ALLOCATED VARIABLES */
-	// Peformed here to avoid memory leak if elven_contents turns out to be an ORC File
-	// tmpBuff = gimme_mem(strlen(elven_contents) + 1, sizeof(char));
-	elfHdrClassDict = init_elf_header_class_dict();
-	elfHdrEndianDict = init_elf_header_endian_dict();
-	elfHdrTargetOSDict = init_elf_header_targetOS_dict();
-	elfHdrElfTypeDict = init_elf_header_elf_type_dict();
-	elfHdrISADict = init_elf_header_isa_dict();
-	elfHdrObjVerDict = init_elf_header_obj_version_dict();
+	/* BOUNDS CHECK */
+	// Every ELF header field read below lives inside the first ELF_H_SIZE_32 (or ELF_H_SIZE_64)
+	//	bytes so this one check covers all of them
+	if (elven_size < ELF_H_SIZE_32 \
+		|| (elven_buffer[4] == ELF_H_CLASS_64 && elven_size < ELF_H_SIZE_64))
+	{
+		report_elf_error(elven_struct->context, "ELF Header truncated at %zu bytes!", elven_size);
+		retVal = ERROR_BAD_OFFSET;
+		return retVal;
+	}
 
+	/* LOOKUP TABLES */
+	// Names come from static tables (see: get_elf_header_*_name()) so no HarkleDicts are
+	//	built or destroyed here
 	// 2. Begin initializing the struct
 
 	// 2.1. Filename should already be initialized in calling function
@@ -229,49 +766,28 @@ int parse_elf(struct Elf_Details* elven_struct, char* elven_contents)
 	// fprintf(stdout, "tmpBuff now holds:\t%c (%d)\n", *tmpBuff, *tmpBuff);  // DEBUGGING
 	// tmpInt = atoi(tmpBuff);  // THIS DOESN'T WORK!
 	// tmpInt = (int)tmpBuff[0];  // Better way to do this?
-	tmpInt = (int)(*(elven_contents + dataOffset));
+	tmpInt = (int)(*(elven_buffer + dataOffset));
 	// fprintf(stdout, "tmpInt now holds:\t%d\n", tmpInt);  // DEBUGGING
-	tmpNode = lookup_value(elfHdrClassDict, tmpInt);
-	if (tmpNode)  // Found it
+	// Every get_elf_header_*_name() below points into static storage so there's nothing to allocate (or free)
+	tmpName = get_elf_header_class_name(tmpInt);
+	if (tmpName)  // Found it
 	{
 		elven_struct->processorType = tmpInt;	// Set the processor type
-		// fprintf(stdout, "tmpNode->name:\t%s\n", tmpNode->name);  // DEBUGGING
-		elven_struct->elfClass = gimme_mem(strlen(tmpNode->name) + 1, sizeof(char));
-		if (elven_struct->elfClass)
-		{
-			if (strncpy(elven_struct->elfClass, tmpNode->name, strlen(tmpNode->name)) != elven_struct->elfClass)
-			{
-				fprintf(stderr, "ELF Class string '%s' not copied into ELF Struct!\n", tmpNode->name);
-			}
-			else
-			{
-#ifdef DEBUGLEROAD
-				fprintf(stdout, "Successfully copied '%s' into ELF Struct!\n", elven_struct->elfClass);
-#endif // DEBUGLEROAD
-			}
-		}
-		else
-		{
-			fprintf(stderr, "Error allocating memory for Elf Struct elfClass!\n");
-		}
+		// fprintf(stdout, "tmpName:\t%s\n", tmpName);  // DEBUGGING
+		elven_struct->elfClass = tmpName;
 	}
 	else
 	{
 		elven_struct->processorType = ELF_H_CLASS_NONE;
-		fprintf(stderr, "ELF Class %d not found in HarkleDict!\n", tmpInt);
-	}
-	// Zeroize/Free/NULLify elfHdrClassDict
-	if (elfHdrClassDict)
-	{
-		tmpInt = destroy_a_list(&elfHdrClassDict);
+		report_elf_error(elven_struct->context, "ELF Class %d not found in lookup table!", tmpInt);
 	}
 
 	// 2.3. Endianness (OFFSET: 0x05)
 	dataOffset += 1;  // 5
-	tmpInt = (int)(*(elven_contents + dataOffset));
+	tmpInt = (int)(*(elven_buffer + dataOffset));
 	// fprintf(stdout, "tmpInt now holds:\t%d\n", tmpInt);  // DEBUGGING
-	tmpNode = lookup_value(elfHdrEndianDict, tmpInt);
-	if (tmpNode)  // Found it
+	tmpName = get_elf_header_endian_name(tmpInt);
+	if (tmpName)  // Found it
 	{
 		// Set endianness bool (bigEndian)
 		if (tmpInt == 2)
@@ -282,99 +798,49 @@ int parse_elf(struct Elf_Details* elven_struct, char* elven_contents)
 		{
 			elven_struct->bigEndian = FALSE;
 		}
-		// fprintf(stdout, "tmpNode->name:\t%s\n", tmpNode->name);  // DEBUGGING
-		elven_struct->endianness = gimme_mem(strlen(tmpNode->name) + 1, sizeof(char));
-		if (elven_struct->endianness)
-		{
-			if (strncpy(elven_struct->endianness, tmpNode->name, strlen(tmpNode->name)) != elven_struct->endianness)
-			{
-				fprintf(stderr, "ELF Endianness string '%s' not copied into ELF Struct!\n", tmpNode->name);
-			}
-			else
-			{
-#ifdef DEBUGLEROAD
-				fprintf(stdout, "Successfully copied '%s' into ELF Struct!\n", elven_struct->endianness);
-#endif // DEBUGLEROAD
-			}
-		}
-		else
-		{
-			fprintf(stderr, "Error allocating memory for Elf Struct Endianness!\n");
-		}
+		// fprintf(stdout, "tmpName:\t%s\n", tmpName);  // DEBUGGING
+		elven_struct->endianness = tmpName;
 	}
 	else
 	{
-		fprintf(stderr, "ELF Endianness %d not found in HarkleDict!\n", tmpInt);
-	}
-	// Zeroize/Free/NULLify elfHdrEndianDict
-	if (elfHdrEndianDict)
-	{
-		tmpInt = destroy_a_list(&elfHdrEndianDict);
+		report_elf_error(elven_struct->context, "ELF Endianness %d not found in lookup table!", tmpInt);
 	}
 
 	// 2.4. ELF Version (OFFSET: 0x06)
 	dataOffset += 1;  // 6
-	elven_struct->elfVersion = (int)(*(elven_contents + dataOffset));
+	elven_struct->elfVersion = (int)(*(elven_buffer + dataOffset));
 	// fprintf(stdout, "elven_struct->elfVersion now holds:\t%d\n", elven_struct->elfVersion);  // DEBUGGING
 
 	// 2.5. Target OS (OFFSET: 0x07)
 	dataOffset += 1;  // 7
-	tmpInt = (int)(*(elven_contents + dataOffset));
+	tmpInt = (int)(*(elven_buffer + dataOffset));
 	// fprintf(stdout, "tmpInt now holds:\t%d\n", tmpInt);  // DEBUGGING
-	tmpNode = lookup_value(elfHdrTargetOSDict, tmpInt);
-	if (tmpNode)  // Found it
+	tmpName = get_elf_header_targetOS_name(tmpInt);
+	if (tmpName)  // Found it
 	{
-		// fprintf(stdout, "tmpNode->name:\t%s\n", tmpNode->name);  // DEBUGGING
-		elven_struct->targetOS = gimme_mem(strlen(tmpNode->name) + 1, sizeof(char));
-		if (elven_struct->targetOS)
-		{
-			if (strncpy(elven_struct->targetOS, tmpNode->name, strlen(tmpNode->name)) != elven_struct->targetOS)
-			{
-				fprintf(stderr, "ELF Target OS string '%s' not copied into ELF Struct!\n", tmpNode->name);
-			}
-			else
-			{
-#ifdef DEBUGLEROAD
-				fprintf(stdout, "Successfully copied '%s' into ELF Struct!\n", elven_struct->targetOS);
-#endif // DEBUGLEROAD
-			}
-		}
-		else
-		{
-			fprintf(stderr, "Error allocating memory for Elf Struct Target OS ABI!\n");
-		}
+		// fprintf(stdout, "tmpName:\t%s\n", tmpName);  // DEBUGGING
+		elven_struct->targetOS = tmpName;
 	}
 	else
 	{
-		fprintf(stderr, "ELF Target OS %d not found in HarkleDict!\n", tmpInt);
-	}
-	// Zeroize/Free/NULLify elfHdrTargetOSDict
-	if (elfHdrTargetOSDict)
-	{
-		tmpInt = destroy_a_list(&elfHdrTargetOSDict);
+		report_elf_error(elven_struct->context, "ELF Target OS %d not found in lookup table!", tmpInt);
 	}
 
-	// 2.6. ABI Version (OFFSET: 0x08) //////////////////////////////////
+	// 2.6. ABI Version (OFFSET: 0x08)
+	// Decoded with the rest of the ELF Header (see: 2.7.)
 	dataOffset += 1;  // 8
-	// elven_struct->ABIversion = (int)(*(elven_contents + dataOffset));  // APPEARS TO BE NON-FUNCTIONAL
-	tmpInt = convert_char_to_int(elven_contents, dataOffset, 1, elven_struct->bigEndian, &tmpUint);
-	if (tmpInt == ERROR_SUCCESS)
-	{
-		elven_struct->ABIversion = tmpUint;
-	}
-	// fprintf(stdout, "elven_struct->ABIversion now holds:\t%d\n", elven_struct->ABIversion);  // DEBUGGING
 
 	// 2.6. Pad (OFFSET: 0x09)
 	// char* pad;			// Unused portion
 	// Not dynamically sized.  Statically sized.  Also, not performing a lookup.  Merely storing
 	//	whatever was found in the Pad.
 	dataOffset += 1;  // 9
-	elven_struct->pad = gimme_mem(0x7 + 0x1, sizeof(char));
+	elven_struct->pad = elf_gimme_mem(elven_struct, 0x7 + 0x1, sizeof(char));
 	if (elven_struct->pad)
 	{
 		if (memcpy(elven_struct->pad, elven_contents + dataOffset, 7) != elven_struct->pad)
 		{
-			fprintf(stderr, "ELF Pad not mem copied into ELF Struct!\n");
+			report_elf_error(elven_struct->context, "ELF Pad not mem copied into ELF Struct!");
 		}
 		else
 		{
@@ -385,366 +851,469 @@ int parse_elf(struct Elf_Details* elven_struct, char* elven_contents)
 	}
 	else
 	{
-		fprintf(stderr, "Error allocating memory for Elf Struct Pad!\n");
+		report_elf_error(elven_struct->context, "Error allocating memory for Elf Struct Pad!");
 	}
 
-	// 2.7. Type (OFFSET: 0x10)
-	dataOffset += 7;  // 16
-	tmpInt = convert_char_to_int(elven_contents, dataOffset, 2, elven_struct->bigEndian, &tmpUint);
-	// fprintf(stdout, "tmpInt now holds:\t%d\n", tmpInt);  // DEBUGGING
-	// fprintf(stdout, "tmpUint now holds:\t%u\n", tmpUint);  // DEBUGGING
-	if (tmpInt != ERROR_SUCCESS)
+	// 2.7. Choose decoders (OFFSET: 0x04 and 0x05)
+	// One decoder per class and byte order so none of the fields below branch on either
+	elven_struct->decoders = get_elf_decoders(elven_buffer[4], elven_buffer[5]);
+	if (!elven_struct->decoders)
+	{
+		report_elf_error(elven_struct->context, "ELF Class or Endianness invalid so the rest of the ELF Header was not read!");
+		retVal = ERROR_ORC_FILE;
+		return retVal;
+	}
+	elven_struct->decoders->elf_header(&hdrRecord, elven_buffer);
+	elven_struct->ABIversion = hdrRecord.abiversion;
+
+	// 2.8. Type (OFFSET: 0x10)
+	tmpName = get_elf_header_elf_type_name(hdrRecord.type);
+	if (tmpName)  // Found it
 	{
-		fprintf(stderr, "Failed to convert to an unsigned int.  Error Code:\t%d\n", tmpInt);
-		tmpNode = NULL;
+		elven_struct->type = tmpName;
 	}
 	else
 	{
-		tmpNode = lookup_value(elfHdrElfTypeDict, (int)tmpUint);
+		report_elf_error(elven_struct->context, "ELF Type %d not found in lookup table!", (int)hdrRecord.type);
 	}
-	
-	if (tmpNode)  // Found it
+
+	// 2.9. Instruction Set Architecture (ISA) (OFFSET: 0x12)
+	tmpName = get_elf_header_isa_name(hdrRecord.machine);
+	if (tmpName)  // Found it
 	{
-		// fprintf(stdout, "tmpNode->name:\t%s\n", tmpNode->name);  // DEBUGGING
-		elven_struct->type = gimme_mem(strlen(tmpNode->name) + 1, sizeof(char));
-		if (elven_struct->type)
-		{
-			if (strncpy(elven_struct->type, tmpNode->name, strlen(tmpNode->name)) != elven_struct->type)
-			{
-				fprintf(stderr, "ELF Type string '%s' not copied into ELF Struct!\n", tmpNode->name);
-			}
-			else
-			{
-#ifdef DEBUGLEROAD
-				fprintf(stdout, "Successfully copied '%s' into ELF Struct!\n", elven_struct->type);
-#endif // DEBUGLEROAD
-			}
-		}
-		else
-		{
-			fprintf(stderr, "Error allocating memory for Elf Struct Type!\n");
-		}
+		elven_struct->ISA = tmpName;
 	}
 	else
 	{
-		fprintf(stderr, "ELF Type %d not found in HarkleDict!\n", (int)tmpUint);
+		report_elf_error(elven_struct->context, "ELF ISA %d not found in lookup table!", (int)hdrRecord.machine);
+	}
+
+	// 2.10. Object File Version (OFFSET: 0x14)
+	tmpName = get_elf_header_obj_version_name(hdrRecord.version);
+	if (tmpName)  // Found it
+	{
+		elven_struct->objVersion = tmpName;
 	}
-	// Zeroize/Free/NULLify elfHdrElfTypeDict
-	if (elfHdrElfTypeDict)
+	else
 	{
-		tmpInt = destroy_a_list(&elfHdrElfTypeDict);
+		report_elf_error(elven_struct->context, "ELF Object File Version %d not found in lookup table!", (int)hdrRecord.version);
 	}
 
-	// 2.8. Instruction Set Architecture (ISA) (OFFSET: 0x12)
-	dataOffset += 2;  // 18
-	tmpInt = convert_char_to_int(elven_contents, dataOffset, 2, elven_struct->bigEndian, &tmpUint);
-	// fprintf(stdout, "tmpInt now holds:\t%d\n", tmpInt);  // DEBUGGING
-	// fprintf(stdout, "tmpUint now holds:\t%u\n", tmpUint);  // DEBUGGING
-	if (tmpInt != ERROR_SUCCESS)
+	// 2.11. Entry Point, Program Header Table Offset, Section Header Table Offset
+	// 32-bit Processor
+	if (elven_struct->processorType == ELF_H_CLASS_32)
 	{
-		fprintf(stderr, "Failed to convert to an unsigned int.  Error Code:\t%d\n", tmpInt);
-		tmpNode = NULL;
+		// Decoded from 4 byte fields so these always fit
+		elven_struct->ePnt32 = (uint32_t)hdrRecord.entry;
+		elven_struct->pHdr32 = (uint32_t)hdrRecord.phoff;
+		elven_struct->sHdr32 = (uint32_t)hdrRecord.shoff;
 	}
+	// 64-bit Processor
 	else
 	{
-		tmpNode = lookup_value(elfHdrISADict, (int)tmpUint);
+		elven_struct->ePnt64 = hdrRecord.entry;
+		elven_struct->pHdr64 = hdrRecord.phoff;
+		elven_struct->sHdr64 = hdrRecord.shoff;
 	}
-	
-	if (tmpNode)  // Found it
+
+	// 2.12. ELF Header Flags
+	elven_struct->flags = hdrRecord.flags;
+
+	// 2.13. ELF Header Size
+	elven_struct->elfHdrSize = hdrRecord.ehsize;
+
+	// 2.14. Program Header Size
+	elven_struct->prgmHdrSize = hdrRecord.phentsize;
+
+	// 2.15. Number of Program Header Entries
+	elven_struct->prgmHdrEntrNum = hdrRecord.phnum;
+
+	// 2.16. Section Header Size
+	elven_struct->sectHdrSize = hdrRecord.shentsize;
+
+	// 2.17. Number of Section Header Entries
+	elven_struct->sectHdrEntrNum = hdrRecord.shnum;
+
+	// 2.18. Section Header Index to Entry with Names
+	elven_struct->sectHdrSectNms = hdrRecord.shstrndx;
+
+	// 3. Bounds check the tables the ELF Header points to
+	// Skipped if only the ELF Header was handed over (see: read_elf_header())
+	if (elven_size > ELF_H_SIZE_64)
 	{
-		// fprintf(stdout, "tmpNode->name:\t%s\n", tmpNode->name);  // DEBUGGING
-		elven_struct->ISA = gimme_mem(strlen(tmpNode->name) + 1, sizeof(char));
-		if (elven_struct->ISA)
+		if (elven_struct->processorType == ELF_H_CLASS_32)
 		{
-			if (strncpy(elven_struct->ISA, tmpNode->name, strlen(tmpNode->name)) != elven_struct->ISA)
-			{
-				fprintf(stderr, "ELF ISA string '%s' not copied into ELF Struct!\n", tmpNode->name);
-			}
-			else
+			tmpUint64 = elven_struct->pHdr32;
+		}
+		else
+		{
+			tmpUint64 = elven_struct->pHdr64;
+		}
+		if (tmpUint64 > elven_size || \
+			((uint64_t)elven_struct->prgmHdrSize * elven_struct->prgmHdrEntrNum) > (elven_size - tmpUint64))
+		{
+			report_elf_error(elven_struct->context, "Program Header Table runs past the end of the file!");
+			retVal = ERROR_BAD_OFFSET;
+		}
+		// 4. Decode the Program Header Table
+		else
+		{
+			tmpInt = parse_prgrm_headers(elven_struct, elven_buffer, elven_size);
+			if (tmpInt != ERROR_SUCCESS)
 			{
-#ifdef DEBUGLEROAD
-				fprintf(stdout, "Successfully copied '%s' into ELF Struct!\n", elven_struct->ISA);
-#endif // DEBUGLEROAD
+				retVal = tmpInt;
 			}
 		}
+
+		if (elven_struct->processorType == ELF_H_CLASS_32)
+		{
+			tmpUint64 = elven_struct->sHdr32;
+		}
+		else
+		{
+			tmpUint64 = elven_struct->sHdr64;
+		}
+		if (tmpUint64 > elven_size || \
+			((uint64_t)elven_struct->sectHdrSize * elven_struct->sectHdrEntrNum) > (elven_size - tmpUint64))
+		{
+			report_elf_error(elven_struct->context, "Section Header Table runs past the end of the file!");
+			retVal = ERROR_BAD_OFFSET;
+		}
+		// 5. Decode the Section Header Table
 		else
 		{
-			fprintf(stderr, "Error allocating memory for Elf Struct ISA!\n");
+			tmpInt = parse_sectn_headers(elven_struct, elven_buffer, elven_size);
+			if (tmpInt != ERROR_SUCCESS)
+			{
+				retVal = tmpInt;
+			}
 		}
 	}
-	else
+
+	/* CLEAN UP */
+	// Zeroize/Free/NULLify tempBuff
+	// if (tmpBuff)
+	// {
+	// 	take_mem_back((void**)&tmpBuff, strlen(elven_contents) + 1, sizeof(char));
+	// }
+
+	return retVal;
+}
+
+// Purpose:	Decode the Program Header Table into one contiguous array
+// Input:
+//			elven_struct - Struct with a parsed ELF Header
+//			elven_buffer - ELF file contents
+//			elven_size - Number of bytes in elven_buffer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Every entry is decoded in one pass into elven_struct->prgmHdrs (see: elf_gimme_mem())
+//			Entries larger than the ELF_P_SIZE_* record are allowed.  The extra bytes are ignored.
+static int parse_prgrm_headers(struct Elf_Details* elven_struct, const unsigned char* elven_buffer, size_t elven_size)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Prgrm_Header* prgmHdrs = NULL;	// Array of decoded entries
+	const unsigned char* currEntry = NULL;		// Raw entry being decoded
+	void (*decodeEntry)(struct Elf_Prgrm_Header*, const unsigned char*) = NULL;	// Chosen once per file
+	uint64_t tableOffset = 0;					// Offset of the Program Header Table
+	int entrySize = 0;							// Minimum size of one raw entry
+	int i = 0;									// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!elven_struct || !elven_buffer || !elven_struct->decoders)
 	{
-		fprintf(stderr, "ELF ISA %d not found in HarkleDict!\n", (int)tmpUint);
+		retVal = ERROR_NULL_PTR;
+		return retVal;
 	}
-	// Zeroize/Free/NULLify elfHdrISADict
-	if (elfHdrISADict)
+	else if (elven_struct->processorType == ELF_H_CLASS_32)
 	{
-		tmpInt = destroy_a_list(&elfHdrISADict);
+		tableOffset = elven_struct->pHdr32;
+		entrySize = ELF_P_SIZE_32;
 	}
-
-	// 2.9. Object File Version
-	dataOffset += 2;  // 20
-	tmpInt = convert_char_to_int(elven_contents, dataOffset, 4, elven_struct->bigEndian, &tmpUint);
-	// fprintf(stdout, "tmpInt now holds:\t%d\n", tmpInt);  // DEBUGGING
-	// fprintf(stdout, "tmpUint now holds:\t%u\n", tmpUint);  // DEBUGGING
-	if (tmpInt != ERROR_SUCCESS)
+	else if (elven_struct->processorType == ELF_H_CLASS_64)
 	{
-		fprintf(stderr, "Failed to convert to an unsigned int.  Error Code:\t%d\n", tmpInt);
-		tmpNode = NULL;
+		tableOffset = elven_struct->pHdr64;
+		entrySize = ELF_P_SIZE_64;
 	}
 	else
 	{
-		tmpNode = lookup_value(elfHdrObjVerDict, (int)tmpUint);
+		report_elf_error(elven_struct->context, "Struct Processor Type invalid so Program Header Table not read!");
+		retVal = ERROR_BAD_ARG;
+		return retVal;
 	}
-	
-	if (tmpNode)  // Found it
+
+	if (elven_struct->prgmHdrEntrNum < 1)
 	{
-		// fprintf(stdout, "tmpNode->name:\t%s\n", tmpNode->name);  // DEBUGGING
-		elven_struct->objVersion = gimme_mem(strlen(tmpNode->name) + 1, sizeof(char));
-		if (elven_struct->objVersion)
-		{
-			if (strncpy(elven_struct->objVersion, tmpNode->name, strlen(tmpNode->name)) != elven_struct->objVersion)
-			{
-				fprintf(stderr, "ELF Object File Version string '%s' not copied into ELF Struct!\n", tmpNode->name);
-			}
-			else
-			{
-#ifdef DEBUGLEROAD
-				fprintf(stdout, "Successfully copied '%s' into ELF Struct!\n", elven_struct->objVersion);
-#endif // DEBUGLEROAD
-			}
-		}
-		else
-		{
-			fprintf(stderr, "Error allocating memory for Elf Struct Object File Version!\n");
-		}
+		// Nothing to decode
+		return retVal;
 	}
-	else
+	else if (elven_struct->prgmHdrSize < entrySize)
 	{
-		fprintf(stderr, "ELF Object File Version %d not found in HarkleDict!\n", (int)tmpUint);
+		report_elf_error(elven_struct->context, "Program Header entries are too small (%d bytes)!", elven_struct->prgmHdrSize);
+		retVal = ERROR_BAD_OFFSET;
+		return retVal;
 	}
-	// Zeroize/Free/NULLify elfHdrObjVerDict
-	if (elfHdrObjVerDict)
+	else if (tableOffset > elven_size || \
+		((uint64_t)elven_struct->prgmHdrSize * elven_struct->prgmHdrEntrNum) > (elven_size - tableOffset))
 	{
-		tmpInt = destroy_a_list(&elfHdrObjVerDict);
+		retVal = ERROR_BAD_OFFSET;
+		return retVal;
 	}
 
-	// 2.10 Entry Point
-	dataOffset += 4;
-	// 32-bit Processor
-	if (elven_struct->processorType == ELF_H_CLASS_32)
-	{		
-		tmpInt = convert_char_to_uint64(elven_contents, dataOffset, 4, elven_struct->bigEndian, &tmpUint64);
+	/* ALLOCATE */
+	// Don't leak a previous parse
+	if (elven_struct->prgmHdrs)
+	{
+		elf_take_mem_back(elven_struct, (void**)&(elven_struct->prgmHdrs), \
+			elven_struct->numPrgmHdrs, sizeof(struct Elf_Prgrm_Header));
+		elven_struct->numPrgmHdrs = 0;
+	}
+	prgmHdrs = (struct Elf_Prgrm_Header*)elf_gimme_mem(elven_struct, elven_struct->prgmHdrEntrNum, \
+		sizeof(struct Elf_Prgrm_Header));
+	if (!prgmHdrs)
+	{
+		PERROR(errno);
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
 
-		if (tmpInt != ERROR_SUCCESS)
-		{
-			fprintf(stderr, "Failed to convert char to an uint64_t.  Error Code:\t%d\n", tmpInt);  // DEBUGGING
-		}
-		else
-		{
-			tmpInt = convert_uint64_to_uint32(tmpUint64, &tmpUint32);
-			if (tmpInt != ERROR_SUCCESS)
-			{
-				fprintf(stderr, "Failed to convert uint64_t to a uint32_t.  Error Code:\t%d\n", tmpInt);  // DEBUGGING
-			}
-			else
-			{
-				elven_struct->ePnt32 = tmpUint32;
-			}
-		}
+	/* DECODE */
+	// The whole table was bounds checked above
+	decodeEntry = elven_struct->decoders->prgrm_header;
+	currEntry = elven_buffer + tableOffset;
+	for (i = 0; i < elven_struct->prgmHdrEntrNum; i++)
+	{
+		decodeEntry(prgmHdrs + i, currEntry);
+		currEntry += elven_struct->prgmHdrSize;
+	}
+
+	elven_struct->prgmHdrs = prgmHdrs;
+	elven_struct->numPrgmHdrs = elven_struct->prgmHdrEntrNum;
+
+	return retVal;
+}
+
+
+// Purpose:	Decode the Section Header Table into one contiguous array
+// Input:
+//			elven_struct - Struct with a parsed ELF Header
+//			elven_buffer - ELF file contents
+//			elven_size - Number of bytes in elven_buffer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Every entry is decoded in one pass into elven_struct->sectHdrs (see: elf_gimme_mem())
+//			Only the location of the section name string table is recorded here.  Names are
+//				resolved on demand by get_section_name().
+//			Extended numbering is supported: e_shnum 0 takes the count from section 0's size and
+//				e_shstrndx ELF_S_INDEX_XINDEX takes the index from section 0's link
+static int parse_sectn_headers(struct Elf_Details* elven_struct, const unsigned char* elven_buffer, size_t elven_size)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Sectn_Header* sectHdrs = NULL;	// Array of decoded entries
+	struct Elf_Sectn_Header* currHdr = NULL;	// Section name string table entry
+	const unsigned char* currEntry = NULL;		// Raw entry being decoded
+	void (*decodeEntry)(struct Elf_Sectn_Header*, const unsigned char*) = NULL;	// Chosen once per file
+	uint64_t tableOffset = 0;					// Offset of the Section Header Table
+	int entrySize = 0;							// Minimum size of one raw entry
+	uint64_t numEntries = 0;					// Number of entries in the Section Header Table
+	struct Elf_Sectn_Header firstHdr;			// Entry 0 (holds the count when e_shnum is 0)
+	unsigned int namesIndex = 0;				// Index of the section name string table
+	uint64_t i = 0;								// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!elven_struct || !elven_buffer || !elven_struct->decoders)
+	{
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
+	else if (elven_struct->processorType == ELF_H_CLASS_32)
+	{
+		tableOffset = elven_struct->sHdr32;
+		entrySize = ELF_S_SIZE_32;
 	}
-	// 64-bit Processor
 	else if (elven_struct->processorType == ELF_H_CLASS_64)
 	{
-		tmpInt = convert_char_to_uint64(elven_contents, dataOffset, 8, elven_struct->bigEndian, &tmpUint64);
-
-		if (tmpInt != ERROR_SUCCESS)
-		{
-			fprintf(stderr, "Failed to convert char to an uint64_t.  Error Code:\t%d\n", tmpInt);  // DEBUGGING
-		}
-		else
-		{
-			elven_struct->ePnt64 = tmpUint64;
-		}
+		tableOffset = elven_struct->sHdr64;
+		entrySize = ELF_S_SIZE_64;
 	}
-	// ??-bit Processor
 	else
 	{
-		fprintf(stderr, "Struct Processor Type invalid so Entry Point not read!\n");
+		report_elf_error(elven_struct->context, "Struct Processor Type invalid so Section Header Table not read!");
+		retVal = ERROR_BAD_ARG;
+		return retVal;
 	}
 
-	// 2.11. Program Header Table Offset
-	// 32-bit Processor
-	if (elven_struct->processorType == ELF_H_CLASS_32)
+	if (elven_struct->sectHdrEntrNum < 1 && tableOffset == 0)
 	{
-		dataOffset += 4;
-		tmpInt = convert_char_to_uint64(elven_contents, dataOffset, 4, elven_struct->bigEndian, &tmpUint64);
-
-		if (tmpInt != ERROR_SUCCESS)
-		{
-			fprintf(stderr, "Failed to convert char to an uint64_t.  Error Code:\t%d\n", tmpInt);  // DEBUGGING
-		}
-		else
-		{
-			tmpInt = convert_uint64_to_uint32(tmpUint64, &tmpUint32);
-			if (tmpInt != ERROR_SUCCESS)
-			{
-				fprintf(stderr, "Failed to convert uint64_t to a uint32_t.  Error Code:\t%d\n", tmpInt);  // DEBUGGING
-			}
-			else
-			{
-				// elven_struct->pHdr32 = dataOffset + tmpUint32;
-				elven_struct->pHdr32 = tmpUint32;
-			}
-		}
+		// Nothing to decode
+		return retVal;
 	}
-	// 64-bit Processor
-	else if (elven_struct->processorType == ELF_H_CLASS_64)
+	else if (elven_struct->sectHdrSize < entrySize)
 	{
-		dataOffset += 8;
-		tmpInt = convert_char_to_uint64(elven_contents, dataOffset, 8, elven_struct->bigEndian, &tmpUint64);
-
-		if (tmpInt != ERROR_SUCCESS)
-		{
-			fprintf(stderr, "Failed to convert char to an uint64_t.  Error Code:\t%d\n", tmpInt);  // DEBUGGING
-		}
-		else
-		{
-			// elven_struct->pHdr64 = dataOffset + tmpUint64;
-			elven_struct->pHdr64 = tmpUint64;
-		}
+		report_elf_error(elven_struct->context, "Section Header entries are too small (%d bytes)!", elven_struct->sectHdrSize);
+		retVal = ERROR_BAD_OFFSET;
+		return retVal;
 	}
-	// ??-bit Processor
-	else
+	else if (tableOffset > elven_size || (size_t)elven_struct->sectHdrSize > (elven_size - tableOffset))
 	{
-		fprintf(stderr, "Struct Processor Type invalid so Program Header Offset not read!\n");
+		retVal = ERROR_BAD_OFFSET;
+		return retVal;
 	}
 
-	// 2.12. Section Header Table Offset
-	// 32-bit Processor
-	if (elven_struct->processorType == ELF_H_CLASS_32)
+	/* COUNT ENTRIES */
+	// Files with 0xFF00 or more sections set e_shnum to 0 and keep the real count in section 0's size
+	numEntries = (uint64_t)elven_struct->sectHdrEntrNum;
+	if (numEntries < 1)
 	{
-		dataOffset += 4;
-		tmpInt = convert_char_to_uint64(elven_contents, dataOffset, 4, elven_struct->bigEndian, &tmpUint64);
-
-		if (tmpInt != ERROR_SUCCESS)
-		{
-			fprintf(stderr, "Failed to convert char to an uint64_t.  Error Code:\t%d\n", tmpInt);  // DEBUGGING
-		}
-		else
-		{
-			tmpInt = convert_uint64_to_uint32(tmpUint64, &tmpUint32);
-			if (tmpInt != ERROR_SUCCESS)
-			{
-				fprintf(stderr, "Failed to convert uint64_t to a uint32_t.  Error Code:\t%d\n", tmpInt);  // DEBUGGING
-			}
-			else
-			{
-				elven_struct->sHdr32 = tmpUint32;
-			}
-		}
+		elven_struct->decoders->sectn_header(&firstHdr, elven_buffer + tableOffset);
+		numEntries = firstHdr.size;
 	}
-	// 64-bit Processor
-	else if (elven_struct->processorType == ELF_H_CLASS_64)
+	if (numEntries < 1)
 	{
-		dataOffset += 8;
-		tmpInt = convert_char_to_uint64(elven_contents, dataOffset, 8, elven_struct->bigEndian, &tmpUint64);
-
-		if (tmpInt != ERROR_SUCCESS)
-		{
-			fprintf(stderr, "Failed to convert char to an uint64_t.  Error Code:\t%d\n", tmpInt);  // DEBUGGING
-		}
-		else
-		{
-			elven_struct->sHdr64 = tmpUint64;
-		}
+		// Nothing to decode
+		return retVal;
 	}
-	// ??-bit Processor
-	else
+	else if (numEntries > INT32_MAX || \
+		((uint64_t)elven_struct->sectHdrSize * numEntries) > (elven_size - tableOffset))
 	{
-		fprintf(stderr, "Struct Processor Type invalid so Section Header Offset not read!\n");
+		report_elf_error(elven_struct->context, "Section Header Table runs past the end of the file!");
+		retVal = ERROR_BAD_OFFSET;
+		return retVal;
 	}
 
-	// 2.13. ELF Header Flags
-	// 32-bit Processor
-	if (elven_struct->processorType == ELF_H_CLASS_32)
-	{
-		dataOffset += 4;
-	}
-	// 64-bit Processor
-	else if (elven_struct->processorType == ELF_H_CLASS_64)
+	/* ALLOCATE */
+	// Don't leak a previous parse
+	if (elven_struct->sectHdrs)
 	{
-		dataOffset += 8;
+		elf_take_mem_back(elven_struct, (void**)&(elven_struct->sectHdrs), \
+			elven_struct->numSectHdrs, sizeof(struct Elf_Sectn_Header));
+		elven_struct->numSectHdrs = 0;
 	}
-	// ??-bit Processor
-	else
+	elven_struct->sectNames = NULL;
+	elven_struct->sectNamesSize = 0;
+	sectHdrs = (struct Elf_Sectn_Header*)elf_gimme_mem(elven_struct, (size_t)numEntries, \
+		sizeof(struct Elf_Sectn_Header));
+	if (!sectHdrs)
 	{
-		fprintf(stderr, "Struct Processor Type invalid so Flags not read!\n");
+		PERROR(errno);
+		retVal = ERROR_NULL_PTR;
+		return retVal;
 	}
-	tmpInt = convert_char_to_int(elven_contents, dataOffset, 4, elven_struct->bigEndian, &tmpUint);
-	if (tmpInt == ERROR_SUCCESS)
+
+	/* DECODE */
+	// The whole table was bounds checked above
+	decodeEntry = elven_struct->decoders->sectn_header;
+	currEntry = elven_buffer + tableOffset;
+	for (i = 0; i < numEntries; i++)
 	{
-		elven_struct->flags = tmpUint;
+		decodeEntry(sectHdrs + i, currEntry);
+		currEntry += elven_struct->sectHdrSize;
 	}
 
-	// 2.14. ELF Header Size
-	dataOffset += 4;
-	tmpInt = convert_char_to_int(elven_contents, dataOffset, 2, elven_struct->bigEndian, &tmpUint);
-	if (tmpInt == ERROR_SUCCESS)
+	elven_struct->sectHdrs = sectHdrs;
+	elven_struct->numSectHdrs = (int)numEntries;
+
+	/* LOCATE SECTION NAMES */
+	// Large indexes live in section 0's link member
+	namesIndex = elven_struct->sectHdrSectNms;
+	if (namesIndex == ELF_S_INDEX_XINDEX)
 	{
-		elven_struct->elfHdrSize = tmpUint;
+		namesIndex = sectHdrs->link;
 	}
-	
-	// 2.15. Program Header Size
-	dataOffset += 2;
-	tmpInt = convert_char_to_int(elven_contents, dataOffset, 2, elven_struct->bigEndian, &tmpUint);
-	if (tmpInt == ERROR_SUCCESS)
+	if (namesIndex != ELF_S_INDEX_UNDEF && namesIndex < numEntries)
 	{
-		elven_struct->prgmHdrSize = tmpUint;
+		currHdr = sectHdrs + namesIndex;
+		if (currHdr->type == ELF_S_TYPE_NOBITS || currHdr->offset > elven_size \
+			|| currHdr->size > (elven_size - currHdr->offset))
+		{
+			report_elf_error(elven_struct->context, "Section name string table runs past the end of the file!");
+			retVal = ERROR_BAD_OFFSET;
+		}
+		else
+		{
+			elven_struct->sectNames = (const char*)elven_buffer + currHdr->offset;
+			elven_struct->sectNamesSize = currHdr->size;
+		}
 	}
 
-	// 2.16. Number of Program Header Entries
-	dataOffset += 2;
-	tmpInt = convert_char_to_int(elven_contents, dataOffset, 2, elven_struct->bigEndian, &tmpUint);
-	if (tmpInt == ERROR_SUCCESS)
+	return retVal;
+}
+
+
+// Purpose:	Resolve the name of a section
+// Input:
+//			elven_struct - Struct with a decoded Section Header Table
+//			sectIndex - Index into elven_struct->sectHdrs
+// Output:	Pointer to the nul-terminated name on success, NULL on failure
+// Note:	
+//			Names are resolved on demand from the section name string table
+//			The return value points into the buffer given to parse_elf_buffer().  Do not free()
+//				it and do not use it after that buffer is gone.
+const char* get_section_name(struct Elf_Details* elven_struct, int sectIndex)
+{
+	/* LOCAL VARIABLES */
+	const char* retVal = NULL;
+	uint32_t nameOffset = 0;	// Offset of the name in the section name string table
+
+	/* INPUT VALIDATION */
+	if (!elven_struct || !elven_struct->sectHdrs || !elven_struct->sectNames)
+	{
+		return retVal;
+	}
+	else if (sectIndex < 0 || sectIndex >= elven_struct->numSectHdrs)
 	{
-		elven_struct->prgmHdrEntrNum = tmpUint;
+		return retVal;
 	}
 
-	// 2.17. Program Header Size
-	dataOffset += 2;
-	tmpInt = convert_char_to_int(elven_contents, dataOffset, 2, elven_struct->bigEndian, &tmpUint);
-	if (tmpInt == ERROR_SUCCESS)
+	/* RESOLVE NAME */
+	nameOffset = elven_struct->sectHdrs[sectIndex].name;
+	// The name must be nul-terminated inside the string table
+	if (nameOffset < elven_struct->sectNamesSize \
+		&& memchr(elven_struct->sectNames + nameOffset, '\0', elven_struct->sectNamesSize - nameOffset))
 	{
-		elven_struct->sectHdrSize = tmpUint;
+		retVal = elven_struct->sectNames + nameOffset;
 	}
 
-	// 2.18. Number of Section Header Entries
-	dataOffset += 2;
-	tmpInt = convert_char_to_int(elven_contents, dataOffset, 2, elven_struct->bigEndian, &tmpUint);
-	if (tmpInt == ERROR_SUCCESS)
+	return retVal;
+}
+
+
+// Purpose:	Find a section by name
+// Input:
+//			elven_struct - Struct with a decoded Section Header Table
+//			sectName - Name to find (e.g., ".text")
+// Output:	Index into elven_struct->sectHdrs on success, -1 if not found
+// Note:	Returns the first match
+int find_section(struct Elf_Details* elven_struct, const char* sectName)
+{
+	/* LOCAL VARIABLES */
+	int retVal = -1;
+	const char* currName = NULL;	// Name of the section being checked
+	int i = 0;						// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!elven_struct || !sectName)
 	{
-		elven_struct->sectHdrEntrNum = tmpUint;
+		return retVal;
 	}
 
-	// 2.18. Section Header Index to Entry with Names
-	dataOffset += 2;
-	tmpInt = convert_char_to_int(elven_contents, dataOffset, 2, elven_struct->bigEndian, &tmpUint);
-	if (tmpInt == ERROR_SUCCESS)
+	/* FIND IT */
+	for (i = 0; i < elven_struct->numSectHdrs; i++)
 	{
-		elven_struct->sectHdrSectNms = tmpUint;
+		currName = get_section_name(elven_struct, i);
+		if (currName && !strcmp(currName, sectName))
+		{
+			retVal = i;
+			break;
+		}
 	}
 
-	/* CLEAN UP */
-	// Zeroize/Free/NULLify tempBuff
-	// if (tmpBuff)
-	// {
-	// 	take_mem_back((void**)&tmpBuff, strlen(elven_contents) + 1, sizeof(char));
-	// }
-
 	return retVal;
 }
 
+
 // Purpose:	Print human-readable details about an ELF file
 // Input:
 //			elven_file - A Elf_Details struct that contains data about an ELF file
@@ -752,13 +1321,15 @@ int parse_elf(struct Elf_Details* elven_struct, char* elven_contents)
 //				to control what the function actually prints.
 //			stream - A stream to send the information to (e.g., stdout, A file)
 // Output:	None
-// Note:	This function will print the relevant data from elven_file into stream
+// Note:	
+//			This function will print the relevant data from elven_file into stream
 //				based on the flags found in sectionsToPrint
+//			Formats into this thread's output buffer (see: format_elf_details()) and writes
+//				it out before returning
 void print_elf_details(struct Elf_Details* elven_file, unsigned int sectionsToPrint, FILE* stream)
 {
 	/* LOCAL VARIABLES */
-	const char notConfigured[] = { "¡NOT CONFIGURED!"};	// Standard error output
-	int i = 0;  										// Iterating variable
+	struct Elf_Output* output = NULL;	// This thread's output buffer
 
 	/* INPUT VALIDATION */
 	if (!stream)
@@ -766,29 +1337,51 @@ void print_elf_details(struct Elf_Details* elven_file, unsigned int sectionsToPr
 		fprintf(stderr, "ERROR: FILE* stream was NULL!\n");
 		return;
 	}
-	else if (!elven_file)
+
+	/* PRINT IT */
+	output = get_thread_output(stream);
+	format_elf_details(output, elven_file, sectionsToPrint);
+	flush_elf_output(output);
+
+	return;
+}
+
+
+// Purpose:	Format human-readable details about an ELF file
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			elven_file - A Elf_Details struct that contains data about an ELF file
+//			sectionsToPrint - Bitwise AND the "PRINT_*" macros into this variable
+//				to control what the function actually prints.
+// Output:	None
+// Note:	Same layout as print_elf_details() but nothing is flushed, so details for many
+//				files can go out in a few large writes
+void format_elf_details(struct Elf_Output* output, struct Elf_Details* elven_file, unsigned int sectionsToPrint)
+{
+	/* LOCAL VARIABLES */
+	const char notConfigured[] = { "¡NOT CONFIGURED!"};	// Standard error output
+	int i = 0;  										// Iterating variable
+	struct Elf_Prgrm_Header* currPrgmHdr = NULL;			// Program Header entry being printed
+	struct Elf_Sectn_Header* currSectnHdr = NULL;			// Section Header entry being printed
+	const char* tmpName = NULL;							// Holds return values from get_*_name()
+
+	/* INPUT VALIDATION */
+	if (!output)
 	{
-		fprintf(stream, "ERROR: struct Elf_Details* elven_file was NULL!\n");
+		fprintf(stderr, "ERROR: struct Elf_Output* output was NULL!\n");
 		return;
 	}
-	else if ((sectionsToPrint >> 6) > 0)
+	else if (!elven_file)
 	{
-		fprintf(stream, "ERROR: Invalid flags found in sectionsToPrint!\n");
+		output_str(output, "ERROR: struct Elf_Details* elven_file was NULL!\n");
 		return;
 	}
-	else if (!elven_file->magicNum)
+	else if ((sectionsToPrint >> 6) > 0)
 	{
-		if (elven_file->fileName)
-		{
-			fprintf(stderr, "\n\n\tINVALID:  %s is not an ELF formatted file.\n\n\n", elven_file->fileName);
-		}
-		else
-		{
-			fprintf(stderr, "\n\n\tINVALID:  This is not an ELF formatted file.\n\n\n");
-		}
+		output_str(output, "ERROR: Invalid flags found in sectionsToPrint!\n");
 		return;
 	}
-	else if (strncmp(elven_file->magicNum, ELF_H_MAGIC_NUM, 4))
+	else if (!elven_file->magicNum || strncmp(elven_file->magicNum, ELF_H_MAGIC_NUM, 4))
 	{
 		if (elven_file->fileName)
 		{
@@ -801,231 +1394,336 @@ void print_elf_details(struct Elf_Details* elven_file, unsigned int sectionsToPr
 		return;
 	}
 
-	fprintf(stream, "\n\n");
+	output_str(output, "\n\n");
 
 	/* ELF HEADER */
 	if (sectionsToPrint & PRINT_ELF_HEADER || sectionsToPrint & PRINT_EVERYTHING)
 	{
 		// Header
-		print_fancy_header(stream, "ELF HEADER", HEADER_DELIM);
+		format_fancy_header(output, "ELF HEADER", HEADER_DELIM);
 
 		// Filename
-		if (elven_file->fileName)
-		{
-			fprintf(stream, "Filename:\t%s\n", elven_file->fileName);
-		}
-		else
-		{
-			fprintf(stream, "Filename:\t%s\n", notConfigured);	
-		}
+		output_str(output, "Filename:\t");
+		output_str(output, elven_file->fileName ? elven_file->fileName : notConfigured);
+		output_char(output, '\n');
 
 		// Class
-		if (elven_file->elfClass)
-		{
-			fprintf(stream, "Class:\t\t%s\n", elven_file->elfClass);
-		}
-		else
-		{
-			fprintf(stream, "Class:\t\t%s\n", notConfigured);	
-		}
+		output_str(output, "Class:\t\t");
+		output_str(output, elven_file->elfClass ? elven_file->elfClass : notConfigured);
+		output_char(output, '\n');
 
 		// Endianness
+		output_str(output, "Endianness:\t");
 		if (elven_file->endianness)
 		{
-			fprintf(stream, "Endianness:\t%s\n", elven_file->endianness);
+			output_str(output, elven_file->endianness);
 		}
 		else if (elven_file->bigEndian == TRUE)
 		{
-			fprintf(stream, "Endianness:\t%s\n", "Big Endian");
+			output_str(output, "Big Endian");
 		}
 		else
 		{
-			fprintf(stream, "Endianness:\t%s\n", notConfigured);	
+			output_str(output, notConfigured);
 		}
+		output_char(output, '\n');
 
 		// ELF Version
-		fprintf(stream, "ELF Version:\t%d\n", elven_file->elfVersion);
+		output_str(output, "ELF Version:\t");
+		output_dec(output, elven_file->elfVersion);
+		output_char(output, '\n');
 
 		// Target OS ABI
-		if (elven_file->targetOS)
-		{
-			fprintf(stream, "Target OS ABI:\t%s\n", elven_file->targetOS);
-		}
-		else
-		{
-			fprintf(stream, "Target OS ABI:\t%s\n", notConfigured);	
-		}
+		output_str(output, "Target OS ABI:\t");
+		output_str(output, elven_file->targetOS ? elven_file->targetOS : notConfigured);
+		output_char(output, '\n');
 
 		// Version of the ABI
-		fprintf(stream, "ABI Version:\t%d\n", elven_file->ABIversion);
+		output_str(output, "ABI Version:\t");
+		output_dec(output, elven_file->ABIversion);
+		output_char(output, '\n');
 
 		// Pad
 		if (elven_file->pad)
 		{
-			fprintf(stream, "Pad:\t\t");
+			output_str(output, "Pad:\t\t");
 			for (i = 0; i < 7; i++)
 			{
-				fprintf(stream, "%c(%d) ", (*(elven_file->pad + i)), (*(elven_file->pad + i)));
+				// Raw character then its value, like "%c(%d) "
+				output_char(output, (*(elven_file->pad + i)));
+				output_char(output, '(');
+				output_dec(output, (*(elven_file->pad + i)));
+				output_str(output, ") ");
 			}
-			fprintf(stream, "\n");
+			output_char(output, '\n');
 		}
 		else
 		{
-			fprintf(stream, "Pad:\t%s\n", notConfigured);	
+			output_str(output, "Pad:\t");
+			output_str(output, notConfigured);
+			output_char(output, '\n');
 		}
 
 		// Type of ELF File
-		if (elven_file->type)
-		{
-			fprintf(stream, "ELF Type:\t%s\n", elven_file->type);
-		}
-		else
-		{
-			fprintf(stream, "ELF Type:\t%s\n", notConfigured);	
-		}
+		output_str(output, "ELF Type:\t");
+		output_str(output, elven_file->type ? elven_file->type : notConfigured);
+		output_char(output, '\n');
 
 		// Instruction Set Architecture (ISA)
-		if (elven_file->ISA)
-		{
-			fprintf(stream, "Target ISA:\t%s\n", elven_file->ISA);
-		}
-		else
-		{
-			fprintf(stream, "Target ISA:\t%s\n", notConfigured);	
-		}
+		output_str(output, "Target ISA:\t");
+		output_str(output, elven_file->ISA ? elven_file->ISA : notConfigured);
+		output_char(output, '\n');
 
 		// Object File Version
-		if (elven_file->objVersion)
-		{
-			fprintf(stream, "Object File:\t%s\n", elven_file->objVersion);
-		}
-		else
-		{
-			fprintf(stream, "Object File:\t%s\n", notConfigured);	
-		}
-
-		// Entry Point
-		// 32-bit Processor
-		if (elven_file->processorType == ELF_H_CLASS_32)
-		{
-			fprintf(stream, "Entry Point:\t0x%08" PRIx32 "\n", elven_file->ePnt32);
-		}
-		// 64-bit Processor
-		else if (elven_file->processorType == ELF_H_CLASS_64)
-		{
-			fprintf(stream, "Entry Point:\t0x%016" PRIx64 "\n", elven_file->ePnt64);
-		}
-		// ??-bit Processor
-		else
-		{
-			fprintf(stream, "Entry Point:\t%s\n", notConfigured);
-		}
-
-		// Program Header Offset
-		// 32-bit Processor
-		if (elven_file->processorType == ELF_H_CLASS_32)
-		{
-			fprintf(stream, "PH Offset:\t0x%" PRIx32 "\n", elven_file->pHdr32);
-		}
-		// 64-bit Processor
-		else if (elven_file->processorType == ELF_H_CLASS_64)
-		{
-			fprintf(stream, "PH Offset:\t0x%" PRIx64 "\n", elven_file->pHdr64);
-		}
-		// ??-bit Processor
-		else
-		{
-			fprintf(stream, "PH Offset:\t%s\n", notConfigured);
-		}
+		output_str(output, "Object File:\t");
+		output_str(output, elven_file->objVersion ? elven_file->objVersion : notConfigured);
+		output_char(output, '\n');
 
-		// Section Header Offset
+		// Entry Point, Program Header Offset, Section Header Offset
 		// 32-bit Processor
 		if (elven_file->processorType == ELF_H_CLASS_32)
 		{
-			fprintf(stream, "SH Offset:\t0x%" PRIx32 "\n", elven_file->sHdr32);
+			output_str(output, "Entry Point:\t0x");
+			output_hex(output, elven_file->ePnt32, 8);
+			output_str(output, "\nPH Offset:\t0x");
+			output_hex(output, elven_file->pHdr32, 0);
+			output_str(output, "\nSH Offset:\t0x");
+			output_hex(output, elven_file->sHdr32, 0);
+			output_char(output, '\n');
 		}
 		// 64-bit Processor
 		else if (elven_file->processorType == ELF_H_CLASS_64)
 		{
-			fprintf(stream, "SH Offset:\t0x%" PRIx64 "\n", elven_file->sHdr64);
+			output_str(output, "Entry Point:\t0x");
+			output_hex(output, elven_file->ePnt64, 16);
+			output_str(output, "\nPH Offset:\t0x");
+			output_hex(output, elven_file->pHdr64, 0);
+			output_str(output, "\nSH Offset:\t0x");
+			output_hex(output, elven_file->sHdr64, 0);
+			output_char(output, '\n');
 		}
 		// ??-bit Processor
 		else
 		{
-			fprintf(stream, "SH Offset:\t%s\n", notConfigured);
+			output_str(output, "Entry Point:\t");
+			output_str(output, notConfigured);
+			output_str(output, "\nPH Offset:\t");
+			output_str(output, notConfigured);
+			output_str(output, "\nSH Offset:\t");
+			output_str(output, notConfigured);
+			output_char(output, '\n');
 		}
 
 		// Flags
+		output_str(output, "Flags:\t\t");
 		if (elven_file->processorType == ELF_H_CLASS_32 || elven_file->processorType == ELF_H_CLASS_64)
 		{
-			fprintf(stream, "Flags:\t\t");
-			// Binary printer
 			// Printing flags so endianness shouldn't matter
-			print_binary(stream, &(elven_file->flags), sizeof(elven_file->flags), TRUE);
-			fprintf(stream, "\n");
+			output_binary(output, &(elven_file->flags), sizeof(elven_file->flags), TRUE);
 		}
 		// ??-bit Processor
 		else
 		{
-			fprintf(stream, "Flags:\t\t%s\n", notConfigured);
+			output_str(output, notConfigured);
 		}
+		output_char(output, '\n');
 
 		// ELF Header Size
-		fprintf(stream, "EHeader Size:\t%d\n", elven_file->elfHdrSize);
-		
+		output_str(output, "EHeader Size:\t");
+		output_dec(output, elven_file->elfHdrSize);
+
 		// Program Header Size
-		fprintf(stream, "PHeader Size:\t%d\n", elven_file->prgmHdrSize);
+		output_str(output, "\nPHeader Size:\t");
+		output_dec(output, elven_file->prgmHdrSize);
 
 		// Number of Program Header Entries
-		fprintf(stream, "# PH Entries:\t%d\n", elven_file->prgmHdrEntrNum);
+		output_str(output, "\n# PH Entries:\t");
+		output_dec(output, elven_file->prgmHdrEntrNum);
 
 		// Section Header Size
-		fprintf(stream, "SHeader Size:\t%d\n", elven_file->sectHdrSize);
+		output_str(output, "\nSHeader Size:\t");
+		output_dec(output, elven_file->sectHdrSize);
 
 		// Number of Section Header Entries
-		fprintf(stream, "# SH Entries:\t%d\n", elven_file->sectHdrEntrNum);
+		output_str(output, "\n# SH Entries:\t");
+		output_dec(output, elven_file->sectHdrEntrNum);
 
 		// Section Header Index to the Entry with Names
-		fprintf(stream, "SH Name Index:\t%d\n", elven_file->sectHdrSectNms);
+		output_str(output, "\nSH Name Index:\t");
+		output_dec(output, elven_file->sectHdrSectNms);
+		output_char(output, '\n');
 
 		// Section delineation
-		fprintf(stream, "\n\n");
+		output_str(output, "\n\n");
 	}
 
 	/* PROGRAM HEADER */
 	if (sectionsToPrint & PRINT_ELF_PRGRM_HEADER || sectionsToPrint & PRINT_EVERYTHING)
 	{
 		// Header
-		print_fancy_header(stream, "PROGRAM HEADER", HEADER_DELIM);
-		// Implement later
-		fprintf(stream, "\n\n");
+		format_fancy_header(output, "PROGRAM HEADER", HEADER_DELIM);
+
+		if (elven_file->prgmHdrs)
+		{
+			for (i = 0; i < elven_file->numPrgmHdrs; i++)
+			{
+				currPrgmHdr = elven_file->prgmHdrs + i;
+
+				// Segment
+				output_str(output, "Segment:\t");
+				output_dec(output, i);
+
+				// Segment Type
+				output_str(output, "\nType:\t\t");
+				tmpName = get_prgrm_header_type_name(currPrgmHdr->type);
+				if (tmpName)
+				{
+					output_str(output, tmpName);
+				}
+				else
+				{
+					output_str(output, "0x");
+					output_hex(output, currPrgmHdr->type, 0);
+				}
+
+				// Segment Flags
+				output_str(output, "\nFlags:\t\t");
+				output_char(output, currPrgmHdr->flags & ELF_P_FLAG_R ? 'R' : '-');
+				output_char(output, currPrgmHdr->flags & ELF_P_FLAG_W ? 'W' : '-');
+				output_char(output, currPrgmHdr->flags & ELF_P_FLAG_X ? 'X' : '-');
+
+				// Offset, Addresses, Sizes and Alignment
+				output_str(output, "\nOffset:\t\t0x");
+				output_hex(output, currPrgmHdr->offset, 0);
+				output_str(output, "\nVirtual Addr:\t0x");
+				output_hex(output, currPrgmHdr->vaddr, 0);
+				output_str(output, "\nPhysical Addr:\t0x");
+				output_hex(output, currPrgmHdr->paddr, 0);
+				output_str(output, "\nFile Size:\t0x");
+				output_hex(output, currPrgmHdr->filesz, 0);
+				output_str(output, "\nMemory Size:\t0x");
+				output_hex(output, currPrgmHdr->memsz, 0);
+				output_str(output, "\nAlignment:\t0x");
+				output_hex(output, currPrgmHdr->align, 0);
+				output_char(output, '\n');
+
+				// Entry delineation
+				if (i + 1 < elven_file->numPrgmHdrs)
+				{
+					output_char(output, '\n');
+				}
+			}
+		}
+		else if (elven_file->prgmHdrEntrNum > 0)
+		{
+			output_str(output, "Segments:\t");
+			output_str(output, notConfigured);
+			output_char(output, '\n');
+		}
+		else
+		{
+			output_str(output, "Segments:\tNone\n");
+		}
+
+		// Section delineation
+		output_str(output, "\n\n");
 	}
 
-	/* SECTION HEADER */
-	if (sectionsToPrint & PRINT_ELF_SECTN_HEADER || sectionsToPrint & PRINT_EVERYTHING)
-	{
-		// Header
-		print_fancy_header(stream, "SECTION HEADER", HEADER_DELIM);
-		// Implement later
-		fprintf(stream, "\n\n");
+	/* SECTION HEADER */
+	if (sectionsToPrint & PRINT_ELF_SECTN_HEADER || sectionsToPrint & PRINT_EVERYTHING)
+	{
+		// Header
+		format_fancy_header(output, "SECTION HEADER", HEADER_DELIM);
+
+		if (elven_file->sectHdrs)
+		{
+			for (i = 0; i < elven_file->numSectHdrs; i++)
+			{
+				currSectnHdr = elven_file->sectHdrs + i;
+
+				// Section
+				output_str(output, "Section:\t");
+				output_dec(output, i);
+
+				// Section Name
+				output_str(output, "\nName:\t\t");
+				tmpName = get_section_name(elven_file, i);
+				output_str(output, tmpName ? tmpName : notConfigured);
+
+				// Section Type
+				output_str(output, "\nType:\t\t");
+				tmpName = get_sectn_header_type_name(currSectnHdr->type);
+				if (tmpName)
+				{
+					output_str(output, tmpName);
+				}
+				else
+				{
+					output_str(output, "0x");
+					output_hex(output, currSectnHdr->type, 0);
+				}
+
+				// Section Flags
+				output_str(output, "\nFlags:\t\t");
+				output_char(output, currSectnHdr->flags & ELF_S_FLAG_WRITE ? 'W' : '-');
+				output_char(output, currSectnHdr->flags & ELF_S_FLAG_ALLOC ? 'A' : '-');
+				output_char(output, currSectnHdr->flags & ELF_S_FLAG_EXECINSTR ? 'X' : '-');
+
+				// Address, Offset, Size, Links and Alignment
+				output_str(output, "\nAddress:\t0x");
+				output_hex(output, currSectnHdr->addr, 0);
+				output_str(output, "\nOffset:\t\t0x");
+				output_hex(output, currSectnHdr->offset, 0);
+				output_str(output, "\nSize:\t\t0x");
+				output_hex(output, currSectnHdr->size, 0);
+				output_str(output, "\nLink:\t\t");
+				output_udec(output, currSectnHdr->link);
+				output_str(output, "\nInfo:\t\t");
+				output_udec(output, currSectnHdr->info);
+				output_str(output, "\nAlignment:\t0x");
+				output_hex(output, currSectnHdr->addralign, 0);
+				output_str(output, "\nEntry Size:\t0x");
+				output_hex(output, currSectnHdr->entsize, 0);
+				output_char(output, '\n');
+
+				// Entry delineation
+				if (i + 1 < elven_file->numSectHdrs)
+				{
+					output_char(output, '\n');
+				}
+			}
+		}
+		else if (elven_file->sectHdrEntrNum > 0)
+		{
+			output_str(output, "Sections:\t");
+			output_str(output, notConfigured);
+			output_char(output, '\n');
+		}
+		else
+		{
+			output_str(output, "Sections:\tNone\n");
+		}
+
+		// Section delineation
+		output_str(output, "\n\n");
 	}
 
 	/* PROGRAM DATA */
 	if (sectionsToPrint & PRINT_ELF_PRGRM_DATA || sectionsToPrint & PRINT_EVERYTHING)
 	{
 		// Header
-		print_fancy_header(stream, "PROGRAM DATA", HEADER_DELIM);
+		format_fancy_header(output, "PROGRAM DATA", HEADER_DELIM);
 		// Implement later
-		fprintf(stream, "\n\n");
+		output_str(output, "\n\n");
 	}
 
 	/* SECTION DATA */
 	if (sectionsToPrint & PRINT_ELF_SECTN_DATA || sectionsToPrint & PRINT_EVERYTHING)
 	{
 		// Header
-		print_fancy_header(stream, "SECTION DATA", HEADER_DELIM);
+		format_fancy_header(output, "SECTION DATA", HEADER_DELIM);
 		// Implement later
-		fprintf(stream, "\n\n");
+		output_str(output, "\n\n");
 	}
 
 	return;
@@ -1035,10 +1733,13 @@ void print_elf_details(struct Elf_Details* elven_file, unsigned int sectionsToPr
 // Purpose:	Assist clean up efforts by zeroizing/free'ing an Elf_Details struct
 // Input:	Pointer to an Elf_Details struct pointer
 // Output:	ERROR_* as specified in Elf_Details.h
-// Note:	This function will modify the original variable in the calling function
+// Note:	
+//			This function will modify the original variable in the calling function
+//			Arena-backed structs (see: read_elf_arena()) are released with one destroy_arena()
 int kill_elf(struct Elf_Details** old_struct)
 {
 	int retVal = ERROR_SUCCESS;
+	struct Elf_Arena* elfArena = NULL;	// Arena that owns *old_struct, if any
 
 	if (old_struct)
 	{
@@ -1046,100 +1747,67 @@ int kill_elf(struct Elf_Details** old_struct)
 		if (*old_struct)
 		{
 			// fprintf(stdout, "*old_struct:\t%p\n", *old_struct);  // DEBUGGING
-			/* ZEROIZE AND FREE (as appropriate) STRUCT MEMBERS */
-			// char* fileName;		// Absolute or relative path
-			if ((*old_struct)->fileName)
-			{
-				retVal += take_mem_back((void**)&((*old_struct)->fileName), strlen((*old_struct)->fileName), sizeof(char));
-				if (retVal)
-				{
-					PERROR(errno);
-					fprintf(stderr, "take_mem_back() returned %d on struct->filename free!\n", retVal);
-					retVal = ERROR_SUCCESS;
-				}
-				else
-				{
-#ifdef DEBUGLEROAD
-					fprintf(stdout, "take_mem_back() successfully freed struct->filename.\n");
-#endif // DEBUGLEROAD
-				}
-			}
-			// 	char* magicNum;		// First four bytes of file
-			if ((*old_struct)->magicNum)
+			/* DON'T LEAK A MAPPED FILE VIEW */
+			if ((*old_struct)->gutsMapped == TRUE)
 			{
-				retVal += take_mem_back((void**)&((*old_struct)->magicNum), strlen((*old_struct)->magicNum), sizeof(char));
-				if (retVal)
-				{
-					PERROR(errno);
-					fprintf(stderr, "take_mem_back() returned %d on struct->magicNum free!\n", retVal);
-					retVal = ERROR_SUCCESS;
-				}
-				else
-				{
-#ifdef DEBUGLEROAD
-					fprintf(stdout, "take_mem_back() successfully freed struct->magicNum.\n");
-#endif // DEBUGLEROAD
-				}
+				return kill_elf_mapped(old_struct);
 			}
-			// char* elfClass;		// 32 or 64 bit
-			if ((*old_struct)->elfClass)
+
+			/* RELEASE RETAINED FILE CONTENTS */
+			// Mapped views were diverted above so this buffer came from read_file_guts()
+			if ((*old_struct)->elfGuts)
 			{
-				retVal += take_mem_back((void**)&((*old_struct)->elfClass), strlen((*old_struct)->elfClass), sizeof(char));
-				if (retVal)
-				{
-					PERROR(errno);
-					fprintf(stderr, "take_mem_back() returned %d on struct->elfClass free!\n", retVal);
-					retVal = ERROR_SUCCESS;
-				}
-				else
-				{
-#ifdef DEBUGLEROAD
-					fprintf(stdout, "take_mem_back() successfully freed struct->elfClass.\n");
-#endif // DEBUGLEROAD
-				}
+				take_sensitive_mem_back((void**)&((*old_struct)->elfGuts), (*old_struct)->elfSize + 1, sizeof(char));
+				(*old_struct)->elfSize = 0;
 			}
-			// int processorType;	// 32 or 64 bit
-			(*old_struct)->processorType = ZEROIZE_VALUE;
-			// char* endianness;	// Little or Big
-			if ((*old_struct)->endianness)
+			// Pointed into elfGuts
+			(*old_struct)->sectNames = NULL;
+
+			/* RELEASE AN ARENA-BACKED STRUCT ALL AT ONCE */
+			// The struct itself lives in the arena so there's nothing to do member by member
+			if ((*old_struct)->arena)
 			{
-				retVal += take_mem_back((void**)&((*old_struct)->endianness), strlen((*old_struct)->endianness), sizeof(char));
-				if (retVal)
-				{
-					PERROR(errno);
-					fprintf(stderr, "take_mem_back() returned %d on struct->endianness free!\n", retVal);
-					retVal = ERROR_SUCCESS;
-				}
-				else
+				elfArena = (*old_struct)->arena;
+				// A caller-owned arena (see: read_elf_ctx()) outlives the struct
+				if ((*old_struct)->arenaShared == TRUE)
 				{
-#ifdef DEBUGLEROAD
-					fprintf(stdout, "take_mem_back() successfully freed struct->endianness.\n");
-#endif // DEBUGLEROAD
+					*old_struct = NULL;
+					return retVal;
 				}
+				*old_struct = NULL;
+				return destroy_arena(&elfArena);
 			}
-			// int bigEndian;		// If TRUE, bigEndian
-			(*old_struct)->bigEndian = ZEROIZE_VALUE;
-			// int elfVersion;		// ELF version
-			(*old_struct)->elfVersion = ZEROIZE_VALUE;
-			// char* targetOS;		// Target OS ABI
-			if ((*old_struct)->targetOS)
+
+			/* ZEROIZE AND FREE (as appropriate) STRUCT MEMBERS */
+			// char* fileName;		// Absolute or relative path
+			if ((*old_struct)->fileName)
 			{
-				retVal += take_mem_back((void**)&((*old_struct)->targetOS), strlen((*old_struct)->targetOS), sizeof(char));
+				retVal += take_mem_back((void**)&((*old_struct)->fileName), strlen((*old_struct)->fileName), sizeof(char));
 				if (retVal)
 				{
 					PERROR(errno);
-					fprintf(stderr, "take_mem_back() returned %d on struct->targetOS free!\n", retVal);
+					fprintf(stderr, "take_mem_back() returned %d on struct->filename free!\n", retVal);
 					retVal = ERROR_SUCCESS;
 				}
 				else
 				{
 #ifdef DEBUGLEROAD
-					fprintf(stdout, "take_mem_back() successfully freed struct->targetOS.\n");
+					fprintf(stdout, "take_mem_back() successfully freed struct->filename.\n");
 #endif // DEBUGLEROAD
 				}
 			}
-			// int ABIversion;		// Version of the ABI
-			(*old_struct)->ABIversion = ZEROIZE_VALUE;
+			// 	const char* magicNum;		// First four bytes of file
+			// Points into static storage
+			(*old_struct)->magicNum = NULL;
+			// const char* elfClass;		// 32 or 64 bit
+			// Points into static storage
+			(*old_struct)->elfClass = NULL;
+			// const char* endianness;	// Little or Big
+			// Points into static storage
+			(*old_struct)->endianness = NULL;
+			// const char* targetOS;		// Target OS ABI
+			// Points into static storage
+			(*old_struct)->targetOS = NULL;
 			// char* pad;			// Unused portion
 			// NOTE: This char* member is statically sized based on ELF Header specifications
 			if ((*old_struct)->pad)
@@ -1158,96 +1826,101 @@ int kill_elf(struct Elf_Details** old_struct)
 #endif // DEBUGLEROAD
 				}
 			}
-			// char* type;			// The type of ELF file
-			if ((*old_struct)->type)
+			// struct Elf_Prgrm_Header* prgmHdrs;	// Contiguous array of decoded program header table entries
+			if ((*old_struct)->prgmHdrs)
 			{
-				retVal += take_mem_back((void**)&((*old_struct)->type), strlen((*old_struct)->type), sizeof(char));
+				retVal += take_mem_back((void**)&((*old_struct)->prgmHdrs), (*old_struct)->numPrgmHdrs, \
+					sizeof(struct Elf_Prgrm_Header));
 				if (retVal)
 				{
 					PERROR(errno);
-					fprintf(stderr, "take_mem_back() returned %d on struct->type free!\n", retVal);
+					fprintf(stderr, "take_mem_back() returned %d on struct->prgmHdrs free!\n", retVal);
 					retVal = ERROR_SUCCESS;
 				}
-				else
-				{
-#ifdef DEBUGLEROAD
-					fprintf(stdout, "take_mem_back() successfully freed struct->type.\n");
-#endif // DEBUGLEROAD
-				}
 			}
-			// char* ISA;			// Specifies target Instruction Set Architecture
-			if ((*old_struct)->ISA)
+			// struct Elf_Sectn_Header* sectHdrs;	// Contiguous array of decoded section header table entries
+			if ((*old_struct)->sectHdrs)
 			{
-				retVal += take_mem_back((void**)&((*old_struct)->ISA), strlen((*old_struct)->ISA), sizeof(char));
+				retVal += take_mem_back((void**)&((*old_struct)->sectHdrs), (*old_struct)->numSectHdrs, \
+					sizeof(struct Elf_Sectn_Header));
 				if (retVal)
 				{
 					PERROR(errno);
-					fprintf(stderr, "take_mem_back() returned %d on struct->ISA free!\n", retVal);
+					fprintf(stderr, "take_mem_back() returned %d on struct->sectHdrs free!\n", retVal);
 					retVal = ERROR_SUCCESS;
 				}
-				else
-				{
-#ifdef DEBUGLEROAD
-					fprintf(stdout, "take_mem_back() successfully freed struct->ISA.\n");
-#endif // DEBUGLEROAD
-				}
 			}
-			// char* objVersion;	// Object File Version
-			if ((*old_struct)->objVersion)
+			// const char* type;			// The type of ELF file
+			// Points into static storage
+			(*old_struct)->type = NULL;
+			// const char* ISA;			// Specifies target Instruction Set Architecture
+			// Points into static storage
+			(*old_struct)->ISA = NULL;
+			// const char* objVersion;	// Object File Version
+			// Points into static storage
+			(*old_struct)->objVersion = NULL;
+
+			/* ZEROIZE SCALAR MEMBERS */
+			// Skipped if the zeroization policy says so
+			if (should_zeroize(FALSE) == TRUE)
 			{
-				retVal += take_mem_back((void**)&((*old_struct)->objVersion), strlen((*old_struct)->objVersion), sizeof(char));
-				if (retVal)
-				{
-					PERROR(errno);
-					fprintf(stderr, "take_mem_back() returned %d on struct->objVersion free!\n", retVal);
-					retVal = ERROR_SUCCESS;
-				}
-				else
-				{
-#ifdef DEBUGLEROAD
-					fprintf(stdout, "take_mem_back() successfully freed struct->objVersion.\n");
-#endif // DEBUGLEROAD
-				}
+				// int processorType;	// 32 or 64 bit
+				(*old_struct)->processorType = ZEROIZE_VALUE;
+				// int bigEndian;		// If TRUE, bigEndian
+				(*old_struct)->bigEndian = ZEROIZE_VALUE;
+				// int elfVersion;		// ELF version
+				(*old_struct)->elfVersion = ZEROIZE_VALUE;
+				// int ABIversion;		// Version of the ABI
+				(*old_struct)->ABIversion = ZEROIZE_VALUE;
+				// uint32_t ePnt32;	// 32-bit memory address of the entry point from where the process starts executing
+				(*old_struct)->ePnt32 = 0;
+				(*old_struct)->ePnt32 |= ZEROIZE_VALUE;
+				// uint64_t ePnt64;	// 64-bit memory address of the entry point from where the process starts executing
+				(*old_struct)->ePnt64 = 0;
+				(*old_struct)->ePnt64 |= ZEROIZE_VALUE;
+				// uint32_t pHdr32;	// 32-bit address offset of the program header table
+				(*old_struct)->pHdr32 = 0;
+				(*old_struct)->pHdr32 |= ZEROIZE_VALUE;
+				// uint32_t pHdr64;	// 64-bit address offset of the program header table
+				(*old_struct)->pHdr64 = 0;
+				(*old_struct)->pHdr64 |= ZEROIZE_VALUE;
+				// uint32_t sHdr32;	// 32-bit address offset of the section header table
+				(*old_struct)->sHdr32 = 0;
+				(*old_struct)->sHdr32 |= ZEROIZE_VALUE;
+				// uint64_t sHdr64;	// 64-bit address offset of the section header table
+				(*old_struct)->sHdr64 = 0;
+				(*old_struct)->sHdr64 |= ZEROIZE_VALUE;
+				// unsigned int flags;	// Interpretation of this field depends on the target architecture
+				(*old_struct)->flags = 0;
+				(*old_struct)->flags |= ZEROIZE_VALUE;
+				// int elfHdrSize;  // ELF Header Size
+				(*old_struct)->elfHdrSize = 0;
+				(*old_struct)->elfHdrSize |= ZEROIZE_VALUE;
+				// int prgmHdrSize; // Contains the size of a program header table entry.
+				(*old_struct)->prgmHdrSize = 0;
+				(*old_struct)->prgmHdrSize |= ZEROIZE_VALUE;
+				// int prgmHdrEntrNum;	// Number of entries in the program header table
+				(*old_struct)->prgmHdrEntrNum = 0;
+				(*old_struct)->prgmHdrEntrNum |= ZEROIZE_VALUE;
+				// int sectHdrSize;	// Contains the size of a section header table entry.
+				(*old_struct)->sectHdrSize = 0;
+				(*old_struct)->sectHdrSize |= ZEROIZE_VALUE;
+				// int sectHdrEntrNum;	// Number of entries in the section header table
+				(*old_struct)->sectHdrEntrNum = 0;
+				(*old_struct)->sectHdrEntrNum |= ZEROIZE_VALUE;
+				// int sectHdrSectNms;	// Index of the section header table entry with section names
+				(*old_struct)->sectHdrSectNms = 0;
+				(*old_struct)->sectHdrSectNms |= ZEROIZE_VALUE;
+				// int numPrgmHdrs;	// Number of entries in prgmHdrs
+				(*old_struct)->numPrgmHdrs = 0;
+				(*old_struct)->numPrgmHdrs |= ZEROIZE_VALUE;
+				// int numSectHdrs;	// Number of entries in sectHdrs
+				(*old_struct)->numSectHdrs = 0;
+				(*old_struct)->numSectHdrs |= ZEROIZE_VALUE;
+				// uint64_t sectNamesSize;	// Number of bytes in sectNames
+				(*old_struct)->sectNamesSize = 0;
+				(*old_struct)->sectNamesSize |= ZEROIZE_VALUE;
 			}
-			// uint32_t ePnt32;	// 32-bit memory address of the entry point from where the process starts executing
-			(*old_struct)->ePnt32 = 0;
-			(*old_struct)->ePnt32 |= ZEROIZE_VALUE;
-			// uint64_t ePnt64;	// 64-bit memory address of the entry point from where the process starts executing
-			(*old_struct)->ePnt64 = 0;
-			(*old_struct)->ePnt64 |= ZEROIZE_VALUE;
-			// uint32_t pHdr32;	// 32-bit address offset of the program header table
-			(*old_struct)->pHdr32 = 0;
-			(*old_struct)->pHdr32 |= ZEROIZE_VALUE;
-			// uint32_t pHdr64;	// 64-bit address offset of the program header table
-			(*old_struct)->pHdr64 = 0;
-			(*old_struct)->pHdr64 |= ZEROIZE_VALUE;
-			// uint32_t sHdr32;	// 32-bit address offset of the section header table
-			(*old_struct)->sHdr32 = 0;
-			(*old_struct)->sHdr32 |= ZEROIZE_VALUE;
-			// uint64_t sHdr64;	// 64-bit address offset of the section header table
-			(*old_struct)->sHdr64 = 0;
-			(*old_struct)->sHdr64 |= ZEROIZE_VALUE;
-			// unsigned int flags;	// Interpretation of this field depends on the target architecture
-			(*old_struct)->flags = 0;
-			(*old_struct)->flags |= ZEROIZE_VALUE;
-			// int elfHdrSize;  // ELF Header Size
-			(*old_struct)->elfHdrSize = 0;
-			(*old_struct)->elfHdrSize |= ZEROIZE_VALUE;
-			// int prgmHdrSize; // Contains the size of a program header table entry.
-			(*old_struct)->prgmHdrSize = 0;
-			(*old_struct)->prgmHdrSize |= ZEROIZE_VALUE;
-			// int prgmHdrEntrNum;	// Number of entries in the program header table
-			(*old_struct)->prgmHdrEntrNum = 0;
-			(*old_struct)->prgmHdrEntrNum |= ZEROIZE_VALUE;
-			// int sectHdrSize;	// Contains the size of a section header table entry.
-			(*old_struct)->sectHdrSize = 0;
-			(*old_struct)->sectHdrSize |= ZEROIZE_VALUE;
-			// int sectHdrEntrNum;	// Number of entries in the section header table
-			(*old_struct)->sectHdrEntrNum = 0;
-			(*old_struct)->sectHdrEntrNum |= ZEROIZE_VALUE;
-			// int sectHdrSectNms;	// Index of the section header table entry with section names
-			(*old_struct)->sectHdrSectNms = 0;
-			(*old_struct)->sectHdrSectNms |= ZEROIZE_VALUE;
 
 			/* FREE THE STRUCT ITSELF */
 			retVal += take_mem_back((void**)old_struct, 1, sizeof(struct Elf_Details));
@@ -1278,6 +1951,53 @@ int kill_elf(struct Elf_Details** old_struct)
 }
 
 
+// Purpose:	Unmap the file view retained by read_elf_mapped() then zeroize/free the Elf_Details struct
+// Input:	Pointer to an Elf_Details struct pointer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			This function will modify the original variable in the calling function
+//			Safe to call on a struct returned by read_elf()
+int kill_elf_mapped(struct Elf_Details** old_struct)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (old_struct)
+	{
+		if (*old_struct)
+		{
+			/* UNMAP THE FILE VIEW */
+			// Read-only mapping so there's nothing to zeroize
+			if ((*old_struct)->gutsMapped == TRUE && (*old_struct)->elfGuts)
+			{
+				if (munmap((*old_struct)->elfGuts, (*old_struct)->elfSize))
+				{
+					PERROR(errno);
+					fprintf(stderr, "munmap() failed on struct->elfGuts!\n");
+				}
+				(*old_struct)->elfGuts = NULL;
+				(*old_struct)->elfSize = 0;
+				(*old_struct)->sectNames = NULL;
+			}
+			// Anything else in elfGuts belongs to kill_elf()
+			(*old_struct)->gutsMapped = FALSE;
+
+			/* FREE THE REST */
+			retVal = kill_elf(old_struct);
+		}
+		else
+		{
+			retVal = ERROR_NULL_PTR;
+		}
+	}
+	else
+	{
+		retVal = ERROR_NULL_PTR;
+	}
+
+	return retVal;
+}
+
+
 // Purpose:	Prints an uppercase title surrounded by delimiters
 // Input:
 //			stream - Stream to print the header to
@@ -1287,8 +2007,7 @@ int kill_elf(struct Elf_Details** old_struct)
 // Note:	Automatically sizes the box
 void print_fancy_header(FILE* stream, char* title, unsigned char delimiter)
 {
-	int headerWidth = 0;  // Used to dynamically determine the width of the header
-	int i = 0;  // Iterating variable
+	struct Elf_Output* output = NULL;	// This thread's output buffer
 
 	if (!stream || !title || !delimiter)
 	{
@@ -1296,25 +2015,49 @@ void print_fancy_header(FILE* stream, char* title, unsigned char delimiter)
 		return;
 	}
 
+	output = get_thread_output(stream);
+	format_fancy_header(output, title, delimiter);
+	flush_elf_output(output);
+
+	return;
+}
+
+
+// Purpose:	Formats an uppercase title surrounded by delimiters
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			title - Title to format
+//			delimiter - Single character to create the box
+// Output:	None
+// Note:	Same box as print_fancy_header(), without the flush
+void format_fancy_header(struct Elf_Output* output, const char* title, unsigned char delimiter)
+{
+	size_t headerWidth = 0;  // Used to dynamically determine the width of the header
+
+	if (!output || !title || !delimiter)
+	{
+		fprintf(stderr, "ERROR: NULL/nul parameter received!\n");
+		return;
+	}
+
 	// ### title ###
 	headerWidth = 3 + 1 + strlen(title) + 1 + 3;
 
 	// First line
-	for (i = 0; i < headerWidth; i++)
-	{
-		fputc(delimiter, stream);
-	}
-	fputc(0xA, stream);
+	output_repeat(output, delimiter, headerWidth);
+	output_char(output, '\n');
 
 	// Second line
-	fprintf(stream, "%c%c%c %s %c%c%c\n", delimiter, delimiter, delimiter, title, delimiter, delimiter, delimiter);
+	output_repeat(output, delimiter, 3);
+	output_char(output, ' ');
+	output_str(output, title);
+	output_char(output, ' ');
+	output_repeat(output, delimiter, 3);
+	output_char(output, '\n');
 
 	// Third line
-	for (i = 0; i < headerWidth; i++)
-	{
-		fputc(delimiter, stream);
-	}
-	fputc(0xA, stream);
+	output_repeat(output, delimiter, headerWidth);
+	output_char(output, '\n');
 
 	return;
 }
@@ -1323,29 +2066,35 @@ void print_fancy_header(FILE* stream, char* title, unsigned char delimiter)
 // Purpose:	Determine the exact length of a file
 // Input:	Open FILE pointer
 // Output:	Exact length of file in bytes
+// Note:	
+//			Regular files are sized from their metadata without reading a single byte
+//			Everything else (pipes, /proc files) is counted with chunked reads and then
+//				rewound, which only works if the stream is seekable.  Use read_file_guts()
+//				to size and read a non-seekable stream in one pass.
 size_t file_len(FILE* openFile)
 {
 	size_t retVal = 0;
-	char oneLetter = 'H';
+	struct stat fileStat;					// Holds file metadata
+	char chunk[READ_CHUNK_SIZE] = { 0 };	// Scratch buffer for streams without metadata
+	size_t numRead = 0;						// Number of bytes fread() returned
 
 	if (openFile)
 	{
-		while (1)
+		// Regular files report their size (except for /proc files which all report 0)
+		if (!fstat(fileno(openFile), &fileStat) && S_ISREG(fileStat.st_mode) && fileStat.st_size > 0)
 		{
-			oneLetter = fgetc(openFile);
-			PERROR(errno);  // DEBUGGING
-
-			if (oneLetter != EOF)
-			{
-				retVal++;
-			}
-			else
-			{
-				break;
-			}
+			retVal = (size_t)fileStat.st_size;
 		}
+		else
+		{
+			do
+			{
+				numRead = fread(chunk, sizeof(char), sizeof(chunk), openFile);
+				retVal += numRead;
+			} while (numRead == sizeof(chunk));
 
-		rewind(openFile);
+			rewind(openFile);
+		}
 	}
 	else
 	{
@@ -1356,6 +2105,95 @@ size_t file_len(FILE* openFile)
 }
 
 
+// Purpose:	Read the entire contents of an open file into a nul-terminated buffer
+// Input:
+//			openFile - Open FILE pointer positioned at the beginning of the file
+//			gutsSize [out] - Number of bytes read, not counting the nul terminator
+// Output:	Dynamically allocated buffer of *gutsSize + 1 bytes on success, NULL on failure
+// Note:	
+//			Regular files are sized from their metadata and read with a single fread()
+//			Non-seekable inputs (pipes, /proc files) fall back to chunked reads into a
+//				growing buffer so they are never read twice
+//			A failed read leaves its errno for the calling function to report
+//			It is the responsibility of the calling function to take_mem_back() the return value
+//				using *gutsSize + 1 elements
+char* read_file_guts(FILE* openFile, size_t* gutsSize)
+{
+	/* LOCAL VARIABLES */
+	char* retVal = NULL;		// Holds the file contents
+	char* tmpPtr = NULL;		// Holds return value from gimme_mem() while growing retVal
+	struct stat fileStat;		// Holds file metadata
+	size_t buffSize = 0;		// Number of bytes allocated for retVal, not counting the nul
+	size_t numRead = 0;			// Number of bytes read so far
+	size_t tmpRead = 0;			// Number of bytes the last fread() returned
+	int sizedByStat = FALSE;	// If TRUE, buffSize came from file metadata
+	int errNum = 0;				// errno from a failed fread()
+
+	/* INPUT VALIDATION */
+	if (!openFile || !gutsSize)
+	{
+		return retVal;
+	}
+	else
+	{
+		*gutsSize = 0;
+	}
+
+	/* SIZE THE FILE */
+	if (!fstat(fileno(openFile), &fileStat) && S_ISREG(fileStat.st_mode) && fileStat.st_size > 0)
+	{
+		buffSize = (size_t)fileStat.st_size;
+		sizedByStat = TRUE;
+	}
+	else
+	{
+		buffSize = READ_CHUNK_SIZE;
+	}
+
+	/* READ THE FILE */
+	retVal = (char*)gimme_mem(buffSize + 1, sizeof(char));
+	while (retVal)
+	{
+		tmpRead = fread(retVal + numRead, sizeof(char), buffSize - numRead, openFile);
+		numRead += tmpRead;
+
+		// EOF, an error, or everything the metadata promised has been read
+		if (numRead < buffSize || sizedByStat == TRUE)
+		{
+			break;
+		}
+
+		// Grow the buffer and keep reading
+		tmpPtr = (char*)gimme_mem((buffSize * 2) + 1, sizeof(char));
+		if (!tmpPtr)
+		{
+			take_mem_back((void**)&retVal, buffSize + 1, sizeof(char));
+			break;
+		}
+		memcpy(tmpPtr, retVal, numRead);
+		take_mem_back((void**)&retVal, buffSize + 1, sizeof(char));
+		retVal = tmpPtr;
+		buffSize *= 2;
+	}
+
+	if (retVal && ferror(openFile))
+	{
+		// Don't let take_mem_back() report it
+		errNum = errno;
+		errno = 0;
+		take_mem_back((void**)&retVal, buffSize + 1, sizeof(char));
+		errno = errNum;
+	}
+
+	if (retVal)
+	{
+		*gutsSize = numRead;
+	}
+
+	return retVal;
+}
+
+
 // Purpose:	Print a buffer, regardless of nul characters
 // Input:	
 //			buff - non-nul terminated char array
@@ -1373,51 +2211,134 @@ size_t print_it(char* buff, size_t size)
 			putchar((*(buff + retVal)));
 		}
 	}
-	puts("\n");
+	puts("\n");
+
+	return retVal;
+}
+
+
+// Purpose:	Wrap calloc
+// Input:
+//			numElem - function allocates memory for an array of numElem elements
+//			sizeElem - size of each numElem
+// Output:	Pointer to dynamically allocated array
+// Note:	
+//			Cast the return value to the type you want
+//			It is the responsibility of the calling function to free the mem returned
+void* gimme_mem(size_t numElem, size_t sizeElem)
+{
+	void* retVal = NULL;
+	int numRetries = 0;
+
+	for (; numRetries <= MAX_RETRIES; numRetries++)
+	{
+		retVal = (void*)calloc(numElem, sizeElem);
+		if (retVal)
+		{
+			break;
+		}
+	}
+
+	if (!retVal)
+	{
+		PERROR(errno);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Automate zeroizing, free'ing, and NULL'ing of dynamically allocated memory
+// Input:	
+//			buff - Pointer to a buffer pointer
+//			numElem - The number of things in *buff
+//			sizeElem - The size of each thing in *buff
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Modifies the pointer to *buf by making it NULL
+//			Only zeroizes if the zeroization policy says so (see: set_zeroize_policy())
+int take_mem_back(void** buff, size_t numElem, size_t sizeElem)
+{
+	return release_mem(buff, numElem, sizeElem, FALSE);
+}
+
+
+// Purpose:	Zeroize, free, and NULL a buffer flagged as sensitive
+// Input:	
+//			buff - Pointer to a buffer pointer
+//			numElem - The number of things in *buff
+//			sizeElem - The size of each thing in *buff
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Modifies the pointer to *buf by making it NULL
+//			Zeroizes under the ZEROIZE_ALWAYS and ZEROIZE_SENSITIVE policies
+int take_sensitive_mem_back(void** buff, size_t numElem, size_t sizeElem)
+{
+	return release_mem(buff, numElem, sizeElem, TRUE);
+}
+
+
+// Purpose:	Choose when take_mem_back() and friends zeroize memory
+// Input:	newPolicy - ZEROIZE_ALWAYS, ZEROIZE_NEVER, or ZEROIZE_SENSITIVE
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Defaults to ZEROIZE_POLICY
+//			Set it once, before any other threads start freeing memory
+int set_zeroize_policy(int newPolicy)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (newPolicy != ZEROIZE_ALWAYS && newPolicy != ZEROIZE_NEVER && newPolicy != ZEROIZE_SENSITIVE)
+	{
+		retVal = ERROR_BAD_ARG;
+	}
+	else
+	{
+		zeroizePolicy = newPolicy;
+	}
 
 	return retVal;
 }
 
 
-// Purpose:	Wrap calloc
-// Input:
-//			numElem - function allocates memory for an array of numElem elements
-//			sizeElem - size of each numElem
-// Output:	Pointer to dynamically allocated array
-// Note:	
-//			Cast the return value to the type you want
-//			It is the responsibility of the calling function to free the mem returned
-void* gimme_mem(size_t numElem, size_t sizeElem)
+// Purpose:	Report the current zeroization policy
+// Input:	None
+// Output:	ZEROIZE_ALWAYS, ZEROIZE_NEVER, or ZEROIZE_SENSITIVE
+int get_zeroize_policy(void)
 {
-	void* retVal = NULL;
-	int numRetries = 0;
+	return zeroizePolicy;
+}
 
-	for (; numRetries <= MAX_RETRIES; numRetries++)
+
+// Purpose:	Determine if memory should be zeroized before it is released
+// Input:	sensitive - TRUE if the memory was flagged as sensitive
+// Output:	TRUE if the current zeroization policy calls for it, FALSE otherwise
+int should_zeroize(int sensitive)
+{
+	int retVal = FALSE;
+
+	if (zeroizePolicy == ZEROIZE_ALWAYS)
 	{
-		retVal = (void*)calloc(numElem, sizeElem);
-		if (retVal)
-		{
-			break;
-		}
+		retVal = TRUE;
 	}
-
-	if (!retVal)
+	else if (zeroizePolicy == ZEROIZE_SENSITIVE && sensitive == TRUE)
 	{
-		PERROR(errno);
+		retVal = TRUE;
 	}
 
 	return retVal;
 }
 
 
-// Purpose:	Automate zeroizing, free'ing, and NULL'ing of dynamically allocated memory
+// Purpose:	Implements take_mem_back() and take_sensitive_mem_back()
 // Input:	
 //			buff - Pointer to a buffer pointer
 //			numElem - The number of things in *buff
 //			sizeElem - The size of each thing in *buff
+//			sensitive - TRUE if *buff was flagged as sensitive
 // Output:	ERROR_* as specified in Elf_Details.h
 // Note:	Modifies the pointer to *buf by making it NULL
-int take_mem_back(void** buff, size_t numElem, size_t sizeElem)
+static int release_mem(void** buff, size_t numElem, size_t sizeElem, int sensitive)
 {
 	/* LOCAL VARIABLES */
 	int retVal = ERROR_SUCCESS;
@@ -1439,8 +2360,11 @@ int take_mem_back(void** buff, size_t numElem, size_t sizeElem)
 	else
 	{
 		// Zeroize the memory
-		memset(*buff, ZEROIZE_CHAR, numElem * sizeElem);
-		PERROR(errno);
+		if (should_zeroize(sensitive) == TRUE)
+		{
+			memset(*buff, ZEROIZE_CHAR, numElem * sizeElem);
+			PERROR(errno);
+		}
 
 		// Free the memory
 		free(*buff);
@@ -1502,7 +2426,7 @@ int convert_char_to_int(char* buffToConvert, int dataOffset, \
 		retVal = ERROR_BAD_ARG;
 		return retVal;
 	}
-	else if (numBytesToConvert > sizeof(value))
+	else if ((size_t)numBytesToConvert > sizeof(value))
 	{
 		retVal = ERROR_OVERFLOW;
 		return retVal;
@@ -1609,7 +2533,7 @@ int convert_char_to_uint64(char* buffToConvert, int dataOffset, \
 		retVal = ERROR_BAD_ARG;
 		return retVal;
 	}
-	else if (numBytesToConvert > sizeof(value))
+	else if ((size_t)numBytesToConvert > sizeof(value))
 	{
 		retVal = ERROR_OVERFLOW;
 		return retVal;
@@ -1693,7 +2617,6 @@ int convert_uint64_to_uint32(uint64_t inVal, uint32_t* outVal)
 	int retVal = ERROR_SUCCESS;	// Function's return value
 	uint32_t newVal = 0;		// Value to calculate from the input uint64_t
 	// uint32_t tmpVal = 0;		// Used to hold bits of the uint64_t
-	int i = 0;					// Iterating variable
 
 	/* INPUT VALIDATION */
 	if (!outVal)
@@ -1733,416 +2656,511 @@ int convert_uint64_to_uint32(uint64_t inVal, uint32_t* outVal)
 void print_binary(FILE* stream, void* valueToPrint, size_t numBytesToPrint, int bigEndian)
 {
 	/* LOCAL VARIABLES */
-	unsigned char mask = 0;			// Bit mask used to print bits
-	unsigned char printThis = 0;	// Value to print
-	int i = 0;					// Iterating variable
-	int j = 0;					// Iterating variable
-	// int numOfPasses = 0;	// Number of passes for the mask
+	struct Elf_Output* output = NULL;	// This thread's output buffer
 
 	/* INPUT VALIDATION */
 	if (!stream)
 	{
 		return;
 	}
-	else if (!valueToPrint)
-	{
-		fprintf(stream, " ");
-		return;
-	}
-	else if (numBytesToPrint < 1)
-	{
-		fprintf(stream, " ");
-		return;
-	}
-	else if (bigEndian != TRUE && bigEndian != FALSE)
+	output = get_thread_output(stream);
+	if (!valueToPrint || numBytesToPrint < 1 || (bigEndian != TRUE && bigEndian != FALSE))
 	{
-		fprintf(stream, " ");
-		return;
+		output_char(output, ' ');
 	}
-
 	/* START PRINTING */
-	if (bigEndian == TRUE)
+	else
 	{
-		for (i = 0; i < numBytesToPrint; i++)
-		{
-			printThis = (unsigned char)(*(unsigned char*)(valueToPrint + i));
+		output_binary(output, valueToPrint, numBytesToPrint, bigEndian);
+	}
+	flush_elf_output(output);
 
-			for (j = 7; j >= 0; j--)
-			{
-				if (j == 3)
-				{
-					fprintf(stream, " ");
-				}
+	return;
+}
 
-				mask = 1 << j;
-				// printf("i == %d\tj== %d\tMask:\t0x%02X\tCurrent Value:\t0x%02X\n", i, j, mask, printThis);  // DEBUGGING
-				if (printThis & mask)
-				{
-					fprintf(stream, "1");
-				}
-				else
-				{
-					fprintf(stream, "0");
-				}
-			}
-			fprintf(stream, " ");
-		}
-	}
-	else if (bigEndian == FALSE)
-	{
-		for (i = (numBytesToPrint - 1); i >= 0; i--)
-		{
-			printThis = (unsigned char)(*(unsigned char*)(valueToPrint + i));
 
-			for (j = 7; j >= 0; j--)
-			{
-				if (j == 3)
-				{
-					fprintf(stream, " ");
-				}
+/* STATIC LOOKUP TABLES */
+// Indexed directly by value.  NULL entries are values without a name.
+static const char* const elfHdrClassNames[] = {
+	[ELF_H_CLASS_NONE] = "Invalid class",
+	[ELF_H_CLASS_32] = "32-bit format",
+	[ELF_H_CLASS_64] = "64-bit format",
+};
+
+static const char* const elfHdrEndianNames[] = {
+	[ELF_H_DATA_NONE] = "Invalid data encoding",
+	[ELF_H_DATA_LITTLE] = "Little Endian",
+	[ELF_H_DATA_BIG] = "Big Endian",
+};
+
+static const char* const elfHdrTargetOSNames[] = {
+	[ELF_H_OSABI_SYSTEM_V] = "System V",
+	[ELF_H_OSABI_HP_UX] = "HP-UX",
+	[ELF_H_OSABI_NETBSD] = "NetBSD",
+	[ELF_H_OSABI_LINUX] = "Linux",
+	[ELF_H_OSABI_GNU_HURD] = "GNU Hurd",
+	[ELF_H_OSABI_SOLARIS] = "Solaris",
+	[ELF_H_OSABI_AIX] = "AIX",
+	[ELF_H_OSABI_IRIX] = "IRIX",
+	[ELF_H_OSABI_FREE_BSD] = "FreeBSD",
+	[ELF_H_OSABI_TRU64] = "Tru64",
+	[ELF_H_OSABI_NOVELL] = "Novell Modesto",
+	[ELF_H_OSABI_OPEN_BSD] = "OpenBSD",
+	[ELF_H_OSABI_OPEN_VMS] = "OpenVMS",
+	[ELF_H_OSABI_NONSTOP_K] = "NonStop Kernel",
+	[ELF_H_OSABI_AROS] = "AROS",
+	[ELF_H_OSABI_FENIX_OS] = "Fenix OS",
+	[ELF_H_OSABI_CLOUB_ABI] = "CloudABI",
+	[ELF_H_OSABI_SORTIX] = "Sortix",
+};
+
+// ELF_H_TYPE_LO_OS through ELF_H_TYPE_HI_PROC are ranges handled in get_elf_header_elf_type_name()
+static const char* const elfHdrElfTypeNames[] = {
+	[ELF_H_TYPE_NONE] = "No file type",
+	[ELF_H_TYPE_RELOCATABLE] = "Relocatable file",
+	[ELF_H_TYPE_EXECUTABLE] = "Executable file",
+	[ELF_H_TYPE_SHARED] = "Shared object file",
+	[ELF_H_TYPE_CORE] = "Core file",
+};
+
+static const char* const elfHdrISANames[] = {
+	[ELF_H_ISA_NONE] = "No machine",
+	[ELF_H_ISA_M32] = "AT&T WE 32100",
+	[ELF_H_ISA_SPARC] = "SPARC",
+	[ELF_H_ISA_386] = "Intel 80386",
+	[ELF_H_ISA_68K] = "Motorola 68000",
+	[ELF_H_ISA_88K] = "Motorola 88000",
+	[ELF_H_ISA_IAMCU] = "Intel MCU",
+	[ELF_H_ISA_860] = "Intel 80860",
+	[ELF_H_ISA_MIPS] = "MIPS I Architecture",
+	[ELF_H_ISA_S370] = "IBM System/370 Processor",
+	[ELF_H_ISA_MIPS_RS3_LE] = "MIPS RS3000 Little-endian",
+	[11] = "Reserved for future use",
+	[12] = "Reserved for future use",
+	[13] = "Reserved for future use",
+	[14] = "Reserved for future use",
+	[ELF_H_ISA_PARISC] = "Hewlett-Packard PA-RISC",
+	[16] = "Reserved for future use",
+	[ELF_H_ISA_VPP500] = "Fujitsu VPP500",
+	[ELF_H_ISA_SPARC32PLUS] = "Enhanced instruction set SPARC",
+	[ELF_H_ISA_960] = "Intel 80960",
+	[ELF_H_ISA_PPC] = "PowerPC",
+	[ELF_H_ISA_PPC64] = "64-bit PowerPC",
+	[ELF_H_ISA_S390] = "IBM System/390 Processor",
+	[ELF_H_ISA_SPU] = "IBM SPU/SPC",
+	[24] = "Reserved for future use",
+	[25] = "Reserved for future use",
+	[26] = "Reserved for future use",
+	[27] = "Reserved for future use",
+	[28] = "Reserved for future use",
+	[29] = "Reserved for future use",
+	[30] = "Reserved for future use",
+	[31] = "Reserved for future use",
+	[32] = "Reserved for future use",
+	[33] = "Reserved for future use",
+	[34] = "Reserved for future use",
+	[35] = "Reserved for future use",
+	[ELF_H_ISA_V800] = "NEC V800",
+	[ELF_H_ISA_FR20] = "Fujitsu FR20",
+	[ELF_H_ISA_RH32] = "TRW RH-32",
+	[ELF_H_ISA_RCE] = "Motorola RCE",
+	[ELF_H_ISA_ARM] = "Advanced RISC Machines ARM",
+	[ELF_H_ISA_ALPHA] = "Digital Alpha",
+	[ELF_H_ISA_SH] = "Hitachi SH",
+	[ELF_H_ISA_SPARCV9] = "SPARC Version 9",
+	[ELF_H_ISA_TRICORE] = "Siemens Tricore embedded processor",
+	[ELF_H_ISA_ARC] = "Argonaut RISC Core, Argonaut Technologies Inc.",
+	[ELF_H_ISA_H8_300] = "Hitachi H8/300",
+	[ELF_H_ISA_H8_300H] = "Hitachi H8/300H",
+	[ELF_H_ISA_H8S] = "Hitachi H8S",
+	[ELF_H_ISA_H8_500] = "Hitachi H8/500",
+	[ELF_H_ISA_IA_64] = "Intel IA-64 processor architecture",
+	[ELF_H_ISA_MIPS_X] = "Stanford MIPS-X",
+	[ELF_H_ISA_COLDFIRE] = "Motorola ColdFire",
+	[ELF_H_ISA_68HC12] = "Motorola M68HC12",
+	[ELF_H_ISA_MMA] = "Fujitsu MMA Multimedia Accelerator",
+	[ELF_H_ISA_PCP] = "Siemens PCP",
+	[ELF_H_ISA_NCPU] = "Sony nCPU embedded RISC processor",
+	[ELF_H_ISA_NDR1] = "Denso NDR1 microprocessor",
+	[ELF_H_ISA_STARCORE] = "Motorola Star*Core processor",
+	[ELF_H_ISA_ME16] = "Toyota ME16 processor",
+	[ELF_H_ISA_ST100] = "STMicroelectronics ST100 processor",
+	[ELF_H_ISA_TINYJ] = "Advanced Logic Corp. TinyJ embedded processor family",
+	[ELF_H_ISA_X86_64] = "AMD x86-64 architecture",
+	[ELF_H_ISA_PDSP] = "Sony DSP Processor",
+	[ELF_H_ISA_PDP10] = "Digital Equipment Corp. PDP-10",
+	[ELF_H_ISA_PDP11] = "Digital Equipment Corp. PDP-11",
+	[ELF_H_ISA_FX66] = "Siemens FX66 microcontroller",
+	[ELF_H_ISA_ST9PLUS] = "STMicroelectronics ST9+ 8/16 bit microcontroller",
+	[ELF_H_ISA_ST7] = "STMicroelectronics ST7 8-bit microcontroller",
+	[ELF_H_ISA_68HC16] = "Motorola MC68HC16 Microcontroller",
+	[ELF_H_ISA_68HC11] = "Motorola MC68HC11 Microcontroller",
+	[ELF_H_ISA_68HC08] = "Motorola MC68HC08 Microcontroller",
+	[ELF_H_ISA_68HC05] = "Motorola MC68HC05 Microcontroller",
+	[ELF_H_ISA_SVX] = "Silicon Graphics SVx",
+	[ELF_H_ISA_ST19] = "STMicroelectronics ST19 8-bit microcontroller",
+	[ELF_H_ISA_VAX] = "Digital VAX",
+	[ELF_H_ISA_CRIS] = "Axis Communications 32-bit embedded processor",
+	[ELF_H_ISA_JAVELIN] = "Infineon Technologies 32-bit embedded processor",
+	[ELF_H_ISA_FIREPATH] = "Element 14 64-bit DSP Processor",
+	[ELF_H_ISA_ZSP] = "LSI Logic 16-bit DSP Processor",
+	[ELF_H_ISA_MMIX] = "Donald Knuth's educational 64-bit processor",
+	[ELF_H_ISA_HUANY] = "Harvard University machine-independent object files",
+	[ELF_H_ISA_PRISM] = "SiTera Prism",
+};
+
+static const char* const elfHdrObjVerNames[] = {
+	[ELF_H_OBJ_V_NONE] = "Invalid version",
+	[ELF_H_OBJ_V_CURRENT] = "Current version",
+};
+
+// ELF_P_TYPE_LO_OS through ELF_P_TYPE_HI_PROC are handled in get_prgrm_header_type_name()
+static const char* const prgmHdrTypeNames[] = {
+	[ELF_P_TYPE_NULL] = "Unused entry",
+	[ELF_P_TYPE_LOAD] = "Loadable segment",
+	[ELF_P_TYPE_DYNAMIC] = "Dynamic linking information",
+	[ELF_P_TYPE_INTERP] = "Interpreter path",
+	[ELF_P_TYPE_NOTE] = "Auxiliary information",
+	[ELF_P_TYPE_SHLIB] = "Reserved",
+	[ELF_P_TYPE_PHDR] = "Program header table",
+	[ELF_P_TYPE_TLS] = "Thread-Local Storage template",
+};
+
+// ELF_S_TYPE_LO_OS through ELF_S_TYPE_HI_PROC are handled in get_sectn_header_type_name()
+static const char* const sectnHdrTypeNames[] = {
+	[ELF_S_TYPE_NULL] = "Unused entry",
+	[ELF_S_TYPE_PROGBITS] = "Program data",
+	[ELF_S_TYPE_SYMTAB] = "Symbol table",
+	[ELF_S_TYPE_STRTAB] = "String table",
+	[ELF_S_TYPE_RELA] = "Relocation entries with addends",
+	[ELF_S_TYPE_HASH] = "Symbol hash table",
+	[ELF_S_TYPE_DYNAMIC] = "Dynamic linking information",
+	[ELF_S_TYPE_NOTE] = "Notes",
+	[ELF_S_TYPE_NOBITS] = "Program space with no data (bss)",
+	[ELF_S_TYPE_REL] = "Relocation entries, no addends",
+	[ELF_S_TYPE_SHLIB] = "Reserved",
+	[ELF_S_TYPE_DYNSYM] = "Dynamic linker symbol table",
+	[ELF_S_TYPE_INIT_ARRAY] = "Array of constructors",
+	[ELF_S_TYPE_FINI_ARRAY] = "Array of destructors",
+	[ELF_S_TYPE_PREINIT_ARRAY] = "Array of pre-constructors",
+	[ELF_S_TYPE_GROUP] = "Section group",
+	[ELF_S_TYPE_SYMTAB_SHNDX] = "Extended section indices",
+};
+
+#define NUM_NAMES(nameTable) (sizeof(nameTable)/sizeof(*nameTable))
+
+
+// Purpose:	Index into one of the static lookup tables
+// Input:
+//			nameTable - Static table of names indexed by value
+//			numNames - Number of entries in nameTable
+//			value - Value to lookup
+// Output:	Name on success, NULL if value is out of range or has no name
+static const char* lookup_static_name(const char* const* nameTable, size_t numNames, unsigned int value)
+{
+	const char* retVal = NULL;
 
-				mask = 1 << j;
-				// printf("i == %d\tj== %d\tMask:\t0x%02X\tCurrent Value:\t0x%02X\n", i, j, mask, printThis);  // DEBUGGING
-				if (printThis & mask)
-				{
-					fprintf(stream, "1");
-				}
-				else
-				{
-					fprintf(stream, "0");
-				}
-			}
-			fprintf(stream, " ");
-		}
-	}
-	else
+	if (nameTable && value < numNames)
 	{
-		fprintf(stream, " ");
+		retVal = nameTable[value];
 	}
 
-	return;
+	return retVal;
 }
 
 
-// Purpose:	Build a HarkleDict of Elf Header Class definitions
-// Input:	None
+// Purpose:	Build a HarkleDict from one of the static lookup tables
+// Input:
+//			nameTable - Static table of names indexed by value
+//			numNames - Number of entries in nameTable
 // Output:	Pointer to the head node of a linked list of HarkleDicts
 // Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
-struct HarkleDict* init_elf_header_class_dict(void)
+static struct HarkleDict* build_dict_from_table(const char* const* nameTable, size_t numNames)
 {
 	/* LOCAL VARIABLES */
 	struct HarkleDict* retVal = NULL;
-	char* arrayOfNames[] = { "Invalid class", "32-bit format", "64-bit format" };
-	// fprintf(stdout, "ELF_H_CLASS_32:\t%s\n", STR_ME(ELF_H_CLASS_32));  // DEBUGGING
-	size_t numNames = sizeof(arrayOfNames)/sizeof(*arrayOfNames);
-	int arrayOfValues[] = { ELF_H_CLASS_NONE, ELF_H_CLASS_32, ELF_H_CLASS_64 };
-	size_t numValues = sizeof(arrayOfValues)/sizeof(*arrayOfValues);
-	int i = 0;
-
-	/* INPUT VALIDATION */
-	// Verify the parallel arrays are the same length
-	assert(numNames == numValues);
+	struct HarkleDict* tailNode = NULL;	// Appending to the tail avoids walking the list every time
+	struct HarkleDict* tmpNode = NULL;	// Newly built node
+	size_t i = 0;
 
 	for (i = 0; i < numNames; i++)
 	{
-		retVal = add_entry(retVal, (*(arrayOfNames + i)), (*(arrayOfValues + i)));
-		if (!retVal)
+		if (!nameTable[i])
 		{
-			fprintf(stderr, "Harkledict add_entry() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
-				(*(arrayOfNames + i)), (*(arrayOfValues + i)));
+			continue;
+		}
+
+		tmpNode = build_a_node((char*)nameTable[i], (int)i);
+		if (!tmpNode)
+		{
+			fprintf(stderr, "Harkledict build_a_node() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
+				nameTable[i], (int)i);
 			break;
 		}
+		else if (!retVal)
+		{
+			retVal = tmpNode;
+		}
+		else
+		{
+			tailNode->next = tmpNode;
+		}
+		tailNode = tmpNode;
 	}
 
 	return retVal;
 }
 
 
-// Purpose:	Build a HarkleDict of Elf Header Data definitions
-// Input:	None
-// Output:	Pointer to the head node of a linked list of HarkleDicts
-// Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
-struct HarkleDict* init_elf_header_endian_dict(void)
+// Purpose:	Lookup an Elf Header Class name
+// Input:	Value found at ELF Header offset 0x04
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_class_name(unsigned int value)
 {
-	/* LOCAL VARIABLES */
-	struct HarkleDict* retVal = NULL;
-	char* arrayOfNames[] = { "Invalid data encoding", "Little Endian", "Big Endian" };
-	size_t numNames = sizeof(arrayOfNames)/sizeof(*arrayOfNames);
-	int arrayOfValues[] = { ELF_H_DATA_NONE, ELF_H_DATA_LITTLE, ELF_H_DATA_BIG };
-	size_t numValues = sizeof(arrayOfValues)/sizeof(*arrayOfValues);
-	int i = 0;
+	return lookup_static_name(elfHdrClassNames, NUM_NAMES(elfHdrClassNames), value);
+}
 
-	/* INPUT VALIDATION */
-	// Verify the parallel arrays are the same length
-	assert(numNames == numValues);
 
-	for (i = 0; i < numNames; i++)
+// Purpose:	Lookup an Elf Header Data (endianness) name
+// Input:	Value found at ELF Header offset 0x05
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_endian_name(unsigned int value)
+{
+	return lookup_static_name(elfHdrEndianNames, NUM_NAMES(elfHdrEndianNames), value);
+}
+
+
+// Purpose:	Lookup an Elf Header Target OS ABI name
+// Input:	Value found at ELF Header offset 0x07
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_targetOS_name(unsigned int value)
+{
+	return lookup_static_name(elfHdrTargetOSNames, NUM_NAMES(elfHdrTargetOSNames), value);
+}
+
+
+// Purpose:	Lookup an Elf Header Type name
+// Input:	Value found at ELF Header offset 0x10
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_elf_type_name(unsigned int value)
+{
+	const char* retVal = NULL;
+
+	if (value >= ELF_H_TYPE_LO_OS && value <= ELF_H_TYPE_HI_OS)
 	{
-		retVal = add_entry(retVal, (*(arrayOfNames + i)), (*(arrayOfValues + i)));
-		if (!retVal)
-		{
-			fprintf(stderr, "Harkledict add_entry() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
-				(*(arrayOfNames + i)), (*(arrayOfValues + i)));
-			break;
-		}
+		retVal = "Operating system-specific";
+	}
+	else if (value >= ELF_H_TYPE_LO_PROC && value <= ELF_H_TYPE_HI_PROC)
+	{
+		retVal = "Processor-specific";
+	}
+	else
+	{
+		retVal = lookup_static_name(elfHdrElfTypeNames, NUM_NAMES(elfHdrElfTypeNames), value);
 	}
 
 	return retVal;
 }
 
 
-// Purpose:	Build a HarkleDict of Elf Header Target OS ABI definitions
-// Input:	None
-// Output:	Pointer to the head node of a linked list of HarkleDicts
-// Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
-struct HarkleDict* init_elf_header_targetOS_dict(void)
+// Purpose:	Lookup an Elf Header ISA name
+// Input:	Value found at ELF Header offset 0x12
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_isa_name(unsigned int value)
 {
-	/* LOCAL VARIABLES */
-	struct HarkleDict* retVal = NULL;
-	char* arrayOfNames[] = { \
-		"System V", "HP-UX", "NetBSD", \
-		"Linux", "GNU Hurd", "Solaris", \
-		"AIX", "IRIX", "FreeBSD", \
-		"Tru64", "Novell Modesto", "OpenBSD", \
-		"OpenVMS", "NonStop Kernel", "AROS", \
-		"Fenix OS", "CloudABI", "Sortix", \
-	};
-	size_t numNames = sizeof(arrayOfNames)/sizeof(*arrayOfNames);
-	int arrayOfValues[] = { \
-		ELF_H_OSABI_SYSTEM_V, ELF_H_OSABI_HP_UX, ELF_H_OSABI_NETBSD,\
-		ELF_H_OSABI_LINUX, ELF_H_OSABI_GNU_HURD, ELF_H_OSABI_SOLARIS,\
-		ELF_H_OSABI_AIX, ELF_H_OSABI_IRIX, ELF_H_OSABI_FREE_BSD,\
-		ELF_H_OSABI_TRU64, ELF_H_OSABI_NOVELL, ELF_H_OSABI_OPEN_BSD,\
-		ELF_H_OSABI_OPEN_VMS, ELF_H_OSABI_NONSTOP_K, ELF_H_OSABI_AROS,\
-		ELF_H_OSABI_FENIX_OS, ELF_H_OSABI_CLOUB_ABI, ELF_H_OSABI_SORTIX,\
-	};
-	size_t numValues = sizeof(arrayOfValues)/sizeof(*arrayOfValues);
-	int i = 0;
+	return lookup_static_name(elfHdrISANames, NUM_NAMES(elfHdrISANames), value);
+}
 
-	/* INPUT VALIDATION */
-	// Verify the parallel arrays are the same length
-	assert(numNames == numValues);
 
-	for (i = 0; i < numNames; i++)
+// Purpose:	Lookup an Elf Header Object File Version name
+// Input:	Value found at ELF Header offset 0x14
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_obj_version_name(unsigned int value)
+{
+	return lookup_static_name(elfHdrObjVerNames, NUM_NAMES(elfHdrObjVerNames), value);
+}
+
+
+// Purpose:	Lookup a Program Header Segment Type name
+// Input:	Value found at Program Header offset 0x00
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_prgrm_header_type_name(unsigned int value)
+{
+	const char* retVal = NULL;
+
+	switch (value)
 	{
-		retVal = add_entry(retVal, (*(arrayOfNames + i)), (*(arrayOfValues + i)));
-		if (!retVal)
-		{
-			fprintf(stderr, "Harkledict add_entry() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
-				(*(arrayOfNames + i)), (*(arrayOfValues + i)));
+		case ELF_P_TYPE_GNU_EH_FRAME:
+			retVal = "GNU exception handling frame";
 			break;
-		}
+		case ELF_P_TYPE_GNU_STACK:
+			retVal = "GNU stack permissions";
+			break;
+		case ELF_P_TYPE_GNU_RELRO:
+			retVal = "GNU read-only after relocation";
+			break;
+		case ELF_P_TYPE_GNU_PROPERTY:
+			retVal = "GNU property notes";
+			break;
+		default:
+			if (value >= ELF_P_TYPE_LO_OS && value <= ELF_P_TYPE_HI_OS)
+			{
+				retVal = "Operating system-specific";
+			}
+			else if (value >= ELF_P_TYPE_LO_PROC && value <= ELF_P_TYPE_HI_PROC)
+			{
+				retVal = "Processor-specific";
+			}
+			else
+			{
+				retVal = lookup_static_name(prgmHdrTypeNames, NUM_NAMES(prgmHdrTypeNames), value);
+			}
 	}
 
 	return retVal;
 }
 
 
-// Purpose:	Build a HarkleDict of Elf Header Type definitions
-// Input:	None
-// Output:	Pointer to the head node of a linked list of HarkleDicts
-// Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
-struct HarkleDict* init_elf_header_elf_type_dict(void)
+// Purpose:	Lookup a Section Header Type name
+// Input:	Value found at Section Header offset 0x04
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_sectn_header_type_name(unsigned int value)
 {
-	/* LOCAL VARIABLES */
-	struct HarkleDict* retVal = NULL;
-	char* arrayOfNames[] = { \
-		"No file type", "Relocatable file", \
-		"Executable file", "Shared object file", \
-		"Core file", \
-	};
-	size_t numNames = sizeof(arrayOfNames)/sizeof(*arrayOfNames);
-	int arrayOfValues[] = { \
-		ELF_H_TYPE_NONE, ELF_H_TYPE_RELOCATABLE, \
-		ELF_H_TYPE_EXECUTABLE, ELF_H_TYPE_SHARED, \
-		ELF_H_TYPE_CORE, \
-	};
-	size_t numValues = sizeof(arrayOfValues)/sizeof(*arrayOfValues);
-	int i = 0;
-
-	/* INPUT VALIDATION */
-	// Verify the parallel arrays are the same length
-	assert(numNames == numValues);
+	const char* retVal = NULL;
 
-	for (i = 0; i < numNames; i++)
+	switch (value)
 	{
-		retVal = add_entry(retVal, (*(arrayOfNames + i)), (*(arrayOfValues + i)));
-		if (!retVal)
-		{
-			fprintf(stderr, "Harkledict add_entry() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
-				(*(arrayOfNames + i)), (*(arrayOfValues + i)));
+		case ELF_S_TYPE_GNU_HASH:
+			retVal = "GNU-style hash table";
 			break;
-		}
-	}
-
-	for (i = ELF_H_TYPE_LO_OS; i <= ELF_H_TYPE_HI_OS; i++)
-	{
-		retVal = add_entry(retVal, "Operating system-specific", i);
-		if (!retVal)
-		{
-			fprintf(stderr, "Harkledict add_entry() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
-				"Operating system-specific", i);
+		case ELF_S_TYPE_GNU_VERDEF:
+			retVal = "GNU version definitions";
 			break;
-		}
-	}
-
-	for (i = ELF_H_TYPE_LO_PROC; i <= ELF_H_TYPE_HI_PROC; i++)
-	{
-		retVal = add_entry(retVal, "Processor-specific", i);
-		if (!retVal)
-		{
-			fprintf(stderr, "Harkledict add_entry() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
-				"Processor-specific", i);
+		case ELF_S_TYPE_GNU_VERNEED:
+			retVal = "GNU version needs";
 			break;
-		}
+		case ELF_S_TYPE_GNU_VERSYM:
+			retVal = "GNU version symbol table";
+			break;
+		default:
+			if (value >= ELF_S_TYPE_LO_OS && value <= ELF_S_TYPE_HI_OS)
+			{
+				retVal = "Operating system-specific";
+			}
+			else if (value >= ELF_S_TYPE_LO_PROC && value <= ELF_S_TYPE_HI_PROC)
+			{
+				retVal = "Processor-specific";
+			}
+			else
+			{
+				retVal = lookup_static_name(sectnHdrTypeNames, NUM_NAMES(sectnHdrTypeNames), value);
+			}
 	}
 
 	return retVal;
 }
 
 
-// Purpose:	Build a HarkleDict of Elf Header ISA definitions
+// Purpose:	Build a HarkleDict of Elf Header Class definitions
 // Input:	None
 // Output:	Pointer to the head node of a linked list of HarkleDicts
-// Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
-struct HarkleDict* init_elf_header_isa_dict(void)
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_class_name()
+struct HarkleDict* init_elf_header_class_dict(void)
+{
+	return build_dict_from_table(elfHdrClassNames, NUM_NAMES(elfHdrClassNames));
+}
+
+
+// Purpose:	Build a HarkleDict of Elf Header Data definitions
+// Input:	None
+// Output:	Pointer to the head node of a linked list of HarkleDicts
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_endian_name()
+struct HarkleDict* init_elf_header_endian_dict(void)
+{
+	return build_dict_from_table(elfHdrEndianNames, NUM_NAMES(elfHdrEndianNames));
+}
+
+
+// Purpose:	Build a HarkleDict of Elf Header Target OS ABI definitions
+// Input:	None
+// Output:	Pointer to the head node of a linked list of HarkleDicts
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_targetOS_name()
+struct HarkleDict* init_elf_header_targetOS_dict(void)
+{
+	return build_dict_from_table(elfHdrTargetOSNames, NUM_NAMES(elfHdrTargetOSNames));
+}
+
+
+// Purpose:	Build a HarkleDict of Elf Header Type definitions
+// Input:	None
+// Output:	Pointer to the head node of a linked list of HarkleDicts
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_elf_type_name()
+struct HarkleDict* init_elf_header_elf_type_dict(void)
 {
 	/* LOCAL VARIABLES */
 	struct HarkleDict* retVal = NULL;
-	// The following arrays may not be in numerical order but they are still
-	//	parallel.
-	// FUN FACT: The arrays were originally created with an old list of ISAs and later updated.
-	char* arrayOfNames[] = { \
-		"No machine", "AT&T WE 32100", "SPARC", \
-		"Intel 80386", "Motorola 68000", "Motorola 88000", \
-		"Intel 80860", "MIPS I Architecture", "IBM System/370 Processor", \
-		"MIPS RS3000 Little-endian", "Hewlett-Packard PA-RISC", "Fujitsu VPP500", \
-		"Enhanced instruction set SPARC", "Intel 80960", "PowerPC", \
-		"64-bit PowerPC", "NEC V800", "Fujitsu FR20", \
-		"TRW RH-32", "Motorola RCE", "Advanced RISC Machines ARM", \
-		"Digital Alpha", "Hitachi SH", "SPARC Version 9", \
-		"Siemens Tricore embedded processor", "Argonaut RISC Core, Argonaut Technologies Inc.", "Hitachi H8/300", \
-		"Hitachi H8/300H", "Hitachi H8S", "Hitachi H8/500", \
-		"Intel IA-64 processor architecture", "Stanford MIPS-X", "Motorola ColdFire", \
-		"Motorola M68HC12", "Fujitsu MMA Multimedia Accelerator", "Siemens PCP", \
-		"Sony nCPU embedded RISC processor", "Denso NDR1 microprocessor", "Motorola Star*Core processor", \
-		"Toyota ME16 processor", "STMicroelectronics ST100 processor", "Advanced Logic Corp. TinyJ embedded processor family", \
-		"Siemens FX66 microcontroller", "STMicroelectronics ST9+ 8/16 bit microcontroller", "STMicroelectronics ST7 8-bit microcontroller", \
-		"Motorola MC68HC16 Microcontroller", "Motorola MC68HC11 Microcontroller", "Motorola MC68HC08 Microcontroller", \
-		"Motorola MC68HC05 Microcontroller", "Silicon Graphics SVx", "STMicroelectronics ST19 8-bit microcontroller", \
-		"Digital VAX", "Axis Communications 32-bit embedded processor", "Infineon Technologies 32-bit embedded processor", \
-		"Element 14 64-bit DSP Processor", "LSI Logic 16-bit DSP Processor", "Donald Knuth's educational 64-bit processor", \
-		"Harvard University machine-independent object files", "SiTera Prism", "Intel MCU", \
-		"IBM System/390 Processor", "IBM SPU/SPC", "AMD x86-64 architecture", \
-		"Sony DSP Processor", "Digital Equipment Corp. PDP-10", "Digital Equipment Corp. PDP-11", \
-	};
-	size_t numNames = sizeof(arrayOfNames)/sizeof(*arrayOfNames);
-	int arrayOfValues[] = { \
-		ELF_H_ISA_NONE, ELF_H_ISA_M32, ELF_H_ISA_SPARC, \
-		ELF_H_ISA_386, ELF_H_ISA_68K, ELF_H_ISA_88K, \
-		ELF_H_ISA_860, ELF_H_ISA_MIPS, ELF_H_ISA_S370, \
-		ELF_H_ISA_MIPS_RS3_LE, ELF_H_ISA_PARISC, ELF_H_ISA_VPP500, \
-		ELF_H_ISA_SPARC32PLUS, ELF_H_ISA_960, ELF_H_ISA_PPC, \
-		ELF_H_ISA_PPC64, ELF_H_ISA_V800, ELF_H_ISA_FR20, \
-		ELF_H_ISA_RH32, ELF_H_ISA_RCE, ELF_H_ISA_ARM, \
-		ELF_H_ISA_ALPHA, ELF_H_ISA_SH, ELF_H_ISA_SPARCV9, \
-		ELF_H_ISA_TRICORE, ELF_H_ISA_ARC, ELF_H_ISA_H8_300, \
-		ELF_H_ISA_H8_300H, ELF_H_ISA_H8S, ELF_H_ISA_H8_500, \
-		ELF_H_ISA_IA_64, ELF_H_ISA_MIPS_X, ELF_H_ISA_COLDFIRE, \
-		ELF_H_ISA_68HC12, ELF_H_ISA_MMA, ELF_H_ISA_PCP, \
-		ELF_H_ISA_NCPU, ELF_H_ISA_NDR1, ELF_H_ISA_STARCORE, \
-		ELF_H_ISA_ME16, ELF_H_ISA_ST100, ELF_H_ISA_TINYJ, \
-		ELF_H_ISA_FX66, ELF_H_ISA_ST9PLUS, ELF_H_ISA_ST7, \
-		ELF_H_ISA_68HC16, ELF_H_ISA_68HC11, ELF_H_ISA_68HC08, \
-		ELF_H_ISA_68HC05, ELF_H_ISA_SVX, ELF_H_ISA_ST19, \
-		ELF_H_ISA_VAX, ELF_H_ISA_CRIS, ELF_H_ISA_JAVELIN, \
-		ELF_H_ISA_FIREPATH, ELF_H_ISA_ZSP, ELF_H_ISA_MMIX, \
-		ELF_H_ISA_HUANY, ELF_H_ISA_PRISM, ELF_H_ISA_IAMCU, \
-		ELF_H_ISA_S390, ELF_H_ISA_SPU, ELF_H_ISA_X86_64, \
-		ELF_H_ISA_PDSP, ELF_H_ISA_PDP10, ELF_H_ISA_PDP11, \
-	};
-	size_t numValues = sizeof(arrayOfValues)/sizeof(*arrayOfValues);
+	struct HarkleDict* tailNode = NULL;	// Appending to the tail avoids walking the list every time
 	int i = 0;
 
-	/* INPUT VALIDATION */
-	// Verify the parallel arrays are the same length
-	assert(numNames == numValues);
+	retVal = build_dict_from_table(elfHdrElfTypeNames, NUM_NAMES(elfHdrElfTypeNames));
+	tailNode = find_last_node(retVal);
 
-	for (i = 0; i < numNames; i++)
+	for (i = ELF_H_TYPE_LO_OS; tailNode && i <= ELF_H_TYPE_HI_PROC; i++)
 	{
-		retVal = add_entry(retVal, (*(arrayOfNames + i)), (*(arrayOfValues + i)));
-		if (!retVal)
+		if (i > ELF_H_TYPE_HI_OS && i < ELF_H_TYPE_LO_PROC)
 		{
-			fprintf(stderr, "Harkledict add_entry() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
-				(*(arrayOfNames + i)), (*(arrayOfValues + i)));
-			break;
+			continue;
 		}
-	}
 
-	// RESERVED ENTRIES
-	// RESERVED 	11-14 	Reserved for future use
-	for (i = 11; i <= 14; i++)
-	{
-		retVal = add_entry(retVal, "Reserved for future use", i);
-		if (!retVal)
-		{
-			fprintf(stderr, "Harkledict add_entry() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
-				"Reserved for future use", i);
-			break;
-		}
-	}
-	// RESERVED 	16 	Reserved for future use
-	i = 16;  
-	retVal = add_entry(retVal, "Reserved for future use", i);
-	if (!retVal)
-	{
-		fprintf(stderr, "Harkledict add_entry() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
-			"Reserved for future use", i);
-	}
-	// RESERVED 	24-35 	Reserved for future use
-	for (i = 24; i <= 35; i++)
-	{
-		retVal = add_entry(retVal, "Reserved for future use", i);
-		if (!retVal)
+		tailNode->next = build_a_node((char*)get_elf_header_elf_type_name(i), i);
+		if (!tailNode->next)
 		{
-			fprintf(stderr, "Harkledict add_entry() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
-				"Reserved for future use", i);
+			fprintf(stderr, "Harkledict build_a_node() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
+				get_elf_header_elf_type_name(i), i);
 			break;
 		}
+		tailNode = tailNode->next;
 	}
 
 	return retVal;
 }
 
 
-// Purpose:	Build a HarkleDict of Elf Header Object File Version definitions
+// Purpose:	Build a HarkleDict of Elf Header ISA definitions
 // Input:	None
 // Output:	Pointer to the head node of a linked list of HarkleDicts
-// Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
-struct HarkleDict* init_elf_header_obj_version_dict(void)
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_isa_name()
+struct HarkleDict* init_elf_header_isa_dict(void)
 {
-	/* LOCAL VARIABLES */
-	struct HarkleDict* retVal = NULL;
-	char* arrayOfNames[] = { "Invalid version", "Current version" };
-	size_t numNames = sizeof(arrayOfNames)/sizeof(*arrayOfNames);
-	int arrayOfValues[] = { ELF_H_OBJ_V_NONE, ELF_H_OBJ_V_CURRENT };
-	size_t numValues = sizeof(arrayOfValues)/sizeof(*arrayOfValues);
-	int i = 0;
-
-	/* INPUT VALIDATION */
-	// Verify the parallel arrays are the same length
-	assert(numNames == numValues);
+	return build_dict_from_table(elfHdrISANames, NUM_NAMES(elfHdrISANames));
+}
 
-	for (i = 0; i < numNames; i++)
-	{
-		retVal = add_entry(retVal, (*(arrayOfNames + i)), (*(arrayOfValues + i)));
-		if (!retVal)
-		{
-			fprintf(stderr, "Harkledict add_entry() returned NULL for:\n\tName:\t%s\n\tValue:\t%d\n", \
-				(*(arrayOfNames + i)), (*(arrayOfValues + i)));
-			break;
-		}
-	}
 
-	return retVal;
+// Purpose:	Build a HarkleDict of Elf Header Object File Version definitions
+// Input:	None
+// Output:	Pointer to the head node of a linked list of HarkleDicts
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_obj_version_name()
+struct HarkleDict* init_elf_header_obj_version_dict(void)
+{
+	return build_dict_from_table(elfHdrObjVerNames, NUM_NAMES(elfHdrObjVerNames));
 }
@@ -4,6 +4,11 @@
 #ifndef __ELF_DETAILS_H__
 #define __ELF_DETAILS_H__
 
+#include "Elf_Arena.h"
+#include "Elf_Context.h"
+#include "Elf_Decode.h"
+#include "Elf_Output.h"
+#include "Elf_Symbols.h"
 #include "Harklehash.h"
 #include <errno.h>
 #include <stdint.h>
@@ -14,10 +19,22 @@
 #define ERROR_BAD_ARG	((int)-2)	// Bad arguments
 #define ERROR_ORC_FILE	((int)-3)	// Indicates this is not an ELF file
 #define ERROR_OVERFLOW	((int)-4)	// The given data type will overflow
+#define ERROR_BAD_OFFSET ((int)-5)	// An offset or size points outside of the file
 #define MAX_RETRIES		((int)10)	// Number of times to retry a function call before giving up
 #define ZEROIZE_VALUE	((int)42)	// Value used to 'clear' int values
 #define ZEROIZE_CHAR	((char)'H') // Character used to memset free()'d memory
+#define ZEROIZE_ALWAYS		((int)0)	// Zeroize every buffer before it is free()'d
+#define ZEROIZE_NEVER		((int)1)	// Never zeroize, just free()
+#define ZEROIZE_SENSITIVE	((int)2)	// Only zeroize buffers released by take_sensitive_mem_back()
+// Sensitive buffers are heap copies of file contents: read_elf() when the file can't be
+//	mapped (e.g., pipes) and the note areas read_elf_build_id() copies out.  Mapped views
+//	(read_elf_mapped(), read_elf_arena()) are read-only and are never zeroized, so under
+//	ZEROIZE_SENSITIVE most scans zeroize nothing.
+#ifndef ZEROIZE_POLICY
+#define ZEROIZE_POLICY	ZEROIZE_ALWAYS	// Build-time default (e.g., -DZEROIZE_POLICY=ZEROIZE_NEVER)
+#endif // ZEROIZE_POLICY
 #define HEADER_DELIM	((char)'#')	// Character used to print fance output headers
+#define READ_CHUNK_SIZE	((size_t)65536)	// Bytes per read when a file's size can't be taken from metadata
 // #define DEBUGLEROAD					// No IDEs were harmed during the coding of this project
 
 #ifndef TRUE
@@ -165,10 +182,144 @@ do { if (errnum) { printf("Error Number:\t%d\nError Description:\t%s\n", errnum,
 // Object File Version 0x14 - 0x17
 #define ELF_H_OBJ_V_NONE		0				// Invalid version
 #define ELF_H_OBJ_V_CURRENT		1				// Current version
+// ELF Header Size
+#define ELF_H_SIZE_32			52				// ELFCLASS32 header is 0x34 bytes
+#define ELF_H_SIZE_64			64				// ELFCLASS64 header is 0x40 bytes
 /****************************/
 /***** ELF HEADER STOP ******/
 /****************************/
 
+/****************************/
+/*** PROGRAM HEADER START ***/
+/****************************/
+// Segment Type 0x00
+#define ELF_P_TYPE_NULL			0x00000000		// Unused entry
+#define ELF_P_TYPE_LOAD			0x00000001		// Loadable segment
+#define ELF_P_TYPE_DYNAMIC		0x00000002		// Dynamic linking information
+#define ELF_P_TYPE_INTERP		0x00000003		// Path to an interpreter
+#define ELF_P_TYPE_NOTE			0x00000004		// Auxiliary information
+#define ELF_P_TYPE_SHLIB		0x00000005		// Reserved
+#define ELF_P_TYPE_PHDR			0x00000006		// The program header table itself
+#define ELF_P_TYPE_TLS			0x00000007		// Thread-Local Storage template
+#define ELF_P_TYPE_LO_OS		0x60000000		// Operating system-specific (start)
+#define ELF_P_TYPE_GNU_EH_FRAME	0x6474E550		// GCC .eh_frame_hdr segment
+#define ELF_P_TYPE_GNU_STACK	0x6474E551		// Stack executability
+#define ELF_P_TYPE_GNU_RELRO	0x6474E552		// Read-only after relocation
+#define ELF_P_TYPE_GNU_PROPERTY	0x6474E553		// GNU property notes
+#define ELF_P_TYPE_HI_OS		0x6FFFFFFF		// Operating system-specific (stop)
+#define ELF_P_TYPE_LO_PROC		0x70000000		// Processor-specific (start)
+#define ELF_P_TYPE_HI_PROC		0x7FFFFFFF		// Processor-specific (stop)
+// Segment Flags 0x04 (64-bit) or 0x18 (32-bit)
+#define ELF_P_FLAG_X			0x1				// Execute
+#define ELF_P_FLAG_W			0x2				// Write
+#define ELF_P_FLAG_R			0x4				// Read
+// Program Header Entry Size
+#define ELF_P_SIZE_32			32				// ELFCLASS32 entry is 0x20 bytes
+#define ELF_P_SIZE_64			56				// ELFCLASS64 entry is 0x38 bytes
+// Program Header Entry Count
+#define ELF_P_NUM_XNUM			0xFFFF			// Real count is held in section 0's info
+/****************************/
+/**** PROGRAM HEADER STOP ***/
+/****************************/
+
+/****************************/
+/*** SECTION HEADER START ***/
+/****************************/
+// Special Section Indexes
+#define ELF_S_INDEX_UNDEF		0x0000			// Undefined section
+#define ELF_S_INDEX_LO_RESERVE	0xFF00			// Start of the reserved indexes
+#define ELF_S_INDEX_ABS			0xFFF1			// Absolute value, not relative to a section
+#define ELF_S_INDEX_COMMON		0xFFF2			// Unallocated common block
+#define ELF_S_INDEX_XINDEX		0xFFFF			// Real index is held elsewhere (e.g., section 0's link)
+// Section Type 0x04
+#define ELF_S_TYPE_NULL			0x00			// Unused entry
+#define ELF_S_TYPE_PROGBITS		0x01			// Program data
+#define ELF_S_TYPE_SYMTAB		0x02			// Symbol table
+#define ELF_S_TYPE_STRTAB		0x03			// String table
+#define ELF_S_TYPE_RELA			0x04			// Relocation entries with addends
+#define ELF_S_TYPE_HASH			0x05			// Symbol hash table
+#define ELF_S_TYPE_DYNAMIC		0x06			// Dynamic linking information
+#define ELF_S_TYPE_NOTE			0x07			// Notes
+#define ELF_S_TYPE_NOBITS		0x08			// Program space with no data (bss)
+#define ELF_S_TYPE_REL			0x09			// Relocation entries, no addends
+#define ELF_S_TYPE_SHLIB		0x0A			// Reserved
+#define ELF_S_TYPE_DYNSYM		0x0B			// Dynamic linker symbol table
+#define ELF_S_TYPE_INIT_ARRAY	0x0E			// Array of constructors
+#define ELF_S_TYPE_FINI_ARRAY	0x0F			// Array of destructors
+#define ELF_S_TYPE_PREINIT_ARRAY	0x10		// Array of pre-constructors
+#define ELF_S_TYPE_GROUP		0x11			// Section group
+#define ELF_S_TYPE_SYMTAB_SHNDX	0x12			// Extended section indices
+#define ELF_S_TYPE_LO_OS		0x60000000		// Operating system-specific (start)
+#define ELF_S_TYPE_GNU_HASH		0x6FFFFFF6		// GNU-style hash table
+#define ELF_S_TYPE_GNU_VERDEF	0x6FFFFFFD		// GNU version definitions
+#define ELF_S_TYPE_GNU_VERNEED	0x6FFFFFFE		// GNU version needs
+#define ELF_S_TYPE_GNU_VERSYM	0x6FFFFFFF		// GNU version symbol table
+#define ELF_S_TYPE_HI_OS		0x6FFFFFFF		// Operating system-specific (stop)
+#define ELF_S_TYPE_LO_PROC		0x70000000		// Processor-specific (start)
+#define ELF_S_TYPE_HI_PROC		0x7FFFFFFF		// Processor-specific (stop)
+// Section Flags 0x08
+#define ELF_S_FLAG_WRITE		0x001			// Writable
+#define ELF_S_FLAG_ALLOC		0x002			// Occupies memory during execution
+#define ELF_S_FLAG_EXECINSTR	0x004			// Executable
+#define ELF_S_FLAG_MERGE		0x010			// Might be merged
+#define ELF_S_FLAG_STRINGS		0x020			// Contains nul-terminated strings
+#define ELF_S_FLAG_INFO_LINK	0x040			// info holds a section index
+#define ELF_S_FLAG_TLS			0x400			// Thread-Local Storage
+// Section Header Entry Size
+#define ELF_S_SIZE_32			40				// ELFCLASS32 entry is 0x28 bytes
+#define ELF_S_SIZE_64			64				// ELFCLASS64 entry is 0x40 bytes
+/****************************/
+/**** SECTION HEADER STOP ***/
+/****************************/
+
+/****************************/
+/**** SYMBOL TABLE START ****/
+/****************************/
+// Symbol Binding (high nibble of info)
+#define ELF_SYM_BIND(info)		((info) >> 4)
+#define ELF_SYM_BIND_LOCAL		0x0				// Not visible outside the object file
+#define ELF_SYM_BIND_GLOBAL		0x1				// Visible to every object file
+#define ELF_SYM_BIND_WEAK		0x2				// Global, but with lower precedence
+// Symbol Type (low nibble of info)
+#define ELF_SYM_TYPE(info)		((info) & 0xF)
+#define ELF_SYM_TYPE_NOTYPE		0x0				// Unspecified
+#define ELF_SYM_TYPE_OBJECT		0x1				// Data object
+#define ELF_SYM_TYPE_FUNC		0x2				// Function or other executable code
+#define ELF_SYM_TYPE_SECTION	0x3				// Section
+#define ELF_SYM_TYPE_FILE		0x4				// Source file
+#define ELF_SYM_TYPE_COMMON		0x5				// Uninitialized common block
+#define ELF_SYM_TYPE_TLS		0x6				// Thread-Local Storage (value is an offset)
+#define ELF_SYM_TYPE_GNU_IFUNC	0xA				// Indirect function
+// Symbol Table Entry Size
+#define ELF_SYM_SIZE_32			16				// ELFCLASS32 entry is 0x10 bytes
+#define ELF_SYM_SIZE_64			24				// ELFCLASS64 entry is 0x18 bytes
+/****************************/
+/**** SYMBOL TABLE STOP *****/
+/****************************/
+
+/****************************/
+/*** DYNAMIC SECTION START **/
+/****************************/
+// Dynamic Entry Tag
+#define ELF_D_TAG_NULL			0				// Marks the end of the array
+#define ELF_D_TAG_NEEDED		1				// String table offset of a needed library
+#define ELF_D_TAG_STRTAB		5				// Address of the dynamic string table
+#define ELF_D_TAG_STRSZ			10				// Size of the dynamic string table (bytes)
+#define ELF_D_TAG_SONAME		14				// String table offset of this object's name
+#define ELF_D_TAG_RPATH			15				// String table offset of the library search path (deprecated)
+#define ELF_D_TAG_RUNPATH		29				// String table offset of the library search path
+#define ELF_D_TAG_FLAGS			30				// Flags (see: ELF_D_FLAG_*)
+#define ELF_D_TAG_FLAGS_1		0x6FFFFFFB		// GNU state flags
+// Dynamic Flags (ELF_D_TAG_FLAGS)
+#define ELF_D_FLAG_ORIGIN		0x01			// May use $ORIGIN
+#define ELF_D_FLAG_SYMBOLIC		0x02			// Symbol resolution starts with this object
+#define ELF_D_FLAG_TEXTREL		0x04			// Relocations may modify a non-writable segment
+#define ELF_D_FLAG_BIND_NOW		0x08			// Resolve every relocation at load time
+#define ELF_D_FLAG_STATIC_TLS	0x10			// Uses the static TLS model
+/****************************/
+/*** DYNAMIC SECTION STOP ***/
+/****************************/
+
 /* sectionsToPrint Flags for print_elf_details() */
 #define PRINT_EVERYTHING		((unsigned int)1)			// Print everything
 #define PRINT_ELF_HEADER		(((unsigned int)1) << 1)	// Print the ELF header
@@ -177,21 +328,64 @@ do { if (errnum) { printf("Error Number:\t%d\nError Description:\t%s\n", errnum,
 #define PRINT_ELF_PRGRM_DATA	(((unsigned int)1) << 4)	// Print the Program header data
 #define PRINT_ELF_SECTN_DATA	(((unsigned int)1) << 5)	// Print the Section header data 
 
+// One program header table entry, normalized to host endianness
+// 32-bit fields are widened so both classes share one fixed-width record
+struct Elf_Prgrm_Header
+{
+	uint32_t type;		// Segment type (see: ELF_P_TYPE_*)
+	uint32_t flags;		// Segment permissions (see: ELF_P_FLAG_*)
+	uint64_t offset;	// Offset of the segment in the file
+	uint64_t vaddr;		// Virtual address of the segment in memory
+	uint64_t paddr;		// Physical address of the segment (where relevant)
+	uint64_t filesz;	// Size of the segment in the file (bytes)
+	uint64_t memsz;		// Size of the segment in memory (bytes)
+	uint64_t align;		// Alignment of the segment
+};
+
+// One section header table entry, normalized to host endianness
+// 32-bit fields are widened so both classes share one fixed-width record
+struct Elf_Sectn_Header
+{
+	uint32_t name;		// Offset of the section name in the section name string table
+	uint32_t type;		// Section type (see: ELF_S_TYPE_*)
+	uint64_t flags;		// Section attributes (see: ELF_S_FLAG_*)
+	uint64_t addr;		// Virtual address of the section in memory
+	uint64_t offset;	// Offset of the section in the file
+	uint64_t size;		// Size of the section (bytes)
+	uint32_t link;		// Section index of an associated section
+	uint32_t info;		// Extra information (depends on type)
+	uint64_t addralign;	// Alignment of the section
+	uint64_t entsize;	// Size of each entry for sections that hold fixed-size entries
+};
+
+// One symbol table entry, normalized to host endianness
+// 32-bit fields are widened so both classes share one fixed-width record
+struct Elf_Symbol
+{
+	uint32_t name;		// Offset of the symbol name in the linked string table
+	unsigned char info;	// Binding and type (see: ELF_SYM_BIND(), ELF_SYM_TYPE())
+	unsigned char other;	// Visibility
+	uint16_t shndx;		// Index of the section the symbol is defined in (see: ELF_S_INDEX_*)
+	uint64_t value;		// Address of the symbol
+	uint64_t size;		// Size of the symbol (bytes)
+	const char* symName;	// Resolved name (points into the parsed buffer), NULL if unnamed or invalid
+};
+
 struct Elf_Details
 {
 	char* fileName;		// Absolute or relative path
-	char* magicNum;		// First four bytes of file
-	char* elfClass;		// 32 or 64 bit
+	const char* magicNum;	// First four bytes of file
+	const char* elfClass;	// 32 or 64 bit
 	int processorType;	// 32 or 64 bit
-	char* endianness;	// Little or Big
+	const char* endianness;	// Little or Big
 	int bigEndian;		// If TRUE, bigEndian
 	int elfVersion;		// ELF version
-	char* targetOS;		// Target OS ABI
+	const char* targetOS;	// Target OS ABI
 	int ABIversion;		// Version of the ABI
 	char* pad;			// Unused portion
-	char* type;			// The type of ELF file
-	char* ISA;			// Specifies target Instruction Set Architecture
-	char* objVersion;	// Object File Version
+	const char* type;	// The type of ELF file
+	const char* ISA;	// Specifies target Instruction Set Architecture
+	const char* objVersion;	// Object File Version
 	uint32_t ePnt32;	// 32-bit memory address of the entry point from where the process starts executing
 	uint64_t ePnt64;	// 64-bit memory address of the entry point from where the process starts executing
 	uint32_t pHdr32;	// 32-bit address offset of the program header table
@@ -205,24 +399,160 @@ struct Elf_Details
 	int sectHdrSize;	// Contains the size of a section header table entry.
 	int sectHdrEntrNum;	// Number of entries in the section header table
 	int sectHdrSectNms;	// Index of the section header table entry with section names
+	struct Elf_Prgrm_Header* prgmHdrs;	// Contiguous array of decoded program header table entries
+	int numPrgmHdrs;	// Number of entries in prgmHdrs
+	struct Elf_Sectn_Header* sectHdrs;	// Contiguous array of decoded section header table entries
+	int numSectHdrs;	// Number of entries in sectHdrs
+	const char* sectNames;	// Section name string table (points into the parsed buffer)
+	uint64_t sectNamesSize;	// Number of bytes in sectNames
+	char* elfGuts;		// File contents retained by read_elf() and read_elf_mapped()
+	size_t elfSize;		// Number of bytes in elfGuts (also read by parse_elf() as the contents length)
+	int gutsMapped;		// If TRUE, elfGuts is an mmap()'d view that must be munmap()'d
+	struct Elf_Arena* arena;	// If not NULL, this struct and everything it owns live in this arena
+	int arenaShared;	// If TRUE, arena belongs to the caller (see: Elf_Context) and outlives this struct
+	struct Elf_Context* context;	// Where diagnostics go (NULL for stderr)
+	const struct Elf_Decoders* decoders;	// Chosen once per file by parse_elf_buffer() (see: Elf_Decode.h)
 };
 // All char* members should be dynamically allocated and later free()'d
+//	...except a mapped elfGuts, which is released by kill_elf_mapped()
+//	...and anything allocated from arena, which is released all at once by kill_elf()
+// All const char* members point into static storage (or the file contents) and are never free()'d
+//	...and so does decoders
+//	...and context, which belongs to the caller
 
 
 // Purpose: Open and parse an ELF file.  Allocate, configure and return Elf_Details pointer.
 // Input:	Filename, relative or absolute, to an ELF file
 // Output:	A dynamically allocated Elf_Details struct that contains information about elvenFilename
-// Note:	It is caller's responsibility to free the return value from this function by calling
+// Note:	
+//			It is caller's responsibility to free the return value from this function by calling
 //				kill_elf()
+//			The file contents are retained in the struct (elfGuts/elfSize) so section names can
+//				be resolved later (see: get_section_name())
 struct Elf_Details* read_elf(char* elvenFilename);
 
+// Purpose: Map an ELF file read-only and parse it in place.  Allocate, configure and return Elf_Details pointer.
+// Input:	Filename, relative or absolute, to an ELF file
+// Output:	A dynamically allocated Elf_Details struct that contains information about elvenFilename
+// Note:	
+//			It is caller's responsibility to free the return value from this function by calling
+//				kill_elf_mapped()
+//			The mapping is retained in the struct (elfGuts/elfSize) so only the pages parse_elf()
+//				actually touches are ever read from disk
+//			Falls back to read_elf() if elvenFilename can not be mapped (e.g., pipes, empty files)
+struct Elf_Details* read_elf_mapped(char* elvenFilename);
+
+// Purpose: Read only the ELF header of a file.  Allocate, configure and return Elf_Details pointer.
+// Input:	Filename, relative or absolute, to an ELF file
+// Output:	A dynamically allocated Elf_Details struct with only the ELF header members populated
+// Note:	
+//			It is caller's responsibility to free the return value from this function by calling
+//				kill_elf()
+//			Performs one positioned read of ELF_H_SIZE_64 bytes (which covers the ELF_H_SIZE_32
+//				bytes of an ELFCLASS32 header) regardless of the size of the file
+struct Elf_Details* read_elf_header(char* elvenFilename);
+
+// Purpose: Parse an ELF file into an Elf_Details struct that lives in its own arena
+// Input:
+//			elvenFilename - Filename, relative or absolute, to an ELF file
+//			headerOnly - If TRUE, behave like read_elf_header().  Otherwise, read_elf_mapped().
+// Output:	An arena-backed Elf_Details struct that contains information about elvenFilename
+// Note:	
+//			The struct and every buffer it owns come from one Elf_Arena (see: struct->arena)
+//			kill_elf() (or kill_elf_mapped()) releases all of it in one operation
+struct Elf_Details* read_elf_arena(char* elvenFilename, int headerOnly);
+
+// Purpose: Reentrant read_elf_arena()
+// Input:
+//			context - Caller-owned context (see: init_elf_context())
+//			elvenFilename - Filename, relative or absolute, to an ELF file
+//			elven_out [out] - Parsed struct
+// Output:	ERROR_* as specified in Elf_Details.h (also stored in context->status)
+// Note:	
+//			Nothing is printed unless context->verbose is TRUE.  The first diagnostic is kept in
+//				context->errBuff and a failed open() or read() leaves its errno in context->errnum.
+//			*elven_out is set whenever the ELF Header was parsed, even if a table it points to was
+//				rejected (e.g., ERROR_BAD_OFFSET).  Otherwise it is NULL.
+//			Caller is responsible for utilizing kill_elf_mapped() to free *elven_out.  A struct
+//				allocated from context->arena is only detached; the caller releases the arena.
+//			Later diagnostics about *elven_out (e.g., from read_elf_symbols()) are also reported
+//				to context so it must outlive *elven_out
+int read_elf_ctx(struct Elf_Context* context, char* elvenFilename, struct Elf_Details** elven_out);
+
+// Purpose:	Reentrant parse_elf_buffer()
+// Input:
+//			context - Caller-owned context (see: init_elf_context())
+//			elven_struct - Struct to store elven details
+//			elven_buffer - ELF file contents
+//			elven_size - Number of bytes in elven_buffer
+// Output:	ERROR_* as specified in Elf_Details.h (also stored in context->status)
+// Note:	Diagnostics are handled as in read_elf_ctx()
+int parse_elf_buffer_ctx(struct Elf_Context* context, struct Elf_Details* elven_struct, \
+	const unsigned char* elven_buffer, size_t elven_size);
+
+// Purpose:	Allocate memory on behalf of an Elf_Details struct
+// Input:
+//			elven_struct - Struct that will own the memory
+//			numElem - Number of elements to allocate
+//			sizeElem - Size of each element
+// Output:	Pointer to zeroized memory, NULL on failure
+// Note:	Comes out of elven_struct->arena if it has one, otherwise gimme_mem()
+void* elf_gimme_mem(struct Elf_Details* elven_struct, size_t numElem, size_t sizeElem);
+
+// Purpose:	Release memory allocated by elf_gimme_mem()
+// Input:
+//			elven_struct - Struct that owns the memory
+//			buff - Pointer to a buffer pointer
+//			numElem - The number of things in *buff
+//			sizeElem - The size of each thing in *buff
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Arena memory is only NULL'd here.  It is released with the rest of the arena.
+int elf_take_mem_back(struct Elf_Details* elven_struct, void** buff, size_t numElem, size_t sizeElem);
+
 // Purpse:	Parse an ELF file contents into an Elf_Details struct
 // Input:
 //			elven_struct - Struct to store elven details
 //			elven_contents - ELF file contents
 // Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Wrapper around parse_elf_buffer().  Prefer calling that directly.
+//			If elven_struct->elfSize is non-zero it is taken as the number of bytes in
+//				elven_contents.  Otherwise, elven_contents is assumed to hold at least
+//				a whole ELF Header if it starts with the magic number.
 int parse_elf(struct Elf_Details* elven_struct, char* elven_contents);
 
+// Purpose:	Parse an ELF file contents into an Elf_Details struct
+// Input:
+//			elven_struct - Struct to store elven details
+//			elven_buffer - ELF file contents
+//			elven_size - Number of bytes in elven_buffer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			The magic number is a fixed four byte compare at offset 0 so non-ELF input is
+//				rejected in constant time
+//			Every read is bounds checked against elven_size.  elven_buffer does not need to be
+//				nul terminated.
+int parse_elf_buffer(struct Elf_Details* elven_struct, const unsigned char* elven_buffer, size_t elven_size);
+
+// Purpose:	Resolve the name of a section
+// Input:
+//			elven_struct - Struct with a decoded Section Header Table
+//			sectIndex - Index into elven_struct->sectHdrs
+// Output:	Pointer to the nul-terminated name on success, NULL on failure
+// Note:	
+//			Names are resolved on demand from the section name string table
+//			The return value points into the buffer given to parse_elf_buffer().  Do not free()
+//				it and do not use it after that buffer is gone.
+const char* get_section_name(struct Elf_Details* elven_struct, int sectIndex);
+
+// Purpose:	Find a section by name
+// Input:
+//			elven_struct - Struct with a decoded Section Header Table
+//			sectName - Name to find (e.g., ".text")
+// Output:	Index into elven_struct->sectHdrs on success, -1 if not found
+// Note:	Returns the first match
+int find_section(struct Elf_Details* elven_struct, const char* sectName);
+
 // Purpose:	Print human-readable details about an ELF file
 // Input:
 //			elven_file - A Elf_Details struct that contains data about an ELF file
@@ -230,16 +560,40 @@ int parse_elf(struct Elf_Details* elven_struct, char* elven_contents);
 //				to control what the function actually prints.
 //			stream - A stream to send the information to (e.g., stdout, A file)
 // Output:	None
-// Note:	This function will print the relevant data from elven_file into stream
+// Note:	
+//			This function will print the relevant data from elven_file into stream
 //				based on the flags found in sectionsToPrint
+//			Formats into this thread's output buffer (see: format_elf_details()) and writes
+//				it out before returning
 void print_elf_details(struct Elf_Details* elven_file, unsigned int sectionsToPrint, FILE* stream);
 
+// Purpose:	Format human-readable details about an ELF file
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			elven_file - A Elf_Details struct that contains data about an ELF file
+//			sectionsToPrint - Bitwise AND the "PRINT_*" macros into this variable
+//				to control what the function actually prints.
+// Output:	None
+// Note:	Same layout as print_elf_details() but nothing is flushed, so details for many
+//				files can go out in a few large writes
+void format_elf_details(struct Elf_Output* output, struct Elf_Details* elven_file, unsigned int sectionsToPrint);
+
 // Purpose:	Assist clean up efforts by zeroizing/free'ing an Elf_Details struct
 // Input:	Pointer to an Elf_Details struct pointer
 // Output:	ERROR_* as specified in Elf_Details.h
-// Note:	This function will modify the original variable in the calling function
+// Note:	
+//			This function will modify the original variable in the calling function
+//			Arena-backed structs (see: read_elf_arena()) are released with one destroy_arena()
 int kill_elf(struct Elf_Details** old_struct);
 
+// Purpose:	Unmap the file view retained by read_elf_mapped() then zeroize/free the Elf_Details struct
+// Input:	Pointer to an Elf_Details struct pointer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			This function will modify the original variable in the calling function
+//			Safe to call on a struct returned by read_elf()
+int kill_elf_mapped(struct Elf_Details** old_struct);
+
 // Purpose:	Prints an uppercase title surrounded by delimiters
 // Input:
 //			stream - Stream to print the header to
@@ -249,11 +603,39 @@ int kill_elf(struct Elf_Details** old_struct);
 // Note:	Automatically sizes the box
 void print_fancy_header(FILE* stream, char* title, unsigned char delimiter);
 
+// Purpose:	Formats an uppercase title surrounded by delimiters
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			title - Title to format
+//			delimiter - Single character to create the box
+// Output:	None
+// Note:	Same box as print_fancy_header(), without the flush
+void format_fancy_header(struct Elf_Output* output, const char* title, unsigned char delimiter);
+
 // Purpose:	Determine the exact length of a file
 // Input:	Open FILE pointer
 // Output:	Exact length of file in bytes
+// Note:	
+//			Regular files are sized from their metadata without reading a single byte
+//			Everything else (pipes, /proc files) is counted with chunked reads and then
+//				rewound, which only works if the stream is seekable.  Use read_file_guts()
+//				to size and read a non-seekable stream in one pass.
 size_t file_len(FILE* openFile);
 
+// Purpose:	Read the entire contents of an open file into a nul-terminated buffer
+// Input:
+//			openFile - Open FILE pointer positioned at the beginning of the file
+//			gutsSize [out] - Number of bytes read, not counting the nul terminator
+// Output:	Dynamically allocated buffer of *gutsSize + 1 bytes on success, NULL on failure
+// Note:	
+//			Regular files are sized from their metadata and read with a single fread()
+//			Non-seekable inputs (pipes, /proc files) fall back to chunked reads into a
+//				growing buffer so they are never read twice
+//			A failed read leaves its errno for the calling function to report
+//			It is the responsibility of the calling function to take_mem_back() the return value
+//				using *gutsSize + 1 elements
+char* read_file_guts(FILE* openFile, size_t* gutsSize);
+
 // Purpose:	Print a buffer, regardless of nul characters
 // Input:	
 //			buff - non-nul terminated char array
@@ -277,9 +659,40 @@ void* gimme_mem(size_t numElem, size_t sizeElem);
 //			numElem - The number of things in *buff
 //			sizeElem - The size of each thing in *buff
 // Output:	ERROR_* as specified in Elf_Details.h
-// Note:	Modifies the pointer to *buf by making it NULL
+// Note:	
+//			Modifies the pointer to *buf by making it NULL
+//			Only zeroizes if the zeroization policy says so (see: set_zeroize_policy())
 int take_mem_back(void** buff, size_t numElem, size_t sizeElem);
 
+// Purpose:	Zeroize, free, and NULL a buffer flagged as sensitive
+// Input:	
+//			buff - Pointer to a buffer pointer
+//			numElem - The number of things in *buff
+//			sizeElem - The size of each thing in *buff
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Modifies the pointer to *buf by making it NULL
+//			Zeroizes under the ZEROIZE_ALWAYS and ZEROIZE_SENSITIVE policies
+int take_sensitive_mem_back(void** buff, size_t numElem, size_t sizeElem);
+
+// Purpose:	Choose when take_mem_back() and friends zeroize memory
+// Input:	newPolicy - ZEROIZE_ALWAYS, ZEROIZE_NEVER, or ZEROIZE_SENSITIVE
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Defaults to ZEROIZE_POLICY
+//			Set it once, before any other threads start freeing memory
+int set_zeroize_policy(int newPolicy);
+
+// Purpose:	Report the current zeroization policy
+// Input:	None
+// Output:	ZEROIZE_ALWAYS, ZEROIZE_NEVER, or ZEROIZE_SENSITIVE
+int get_zeroize_policy(void);
+
+// Purpose:	Determine if memory should be zeroized before it is released
+// Input:	sensitive - TRUE if the memory was flagged as sensitive
+// Output:	TRUE if the current zeroization policy calls for it, FALSE otherwise
+int should_zeroize(int sensitive);
+
 // Purpose:	Convert consecutive characters into a single int IAW the specified endianness
 // Input:
 //			buffToConvert - Pointer to the buffer that holds the bytes in question
@@ -348,40 +761,100 @@ int convert_uint64_to_uint32(uint64_t inVal, uint32_t* outVal);
 //			Function will print one space on invalid input
 void print_binary(FILE* stream, void* valueToPrint, size_t numBytesToPrint, int bigEndian);
 
+// Purpose:	Lookup an Elf Header Class name
+// Input:	Value found at ELF Header offset 0x04
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_class_name(unsigned int value);
+
+// Purpose:	Lookup an Elf Header Data (endianness) name
+// Input:	Value found at ELF Header offset 0x05
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_endian_name(unsigned int value);
+
+// Purpose:	Lookup an Elf Header Target OS ABI name
+// Input:	Value found at ELF Header offset 0x07
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_targetOS_name(unsigned int value);
+
+// Purpose:	Lookup an Elf Header Type name
+// Input:	Value found at ELF Header offset 0x10
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_elf_type_name(unsigned int value);
+
+// Purpose:	Lookup an Elf Header ISA name
+// Input:	Value found at ELF Header offset 0x12
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_isa_name(unsigned int value);
+
+// Purpose:	Lookup an Elf Header Object File Version name
+// Input:	Value found at ELF Header offset 0x14
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_elf_header_obj_version_name(unsigned int value);
+
+// Purpose:	Lookup a Program Header Segment Type name
+// Input:	Value found at Program Header offset 0x00
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_prgrm_header_type_name(unsigned int value);
+
+// Purpose:	Lookup a Section Header Type name
+// Input:	Value found at Section Header offset 0x04
+// Output:	Static string on success, NULL if the value is unknown
+// Note:	Do not free() the return value
+const char* get_sectn_header_type_name(unsigned int value);
+
 // Purpose:	Build a HarkleDict of Elf Header Class definitions
 // Input:	None
 // Output:	Pointer to the head node of a linked list of HarkleDicts
-// Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_class_name()
 struct HarkleDict* init_elf_header_class_dict(void);
 
 // Purpose:	Build a HarkleDict of Elf Header Data definitions
 // Input:	None
 // Output:	Pointer to the head node of a linked list of HarkleDicts
-// Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_endian_name()
 struct HarkleDict* init_elf_header_endian_dict(void);
 
 // Purpose:	Build a HarkleDict of Elf Header Target OS ABI definitions
 // Input:	None
 // Output:	Pointer to the head node of a linked list of HarkleDicts
-// Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_targetOS_name()
 struct HarkleDict* init_elf_header_targetOS_dict(void);
 
 // Purpose:	Build a HarkleDict of Elf Header Type definitions
 // Input:	None
 // Output:	Pointer to the head node of a linked list of HarkleDicts
-// Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_elf_type_name()
 struct HarkleDict* init_elf_header_elf_type_dict(void);
 
 // Purpose:	Build a HarkleDict of Elf Header ISA definitions
 // Input:	None
 // Output:	Pointer to the head node of a linked list of HarkleDicts
-// Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_isa_name()
 struct HarkleDict* init_elf_header_isa_dict(void);
 
 // Purpose:	Build a HarkleDict of Elf Header Object File Version definitions
 // Input:	None
 // Output:	Pointer to the head node of a linked list of HarkleDicts
-// Note:	Caller is responsible for utilizing destroy_a_list() to free this linked list
+// Note:	
+//			Caller is responsible for utilizing destroy_a_list() to free this linked list
+//			Backed by the same static table as get_elf_header_obj_version_name()
 struct HarkleDict* init_elf_header_obj_version_dict(void);
 
 #endif // __ELF_DETAILS_H__
@@ -0,0 +1,798 @@
+#include "Elf_Digest.h"
+#include "Elf_Details.h"
+#include "Elf_Output.h"
+#include <errno.h>
+#include <string.h>		// memcpy()
+
+#if defined(__x86_64__) || defined(__i386__)
+#define DIGEST_X86
+#include <immintrin.h>	// SHA and SSE4.1 intrinsics
+#endif // x86
+
+/* XXH64 PRIMES */
+#define XXH_PRIME64_1	0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2	0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3	0x165667B19E3779F9ULL
+#define XXH_PRIME64_4	0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5	0x27D4EB2F165667C5ULL
+
+#define ROTR32(value, bits)	(((value) >> (bits)) | ((value) << (32 - (bits))))
+#define ROTL64(value, bits)	(((value) << (bits)) | ((value) >> (64 - (bits))))
+
+/* LOCAL VARIABLES */
+static int forcedIsa = DIGEST_ISA_AUTO;	// See: set_digest_isa()
+static const char hexDigits[] = "0123456789abcdef";	// Lowercase, like sha256sum
+// SHA-256 round constants
+static const uint32_t shaRoundK[64] = { \
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5, \
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, \
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da, \
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, \
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, \
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, \
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3, \
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2, };
+// SHA-256 initial hash
+static const uint32_t shaInitial[8] = { \
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19, };
+
+/* LOCAL FUNCTIONS */
+static int cpu_supports_isa(int digestIsa);
+static void sha256_blocks(uint32_t* state, const unsigned char* data, size_t numBlocks);
+static int is_selected(const char* selection, const char* token, size_t tokenLen);
+static struct Elf_Digest* add_digest(struct Elf_Digest_List* digestList, struct Elf_Details* elven_struct, \
+	                                 int kind, int index, uint64_t offset, uint64_t size);
+
+
+/* XXH64 */
+// Purpose:	Read a little-endian value no matter the host or alignment
+static inline uint64_t read_le64(const unsigned char* buff)
+{
+	uint64_t retVal = 0;
+
+	memcpy(&retVal, buff, sizeof(retVal));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	retVal = __builtin_bswap64(retVal);
+#endif // Big endian host
+
+	return retVal;
+}
+
+
+// Purpose:	Read a little-endian value no matter the host or alignment
+static inline uint32_t read_le32(const unsigned char* buff)
+{
+	uint32_t retVal = 0;
+
+	memcpy(&retVal, buff, sizeof(retVal));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	retVal = __builtin_bswap32(retVal);
+#endif // Big endian host
+
+	return retVal;
+}
+
+
+// Purpose:	Mix one 64-bit input into an accumulator
+static inline uint64_t xxh64_round(uint64_t acc, uint64_t input)
+{
+	acc += input * XXH_PRIME64_2;
+	acc = ROTL64(acc, 31);
+	return acc * XXH_PRIME64_1;
+}
+
+
+// Purpose:	Fold a lane into the hash after the stripes are done
+static inline uint64_t xxh64_merge(uint64_t acc, uint64_t value)
+{
+	acc ^= xxh64_round(0, value);
+	return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+
+// Purpose:	XXH64 a buffer
+// Input:
+//			buff - Bytes to hash
+//			size - Number of bytes in buff
+//			seed - XXH64 seed (0 for the usual fingerprint)
+// Output:	The 64-bit hash
+// Note:	Four independent lanes per 32 byte stripe keep the multipliers busy
+uint64_t digest_xxh64(const void* buff, size_t size, uint64_t seed)
+{
+	/* LOCAL VARIABLES */
+	const unsigned char* data = (const unsigned char*)buff;	// Next byte to hash
+	const unsigned char* end = data + size;					// One past the last byte
+	uint64_t retVal = 0;				// Hash
+	uint64_t lanes[4] = { 0 };			// Stripe accumulators
+
+	/* INPUT VALIDATION */
+	if (!data)
+	{
+		size = 0;
+		end = data;
+	}
+
+	/* STRIPES */
+	if (size >= 32)
+	{
+		lanes[0] = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+		lanes[1] = seed + XXH_PRIME64_2;
+		lanes[2] = seed;
+		lanes[3] = seed - XXH_PRIME64_1;
+		do
+		{
+			lanes[0] = xxh64_round(lanes[0], read_le64(data));
+			lanes[1] = xxh64_round(lanes[1], read_le64(data + 8));
+			lanes[2] = xxh64_round(lanes[2], read_le64(data + 16));
+			lanes[3] = xxh64_round(lanes[3], read_le64(data + 24));
+			data += 32;
+		} while (end - data >= 32);
+		retVal = ROTL64(lanes[0], 1) + ROTL64(lanes[1], 7) + ROTL64(lanes[2], 12) + ROTL64(lanes[3], 18);
+		retVal = xxh64_merge(retVal, lanes[0]);
+		retVal = xxh64_merge(retVal, lanes[1]);
+		retVal = xxh64_merge(retVal, lanes[2]);
+		retVal = xxh64_merge(retVal, lanes[3]);
+	}
+	else
+	{
+		retVal = seed + XXH_PRIME64_5;
+	}
+	retVal += (uint64_t)size;
+
+	/* TAIL */
+	while (end - data >= 8)
+	{
+		retVal ^= xxh64_round(0, read_le64(data));
+		retVal = ROTL64(retVal, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+		data += 8;
+	}
+	if (end - data >= 4)
+	{
+		retVal ^= (uint64_t)read_le32(data) * XXH_PRIME64_1;
+		retVal = ROTL64(retVal, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+		data += 4;
+	}
+	while (data < end)
+	{
+		retVal ^= (*data) * XXH_PRIME64_5;
+		retVal = ROTL64(retVal, 11) * XXH_PRIME64_1;
+		data++;
+	}
+
+	/* AVALANCHE */
+	retVal ^= retVal >> 33;
+	retVal *= XXH_PRIME64_2;
+	retVal ^= retVal >> 29;
+	retVal *= XXH_PRIME64_3;
+	retVal ^= retVal >> 32;
+
+	return retVal;
+}
+
+
+/* SHA-256 */
+// Purpose:	Hash whole 64 byte blocks in portable C
+static void sha256_blocks_scalar(uint32_t* state, const unsigned char* data, size_t numBlocks)
+{
+	uint32_t schedule[64];		// Message schedule
+	uint32_t a, b, c, d, e, f, g, h;	// Working variables
+	uint32_t temp1 = 0;
+	uint32_t temp2 = 0;
+	int i = 0;
+
+	while (numBlocks-- > 0)
+	{
+		for (i = 0; i < 16; i++)
+		{
+			schedule[i] = ((uint32_t)data[i * 4] << 24) | ((uint32_t)data[i * 4 + 1] << 16) \
+				| ((uint32_t)data[i * 4 + 2] << 8) | (uint32_t)data[i * 4 + 3];
+		}
+		for (i = 16; i < 64; i++)
+		{
+			temp1 = ROTR32(schedule[i - 15], 7) ^ ROTR32(schedule[i - 15], 18) ^ (schedule[i - 15] >> 3);
+			temp2 = ROTR32(schedule[i - 2], 17) ^ ROTR32(schedule[i - 2], 19) ^ (schedule[i - 2] >> 10);
+			schedule[i] = schedule[i - 16] + temp1 + schedule[i - 7] + temp2;
+		}
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+		e = state[4];
+		f = state[5];
+		g = state[6];
+		h = state[7];
+		for (i = 0; i < 64; i++)
+		{
+			temp1 = h + (ROTR32(e, 6) ^ ROTR32(e, 11) ^ ROTR32(e, 25)) + ((e & f) ^ (~e & g)) \
+				+ shaRoundK[i] + schedule[i];
+			temp2 = (ROTR32(a, 2) ^ ROTR32(a, 13) ^ ROTR32(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+			h = g;
+			g = f;
+			f = e;
+			e = d + temp1;
+			d = c;
+			c = b;
+			b = a;
+			a = temp1 + temp2;
+		}
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+		data += 64;
+	}
+
+	return;
+}
+
+
+#ifdef DIGEST_X86
+// Purpose:	Hash whole 64 byte blocks with the SHA extensions
+// Note:
+//			sha256rnds2 does two rounds on the state split as ABEF/CDGH, so the state is
+//				shuffled into that layout once and back out at the end
+//			Each of the 16 steps does four rounds.  msg1/msg2 build the next four schedule
+//				words while the rounds run.
+__attribute__((target("sha,sse4.1")))
+static void sha256_blocks_sha_ni(uint32_t* state, const unsigned char* data, size_t numBlocks)
+{
+	const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m128i state0, state1;		// ABEF and CDGH
+	__m128i save0, save1;		// State before this block
+	__m128i msg[4];				// Rolling four words of the schedule
+	__m128i roundMsg, temp;
+	int step = 0;
+
+	/* SHUFFLE IN */
+	temp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)state), 0xB1);	// CDAB
+	state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(state + 4)), 0x1B);	// EFGH
+	state0 = _mm_alignr_epi8(temp, state1, 8);	// ABEF
+	state1 = _mm_blend_epi16(state1, temp, 0xF0);	// CDGH
+
+	/* ROUNDS */
+	while (numBlocks-- > 0)
+	{
+		save0 = state0;
+		save1 = state1;
+		// Unrolled so msg[] indexes are constants and the schedule stays in registers
+#pragma GCC unroll 16
+		for (step = 0; step < 16; step++)
+		{
+			if (step < 4)
+			{
+				msg[step] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + step * 16)), byteSwap);
+			}
+			roundMsg = _mm_add_epi32(msg[step & 3], _mm_loadu_si128((const __m128i*)(shaRoundK + step * 4)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, roundMsg);
+			if (step >= 3 && step <= 14)
+			{
+				temp = _mm_alignr_epi8(msg[step & 3], msg[(step - 1) & 3], 4);
+				msg[(step + 1) & 3] = _mm_add_epi32(msg[(step + 1) & 3], temp);
+				msg[(step + 1) & 3] = _mm_sha256msg2_epu32(msg[(step + 1) & 3], msg[step & 3]);
+			}
+			roundMsg = _mm_shuffle_epi32(roundMsg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, roundMsg);
+			if (step >= 1 && step <= 12)
+			{
+				msg[(step - 1) & 3] = _mm_sha256msg1_epu32(msg[(step - 1) & 3], msg[step & 3]);
+			}
+		}
+		state0 = _mm_add_epi32(state0, save0);
+		state1 = _mm_add_epi32(state1, save1);
+		data += 64;
+	}
+
+	/* SHUFFLE OUT */
+	temp = _mm_shuffle_epi32(state0, 0x1B);		// FEBA
+	state1 = _mm_shuffle_epi32(state1, 0xB1);	// DCHG
+	state0 = _mm_blend_epi16(temp, state1, 0xF0);	// DCBA
+	state1 = _mm_alignr_epi8(state1, temp, 8);	// HGFE
+	_mm_storeu_si128((__m128i*)state, state0);
+	_mm_storeu_si128((__m128i*)(state + 4), state1);
+
+	return;
+}
+#endif // DIGEST_X86
+
+
+// Purpose:	Hash whole 64 byte blocks with the chosen implementation
+static void sha256_blocks(uint32_t* state, const unsigned char* data, size_t numBlocks)
+{
+#ifdef DIGEST_X86
+	if (get_digest_isa() == DIGEST_ISA_SHA_NI)
+	{
+		sha256_blocks_sha_ni(state, data, numBlocks);
+		return;
+	}
+#endif // DIGEST_X86
+	sha256_blocks_scalar(state, data, numBlocks);
+
+	return;
+}
+
+
+// Purpose:	Start a SHA-256 hash
+// Input:	sha [out] - State to initialize
+// Output:	ERROR_* as specified in Elf_Details.h
+int init_sha256(struct Elf_Sha256* sha)
+{
+	if (!sha)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	memcpy(sha->state, shaInitial, sizeof(sha->state));
+	sha->numBytes = 0;
+	sha->used = 0;
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Hash more bytes
+// Input:
+//			sha - State from init_sha256()
+//			buff - Bytes to hash
+//			size - Number of bytes in buff
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Whole blocks are hashed straight out of buff
+int update_sha256(struct Elf_Sha256* sha, const void* buff, size_t size)
+{
+	/* LOCAL VARIABLES */
+	const unsigned char* data = (const unsigned char*)buff;	// Next byte to hash
+	size_t numCopy = 0;		// Bytes added to the partial block
+
+	/* INPUT VALIDATION */
+	if (!sha || (!data && size > 0))
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	/* HASH IT */
+	sha->numBytes += size;
+	// Top off a partial block first
+	if (sha->used > 0)
+	{
+		numCopy = sizeof(sha->block) - sha->used;
+		if (numCopy > size)
+		{
+			numCopy = size;
+		}
+		memcpy(sha->block + sha->used, data, numCopy);
+		sha->used += numCopy;
+		data += numCopy;
+		size -= numCopy;
+		if (sha->used == sizeof(sha->block))
+		{
+			sha256_blocks(sha->state, sha->block, 1);
+			sha->used = 0;
+		}
+	}
+	if (size >= sizeof(sha->block))
+	{
+		sha256_blocks(sha->state, data, size / sizeof(sha->block));
+		data += size - (size % sizeof(sha->block));
+		size %= sizeof(sha->block);
+	}
+	if (size > 0)
+	{
+		memcpy(sha->block, data, size);
+		sha->used = size;
+	}
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Finish a SHA-256 hash
+// Input:
+//			sha - State from init_sha256()
+//			digest [out] - DIGEST_SHA256_SIZE bytes
+// Output:	ERROR_* as specified in Elf_Details.h
+int final_sha256(struct Elf_Sha256* sha, unsigned char* digest)
+{
+	/* LOCAL VARIABLES */
+	uint64_t numBits = 0;	// Message length appended to the padding
+	int i = 0;				// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!sha || !digest)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	/* PAD */
+	numBits = sha->numBytes * 8;
+	sha->block[sha->used++] = 0x80;
+	if (sha->used > sizeof(sha->block) - 8)
+	{
+		memset(sha->block + sha->used, 0, sizeof(sha->block) - sha->used);
+		sha256_blocks(sha->state, sha->block, 1);
+		sha->used = 0;
+	}
+	memset(sha->block + sha->used, 0, sizeof(sha->block) - 8 - sha->used);
+	for (i = 0; i < 8; i++)
+	{
+		sha->block[sizeof(sha->block) - 1 - i] = (unsigned char)(numBits >> (i * 8));
+	}
+	sha256_blocks(sha->state, sha->block, 1);
+
+	/* BIG-ENDIAN DIGEST */
+	for (i = 0; i < 8; i++)
+	{
+		digest[i * 4] = (unsigned char)(sha->state[i] >> 24);
+		digest[i * 4 + 1] = (unsigned char)(sha->state[i] >> 16);
+		digest[i * 4 + 2] = (unsigned char)(sha->state[i] >> 8);
+		digest[i * 4 + 3] = (unsigned char)sha->state[i];
+	}
+	sha->used = 0;
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	SHA-256 a buffer
+// Input:
+//			buff - Bytes to hash
+//			size - Number of bytes in buff
+//			digest [out] - DIGEST_SHA256_SIZE bytes
+// Output:	ERROR_* as specified in Elf_Details.h
+int digest_sha256(const void* buff, size_t size, unsigned char* digest)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Sha256 sha;		// Running state
+
+	/* HASH IT */
+	retVal = init_sha256(&sha);
+	if (retVal == ERROR_SUCCESS)
+	{
+		retVal = update_sha256(&sha, buff, size);
+	}
+	if (retVal == ERROR_SUCCESS)
+	{
+		retVal = final_sha256(&sha, digest);
+	}
+
+	return retVal;
+}
+
+
+/* ELF CONTENTS */
+// Purpose:	Hash the selected regions of a parsed file
+// Input:
+//			elven_struct - Struct with retained file contents (e.g., read_elf_mapped(), not read_elf_header())
+//			selection - Comma-separated regions to hash (see: Elf_Digest.h)
+//			algorithms - DIGEST_XXH64, DIGEST_SHA256, or both
+// Output:	Pointer to a dynamically allocated Elf_Digest_List on success, NULL on failure (check errno)
+// Note:	Caller is responsible for utilizing kill_digest_list() to free the return value
+struct Elf_Digest_List* digest_elf_contents(struct Elf_Details* elven_struct, const char* selection, int algorithms)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Digest_List* retVal = NULL;	// List to be allocated, filled and returned
+	struct Elf_Digest* digest = NULL;		// Region being hashed
+	const char* sectName = NULL;			// Name of the section being considered
+	int wantLoad = FALSE;					// If TRUE, "load" was selected
+	int wantSections = FALSE;				// If TRUE, "sections" was selected
+	uint64_t sectSize = 0;					// Bytes a section occupies in the file
+	int i = 0;								// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!elven_struct || !selection)
+	{
+		errno = EINVAL;
+		return retVal;
+	}
+	else if (!elven_struct->elfGuts || !(algorithms & DIGEST_ALL) || (algorithms & ~DIGEST_ALL))
+	{
+		// Header-only structs don't retain the contents
+		errno = EINVAL;
+		return retVal;
+	}
+
+	/* ALLOCATE */
+	retVal = (struct Elf_Digest_List*)gimme_mem(1, sizeof(struct Elf_Digest_List));
+	if (!retVal)
+	{
+		return retVal;
+	}
+	retVal->algorithms = algorithms;
+	// Upper bound: the file, every segment, and every section
+	retVal->capacity = 1 + (elven_struct->prgmHdrs ? elven_struct->numPrgmHdrs : 0) \
+		+ (elven_struct->sectHdrs ? elven_struct->numSectHdrs : 0);
+	retVal->digests = (struct Elf_Digest*)gimme_mem(retVal->capacity, sizeof(struct Elf_Digest));
+	if (!retVal->digests)
+	{
+		take_mem_back((void**)&retVal, 1, sizeof(struct Elf_Digest_List));
+		return retVal;
+	}
+	wantLoad = is_selected(selection, "load", strlen("load"));
+	wantSections = is_selected(selection, "sections", strlen("sections"));
+
+	/* FILE */
+	if (is_selected(selection, "file", strlen("file")) == TRUE)
+	{
+		add_digest(retVal, elven_struct, DIGEST_KIND_FILE, 0, 0, elven_struct->elfSize);
+	}
+
+	/* SEGMENTS */
+	for (i = 0; wantLoad == TRUE && elven_struct->prgmHdrs && i < elven_struct->numPrgmHdrs; i++)
+	{
+		if (elven_struct->prgmHdrs[i].type == ELF_P_TYPE_LOAD)
+		{
+			add_digest(retVal, elven_struct, DIGEST_KIND_SEGMENT, i, elven_struct->prgmHdrs[i].offset, \
+				elven_struct->prgmHdrs[i].filesz);
+		}
+	}
+
+	/* SECTIONS */
+	for (i = 0; elven_struct->sectHdrs && i < elven_struct->numSectHdrs; i++)
+	{
+		sectName = get_section_name(elven_struct, i);
+		// SHT_NOBITS sections occupy nothing in the file
+		sectSize = elven_struct->sectHdrs[i].type == ELF_S_TYPE_NOBITS ? 0 : elven_struct->sectHdrs[i].size;
+		if ((wantSections == TRUE && sectSize > 0) \
+			|| (sectName && *sectName && is_selected(selection, sectName, strlen(sectName)) == TRUE))
+		{
+			digest = add_digest(retVal, elven_struct, DIGEST_KIND_SECTION, i, elven_struct->sectHdrs[i].offset, sectSize);
+			digest->name = sectName;
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Append one line per digest
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			fileName - Printed first on every line
+//			digestList - List from digest_elf_contents()
+// Output:	None
+void format_elf_digests(struct Elf_Output* output, const char* fileName, const struct Elf_Digest_List* digestList)
+{
+	/* LOCAL VARIABLES */
+	const struct Elf_Digest* digest = NULL;	// Digest being formatted
+	size_t i = 0;							// Iterating variable
+	size_t j = 0;							// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!output || !digestList)
+	{
+		return;
+	}
+
+	/* FORMAT */
+	for (i = 0; i < digestList->numDigests; i++)
+	{
+		digest = digestList->digests + i;
+		output_str(output, fileName);
+		output_char(output, '\t');
+		switch (digest->kind)
+		{
+			case DIGEST_KIND_FILE:
+				output_str(output, "file");
+				break;
+			case DIGEST_KIND_SEGMENT:
+				output_str(output, "segment ");
+				output_dec(output, digest->index);
+				break;
+			default:
+				if (digest->name && *(digest->name))
+				{
+					output_str(output, digest->name);
+				}
+				else
+				{
+					output_str(output, "section ");
+					output_dec(output, digest->index);
+				}
+		}
+		output_str(output, "\t0x");
+		output_hex(output, digest->offset, 1);
+		output_char(output, '\t');
+		output_udec(output, digest->size);
+		output_char(output, '\t');
+		if (digest->status == ERROR_SUCCESS && (digestList->algorithms & DIGEST_XXH64))
+		{
+			output_hex(output, digest->xxh64, 16);
+		}
+		else
+		{
+			output_char(output, '-');
+		}
+		output_char(output, '\t');
+		if (digest->status == ERROR_SUCCESS && (digestList->algorithms & DIGEST_SHA256))
+		{
+			for (j = 0; j < DIGEST_SHA256_SIZE; j++)
+			{
+				output_char(output, hexDigits[digest->sha256[j] >> 4]);
+				output_char(output, hexDigits[digest->sha256[j] & 0xF]);
+			}
+		}
+		else
+		{
+			output_char(output, '-');
+		}
+		output_char(output, '\n');
+	}
+
+	return;
+}
+
+
+// Purpose:	Zeroize/free an Elf_Digest_List
+// Input:	Pointer to an Elf_Digest_List pointer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	This function will modify the original variable in the calling function
+int kill_digest_list(struct Elf_Digest_List** old_list)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (!old_list || !(*old_list))
+	{
+		retVal = ERROR_NULL_PTR;
+	}
+	else
+	{
+		if ((*old_list)->digests)
+		{
+			take_mem_back((void**)&((*old_list)->digests), (*old_list)->capacity, sizeof(struct Elf_Digest));
+		}
+		take_mem_back((void**)old_list, 1, sizeof(struct Elf_Digest_List));
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Force a particular SHA-256 implementation
+// Input:	digestIsa - DIGEST_ISA_* as specified in Elf_Digest.h
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			Returns ERROR_BAD_ARG if this CPU can't run digestIsa
+//			Set it once, before any other threads start hashing
+int set_digest_isa(int digestIsa)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (digestIsa != DIGEST_ISA_AUTO && cpu_supports_isa(digestIsa) != TRUE)
+	{
+		retVal = ERROR_BAD_ARG;
+	}
+	else
+	{
+		forcedIsa = digestIsa;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Report the SHA-256 implementation in use
+// Input:	None
+// Output:	DIGEST_ISA_SCALAR or DIGEST_ISA_SHA_NI
+int get_digest_isa(void)
+{
+	int retVal = forcedIsa;
+
+	if (retVal == DIGEST_ISA_AUTO)
+	{
+		if (cpu_supports_isa(DIGEST_ISA_SHA_NI) == TRUE)
+		{
+			retVal = DIGEST_ISA_SHA_NI;
+		}
+		else
+		{
+			retVal = DIGEST_ISA_SCALAR;
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Determine if this CPU can run a SHA-256 implementation
+// Input:	digestIsa - DIGEST_ISA_* as specified in Elf_Digest.h
+// Output:	TRUE if it can, FALSE otherwise
+// Note:	__builtin_cpu_supports() only reads the CPU model cached at startup
+static int cpu_supports_isa(int digestIsa)
+{
+	int retVal = FALSE;
+
+	switch (digestIsa)
+	{
+		case DIGEST_ISA_SCALAR:
+			retVal = TRUE;
+			break;
+#ifdef DIGEST_X86
+		case DIGEST_ISA_SHA_NI:
+			retVal = (__builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1")) ? TRUE : FALSE;
+			break;
+#endif // DIGEST_X86
+		default:
+			retVal = FALSE;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Determine if a region is named in a selection
+// Input:
+//			selection - Comma-separated list
+//			token - Name to look for (need not be nul-terminated)
+//			tokenLen - Number of characters in token
+// Output:	TRUE if token is one of the entries, FALSE otherwise
+static int is_selected(const char* selection, const char* token, size_t tokenLen)
+{
+	/* LOCAL VARIABLES */
+	const char* entry = selection;	// Start of the entry being compared
+	size_t entryLen = 0;			// Characters in entry
+
+	/* COMPARE */
+	while (entry && *entry)
+	{
+		entryLen = strcspn(entry, ",");
+		if (entryLen == tokenLen && !strncmp(entry, token, tokenLen))
+		{
+			return TRUE;
+		}
+		entry += entryLen;
+		if (*entry == ',')
+		{
+			entry++;
+		}
+	}
+
+	return FALSE;
+}
+
+
+// Purpose:	Hash one region into the next free digest
+// Input:
+//			digestList - List being filled (sized by digest_elf_contents())
+//			elven_struct - Struct with retained file contents
+//			kind - DIGEST_KIND_*
+//			index - Program or section header index
+//			offset - Offset of the region in the file
+//			size - Bytes in the region
+// Output:	The digest that was filled in
+static struct Elf_Digest* add_digest(struct Elf_Digest_List* digestList, struct Elf_Details* elven_struct, \
+	                                 int kind, int index, uint64_t offset, uint64_t size)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Digest* retVal = digestList->digests + digestList->numDigests;	// Next free digest
+	const unsigned char* region = NULL;		// First byte of the region
+
+	/* DESCRIBE IT */
+	digestList->numDigests++;
+	retVal->kind = kind;
+	retVal->index = index;
+	retVal->offset = offset;
+	retVal->size = size;
+	// Written so offset + size can't wrap
+	if (offset > elven_struct->elfSize || size > elven_struct->elfSize - offset)
+	{
+		retVal->status = ERROR_BAD_OFFSET;
+		return retVal;
+	}
+	retVal->status = ERROR_SUCCESS;
+	region = (const unsigned char*)elven_struct->elfGuts + offset;
+
+	/* HASH IT */
+	if (digestList->algorithms & DIGEST_XXH64)
+	{
+		retVal->xxh64 = digest_xxh64(region, (size_t)size, 0);
+	}
+	if (digestList->algorithms & DIGEST_SHA256)
+	{
+		digest_sha256(region, (size_t)size, retVal->sha256);
+	}
+
+	return retVal;
+}
@@ -0,0 +1,152 @@
+#ifndef __ELF_DIGEST_H__
+#define __ELF_DIGEST_H__
+
+#include <stddef.h>		// size_t
+#include <stdint.h>		// Fixed-width integers
+
+/*
+ *	USAGE:
+ *		digest_elf_contents() hashes the selected segments and sections of a parsed file
+ *			straight out of the contents the parser already holds (struct->elfGuts), so
+ *			fingerprinting never reads a file twice
+ *		digest_xxh64() and the *_sha256() functions hash any buffer
+ *	ALGORITHMS:
+ *		XXH64 is a fast, non-cryptographic fingerprint (bit-for-bit the reference XXH64)
+ *		SHA-256 uses the x86 SHA extensions when the CPU has them (see: get_digest_isa())
+ *	SELECTION:
+ *		A comma-separated list (e.g., "load,.text") of:
+ *			file - The whole file
+ *			load - Every PT_LOAD segment
+ *			sections - Every section with contents in the file
+ *			Anything else is a section name
+ */
+
+#define DIGEST_XXH64		((int)0x1)		// Compute Elf_Digest.xxh64
+#define DIGEST_SHA256		((int)0x2)		// Compute Elf_Digest.sha256
+#define DIGEST_ALL			(DIGEST_XXH64 | DIGEST_SHA256)
+#define DIGEST_SHA256_SIZE	((size_t)32)	// Bytes in a SHA-256 digest
+
+#define DIGEST_ISA_AUTO		((int)0)	// Choose the best implementation the CPU supports
+#define DIGEST_ISA_SCALAR	((int)1)	// Portable C
+#define DIGEST_ISA_SHA_NI	((int)2)	// x86 SHA extensions (sha256rnds2)
+
+/* Elf_Digest.kind */
+#define DIGEST_KIND_FILE	((int)0)	// The whole file
+#define DIGEST_KIND_SEGMENT	((int)1)	// One program header entry
+#define DIGEST_KIND_SECTION	((int)2)	// One section header entry
+
+struct Elf_Details;
+struct Elf_Output;
+
+// Running SHA-256 state
+struct Elf_Sha256
+{
+	uint32_t state[8];		// Hash so far
+	uint64_t numBytes;		// Bytes hashed so far
+	unsigned char block[64];	// Partial block
+	size_t used;			// Bytes in block
+};
+
+// One hashed region
+struct Elf_Digest
+{
+	int kind;				// DIGEST_KIND_*
+	int index;				// Program or section header index (0 for the whole file)
+	const char* name;		// Section name (borrowed from the parsed file), NULL otherwise
+	uint64_t offset;		// Offset of the region in the file
+	uint64_t size;			// Bytes in the region (0 for SHT_NOBITS sections)
+	int status;				// ERROR_SUCCESS, or ERROR_BAD_OFFSET if the region runs past the end of the file (not hashed)
+	uint64_t xxh64;			// XXH64 (seed 0) if DIGEST_XXH64 was requested
+	unsigned char sha256[DIGEST_SHA256_SIZE];	// SHA-256 if DIGEST_SHA256 was requested
+};
+
+struct Elf_Digest_List
+{
+	struct Elf_Digest* digests;	// File first, then segments, then sections (each in header order)
+	size_t numDigests;			// Number of entries used in digests
+	size_t capacity;			// Number of entries allocated in digests
+	int algorithms;				// DIGEST_* requested
+};
+
+
+// Purpose:	Hash the selected regions of a parsed file
+// Input:
+//			elven_struct - Struct with retained file contents (e.g., read_elf_mapped(), not read_elf_header())
+//			selection - Comma-separated regions to hash (see: SELECTION above)
+//			algorithms - DIGEST_XXH64, DIGEST_SHA256, or both
+// Output:	Pointer to a dynamically allocated Elf_Digest_List on success, NULL on failure (check errno)
+// Note:
+//			Caller is responsible for utilizing kill_digest_list() to free the return value
+//			Section names are borrowed from the file contents so the list must not outlive
+//				the Elf_Details struct it was read from
+struct Elf_Digest_List* digest_elf_contents(struct Elf_Details* elven_struct, const char* selection, int algorithms);
+
+// Purpose:	Append one line per digest
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			fileName - Printed first on every line
+//			digestList - List from digest_elf_contents()
+// Output:	None
+// Note:
+//			Tab separated: file, region, offset, size, XXH64, SHA-256 (lowercase hex)
+//			Regions are "file", "segment N", or the section name ("section N" if unnamed)
+//			Digests that weren't requested or couldn't be computed are "-"
+void format_elf_digests(struct Elf_Output* output, const char* fileName, const struct Elf_Digest_List* digestList);
+
+// Purpose:	Zeroize/free an Elf_Digest_List
+// Input:	Pointer to an Elf_Digest_List pointer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	This function will modify the original variable in the calling function
+int kill_digest_list(struct Elf_Digest_List** old_list);
+
+// Purpose:	XXH64 a buffer
+// Input:
+//			buff - Bytes to hash
+//			size - Number of bytes in buff
+//			seed - XXH64 seed (0 for the usual fingerprint)
+// Output:	The 64-bit hash
+uint64_t digest_xxh64(const void* buff, size_t size, uint64_t seed);
+
+// Purpose:	Start a SHA-256 hash
+// Input:	sha [out] - State to initialize
+// Output:	ERROR_* as specified in Elf_Details.h
+int init_sha256(struct Elf_Sha256* sha);
+
+// Purpose:	Hash more bytes
+// Input:
+//			sha - State from init_sha256()
+//			buff - Bytes to hash
+//			size - Number of bytes in buff
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Whole blocks are hashed straight out of buff
+int update_sha256(struct Elf_Sha256* sha, const void* buff, size_t size);
+
+// Purpose:	Finish a SHA-256 hash
+// Input:
+//			sha - State from init_sha256()
+//			digest [out] - DIGEST_SHA256_SIZE bytes
+// Output:	ERROR_* as specified in Elf_Details.h
+int final_sha256(struct Elf_Sha256* sha, unsigned char* digest);
+
+// Purpose:	SHA-256 a buffer
+// Input:
+//			buff - Bytes to hash
+//			size - Number of bytes in buff
+//			digest [out] - DIGEST_SHA256_SIZE bytes
+// Output:	ERROR_* as specified in Elf_Details.h
+int digest_sha256(const void* buff, size_t size, unsigned char* digest);
+
+// Purpose:	Force a particular SHA-256 implementation
+// Input:	digestIsa - DIGEST_ISA_* as specified above
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			Returns ERROR_BAD_ARG if this CPU can't run digestIsa
+//			Set it once, before any other threads start hashing
+int set_digest_isa(int digestIsa);
+
+// Purpose:	Report the SHA-256 implementation in use
+// Input:	None
+// Output:	DIGEST_ISA_SCALAR or DIGEST_ISA_SHA_NI
+int get_digest_isa(void);
+
+#endif // __ELF_DIGEST_H__
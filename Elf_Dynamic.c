@@ -0,0 +1,850 @@
+#include "Elf_Dynamic.h"
+#include "Elf_Arena.h"
+#include "Elf_Decode.h"
+#include "Elf_Details.h"
+#include "Elf_Output.h"
+#include "Harklehash.h"
+#include <errno.h>
+#include <limits.h>		// PATH_MAX
+#include <pthread.h>	// pthread_mutex_t
+#include <string.h>		// memchr()/strcmp()
+
+#define DEP_GRAPH_MIN_NODES	((size_t)1024)	// Nodes allocated by the first add_dep_node()
+#define DEP_GRAPH_MIN_EDGES	((size_t)4096)	// Edges allocated by the first add_dep_node()
+#define DEP_ARENA_BLOCK		((size_t)65536)	// Arena block for copied strings
+
+/* LOCAL STRUCTS */
+struct Elf_Dep_Graph
+{
+	pthread_mutex_t lock;			// Protects everything below until resolve_dep_graph()
+	struct Elf_Arena* strings;		// Copies of every path and name
+	struct Elf_Dep_Node* nodes;		// Every file, in the order added
+	size_t numNodes;				// Number of entries used in nodes
+	size_t nodesCapacity;			// Number of entries allocated in nodes
+	struct Elf_Dep_Edge* edges;		// Every DT_NEEDED entry, grouped by node
+	size_t numEdges;				// Number of entries used in edges
+	size_t edgesCapacity;			// Number of entries allocated in edges
+	struct HarkleTable* nameIndex;	// SONAME (or file name) to the first node with it
+};
+
+/* LOCAL FUNCTIONS */
+static int find_dynamic(const struct Elf_Details* elven_struct, uint64_t* dynOffset, uint64_t* dynSize, int* strSect);
+static int addr_to_offset(const struct Elf_Details* elven_struct, uint64_t addr, uint64_t* offset);
+static const char* get_dynamic_string(const char* strings, uint64_t stringsSize, uint64_t strOffset);
+static const char* copy_string(struct Elf_Arena* arena, const char* str);
+static const char* get_file_name(const char* path);
+static size_t get_dir_len(const char* path);
+static void normalize_path(char* path);
+static int in_search_path(const char* searchPath, const char* originPath, const char* candidatePath);
+static void* grow_array(void* oldArray, size_t* capacity, size_t minCapacity, size_t sizeElem);
+
+
+// Purpose:	Decode the dynamic section of a parsed file
+// Input:
+//			elven_struct - Struct with retained file contents (e.g., read_elf_mapped())
+//			dynInfo [out] - Decoded entries
+// Output:	See: Elf_Dynamic.h
+int read_elf_dynamic(const struct Elf_Details* elven_struct, struct Elf_Dynamic_Info* dynInfo)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	const struct Elf_Decoders* decoders = NULL;	// elven_struct->decoders
+	const unsigned char* dynamic = NULL;		// Raw dynamic entries
+	uint64_t dynOffset = 0;			// Offset of the dynamic entries
+	uint64_t dynSize = 0;			// Bytes of dynamic entries
+	int strSect = -1;				// Section index of the string table the section headers link to
+	size_t entrySize = 0;			// Bytes in one entry
+	size_t numEntries = 0;			// Entries that fit in dynSize
+	uint64_t tag = 0;				// d_tag
+	uint64_t value = 0;				// d_val
+	uint64_t strAddr = 0;			// DT_STRTAB
+	uint64_t strOffset = 0;			// DT_STRTAB translated to a file offset
+	uint64_t strSize = 0;			// DT_STRSZ
+	int haveStrAddr = FALSE;		// If TRUE, DT_STRTAB was found
+	const char* strings = NULL;		// Dynamic string table
+	const char* tmpStr = NULL;		// String being decoded
+	size_t numNeeded = 0;			// DT_NEEDED entries counted
+	size_t i = 0;					// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!elven_struct || !dynInfo)
+	{
+		return ERROR_NULL_PTR;
+	}
+	memset(dynInfo, 0, sizeof(struct Elf_Dynamic_Info));
+	if (!elven_struct->elfGuts || !elven_struct->decoders)
+	{
+		return ERROR_BAD_ARG;
+	}
+	decoders = elven_struct->decoders;
+	entrySize = decoders->elfClass == ELF_H_CLASS_32 ? 8 : 16;
+
+	/* FIND IT */
+	retVal = find_dynamic(elven_struct, &dynOffset, &dynSize, &strSect);
+	if (retVal != ERROR_SUCCESS)
+	{
+		return retVal;
+	}
+	dynamic = (const unsigned char*)elven_struct->elfGuts + dynOffset;
+	numEntries = (size_t)(dynSize / entrySize);
+
+	/* FIRST PASS */
+	// The string table can come after the entries that use it
+	for (i = 0; i < numEntries; i++)
+	{
+		tag = decoders->addr(dynamic + (i * entrySize));
+		value = decoders->addr(dynamic + (i * entrySize) + (entrySize / 2));
+		if (tag == ELF_D_TAG_NULL)
+		{
+			break;
+		}
+		else if (tag == ELF_D_TAG_STRTAB)
+		{
+			strAddr = value;
+			haveStrAddr = TRUE;
+		}
+		else if (tag == ELF_D_TAG_STRSZ)
+		{
+			strSize = value;
+		}
+		else if (tag == ELF_D_TAG_NEEDED)
+		{
+			numNeeded++;
+		}
+	}
+	dynInfo->numEntries = i;
+
+	/* STRING TABLE */
+	// DT_STRTAB is what the loader uses.  The linked section covers files that don't map it.
+	if (haveStrAddr == TRUE && addr_to_offset(elven_struct, strAddr, &strOffset) == ERROR_SUCCESS \
+		&& strOffset < elven_struct->elfSize)
+	{
+		strings = elven_struct->elfGuts + strOffset;
+		if (strSize == 0 || strSize > elven_struct->elfSize - strOffset)
+		{
+			strSize = elven_struct->elfSize - strOffset;
+		}
+	}
+	else if (strSect >= 0 && strSect < elven_struct->numSectHdrs \
+		&& elven_struct->sectHdrs[strSect].offset < elven_struct->elfSize \
+		&& elven_struct->sectHdrs[strSect].size <= elven_struct->elfSize - elven_struct->sectHdrs[strSect].offset)
+	{
+		strings = elven_struct->elfGuts + elven_struct->sectHdrs[strSect].offset;
+		strSize = elven_struct->sectHdrs[strSect].size;
+	}
+	else if (numNeeded > 0)
+	{
+		return ERROR_BAD_OFFSET;
+	}
+
+	/* SECOND PASS */
+	if (numNeeded > 0)
+	{
+		dynInfo->needed = (const char**)gimme_mem(numNeeded, sizeof(const char*));
+		if (!dynInfo->needed)
+		{
+			return ERROR_NULL_PTR;
+		}
+		dynInfo->neededCapacity = numNeeded;
+	}
+	for (i = 0; i < dynInfo->numEntries; i++)
+	{
+		tag = decoders->addr(dynamic + (i * entrySize));
+		value = decoders->addr(dynamic + (i * entrySize) + (entrySize / 2));
+		tmpStr = get_dynamic_string(strings, strSize, value);
+		switch (tag)
+		{
+			case ELF_D_TAG_NEEDED:
+				if (tmpStr && dynInfo->numNeeded < numNeeded)
+				{
+					dynInfo->needed[dynInfo->numNeeded++] = tmpStr;
+				}
+				break;
+			case ELF_D_TAG_SONAME:
+				dynInfo->soname = tmpStr;
+				break;
+			case ELF_D_TAG_RPATH:
+				dynInfo->rpath = tmpStr;
+				break;
+			case ELF_D_TAG_RUNPATH:
+				dynInfo->runpath = tmpStr;
+				break;
+			case ELF_D_TAG_FLAGS:
+				dynInfo->flags = value;
+				break;
+			case ELF_D_TAG_FLAGS_1:
+				dynInfo->flags1 = value;
+				break;
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Free what read_elf_dynamic() allocated
+// Input:	dynInfo - Struct filled by read_elf_dynamic()
+// Output:	ERROR_* as specified in Elf_Details.h
+int free_dynamic_info(struct Elf_Dynamic_Info* dynInfo)
+{
+	/* INPUT VALIDATION */
+	if (!dynInfo)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	/* FREE IT */
+	if (dynInfo->needed)
+	{
+		// Names the second pass skipped (e.g., bad string offsets) leave numNeeded short
+		take_mem_back((void**)&(dynInfo->needed), dynInfo->neededCapacity ? dynInfo->neededCapacity : 1, \
+			sizeof(const char*));
+	}
+	memset(dynInfo, 0, sizeof(struct Elf_Dynamic_Info));
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Append one tab-separated line per entry ("fileName<TAB>NEEDED<TAB>libc.so.6")
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			fileName - Printed first on every line
+//			dynInfo - From read_elf_dynamic()
+// Output:	None
+// Note:	SONAME, NEEDED (in order), RPATH, RUNPATH, then FLAGS and FLAGS_1 in hex.  Only
+//				entries the file has are printed.
+void format_elf_dynamic(struct Elf_Output* output, const char* fileName, const struct Elf_Dynamic_Info* dynInfo)
+{
+	/* LOCAL VARIABLES */
+	const char* labels[] = { "SONAME", "RPATH", "RUNPATH" };	// Single string entries
+	const char* values[3] = { NULL, NULL, NULL };				// Matching labels
+	size_t i = 0;		// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!output || !fileName || !dynInfo)
+	{
+		return;
+	}
+	values[0] = dynInfo->soname;
+	values[1] = dynInfo->rpath;
+	values[2] = dynInfo->runpath;
+
+	/* FORMAT */
+	if (values[0])
+	{
+		output_str(output, fileName);
+		output_str(output, "\tSONAME\t");
+		output_str(output, values[0]);
+		output_char(output, '\n');
+	}
+	for (i = 0; i < dynInfo->numNeeded; i++)
+	{
+		output_str(output, fileName);
+		output_str(output, "\tNEEDED\t");
+		output_str(output, dynInfo->needed[i]);
+		output_char(output, '\n');
+	}
+	for (i = 1; i < sizeof(labels) / sizeof(*labels); i++)
+	{
+		if (values[i])
+		{
+			output_str(output, fileName);
+			output_char(output, '\t');
+			output_str(output, labels[i]);
+			output_char(output, '\t');
+			output_str(output, values[i]);
+			output_char(output, '\n');
+		}
+	}
+	if (dynInfo->flags)
+	{
+		output_str(output, fileName);
+		output_str(output, "\tFLAGS\t0x");
+		output_hex(output, dynInfo->flags, 1);
+		output_char(output, '\n');
+	}
+	if (dynInfo->flags1)
+	{
+		output_str(output, fileName);
+		output_str(output, "\tFLAGS_1\t0x");
+		output_hex(output, dynInfo->flags1, 1);
+		output_char(output, '\n');
+	}
+
+	return;
+}
+
+
+// Purpose:	Allocate an empty dependency graph
+// Input:	None
+// Output:	Pointer to the new graph, NULL on failure
+struct Elf_Dep_Graph* create_dep_graph(void)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Dep_Graph* retVal = NULL;
+
+	/* ALLOCATE */
+	retVal = (struct Elf_Dep_Graph*)gimme_mem(1, sizeof(struct Elf_Dep_Graph));
+	if (!retVal)
+	{
+		return retVal;
+	}
+	pthread_mutex_init(&(retVal->lock), NULL);
+	retVal->strings = create_arena(DEP_ARENA_BLOCK);
+	if (!retVal->strings)
+	{
+		kill_dep_graph(&retVal);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Add one file to a dependency graph
+// Input:
+//			depGraph - Graph from create_dep_graph()
+//			fileName - Path of the file
+//			elven_struct - The parsed file (for its class and ISA)
+//			dynInfo - From read_elf_dynamic()
+// Output:	ERROR_* as specified in Elf_Details.h
+int add_dep_node(struct Elf_Dep_Graph* depGraph, const char* fileName, const struct Elf_Details* elven_struct, \
+	             const struct Elf_Dynamic_Info* dynInfo)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Dep_Node* node = NULL;	// Node being added
+	void* tmpArray = NULL;				// Grown nodes or edges
+	size_t i = 0;						// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!depGraph || !fileName || !elven_struct || !dynInfo)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	pthread_mutex_lock(&(depGraph->lock));
+	/* MAKE ROOM */
+	if (depGraph->numNodes == depGraph->nodesCapacity)
+	{
+		tmpArray = grow_array(depGraph->nodes, &(depGraph->nodesCapacity), DEP_GRAPH_MIN_NODES, \
+			sizeof(struct Elf_Dep_Node));
+		retVal = tmpArray ? ERROR_SUCCESS : ERROR_NULL_PTR;
+		depGraph->nodes = tmpArray ? (struct Elf_Dep_Node*)tmpArray : depGraph->nodes;
+	}
+	while (retVal == ERROR_SUCCESS && depGraph->numEdges + dynInfo->numNeeded > depGraph->edgesCapacity)
+	{
+		tmpArray = grow_array(depGraph->edges, &(depGraph->edgesCapacity), DEP_GRAPH_MIN_EDGES, \
+			sizeof(struct Elf_Dep_Edge));
+		retVal = tmpArray ? ERROR_SUCCESS : ERROR_NULL_PTR;
+		depGraph->edges = tmpArray ? (struct Elf_Dep_Edge*)tmpArray : depGraph->edges;
+	}
+
+	/* ADD IT */
+	if (retVal == ERROR_SUCCESS)
+	{
+		node = depGraph->nodes + depGraph->numNodes;
+		memset(node, 0, sizeof(struct Elf_Dep_Node));
+		node->path = copy_string(depGraph->strings, fileName);
+		node->soname = copy_string(depGraph->strings, dynInfo->soname);
+		// DT_RPATH is ignored by the loader when DT_RUNPATH is present
+		node->searchPath = copy_string(depGraph->strings, dynInfo->runpath ? dynInfo->runpath : dynInfo->rpath);
+		node->flags = dynInfo->flags;
+		node->elfClass = elven_struct->processorType;
+		node->isa = copy_string(depGraph->strings, elven_struct->ISA);
+		node->firstEdge = depGraph->numEdges;
+		node->nextSameName = -1;
+		for (i = 0; i < dynInfo->numNeeded; i++)
+		{
+			depGraph->edges[node->firstEdge + i].name = copy_string(depGraph->strings, dynInfo->needed[i]);
+			depGraph->edges[node->firstEdge + i].target = DEP_UNRESOLVED;
+		}
+		node->numEdges = dynInfo->numNeeded;
+		if (!node->path || depGraph->numNodes >= INT32_MAX)
+		{
+			retVal = ERROR_NULL_PTR;
+		}
+		else
+		{
+			depGraph->numEdges += node->numEdges;
+			depGraph->numNodes++;
+		}
+	}
+	pthread_mutex_unlock(&(depGraph->lock));
+
+	return retVal;
+}
+
+
+// Purpose:	Resolve every DT_NEEDED entry to a scanned file
+// Input:	depGraph - Graph with every file added
+// Output:	Number of edges left unresolved
+// Note:
+//			Ties are broken by path so the graph doesn't depend on the order files were added
+//			Names with a slash are paths to the library, so only a node with that path matches
+size_t resolve_dep_graph(struct Elf_Dep_Graph* depGraph)
+{
+	/* LOCAL VARIABLES */
+	size_t retVal = 0;
+	struct Elf_Dep_Node* node = NULL;		// Node whose edges are being resolved
+	struct Elf_Dep_Node* candidate = NULL;	// Node that might provide the library
+	struct Elf_Dep_Edge* edge = NULL;		// Edge being resolved
+	struct HarkleDict* entry = NULL;		// nameIndex entry
+	const char* key = NULL;					// Name a node is indexed under
+	int best = DEP_UNRESOLVED;				// Best candidate so far
+	int bestInPath = FALSE;					// If TRUE, best is in node's search path
+	int inPath = FALSE;						// If TRUE, candidate is in node's search path
+	int nextCandidate = 0;					// Index of candidate
+	size_t i = 0;							// Iterating variable
+	size_t j = 0;							// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!depGraph)
+	{
+		return retVal;
+	}
+
+	/* INDEX THE NAMES */
+	if (depGraph->nameIndex)
+	{
+		destroy_a_table(&(depGraph->nameIndex));
+	}
+	depGraph->nameIndex = create_a_table(depGraph->numNodes, FALSE);
+	for (i = 0; depGraph->nameIndex && i < depGraph->numNodes; i++)
+	{
+		node = depGraph->nodes + i;
+		node->nextSameName = -1;
+		key = node->soname ? node->soname : get_file_name(node->path);
+		entry = lookup_table_name(depGraph->nameIndex, (char*)key);
+		if (entry)
+		{
+			// Chained behind the first node with this name
+			node->nextSameName = depGraph->nodes[entry->value].nextSameName;
+			depGraph->nodes[entry->value].nextSameName = (int)i;
+		}
+		else
+		{
+			add_table_entry(depGraph->nameIndex, (char*)key, (int)i);
+		}
+	}
+
+	/* RESOLVE */
+	for (i = 0; i < depGraph->numNodes; i++)
+	{
+		node = depGraph->nodes + i;
+		for (j = node->firstEdge; j < node->firstEdge + node->numEdges; j++)
+		{
+			edge = depGraph->edges + j;
+			best = DEP_UNRESOLVED;
+			bestInPath = FALSE;
+			entry = depGraph->nameIndex ? lookup_table_name(depGraph->nameIndex, (char*)get_file_name(edge->name)) : NULL;
+			for (nextCandidate = entry ? entry->value : -1; nextCandidate >= 0; nextCandidate = candidate->nextSameName)
+			{
+				candidate = depGraph->nodes + nextCandidate;
+				// Same class and ISA, and the exact path if one was given
+				if (candidate->elfClass != node->elfClass || (candidate->isa && node->isa && strcmp(candidate->isa, node->isa)) \
+					|| (strchr(edge->name, '/') && strcmp(candidate->path, edge->name)))
+				{
+					continue;
+				}
+				inPath = in_search_path(node->searchPath, node->path, candidate->path);
+				if (best == DEP_UNRESOLVED || (inPath == TRUE && bestInPath != TRUE) \
+					|| (inPath == bestInPath && strcmp(candidate->path, depGraph->nodes[best].path) < 0))
+				{
+					best = nextCandidate;
+					bestInPath = inPath;
+				}
+			}
+			edge->target = best;
+			retVal += best == DEP_UNRESOLVED ? 1 : 0;
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Get the resolved graph
+// Input:
+//			depGraph - Graph from resolve_dep_graph()
+//			nodes [out] - Every file, in the order added
+//			numNodes [out] - Number of entries in nodes
+//			edges [out] - Every DT_NEEDED entry (see: Elf_Dep_Node.firstEdge)
+// Output:	ERROR_* as specified in Elf_Details.h
+int get_dep_graph(const struct Elf_Dep_Graph* depGraph, const struct Elf_Dep_Node** nodes, size_t* numNodes, \
+	              const struct Elf_Dep_Edge** edges)
+{
+	if (!depGraph || !nodes || !numNodes || !edges)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	*nodes = depGraph->nodes;
+	*numNodes = depGraph->numNodes;
+	*edges = depGraph->edges;
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Append "path<TAB>needed<TAB>resolved path" per edge ("-" if unresolved)
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			depGraph - Graph from resolve_dep_graph()
+// Output:	None
+void format_dep_graph(struct Elf_Output* output, const struct Elf_Dep_Graph* depGraph)
+{
+	/* LOCAL VARIABLES */
+	const struct Elf_Dep_Node* node = NULL;	// Node being formatted
+	const struct Elf_Dep_Edge* edge = NULL;	// Edge being formatted
+	size_t i = 0;							// Iterating variable
+	size_t j = 0;							// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!output || !depGraph)
+	{
+		return;
+	}
+
+	/* FORMAT */
+	for (i = 0; i < depGraph->numNodes; i++)
+	{
+		node = depGraph->nodes + i;
+		for (j = node->firstEdge; j < node->firstEdge + node->numEdges; j++)
+		{
+			edge = depGraph->edges + j;
+			output_str(output, node->path);
+			output_char(output, '\t');
+			output_str(output, edge->name);
+			output_char(output, '\t');
+			output_str(output, edge->target == DEP_UNRESOLVED ? "-" : depGraph->nodes[edge->target].path);
+			output_char(output, '\n');
+		}
+	}
+
+	return;
+}
+
+
+// Purpose:	Zeroize/free a dependency graph
+// Input:	Pointer to a graph pointer
+// Output:	ERROR_* as specified in Elf_Details.h
+int kill_dep_graph(struct Elf_Dep_Graph** depGraph)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Dep_Graph* oldGraph = NULL;	// *depGraph
+
+	/* INPUT VALIDATION */
+	if (!depGraph || !(*depGraph))
+	{
+		return ERROR_NULL_PTR;
+	}
+	oldGraph = *depGraph;
+
+	/* FREE IT */
+	if (oldGraph->nameIndex)
+	{
+		destroy_a_table(&(oldGraph->nameIndex));
+	}
+	if (oldGraph->nodes)
+	{
+		take_mem_back((void**)&(oldGraph->nodes), oldGraph->nodesCapacity, sizeof(struct Elf_Dep_Node));
+	}
+	if (oldGraph->edges)
+	{
+		take_mem_back((void**)&(oldGraph->edges), oldGraph->edgesCapacity, sizeof(struct Elf_Dep_Edge));
+	}
+	if (oldGraph->strings)
+	{
+		destroy_arena(&(oldGraph->strings));
+	}
+	pthread_mutex_destroy(&(oldGraph->lock));
+	take_mem_back((void**)depGraph, 1, sizeof(struct Elf_Dep_Graph));
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Locate the dynamic entries
+// Input:
+//			elven_struct - Parsed file
+//			dynOffset [out] - Offset of the entries
+//			dynSize [out] - Bytes of entries
+//			strSect [out] - Section index of the linked string table (-1 if found by segment)
+// Output:	ERROR_SUCCESS, DYNAMIC_NOT_FOUND, or ERROR_BAD_OFFSET if it runs past the end of the file
+static int find_dynamic(const struct Elf_Details* elven_struct, uint64_t* dynOffset, uint64_t* dynSize, int* strSect)
+{
+	/* LOCAL VARIABLES */
+	int retVal = DYNAMIC_NOT_FOUND;
+	int i = 0;		// Iterating variable
+
+	/* PT_DYNAMIC */
+	for (i = 0; elven_struct->prgmHdrs && i < elven_struct->numPrgmHdrs; i++)
+	{
+		if (elven_struct->prgmHdrs[i].type == ELF_P_TYPE_DYNAMIC)
+		{
+			*dynOffset = elven_struct->prgmHdrs[i].offset;
+			*dynSize = elven_struct->prgmHdrs[i].filesz;
+			retVal = ERROR_SUCCESS;
+			break;
+		}
+	}
+
+	/* SHT_DYNAMIC */
+	// Its link is worth having even when the segment was found
+	for (i = 0; elven_struct->sectHdrs && i < elven_struct->numSectHdrs; i++)
+	{
+		if (elven_struct->sectHdrs[i].type == ELF_S_TYPE_DYNAMIC)
+		{
+			if (retVal != ERROR_SUCCESS)
+			{
+				*dynOffset = elven_struct->sectHdrs[i].offset;
+				*dynSize = elven_struct->sectHdrs[i].size;
+				retVal = ERROR_SUCCESS;
+			}
+			*strSect = (int)elven_struct->sectHdrs[i].link;
+			break;
+		}
+	}
+
+	/* BOUNDS CHECK */
+	if (retVal == ERROR_SUCCESS && (*dynOffset > elven_struct->elfSize || *dynSize > elven_struct->elfSize - *dynOffset))
+	{
+		retVal = ERROR_BAD_OFFSET;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Translate a virtual address to a file offset through the PT_LOAD segments
+// Input:
+//			elven_struct - Parsed file
+//			addr - Virtual address
+//			offset [out] - File offset of addr
+// Output:	ERROR_SUCCESS, or ERROR_BAD_OFFSET if no segment maps addr from the file
+static int addr_to_offset(const struct Elf_Details* elven_struct, uint64_t addr, uint64_t* offset)
+{
+	const struct Elf_Prgrm_Header* prgmHdr = NULL;	// Segment being checked
+	int i = 0;										// Iterating variable
+
+	for (i = 0; elven_struct->prgmHdrs && i < elven_struct->numPrgmHdrs; i++)
+	{
+		prgmHdr = elven_struct->prgmHdrs + i;
+		if (prgmHdr->type == ELF_P_TYPE_LOAD && addr >= prgmHdr->vaddr && addr - prgmHdr->vaddr < prgmHdr->filesz)
+		{
+			*offset = prgmHdr->offset + (addr - prgmHdr->vaddr);
+			return ERROR_SUCCESS;
+		}
+	}
+
+	return ERROR_BAD_OFFSET;
+}
+
+
+// Purpose:	Get a nul-terminated string out of a string table
+// Input:
+//			strings - String table
+//			stringsSize - Bytes in strings
+//			strOffset - Offset of the string
+// Output:	The string, NULL if it isn't terminated inside the table
+static const char* get_dynamic_string(const char* strings, uint64_t stringsSize, uint64_t strOffset)
+{
+	if (!strings || strOffset >= stringsSize || !memchr(strings + strOffset, '\0', (size_t)(stringsSize - strOffset)))
+	{
+		return NULL;
+	}
+
+	return strings + strOffset;
+}
+
+
+// Purpose:	Copy a string into an arena
+// Input:
+//			arena - Where the copy goes
+//			str - String to copy (NULL copies to NULL)
+// Output:	The copy, NULL on failure
+static const char* copy_string(struct Elf_Arena* arena, const char* str)
+{
+	char* retVal = NULL;
+
+	if (str)
+	{
+		retVal = (char*)arena_gimme_mem(arena, strlen(str) + 1, sizeof(char));
+		if (retVal)
+		{
+			memcpy(retVal, str, strlen(str));
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Get the last component of a path
+static const char* get_file_name(const char* path)
+{
+	const char* lastSlash = strrchr(path, '/');
+
+	return lastSlash ? lastSlash + 1 : path;
+}
+
+
+// Purpose:	Get the length of the directory part of a path ("/" for the root, 0 if there isn't one)
+static size_t get_dir_len(const char* path)
+{
+	const char* lastSlash = strrchr(path, '/');
+
+	if (lastSlash == path)
+	{
+		return 1;
+	}
+
+	return lastSlash ? (size_t)(lastSlash - path) : 0;
+}
+
+
+// Purpose:	Remove ".", "..", and repeated slashes from a path without touching the filesystem
+// Input:	path - Path to normalize in place
+// Output:	None
+// Note:	A ".." with nothing left to remove is kept in relative paths and dropped at the root
+static void normalize_path(char* path)
+{
+	/* LOCAL VARIABLES */
+	size_t rootLen = path[0] == '/' ? 1 : 0;	// Never removed
+	char* readPtr = path + rootLen;				// Next component to read
+	char* writePtr = path + rootLen;			// End of the normalized path
+	char* compStart = NULL;						// Component being read
+	size_t compLen = 0;							// Length of that component
+	char* lastComp = NULL;						// Last component written
+
+	/* NORMALIZE */
+	while (*readPtr)
+	{
+		compStart = readPtr;
+		compLen = strcspn(readPtr, "/");
+		readPtr += compLen;
+		while (*readPtr == '/')
+		{
+			readPtr++;
+		}
+		if (compLen == 0 || (compLen == 1 && compStart[0] == '.'))
+		{
+			continue;
+		}
+		if (compLen == 2 && !strncmp(compStart, "..", 2))
+		{
+			*writePtr = '\0';
+			lastComp = strrchr(path + rootLen, '/');
+			lastComp = lastComp ? lastComp + 1 : path + rootLen;
+			if (writePtr > path + rootLen && strcmp(lastComp, ".."))
+			{
+				// Drop the last component and the slash before it
+				writePtr = lastComp > path + rootLen ? lastComp - 1 : path + rootLen;
+				continue;
+			}
+			else if (rootLen)
+			{
+				continue;
+			}
+		}
+		if (writePtr > path + rootLen)
+		{
+			*writePtr++ = '/';
+		}
+		memmove(writePtr, compStart, compLen);
+		writePtr += compLen;
+	}
+	*writePtr = '\0';
+
+	return;
+}
+
+
+// Purpose:	Check whether a file is in one of the directories of a search path
+// Input:
+//			searchPath - Colon-separated directories (NULL for none)
+//			originPath - Path of the file the search path came from ($ORIGIN is its directory)
+//			candidatePath - File to look for
+// Output:	TRUE if candidatePath's directory is listed, FALSE otherwise
+// Note:	Directories are normalized (see: normalize_path()) but not looked up, so symbolic
+//				links aren't followed
+static int in_search_path(const char* searchPath, const char* originPath, const char* candidatePath)
+{
+	/* LOCAL VARIABLES */
+	char candidateDir[PATH_MAX] = { 0 };	// candidatePath's directory, normalized
+	char searchDir[PATH_MAX] = { 0 };		// Directory from searchPath, expanded and normalized
+	const char* dirStart = searchPath;		// Directory being compared
+	size_t dirLen = 0;						// Length of that directory
+	size_t candidateLen = 0;				// Length of candidatePath's directory
+	size_t originLen = 0;					// Length of originPath's directory
+	size_t tokenLen = 0;					// Length of "$ORIGIN" or "${ORIGIN}"
+
+	/* INPUT VALIDATION */
+	if (!searchPath || !originPath || !candidatePath)
+	{
+		return FALSE;
+	}
+	candidateLen = get_dir_len(candidatePath);
+	if (candidateLen == 0 || candidateLen >= PATH_MAX)
+	{
+		return FALSE;
+	}
+	memcpy(candidateDir, candidatePath, candidateLen);
+	normalize_path(candidateDir);
+	originLen = get_dir_len(originPath);
+
+	/* COMPARE EACH DIRECTORY */
+	while (dirStart)
+	{
+		dirLen = strchr(dirStart, ':') ? (size_t)(strchr(dirStart, ':') - dirStart) : strlen(dirStart);
+		tokenLen = !strncmp(dirStart, "${ORIGIN}", 9) ? 9 : 0;
+		tokenLen = !strncmp(dirStart, "$ORIGIN", 7) ? 7 : tokenLen;
+		// Empty entries (the current directory) and $ORIGIN without a directory aren't comparable
+		if (dirLen > 0 && tokenLen <= dirLen && (!tokenLen || originLen) \
+			&& (tokenLen ? originLen : 0) + dirLen - tokenLen < PATH_MAX)
+		{
+			if (tokenLen)
+			{
+				memcpy(searchDir, originPath, originLen);
+			}
+			memcpy(searchDir + (tokenLen ? originLen : 0), dirStart + tokenLen, dirLen - tokenLen);
+			searchDir[(tokenLen ? originLen : 0) + dirLen - tokenLen] = '\0';
+			normalize_path(searchDir);
+			if (!strcmp(searchDir, candidateDir))
+			{
+				return TRUE;
+			}
+		}
+		dirStart = strchr(dirStart, ':');
+		dirStart = dirStart ? dirStart + 1 : NULL;
+	}
+
+	return FALSE;
+}
+
+
+// Purpose:	Double an array
+// Input:
+//			oldArray - Array to grow (NULL for a new one).  Released on success.
+//			capacity - Number of elements in oldArray.  Updated on success.
+//			minCapacity - Number of elements in a new array
+//			sizeElem - Size of each element
+// Output:	The new array, NULL on failure (oldArray is left alone)
+static void* grow_array(void* oldArray, size_t* capacity, size_t minCapacity, size_t sizeElem)
+{
+	size_t newCapacity = *capacity ? *capacity * 2 : minCapacity;
+	void* retVal = gimme_mem(newCapacity, sizeElem);
+
+	if (retVal && oldArray)
+	{
+		memcpy(retVal, oldArray, *capacity * sizeElem);
+		take_mem_back(&oldArray, *capacity, sizeElem);
+	}
+	if (retVal)
+	{
+		*capacity = newCapacity;
+	}
+
+	return retVal;
+}
@@ -0,0 +1,149 @@
+#ifndef __ELF_DYNAMIC_H__
+#define __ELF_DYNAMIC_H__
+
+#include <stddef.h>		// size_t
+#include <stdint.h>		// Fixed-width integers
+
+/*
+ *	USAGE:
+ *		read_elf_dynamic() decodes the dynamic section of a parsed file (DT_NEEDED, DT_SONAME,
+ *			DT_RPATH, DT_RUNPATH, DT_FLAGS, DT_FLAGS_1)
+ *		Dependency graph:
+ *			Start - create_dep_graph()
+ *			Step - add_dep_node() once per file (from any thread), then resolve_dep_graph()
+ *			Stop - kill_dep_graph()
+ *	LOCATING .dynamic:
+ *		The PT_DYNAMIC segment and DT_STRTAB are used first, just like the dynamic loader, so
+ *			files without section headers still work.  The SHT_DYNAMIC section and its linked
+ *			string table are the fallback.
+ *	RESOLUTION:
+ *		Every library is indexed by SONAME (or its file name if it has none) in a HarkleTable,
+ *			so a DT_NEEDED entry is resolved with one lookup instead of filesystem searches.
+ *		When several scanned files share a SONAME, a candidate of the same class and ISA in one
+ *			of the needing file's DT_RUNPATH (or DT_RPATH) directories wins, with $ORIGIN
+ *			expanded and "." and ".." removed.  Otherwise any candidate of the same class and
+ *			ISA does.  Ties go to the lowest path so the result doesn't depend on scan order.
+ *		Only files that were scanned can be found.  Everything else is unresolved.
+ */
+
+#define DYNAMIC_NOT_FOUND	((int)1)	// The file has no dynamic section (e.g., static executables)
+#define DEP_UNRESOLVED		((int)-1)	// Elf_Dep_Edge.target if no scanned file provides the library
+
+struct Elf_Details;
+struct Elf_Output;
+struct Elf_Arena;
+struct HarkleTable;
+
+struct Elf_Dynamic_Info
+{
+	const char** needed;	// DT_NEEDED names in order (point into the parsed buffer)
+	size_t numNeeded;		// Number of entries in needed
+	size_t neededCapacity;	// Number of entries allocated for needed (see: free_dynamic_info())
+	const char* soname;		// DT_SONAME, NULL if none
+	const char* rpath;		// DT_RPATH, NULL if none
+	const char* runpath;	// DT_RUNPATH, NULL if none
+	uint64_t flags;			// DT_FLAGS (see: ELF_D_FLAG_*)
+	uint64_t flags1;		// DT_FLAGS_1
+	size_t numEntries;		// Entries before DT_NULL
+};
+
+// One DT_NEEDED entry of one file
+struct Elf_Dep_Edge
+{
+	const char* name;		// Library name from DT_NEEDED
+	int target;				// Index into Elf_Dep_Graph.nodes, DEP_UNRESOLVED if not found
+};
+
+// One scanned file
+struct Elf_Dep_Node
+{
+	const char* path;		// Path as scanned
+	const char* soname;		// DT_SONAME, NULL if none
+	const char* searchPath;	// DT_RUNPATH, or DT_RPATH if there's no DT_RUNPATH (NULL if neither)
+	uint64_t flags;			// DT_FLAGS
+	int elfClass;			// ELF_H_CLASS_*
+	const char* isa;		// Elf_Details.ISA
+	size_t firstEdge;		// Index into Elf_Dep_Graph.edges
+	size_t numEdges;		// Number of DT_NEEDED entries
+	int nextSameName;		// Next node indexed under the same name, -1 at the end
+};
+
+struct Elf_Dep_Graph;
+
+
+// Purpose:	Decode the dynamic section of a parsed file
+// Input:
+//			elven_struct - Struct with retained file contents (e.g., read_elf_mapped())
+//			dynInfo [out] - Decoded entries
+// Output:
+//			ERROR_SUCCESS on success
+//			DYNAMIC_NOT_FOUND if the file has no dynamic section
+//			ERROR_* as specified in Elf_Details.h on error
+// Note:
+//			Caller is responsible for utilizing free_dynamic_info() to free dynInfo->needed
+//			Strings are borrowed from the file contents so dynInfo must not outlive elven_struct
+//			Entries whose string offsets fall outside the string table are skipped
+int read_elf_dynamic(const struct Elf_Details* elven_struct, struct Elf_Dynamic_Info* dynInfo);
+
+// Purpose:	Free what read_elf_dynamic() allocated
+// Input:	dynInfo - Struct filled by read_elf_dynamic()
+// Output:	ERROR_* as specified in Elf_Details.h
+int free_dynamic_info(struct Elf_Dynamic_Info* dynInfo);
+
+// Purpose:	Append one tab-separated line per entry ("fileName<TAB>NEEDED<TAB>libc.so.6")
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			fileName - Printed first on every line
+//			dynInfo - From read_elf_dynamic()
+// Output:	None
+void format_elf_dynamic(struct Elf_Output* output, const char* fileName, const struct Elf_Dynamic_Info* dynInfo);
+
+// Purpose:	Allocate an empty dependency graph
+// Input:	None
+// Output:	Pointer to the new graph, NULL on failure
+// Note:	Caller is responsible for utilizing kill_dep_graph() to free the graph
+struct Elf_Dep_Graph* create_dep_graph(void);
+
+// Purpose:	Add one file to a dependency graph
+// Input:
+//			depGraph - Graph from create_dep_graph()
+//			fileName - Path of the file
+//			elven_struct - The parsed file (for its class and ISA)
+//			dynInfo - From read_elf_dynamic()
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			Thread-safe.  Every string is copied so the file can be released right away.
+//			Call before resolve_dep_graph()
+int add_dep_node(struct Elf_Dep_Graph* depGraph, const char* fileName, const struct Elf_Details* elven_struct, \
+	             const struct Elf_Dynamic_Info* dynInfo);
+
+// Purpose:	Resolve every DT_NEEDED entry to a scanned file
+// Input:	depGraph - Graph with every file added
+// Output:	Number of edges left unresolved
+// Note:	O(number of edges) HarkleTable lookups.  Call once, after the last add_dep_node().
+size_t resolve_dep_graph(struct Elf_Dep_Graph* depGraph);
+
+// Purpose:	Get the resolved graph
+// Input:
+//			depGraph - Graph from resolve_dep_graph()
+//			nodes [out] - Every file, in the order added
+//			numNodes [out] - Number of entries in nodes
+//			edges [out] - Every DT_NEEDED entry (see: Elf_Dep_Node.firstEdge)
+// Output:	ERROR_* as specified in Elf_Details.h
+int get_dep_graph(const struct Elf_Dep_Graph* depGraph, const struct Elf_Dep_Node** nodes, size_t* numNodes, \
+	              const struct Elf_Dep_Edge** edges);
+
+// Purpose:	Append "path<TAB>needed<TAB>resolved path" per edge ("-" if unresolved)
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			depGraph - Graph from resolve_dep_graph()
+// Output:	None
+void format_dep_graph(struct Elf_Output* output, const struct Elf_Dep_Graph* depGraph);
+
+// Purpose:	Zeroize/free a dependency graph
+// Input:	Pointer to a graph pointer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Modifies the graph pointer by making it NULL
+int kill_dep_graph(struct Elf_Dep_Graph** depGraph);
+
+#endif // __ELF_DYNAMIC_H__
@@ -0,0 +1,509 @@
+#include "Elf_Json.h"
+#include "Elf_Details.h"
+#include "Elf_Output.h"
+#include <string.h>
+
+
+/* LOCAL FUNCTIONS */
+static void output_json_key(struct Elf_Output* output, const char* key, int first);
+static void output_json_hex(struct Elf_Output* output, uint64_t value);
+static void output_json_uint(struct Elf_Output* output, const char* key, uint64_t value);
+static void output_json_int(struct Elf_Output* output, const char* key, int64_t value);
+static void output_json_text(struct Elf_Output* output, const char* key, const char* value);
+static void output_json_addr(struct Elf_Output* output, const char* key, uint64_t value);
+static void format_segments_json(struct Elf_Output* output, struct Elf_Details* elven_file);
+static void format_sections_json(struct Elf_Output* output, struct Elf_Details* elven_file);
+static size_t utf8_sequence_len(const unsigned char* str);
+
+
+// Purpose:	Append one JSON Lines record describing an ELF file
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			elven_file - A Elf_Details struct that contains data about an ELF file
+// Output:	None
+// Note:	Files without the ELF magic number get a "not_elf" record
+void format_elf_json(struct Elf_Output* output, struct Elf_Details* elven_file)
+{
+	/* LOCAL VARIABLES */
+	int i = 0;	// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!output || !elven_file)
+	{
+		fprintf(stderr, "ERROR: NULL parameter received!\n");
+		return;
+	}
+
+	/* IDENTITY */
+	output_char(output, '{');
+	output_json_key(output, "file", TRUE);
+	output_json_str(output, elven_file->fileName);
+	if (!elven_file->magicNum || strncmp(elven_file->magicNum, ELF_H_MAGIC_NUM, 4))
+	{
+		output_json_text(output, "status", JSON_STATUS_NOT_ELF);
+		output_str(output, "}\n");
+		return;
+	}
+	output_json_text(output, "status", JSON_STATUS_ELF);
+
+	/* ELF HEADER */
+	output_json_text(output, "class", elven_file->elfClass);
+	output_json_key(output, "bits", FALSE);
+	if (elven_file->processorType == ELF_H_CLASS_32)
+	{
+		output_str(output, "32");
+	}
+	else if (elven_file->processorType == ELF_H_CLASS_64)
+	{
+		output_str(output, "64");
+	}
+	else
+	{
+		output_str(output, "null");
+	}
+	output_json_text(output, "endianness", elven_file->endianness);
+	output_json_key(output, "big_endian", FALSE);
+	output_str(output, elven_file->bigEndian == TRUE ? "true" : "false");
+	output_json_int(output, "elf_version", elven_file->elfVersion);
+	output_json_text(output, "os_abi", elven_file->targetOS);
+	output_json_int(output, "abi_version", elven_file->ABIversion);
+	output_json_key(output, "pad", FALSE);
+	if (elven_file->pad)
+	{
+		output_char(output, '[');
+		for (i = 0; i < 7; i++)
+		{
+			if (i > 0)
+			{
+				output_char(output, ',');
+			}
+			output_udec(output, (unsigned char)(*(elven_file->pad + i)));
+		}
+		output_char(output, ']');
+	}
+	else
+	{
+		output_str(output, "null");
+	}
+	output_json_text(output, "type", elven_file->type);
+	output_json_text(output, "isa", elven_file->ISA);
+	output_json_text(output, "object_version", elven_file->objVersion);
+	if (elven_file->processorType == ELF_H_CLASS_32)
+	{
+		output_json_addr(output, "entry", elven_file->ePnt32);
+		output_json_addr(output, "phoff", elven_file->pHdr32);
+		output_json_addr(output, "shoff", elven_file->sHdr32);
+	}
+	else if (elven_file->processorType == ELF_H_CLASS_64)
+	{
+		output_json_addr(output, "entry", elven_file->ePnt64);
+		output_json_addr(output, "phoff", elven_file->pHdr64);
+		output_json_addr(output, "shoff", elven_file->sHdr64);
+	}
+	else
+	{
+		output_str(output, ",\"entry\":null,\"phoff\":null,\"shoff\":null");
+	}
+	output_json_uint(output, "flags", elven_file->flags);
+	output_json_int(output, "ehsize", elven_file->elfHdrSize);
+	output_json_int(output, "phentsize", elven_file->prgmHdrSize);
+	output_json_int(output, "phnum", elven_file->prgmHdrEntrNum);
+	output_json_int(output, "shentsize", elven_file->sectHdrSize);
+	output_json_int(output, "shnum", elven_file->sectHdrEntrNum);
+	output_json_int(output, "shstrndx", elven_file->sectHdrSectNms);
+
+	/* TABLES */
+	format_segments_json(output, elven_file);
+	format_sections_json(output, elven_file);
+
+	output_str(output, "}\n");
+
+	return;
+}
+
+
+// Purpose:	Append one JSON Lines record for a file that wasn't parsed
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			fileName - File that wasn't parsed
+//			errnum - errno from the failure.  0 means it was read but isn't an ELF file.
+// Output:	None
+void format_json_unparsed(struct Elf_Output* output, const char* fileName, int errnum)
+{
+	if (!output)
+	{
+		fprintf(stderr, "ERROR: NULL parameter received!\n");
+		return;
+	}
+
+	output_char(output, '{');
+	output_json_key(output, "file", TRUE);
+	output_json_str(output, fileName);
+	if (errnum)
+	{
+		output_json_text(output, "status", JSON_STATUS_ERROR);
+		output_json_int(output, "errno", errnum);
+		output_json_text(output, "error", strerror(errnum));
+	}
+	else
+	{
+		output_json_text(output, "status", JSON_STATUS_NOT_ELF);
+	}
+	output_str(output, "}\n");
+
+	return;
+}
+
+
+// Purpose:	Print one JSON Lines record describing an ELF file
+// Input:
+//			elven_file - A Elf_Details struct that contains data about an ELF file
+//			stream - A stream to send the record to (e.g., stdout, A file)
+// Output:	None
+void print_elf_json(struct Elf_Details* elven_file, FILE* stream)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Output* output = NULL;	// This thread's output buffer
+
+	/* INPUT VALIDATION */
+	if (!stream)
+	{
+		fprintf(stderr, "ERROR: FILE* stream was NULL!\n");
+		return;
+	}
+
+	/* PRINT IT */
+	output = get_thread_output(stream);
+	format_elf_json(output, elven_file);
+	flush_elf_output(output);
+
+	return;
+}
+
+
+// Purpose:	Append a quoted, escaped JSON string
+// Input:
+//			output - Buffer to append to
+//			str - nul-terminated string to append.  NULL is appended as null.
+// Output:	None
+// Note:	Runs of characters that need no escaping are appended with one copy
+void output_json_str(struct Elf_Output* output, const char* str)
+{
+	/* LOCAL VARIABLES */
+	const unsigned char* currChar = (const unsigned char*)str;	// Character being checked
+	const unsigned char* runStart = currChar;	// First character not appended yet
+	size_t seqLen = 0;							// Bytes in a multi-byte UTF-8 character
+	static const char hexDigits[] = "0123456789abcdef";	// For \u00XX escapes
+
+	/* INPUT VALIDATION */
+	if (!str)
+	{
+		output_str(output, "null");
+		return;
+	}
+
+	/* ESCAPE IT */
+	output_char(output, '"');
+	while (*currChar)
+	{
+		if (*currChar >= 0x20 && *currChar < 0x80 && *currChar != '"' && *currChar != '\\')
+		{
+			currChar++;
+			continue;
+		}
+		else if (*currChar >= 0x80)
+		{
+			seqLen = utf8_sequence_len(currChar);
+			if (seqLen > 0)
+			{
+				currChar += seqLen;
+				continue;
+			}
+		}
+
+		// Flush the run then escape this byte
+		output_mem(output, (const char*)runStart, currChar - runStart);
+		switch (*currChar)
+		{
+			case '"':
+				output_str(output, "\\\"");
+				break;
+			case '\\':
+				output_str(output, "\\\\");
+				break;
+			case '\n':
+				output_str(output, "\\n");
+				break;
+			case '\r':
+				output_str(output, "\\r");
+				break;
+			case '\t':
+				output_str(output, "\\t");
+				break;
+			default:
+				if (*currChar >= 0x80)
+				{
+					output_str(output, "\\ufffd");
+				}
+				else
+				{
+					output_str(output, "\\u00");
+					output_char(output, hexDigits[*currChar >> 4]);
+					output_char(output, hexDigits[*currChar & 0xF]);
+				}
+				break;
+		}
+		currChar++;
+		runStart = currChar;
+	}
+	output_mem(output, (const char*)runStart, currChar - runStart);
+	output_char(output, '"');
+
+	return;
+}
+
+
+// Purpose:	Append a key (and the comma before it)
+// Input:
+//			output - Buffer to append to
+//			key - Key to append
+//			first - If TRUE, this is the first key of an object so no comma
+// Output:	None
+static void output_json_key(struct Elf_Output* output, const char* key, int first)
+{
+	if (first != TRUE)
+	{
+		output_char(output, ',');
+	}
+	output_char(output, '"');
+	output_str(output, key);
+	output_str(output, "\":");
+
+	return;
+}
+
+
+// Purpose:	Append a "0x..." string
+// Input:
+//			output - Buffer to append to
+//			value - Value to format
+// Output:	None
+static void output_json_hex(struct Elf_Output* output, uint64_t value)
+{
+	output_str(output, "\"0x");
+	output_hex(output, value, 0);
+	output_char(output, '"');
+
+	return;
+}
+
+
+// Purpose:	Append an unsigned integer member
+// Input:
+//			output - Buffer to append to
+//			key - Member name
+//			value - Member value
+// Output:	None
+static void output_json_uint(struct Elf_Output* output, const char* key, uint64_t value)
+{
+	output_json_key(output, key, FALSE);
+	output_udec(output, value);
+
+	return;
+}
+
+
+// Purpose:	Append a signed integer member
+// Input:
+//			output - Buffer to append to
+//			key - Member name
+//			value - Member value
+// Output:	None
+static void output_json_int(struct Elf_Output* output, const char* key, int64_t value)
+{
+	output_json_key(output, key, FALSE);
+	output_dec(output, value);
+
+	return;
+}
+
+
+// Purpose:	Append a string member
+// Input:
+//			output - Buffer to append to
+//			key - Member name
+//			value - Member value (NULL for null)
+// Output:	None
+static void output_json_text(struct Elf_Output* output, const char* key, const char* value)
+{
+	output_json_key(output, key, FALSE);
+	output_json_str(output, value);
+
+	return;
+}
+
+
+// Purpose:	Append an address or offset member
+// Input:
+//			output - Buffer to append to
+//			key - Member name
+//			value - Member value
+// Output:	None
+static void output_json_addr(struct Elf_Output* output, const char* key, uint64_t value)
+{
+	output_json_key(output, key, FALSE);
+	output_json_hex(output, value);
+
+	return;
+}
+
+
+// Purpose:	Append the "segments" member
+// Input:
+//			output - Buffer to append to
+//			elven_file - File the program headers belong to
+// Output:	None
+// Note:	null if the Program Header Table wasn't read
+static void format_segments_json(struct Elf_Output* output, struct Elf_Details* elven_file)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Prgrm_Header* currPrgmHdr = NULL;	// Program Header entry being formatted
+	char permissions[3] = { 0 };					// "RWX" with '-' for each one unset
+	int i = 0;										// Iterating variable
+
+	output_json_key(output, "segments", FALSE);
+	if (!elven_file->prgmHdrs && elven_file->prgmHdrEntrNum > 0)
+	{
+		output_str(output, "null");
+		return;
+	}
+
+	output_char(output, '[');
+	for (i = 0; elven_file->prgmHdrs && i < elven_file->numPrgmHdrs; i++)
+	{
+		currPrgmHdr = elven_file->prgmHdrs + i;
+		if (i > 0)
+		{
+			output_char(output, ',');
+		}
+		output_char(output, '{');
+		output_json_key(output, "type", TRUE);
+		output_udec(output, currPrgmHdr->type);
+		output_json_key(output, "type_name", FALSE);
+		output_json_str(output, get_prgrm_header_type_name(currPrgmHdr->type));
+		permissions[0] = currPrgmHdr->flags & ELF_P_FLAG_R ? 'R' : '-';
+		permissions[1] = currPrgmHdr->flags & ELF_P_FLAG_W ? 'W' : '-';
+		permissions[2] = currPrgmHdr->flags & ELF_P_FLAG_X ? 'X' : '-';
+		output_json_key(output, "flags", FALSE);
+		output_char(output, '"');
+		output_mem(output, permissions, sizeof(permissions));
+		output_char(output, '"');
+		output_json_addr(output, "offset", currPrgmHdr->offset);
+		output_json_addr(output, "vaddr", currPrgmHdr->vaddr);
+		output_json_addr(output, "paddr", currPrgmHdr->paddr);
+		output_json_uint(output, "filesz", currPrgmHdr->filesz);
+		output_json_uint(output, "memsz", currPrgmHdr->memsz);
+		output_json_uint(output, "align", currPrgmHdr->align);
+		output_char(output, '}');
+	}
+	output_char(output, ']');
+
+	return;
+}
+
+
+// Purpose:	Append the "sections" member
+// Input:
+//			output - Buffer to append to
+//			elven_file - File the section headers belong to
+// Output:	None
+// Note:	null if the Section Header Table wasn't read
+static void format_sections_json(struct Elf_Output* output, struct Elf_Details* elven_file)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Sectn_Header* currSectnHdr = NULL;	// Section Header entry being formatted
+	int i = 0;										// Iterating variable
+
+	output_json_key(output, "sections", FALSE);
+	if (!elven_file->sectHdrs && elven_file->sectHdrEntrNum > 0)
+	{
+		output_str(output, "null");
+		return;
+	}
+
+	output_char(output, '[');
+	for (i = 0; elven_file->sectHdrs && i < elven_file->numSectHdrs; i++)
+	{
+		currSectnHdr = elven_file->sectHdrs + i;
+		if (i > 0)
+		{
+			output_char(output, ',');
+		}
+		output_char(output, '{');
+		output_json_key(output, "name", TRUE);
+		output_json_str(output, get_section_name(elven_file, i));
+		output_json_uint(output, "type", currSectnHdr->type);
+		output_json_key(output, "type_name", FALSE);
+		output_json_str(output, get_sectn_header_type_name(currSectnHdr->type));
+		output_json_uint(output, "flags", currSectnHdr->flags);
+		output_json_addr(output, "addr", currSectnHdr->addr);
+		output_json_addr(output, "offset", currSectnHdr->offset);
+		output_json_uint(output, "size", currSectnHdr->size);
+		output_json_uint(output, "link", currSectnHdr->link);
+		output_json_uint(output, "info", currSectnHdr->info);
+		output_json_uint(output, "addralign", currSectnHdr->addralign);
+		output_json_uint(output, "entsize", currSectnHdr->entsize);
+		output_char(output, '}');
+	}
+	output_char(output, ']');
+
+	return;
+}
+
+
+// Purpose:	Measure one well-formed UTF-8 character
+// Input:	str - First byte of the character (0x80 or above)
+// Output:	Number of bytes in the character, 0 if it isn't well-formed
+// Note:	Overlong forms, surrogates, and values above U+10FFFF are not well-formed
+static size_t utf8_sequence_len(const unsigned char* str)
+{
+	/* LOCAL VARIABLES */
+	size_t retVal = 0;			// Number of bytes in the character
+	unsigned char low = 0x80;	// Lowest valid second byte
+	unsigned char high = 0xBF;	// Highest valid second byte
+	size_t i = 0;				// Iterating variable
+
+	/* LEAD BYTE */
+	if (str[0] >= 0xC2 && str[0] <= 0xDF)
+	{
+		retVal = 2;
+	}
+	else if (str[0] >= 0xE0 && str[0] <= 0xEF)
+	{
+		retVal = 3;
+		low = str[0] == 0xE0 ? 0xA0 : 0x80;
+		high = str[0] == 0xED ? 0x9F : 0xBF;
+	}
+	else if (str[0] >= 0xF0 && str[0] <= 0xF4)
+	{
+		retVal = 4;
+		low = str[0] == 0xF0 ? 0x90 : 0x80;
+		high = str[0] == 0xF4 ? 0x8F : 0xBF;
+	}
+
+	/* CONTINUATION BYTES */
+	// The nul terminator fails these checks so nothing past it is read
+	if (retVal > 0 && (str[1] < low || str[1] > high))
+	{
+		retVal = 0;
+	}
+	for (i = 2; i < retVal; i++)
+	{
+		if (str[i] < 0x80 || str[i] > 0xBF)
+		{
+			retVal = 0;
+		}
+	}
+
+	return retVal;
+}
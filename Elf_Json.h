@@ -0,0 +1,61 @@
+#ifndef __ELF_JSON_H__
+#define __ELF_JSON_H__
+
+#include <stdio.h>		// FILE
+
+/*
+ *	USAGE:
+ *		Each format_*_json() call appends one compact JSON object and a newline (JSON Lines)
+ *		Nothing is built in memory first.  Fields are written straight into an Elf_Output
+ *			in the order they're visited (see: Elf_Output.h).
+ *	RECORD:
+ *		"file" and "status" ("elf", "not_elf", or "error") always come first
+ *		Errors add "errno" and "error"
+ *		ELF files add every Elf_Details field.  Addresses and offsets are "0x..." strings so
+ *			64-bit values survive parsers that store numbers as doubles.  Tables that weren't
+ *			read (e.g., header only) are null.
+ */
+
+#define JSON_STATUS_ELF		"elf"		// Parsed as an ELF file
+#define JSON_STATUS_NOT_ELF	"not_elf"	// Read but not an ELF file
+#define JSON_STATUS_ERROR	"error"		// Could not be read
+
+struct Elf_Details;
+struct Elf_Output;
+
+
+// Purpose:	Append one JSON Lines record describing an ELF file
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			elven_file - A Elf_Details struct that contains data about an ELF file
+// Output:	None
+// Note:	Files without the ELF magic number get a "not_elf" record
+void format_elf_json(struct Elf_Output* output, struct Elf_Details* elven_file);
+
+// Purpose:	Append one JSON Lines record for a file that wasn't parsed
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			fileName - File that wasn't parsed
+//			errnum - errno from the failure.  0 means it was read but isn't an ELF file.
+// Output:	None
+void format_json_unparsed(struct Elf_Output* output, const char* fileName, int errnum);
+
+// Purpose:	Print one JSON Lines record describing an ELF file
+// Input:
+//			elven_file - A Elf_Details struct that contains data about an ELF file
+//			stream - A stream to send the record to (e.g., stdout, A file)
+// Output:	None
+// Note:	The record goes out in one write unless it's larger than OUTPUT_BUFF_SIZE
+void print_elf_json(struct Elf_Details* elven_file, FILE* stream);
+
+// Purpose:	Append a quoted, escaped JSON string
+// Input:
+//			output - Buffer to append to
+//			str - nul-terminated string to append.  NULL is appended as null.
+// Output:	None
+// Note:	
+//			Quotes, backslashes, and control characters are escaped
+//			Bytes that aren't valid UTF-8 (e.g., a corrupt section name) become U+FFFD
+void output_json_str(struct Elf_Output* output, const char* str);
+
+#endif // __ELF_JSON_H__
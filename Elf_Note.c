@@ -0,0 +1,396 @@
+#include "Elf_Note.h"
+#include "Elf_Decode.h"
+#include "Elf_Details.h"
+#include "Elf_Output.h"
+#include <errno.h>
+#include <fcntl.h>		// open()
+#include <string.h>		// memcmp()/memcpy()
+#include <unistd.h>		// pread()/close()
+
+#define NOTE_HDR_SIZE		((uint64_t)12)	// namesz, descsz, and type
+#define NOTE_OWNER_GNU		"GNU"			// Owner of NT_GNU_BUILD_ID (nul included in namesz)
+#define NOTE_SLOT_TABLE		0				// Scratch buffer for a header table
+#define NOTE_SLOT_NOTES		1				// Scratch buffer for a note area
+#define NOTE_NUM_SLOTS		2				// Number of scratch buffers
+
+/* LOCAL STRUCTS */
+// Serves reads out of the first page when it can, and pread()s the rest
+struct Elf_Note_Reader
+{
+	int elfFd;								// File being read
+	unsigned char page[NOTE_PAGE_SIZE];		// The first page of the file
+	size_t pageSize;						// Bytes read into page (less than NOTE_PAGE_SIZE means that's the whole file)
+	unsigned char* scratch[NOTE_NUM_SLOTS];	// Reads that don't fit in page
+	size_t scratchSize[NOTE_NUM_SLOTS];		// Bytes allocated in each scratch buffer
+};
+
+/* LOCAL FUNCTIONS */
+static int read_range(struct Elf_Note_Reader* reader, int slot, uint64_t offset, uint64_t size, const unsigned char** data);
+static int search_note_area(struct Elf_Note_Reader* reader, const struct Elf_Decoders* decoders, uint64_t offset, \
+	                        uint64_t size, uint64_t align, int source, struct Elf_Build_Id* buildId);
+static void release_note_reader(struct Elf_Note_Reader* reader);
+
+
+// Purpose:	Find the GNU build ID of a file
+// Input:
+//			fileName - File to read
+//			buildId [out] - The build ID
+// Output:	See: Elf_Note.h
+int read_elf_build_id(const char* fileName, struct Elf_Build_Id* buildId)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	int elfFd = -1;			// File descriptor of fileName
+	int errNum = 0;			// errno from find_elf_build_id()
+
+	/* INPUT VALIDATION */
+	if (!fileName || !buildId)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	/* READ IT */
+	elfFd = open(fileName, O_RDONLY);
+	if (elfFd < 0)
+	{
+		memset(buildId, 0, sizeof(struct Elf_Build_Id));
+		return ERROR_BAD_ARG;
+	}
+	retVal = find_elf_build_id(elfFd, buildId);
+	errNum = errno;
+	close(elfFd);
+	errno = errNum;
+
+	return retVal;
+}
+
+
+// Purpose:	Find the GNU build ID of an open file
+// Input:
+//			elfFd - File descriptor open for reading (its offset isn't used or changed)
+//			buildId [out] - The build ID
+// Output:	See: Elf_Note.h
+int find_elf_build_id(int elfFd, struct Elf_Build_Id* buildId)
+{
+	/* LOCAL VARIABLES */
+	int retVal = NOTE_NOT_FOUND;
+	int tmpRetVal = ERROR_SUCCESS;				// First error from a table or note area
+	struct Elf_Note_Reader reader;				// Reads the file
+	const struct Elf_Decoders* decoders = NULL;	// Byte order and class of the file
+	struct Elf_Hdr_Record hdrRecord;			// Decoded ELF header
+	struct Elf_Prgrm_Header prgmHdr;			// Decoded Program Header entry
+	struct Elf_Sectn_Header sectHdr;			// Decoded Section Header entry
+	const unsigned char* table = NULL;			// Raw header table
+	ssize_t numRead = 0;						// Number of bytes pread() returned
+	size_t sectSize = 0;						// Smallest valid Section Header entry
+	uint64_t numSegments = 0;					// Entries in the Program Header Table
+	uint64_t numSections = 0;					// Entries in the Section Header Table
+	uint64_t i = 0;								// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!buildId)
+	{
+		return ERROR_NULL_PTR;
+	}
+	memset(buildId, 0, sizeof(struct Elf_Build_Id));
+	memset(&reader, 0, sizeof(reader));
+	reader.elfFd = elfFd;
+
+	/* READ THE FIRST PAGE */
+	numRead = pread(elfFd, reader.page, sizeof(reader.page), 0);
+	if (numRead < 0)
+	{
+		return ERROR_BAD_ARG;
+	}
+	reader.pageSize = (size_t)numRead;
+	if (reader.pageSize < ELF_H_SIZE_32 || memcmp(reader.page, ELF_H_MAGIC_NUM, strlen(ELF_H_MAGIC_NUM)))
+	{
+		return ERROR_ORC_FILE;
+	}
+	decoders = get_elf_decoders(reader.page[4], reader.page[5]);
+	if (!decoders || (decoders->elfClass == ELF_H_CLASS_64 && reader.pageSize < ELF_H_SIZE_64))
+	{
+		return ERROR_ORC_FILE;
+	}
+	decoders->elf_header(&hdrRecord, reader.page);
+	sectSize = decoders->elfClass == ELF_H_CLASS_32 ? ELF_S_SIZE_32 : ELF_S_SIZE_64;
+
+	/* COUNT ENTRIES */
+	// Files with too many entries for the ELF header keep the real counts in section 0 (see: parse_sectn_headers())
+	numSegments = hdrRecord.phnum == ELF_P_NUM_XNUM ? 0 : hdrRecord.phnum;
+	numSections = hdrRecord.shnum;
+	if ((hdrRecord.phnum == ELF_P_NUM_XNUM || hdrRecord.shnum < 1) && hdrRecord.shoff > 0 \
+		&& hdrRecord.shentsize >= sectSize)
+	{
+		tmpRetVal = read_range(&reader, NOTE_SLOT_TABLE, hdrRecord.shoff, hdrRecord.shentsize, &table);
+		if (tmpRetVal == ERROR_SUCCESS)
+		{
+			decoders->sectn_header(&sectHdr, table);
+			numSegments = hdrRecord.phnum == ELF_P_NUM_XNUM ? sectHdr.info : numSegments;
+			numSections = hdrRecord.shnum < 1 ? sectHdr.size : numSections;
+		}
+	}
+
+	/* PT_NOTE SEGMENTS */
+	if (numSegments > 0 \
+		&& hdrRecord.phentsize >= (decoders->elfClass == ELF_H_CLASS_32 ? ELF_P_SIZE_32 : ELF_P_SIZE_64))
+	{
+		tmpRetVal = read_range(&reader, NOTE_SLOT_TABLE, hdrRecord.phoff, numSegments * hdrRecord.phentsize, &table);
+		for (i = 0; tmpRetVal == ERROR_SUCCESS && retVal != ERROR_SUCCESS && i < numSegments; i++)
+		{
+			decoders->prgrm_header(&prgmHdr, table + ((size_t)i * hdrRecord.phentsize));
+			if (prgmHdr.type == ELF_P_TYPE_NOTE)
+			{
+				retVal = search_note_area(&reader, decoders, prgmHdr.offset, prgmHdr.filesz, prgmHdr.align, \
+					NOTE_SOURCE_SEGMENT, buildId);
+				if (retVal < ERROR_SUCCESS)
+				{
+					tmpRetVal = retVal;
+				}
+			}
+		}
+	}
+
+	/* SHT_NOTE SECTIONS */
+	// Only if the segments came up empty (e.g., a relocatable object has no segments)
+	if (retVal != ERROR_SUCCESS && numSections > 0 && hdrRecord.shentsize >= sectSize)
+	{
+		retVal = NOTE_NOT_FOUND;
+		// Section 0's size is 64 bits wide so don't let the table size wrap
+		if (numSections > NOTE_MAX_READ)
+		{
+			tmpRetVal = ERROR_BAD_OFFSET;
+		}
+		else
+		{
+			tmpRetVal = read_range(&reader, NOTE_SLOT_TABLE, hdrRecord.shoff, numSections * hdrRecord.shentsize, &table);
+		}
+		for (i = 0; tmpRetVal == ERROR_SUCCESS && retVal != ERROR_SUCCESS && i < numSections; i++)
+		{
+			decoders->sectn_header(&sectHdr, table + ((size_t)i * hdrRecord.shentsize));
+			if (sectHdr.type == ELF_S_TYPE_NOTE)
+			{
+				retVal = search_note_area(&reader, decoders, sectHdr.offset, sectHdr.size, sectHdr.addralign, \
+					NOTE_SOURCE_SECTION, buildId);
+				if (retVal < ERROR_SUCCESS)
+				{
+					tmpRetVal = retVal;
+				}
+			}
+		}
+	}
+
+	/* CLEAN UP */
+	release_note_reader(&reader);
+	// A bad table or note area only matters if nothing else had the build ID
+	if (retVal != ERROR_SUCCESS && tmpRetVal != ERROR_SUCCESS)
+	{
+		retVal = tmpRetVal;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Search a note area for the GNU build ID
+// Input:
+//			notes - Contents of a PT_NOTE segment or SHT_NOTE section
+//			size - Bytes in notes
+//			align - p_align or sh_addralign (8 means 8 byte padding, anything else 4)
+//			decoders - Byte order of the file (see: get_elf_decoders())
+//			buildId [out] - id and size are set if found
+// Output:	See: Elf_Note.h
+// Note:	Each note is a header of three words, the owner name, then the descriptor, with
+//				the name and descriptor each padded to a multiple of align
+int find_build_id_note(const unsigned char* notes, size_t size, uint64_t align, \
+	                   const struct Elf_Decoders* decoders, struct Elf_Build_Id* buildId)
+{
+	/* LOCAL VARIABLES */
+	uint64_t position = 0;		// Offset of the note being read
+	uint64_t nameSize = 0;		// namesz
+	uint64_t descSize = 0;		// descsz
+	uint64_t descOffset = 0;	// Offset of the descriptor
+	uint32_t noteType = 0;		// type
+
+	/* INPUT VALIDATION */
+	if ((!notes && size > 0) || !decoders || !buildId)
+	{
+		return ERROR_NULL_PTR;
+	}
+	align = align == 8 ? 8 : 4;
+
+	/* WALK THE NOTES */
+	while (size >= NOTE_HDR_SIZE && position <= size - NOTE_HDR_SIZE)
+	{
+		nameSize = decoders->word(notes + position);
+		descSize = decoders->word(notes + position + 4);
+		noteType = decoders->word(notes + position + 8);
+		position += NOTE_HDR_SIZE;
+		// Offsets are padded relative to the start of the (aligned) note area.  Nothing can
+		// wrap since the sizes came from 32-bit fields.
+		descOffset = (position + nameSize + align - 1) & ~(align - 1);
+		if (nameSize > size - position || descOffset > size || descSize > size - descOffset)
+		{
+			// Truncated
+			break;
+		}
+		if (noteType == NOTE_TYPE_GNU_BUILD_ID && nameSize == sizeof(NOTE_OWNER_GNU) \
+			&& !memcmp(notes + position, NOTE_OWNER_GNU, sizeof(NOTE_OWNER_GNU)))
+		{
+			if (descSize > NOTE_MAX_BUILD_ID)
+			{
+				return ERROR_OVERFLOW;
+			}
+			memcpy(buildId->id, notes + descOffset, (size_t)descSize);
+			buildId->size = (size_t)descSize;
+			buildId->offset = descOffset;
+			return ERROR_SUCCESS;
+		}
+		position = (descOffset + descSize + align - 1) & ~(align - 1);
+	}
+
+	return NOTE_NOT_FOUND;
+}
+
+
+// Purpose:	Append "fileName<TAB>build ID" as lowercase hex ("-" if not found)
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			fileName - Printed first
+//			buildId - From read_elf_build_id()
+// Output:	None
+void format_elf_build_id(struct Elf_Output* output, const char* fileName, const struct Elf_Build_Id* buildId)
+{
+	size_t i = 0;	// Iterating variable
+
+	if (!output || !fileName || !buildId)
+	{
+		return;
+	}
+
+	output_str(output, fileName);
+	output_char(output, '\t');
+	for (i = 0; i < buildId->size && i < NOTE_MAX_BUILD_ID; i++)
+	{
+		output_hex(output, buildId->id[i], 2);
+	}
+	if (buildId->size == 0)
+	{
+		output_char(output, '-');
+	}
+	output_char(output, '\n');
+
+	return;
+}
+
+
+// Purpose:	Get a range of the file
+// Input:
+//			reader - Reader of the file
+//			slot - NOTE_SLOT_* scratch buffer to use if the range isn't in the first page
+//			offset - Offset of the range
+//			size - Bytes in the range
+//			data [out] - The range (valid until slot is read into again)
+// Output:
+//			ERROR_SUCCESS on success
+//			ERROR_BAD_OFFSET if the range runs past the end of the file or is larger than NOTE_MAX_READ
+//			ERROR_BAD_ARG if pread() fails (check errno)
+//			ERROR_NULL_PTR if a scratch buffer can't be allocated
+static int read_range(struct Elf_Note_Reader* reader, int slot, uint64_t offset, uint64_t size, const unsigned char** data)
+{
+	/* LOCAL VARIABLES */
+	ssize_t numRead = 0;		// Number of bytes pread() returned
+
+	/* FIRST PAGE */
+	if (offset <= reader->pageSize && size <= reader->pageSize - offset)
+	{
+		*data = reader->page + offset;
+		return ERROR_SUCCESS;
+	}
+	else if (reader->pageSize < sizeof(reader->page) || size > NOTE_MAX_READ || offset > (uint64_t)INT64_MAX - size)
+	{
+		// The first page was the whole file, or the range is absurd
+		return ERROR_BAD_OFFSET;
+	}
+
+	/* SCRATCH */
+	if (reader->scratchSize[slot] < size)
+	{
+		if (reader->scratch[slot])
+		{
+			take_sensitive_mem_back((void**)&(reader->scratch[slot]), reader->scratchSize[slot], sizeof(unsigned char));
+			reader->scratchSize[slot] = 0;
+		}
+		reader->scratch[slot] = (unsigned char*)gimme_mem((size_t)size, sizeof(unsigned char));
+		if (!reader->scratch[slot])
+		{
+			return ERROR_NULL_PTR;
+		}
+		reader->scratchSize[slot] = (size_t)size;
+	}
+	numRead = pread(reader->elfFd, reader->scratch[slot], (size_t)size, (off_t)offset);
+	if (numRead < 0)
+	{
+		return ERROR_BAD_ARG;
+	}
+	else if ((uint64_t)numRead != size)
+	{
+		return ERROR_BAD_OFFSET;
+	}
+	*data = reader->scratch[slot];
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Read one note area and search it for the GNU build ID
+// Input:
+//			reader - Reader of the file
+//			decoders - Byte order of the file
+//			offset - Offset of the note area
+//			size - Bytes in the note area
+//			align - p_align or sh_addralign
+//			source - NOTE_SOURCE_*
+//			buildId [out] - Set if found
+// Output:	See: find_build_id_note() and read_range()
+static int search_note_area(struct Elf_Note_Reader* reader, const struct Elf_Decoders* decoders, uint64_t offset, \
+	                        uint64_t size, uint64_t align, int source, struct Elf_Build_Id* buildId)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	const unsigned char* notes = NULL;	// Contents of the note area
+
+	/* SEARCH IT */
+	retVal = read_range(reader, NOTE_SLOT_NOTES, offset, size, &notes);
+	if (retVal == ERROR_SUCCESS)
+	{
+		retVal = find_build_id_note(notes, (size_t)size, align, decoders, buildId);
+	}
+	if (retVal == ERROR_SUCCESS)
+	{
+		// Relative to the note area until now
+		buildId->offset += offset;
+		buildId->source = source;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Free a reader's scratch buffers
+// Input:	reader - Reader to clean up
+// Output:	None
+static void release_note_reader(struct Elf_Note_Reader* reader)
+{
+	int i = 0;	// Iterating variable
+
+	for (i = 0; i < NOTE_NUM_SLOTS; i++)
+	{
+		if (reader->scratch[i])
+		{
+			take_sensitive_mem_back((void**)&(reader->scratch[i]), reader->scratchSize[i], sizeof(unsigned char));
+		}
+	}
+
+	return;
+}
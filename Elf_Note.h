@@ -0,0 +1,86 @@
+#ifndef __ELF_NOTE_H__
+#define __ELF_NOTE_H__
+
+#include <stddef.h>		// size_t
+#include <stdint.h>		// Fixed-width integers
+
+/*
+ *	USAGE:
+ *		read_elf_build_id() finds the GNU build ID (NT_GNU_BUILD_ID) of a file without
+ *			reading the whole file or parsing anything else
+ *		find_build_id_note() searches a note area that's already in memory
+ *	READS:
+ *		One positioned read of NOTE_PAGE_SIZE bytes at offset 0 usually covers the ELF
+ *			header, the Program Header Table, and the PT_NOTE segments.  Anything outside
+ *			that page is read with one more pread() per table or note area.
+ *		PT_NOTE segments are searched first.  If none of them holds a build ID (e.g.,
+ *			relocatable objects have no Program Header Table), SHT_NOTE sections are.
+ */
+
+#define NOTE_MAX_BUILD_ID	((size_t)64)		// Longest build ID kept (SHA-1 is 20 bytes)
+#define NOTE_PAGE_SIZE		((size_t)4096)		// Bytes read at offset 0 along with the ELF header
+#define NOTE_MAX_READ		((size_t)1048576)	// Largest header table or note area read
+#define NOTE_NOT_FOUND		((int)1)			// The file is an ELF file without a build ID
+#define NOTE_TYPE_GNU_BUILD_ID	((uint32_t)3)	// NT_GNU_BUILD_ID, owned by "GNU"
+
+/* Elf_Build_Id.source */
+#define NOTE_SOURCE_NONE	((int)0)	// Not found
+#define NOTE_SOURCE_SEGMENT	((int)1)	// A PT_NOTE segment
+#define NOTE_SOURCE_SECTION	((int)2)	// An SHT_NOTE section
+
+struct Elf_Decoders;
+struct Elf_Output;
+
+struct Elf_Build_Id
+{
+	unsigned char id[NOTE_MAX_BUILD_ID];	// The note's descriptor
+	size_t size;							// Bytes used in id (0 if not found)
+	int source;								// NOTE_SOURCE_*
+	uint64_t offset;						// Offset of the descriptor in the file
+};
+
+
+// Purpose:	Find the GNU build ID of a file
+// Input:
+//			fileName - File to read
+//			buildId [out] - The build ID
+// Output:
+//			ERROR_SUCCESS if found
+//			NOTE_NOT_FOUND if the file is an ELF file without one
+//			ERROR_ORC_FILE if the file isn't an ELF file
+//			ERROR_BAD_ARG if the file couldn't be opened or read (check errno)
+//			ERROR_* as specified in Elf_Details.h otherwise
+// Note:	Thread-safe.  Nothing is allocated unless a table lies outside the first page.
+int read_elf_build_id(const char* fileName, struct Elf_Build_Id* buildId);
+
+// Purpose:	Find the GNU build ID of an open file
+// Input:
+//			elfFd - File descriptor open for reading (its offset isn't used or changed)
+//			buildId [out] - The build ID
+// Output:	See: read_elf_build_id()
+int find_elf_build_id(int elfFd, struct Elf_Build_Id* buildId);
+
+// Purpose:	Search a note area for the GNU build ID
+// Input:
+//			notes - Contents of a PT_NOTE segment or SHT_NOTE section
+//			size - Bytes in notes
+//			align - p_align or sh_addralign (8 means 8 byte padding, anything else 4)
+//			decoders - Byte order of the file (see: get_elf_decoders())
+//			buildId [out] - id and size are set if found
+// Output:
+//			ERROR_SUCCESS if found
+//			NOTE_NOT_FOUND if not (a truncated note ends the search)
+//			ERROR_OVERFLOW if the build ID is longer than NOTE_MAX_BUILD_ID
+//			ERROR_NULL_PTR on bad input
+int find_build_id_note(const unsigned char* notes, size_t size, uint64_t align, \
+	                   const struct Elf_Decoders* decoders, struct Elf_Build_Id* buildId);
+
+// Purpose:	Append "fileName<TAB>build ID" as lowercase hex ("-" if not found)
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			fileName - Printed first
+//			buildId - From read_elf_build_id()
+// Output:	None
+void format_elf_build_id(struct Elf_Output* output, const char* fileName, const struct Elf_Build_Id* buildId);
+
+#endif // __ELF_NOTE_H__
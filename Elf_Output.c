@@ -0,0 +1,320 @@
+#include "Elf_Output.h"
+#include "Elf_Details.h"
+#include <string.h>
+
+/* LOCAL VARIABLES */
+static __thread char threadBuff[OUTPUT_BUFF_SIZE];	// See: get_thread_output()
+static __thread struct Elf_Output threadOutput;		// See: get_thread_output()
+static const char hexDigits[] = "0123456789abcdef";	// Lowercase, like PRIx64
+// The four characters each nibble is printed as (see: output_binary())
+static const char nibbleBits[16][4] = { \
+	{ '0', '0', '0', '0' }, { '0', '0', '0', '1' }, { '0', '0', '1', '0' }, { '0', '0', '1', '1' }, \
+	{ '0', '1', '0', '0' }, { '0', '1', '0', '1' }, { '0', '1', '1', '0' }, { '0', '1', '1', '1' }, \
+	{ '1', '0', '0', '0' }, { '1', '0', '0', '1' }, { '1', '0', '1', '0' }, { '1', '0', '1', '1' }, \
+	{ '1', '1', '0', '0' }, { '1', '1', '0', '1' }, { '1', '1', '1', '0' }, { '1', '1', '1', '1' }, };
+
+
+// Purpose:	Set up an Elf_Output with a caller-owned buffer
+// Input:
+//			output - Struct to set up
+//			stream - Where the buffer is written
+//			buff - Caller-owned buffer
+//			size - Number of bytes in buff
+// Output:	ERROR_* as specified in Elf_Details.h
+int init_elf_output(struct Elf_Output* output, FILE* stream, char* buff, size_t size)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (!output || !stream || !buff)
+	{
+		retVal = ERROR_NULL_PTR;
+	}
+	else if (size < 1)
+	{
+		retVal = ERROR_BAD_ARG;
+	}
+	else
+	{
+		output->stream = stream;
+		output->buff = buff;
+		output->size = size;
+		output->used = 0;
+		output->numWritten = 0;
+		output->errnum = 0;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Get this thread's output buffer, pointed at stream
+// Input:	stream - Where the buffer is written
+// Output:	This thread's Elf_Output, NULL if stream is NULL
+// Note:	Anything still buffered for a different stream is written out first
+struct Elf_Output* get_thread_output(FILE* stream)
+{
+	struct Elf_Output* retVal = &threadOutput;
+
+	if (!stream)
+	{
+		retVal = NULL;
+	}
+	else if (!retVal->buff)
+	{
+		init_elf_output(retVal, stream, threadBuff, sizeof(threadBuff));
+	}
+	else if (retVal->stream != stream)
+	{
+		flush_elf_output(retVal);
+		retVal->stream = stream;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Write the buffered bytes to the stream
+// Input:	output - Buffer to write
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	The buffer is emptied even if the write fails so formatting can carry on
+int flush_elf_output(struct Elf_Output* output)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (!output || !output->stream)
+	{
+		retVal = ERROR_NULL_PTR;
+	}
+	else if (output->used > 0)
+	{
+		if (fwrite(output->buff, 1, output->used, output->stream) != output->used)
+		{
+			if (!output->errnum)
+			{
+				output->errnum = errno;
+			}
+			retVal = ERROR_BAD_ARG;
+		}
+		output->numWritten += output->used;
+		output->used = 0;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Append bytes
+// Input:
+//			output - Buffer to append to
+//			mem - Bytes to append (nul characters included)
+//			numBytes - Number of bytes in mem
+// Output:	None
+void output_mem(struct Elf_Output* output, const char* mem, size_t numBytes)
+{
+	/* LOCAL VARIABLES */
+	size_t numCopy = 0;		// Bytes copied this pass
+
+	/* INPUT VALIDATION */
+	if (!mem)
+	{
+		return;
+	}
+
+	/* APPEND */
+	while (numBytes > 0)
+	{
+		if (output->used == output->size)
+		{
+			flush_elf_output(output);
+		}
+		numCopy = output->size - output->used;
+		if (numCopy > numBytes)
+		{
+			numCopy = numBytes;
+		}
+		memcpy(output->buff + output->used, mem, numCopy);
+		output->used += numCopy;
+		mem += numCopy;
+		numBytes -= numCopy;
+	}
+
+	return;
+}
+
+
+// Purpose:	Append a nul-terminated string
+// Input:
+//			output - Buffer to append to
+//			str - String to append
+// Output:	None
+void output_str(struct Elf_Output* output, const char* str)
+{
+	if (str)
+	{
+		output_mem(output, str, strlen(str));
+	}
+
+	return;
+}
+
+
+// Purpose:	Append the same character numTimes
+// Input:
+//			output - Buffer to append to
+//			oneChar - Character to append
+//			numTimes - Number of times to append it
+// Output:	None
+void output_repeat(struct Elf_Output* output, char oneChar, size_t numTimes)
+{
+	/* LOCAL VARIABLES */
+	size_t numCopy = 0;		// Bytes set this pass
+
+	/* APPEND */
+	while (numTimes > 0)
+	{
+		if (output->used == output->size)
+		{
+			flush_elf_output(output);
+		}
+		numCopy = output->size - output->used;
+		if (numCopy > numTimes)
+		{
+			numCopy = numTimes;
+		}
+		memset(output->buff + output->used, oneChar, numCopy);
+		output->used += numCopy;
+		numTimes -= numCopy;
+	}
+
+	return;
+}
+
+
+// Purpose:	Append a signed decimal integer (e.g., "%d")
+// Input:
+//			output - Buffer to append to
+//			value - Value to format
+// Output:	None
+void output_dec(struct Elf_Output* output, int64_t value)
+{
+	if (value < 0)
+	{
+		output_char(output, '-');
+		// Negate as unsigned so INT64_MIN doesn't overflow
+		output_udec(output, 0 - (uint64_t)value);
+	}
+	else
+	{
+		output_udec(output, (uint64_t)value);
+	}
+
+	return;
+}
+
+
+// Purpose:	Append an unsigned decimal integer (e.g., "%" PRIu64)
+// Input:
+//			output - Buffer to append to
+//			value - Value to format
+// Output:	None
+// Note:	Digits are built backwards in a scratch buffer and appended in one copy
+void output_udec(struct Elf_Output* output, uint64_t value)
+{
+	/* LOCAL VARIABLES */
+	char digits[20];					// UINT64_MAX is 20 digits
+	size_t index = sizeof(digits);		// First digit in digits
+
+	/* FORMAT */
+	do
+	{
+		digits[--index] = (char)('0' + (value % 10));
+		value /= 10;
+	} while (value > 0);
+
+	/* APPEND */
+	output_mem(output, digits + index, sizeof(digits) - index);
+
+	return;
+}
+
+
+// Purpose:	Append a lowercase hexadecimal integer without a prefix (e.g., "%016" PRIx64)
+// Input:
+//			output - Buffer to append to
+//			value - Value to format
+//			minDigits - Zero pad to at least this many digits (0 or 1 for no padding)
+// Output:	None
+void output_hex(struct Elf_Output* output, uint64_t value, int minDigits)
+{
+	/* LOCAL VARIABLES */
+	char digits[16];					// UINT64_MAX is 16 hex digits
+	size_t index = sizeof(digits);		// First digit in digits
+
+	/* INPUT VALIDATION */
+	if (minDigits > (int)sizeof(digits))
+	{
+		// Wider than any uint64_t so the extra digits are all zero
+		output_repeat(output, '0', minDigits - sizeof(digits));
+		minDigits = sizeof(digits);
+	}
+
+	/* FORMAT */
+	do
+	{
+		digits[--index] = hexDigits[value & 0xF];
+		value >>= 4;
+	} while (value > 0);
+	while ((int)(sizeof(digits) - index) < minDigits)
+	{
+		digits[--index] = '0';
+	}
+
+	/* APPEND */
+	output_mem(output, digits + index, sizeof(digits) - index);
+
+	return;
+}
+
+
+// Purpose:	Append bytes in binary, four bits at a time (see: print_binary())
+// Input:
+//			output - Buffer to append to
+//			valueToPrint - Bytes to format
+//			numBytesToPrint - Number of bytes in valueToPrint
+//			bigEndian - If TRUE, format valueToPrint[0] first.  Otherwise, format it last.
+// Output:	None
+// Note:	Each byte is 10 characters (e.g., "0101 1010 ")
+void output_binary(struct Elf_Output* output, const void* valueToPrint, size_t numBytesToPrint, int bigEndian)
+{
+	/* LOCAL VARIABLES */
+	const unsigned char* bytes = (const unsigned char*)valueToPrint;	// Bytes to format
+	char oneByte[10] = { 0 };	// One byte's worth of output
+	size_t i = 0;				// Iterating variable
+	unsigned char printThis = 0;	// Byte being formatted
+
+	/* INPUT VALIDATION */
+	if (!valueToPrint)
+	{
+		return;
+	}
+
+	/* FORMAT */
+	oneByte[4] = ' ';
+	oneByte[9] = ' ';
+	for (i = 0; i < numBytesToPrint; i++)
+	{
+		if (bigEndian == TRUE)
+		{
+			printThis = bytes[i];
+		}
+		else
+		{
+			printThis = bytes[numBytesToPrint - 1 - i];
+		}
+		memcpy(oneByte, nibbleBits[printThis >> 4], 4);
+		memcpy(oneByte + 5, nibbleBits[printThis & 0xF], 4);
+		output_mem(output, oneByte, sizeof(oneByte));
+	}
+
+	return;
+}
@@ -0,0 +1,122 @@
+#ifndef __ELF_OUTPUT_H__
+#define __ELF_OUTPUT_H__
+
+#include <stddef.h>		// size_t
+#include <stdint.h>		// Fixed-width integers
+#include <stdio.h>		// FILE
+
+/*
+ *	USAGE:
+ *		Start - get_thread_output() for this thread's buffer (or init_elf_output() for your own)
+ *		Step - output_*() to format into the buffer.  It is written out whenever it fills.
+ *		Stop - flush_elf_output() once the caller wants the bytes on the stream
+ *	Integers are formatted by hand and nothing is allocated, so the only stdio call (and the
+ *		only stream lock) is one fwrite() per OUTPUT_BUFF_SIZE bytes
+ */
+
+#define OUTPUT_BUFF_SIZE	((size_t)65536)	// Bytes in each thread's buffer
+
+struct Elf_Output
+{
+	FILE* stream;	// Where the buffer is written
+	char* buff;		// Formatted bytes that haven't been written yet
+	size_t size;	// Number of bytes buff can hold
+	size_t used;	// Number of bytes in buff
+	uint64_t numWritten;	// Number of bytes handed to the stream so far
+	int errnum;		// errno from the first failed write, 0 otherwise
+};
+
+
+// Purpose:	Set up an Elf_Output with a caller-owned buffer
+// Input:
+//			output - Struct to set up
+//			stream - Where the buffer is written
+//			buff - Caller-owned buffer
+//			size - Number of bytes in buff
+// Output:	ERROR_* as specified in Elf_Details.h
+int init_elf_output(struct Elf_Output* output, FILE* stream, char* buff, size_t size);
+
+// Purpose:	Get this thread's output buffer, pointed at stream
+// Input:	stream - Where the buffer is written
+// Output:	This thread's Elf_Output, NULL if stream is NULL
+// Note:
+//			Anything still buffered for a different stream is written out first
+//			The buffer lives in thread-local storage so it's never allocated or freed
+struct Elf_Output* get_thread_output(FILE* stream);
+
+// Purpose:	Write the buffered bytes to the stream
+// Input:	output - Buffer to write
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	Does not fflush() the stream itself
+int flush_elf_output(struct Elf_Output* output);
+
+// Purpose:	Append bytes
+// Input:
+//			output - Buffer to append to
+//			mem - Bytes to append (nul characters included)
+//			numBytes - Number of bytes in mem
+// Output:	None
+void output_mem(struct Elf_Output* output, const char* mem, size_t numBytes);
+
+// Purpose:	Append a nul-terminated string
+// Input:
+//			output - Buffer to append to
+//			str - String to append
+// Output:	None
+void output_str(struct Elf_Output* output, const char* str);
+
+// Purpose:	Append the same character numTimes
+// Input:
+//			output - Buffer to append to
+//			oneChar - Character to append
+//			numTimes - Number of times to append it
+// Output:	None
+void output_repeat(struct Elf_Output* output, char oneChar, size_t numTimes);
+
+// Purpose:	Append a signed decimal integer (e.g., "%d")
+// Input:
+//			output - Buffer to append to
+//			value - Value to format
+// Output:	None
+void output_dec(struct Elf_Output* output, int64_t value);
+
+// Purpose:	Append an unsigned decimal integer (e.g., "%" PRIu64)
+// Input:
+//			output - Buffer to append to
+//			value - Value to format
+// Output:	None
+void output_udec(struct Elf_Output* output, uint64_t value);
+
+// Purpose:	Append a lowercase hexadecimal integer without a prefix (e.g., "%016" PRIx64)
+// Input:
+//			output - Buffer to append to
+//			value - Value to format
+//			minDigits - Zero pad to at least this many digits (0 or 1 for no padding)
+// Output:	None
+void output_hex(struct Elf_Output* output, uint64_t value, int minDigits);
+
+// Purpose:	Append bytes in binary, four bits at a time (see: print_binary())
+// Input:
+//			output - Buffer to append to
+//			valueToPrint - Bytes to format
+//			numBytesToPrint - Number of bytes in valueToPrint
+//			bigEndian - If TRUE, format valueToPrint[0] first.  Otherwise, format it last.
+// Output:	None
+// Note:	Each byte is 10 characters (e.g., "0101 1010 ")
+void output_binary(struct Elf_Output* output, const void* valueToPrint, size_t numBytesToPrint, int bigEndian);
+
+// Purpose:	Append a single character
+// Input:
+//			output - Buffer to append to
+//			oneChar - Character to append
+// Output:	None
+static inline void output_char(struct Elf_Output* output, char oneChar)
+{
+	if (output->used == output->size)
+	{
+		flush_elf_output(output);
+	}
+	output->buff[output->used++] = oneChar;
+}
+
+#endif // __ELF_OUTPUT_H__
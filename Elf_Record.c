@@ -0,0 +1,874 @@
+#include "Elf_Record.h"
+#include "Elf_Details.h"
+#include "Elf_Output.h"
+#include <fcntl.h>		// open()
+#include <string.h>
+#include <sys/mman.h>	// mmap()/munmap()
+#include <sys/stat.h>	// fstat()
+#include <unistd.h>		// close()
+
+/* Entry offsets (version 1) */
+// Program header entry
+#define SEG_OFF_TYPE		0	// uint32_t
+#define SEG_OFF_FLAGS		4	// uint32_t
+#define SEG_OFF_OFFSET		8	// uint64_t, then vaddr, paddr, filesz, memsz, align
+// Section header entry
+#define SECT_OFF_POOL_NAME	0	// uint32_t, offset into the pool (RECORD_NO_STRING if unresolved)
+#define SECT_OFF_NAME		4	// uint32_t, sh_name as it was in the file
+#define SECT_OFF_TYPE		8	// uint32_t
+#define SECT_OFF_LINK		12	// uint32_t
+#define SECT_OFF_INFO		16	// uint32_t
+#define SECT_OFF_FLAGS		24	// uint64_t, then addr, offset, size, addralign, entsize
+
+/* LOCAL FUNCTIONS */
+static void put_le16(unsigned char* buff, uint16_t value);
+static void put_le32(unsigned char* buff, uint32_t value);
+static void put_le64(unsigned char* buff, uint64_t value);
+static uint16_t get_le16(const unsigned char* buff);
+static uint32_t get_le32(const unsigned char* buff);
+static uint64_t get_le64(const unsigned char* buff);
+static void start_record(unsigned char* fixedPart, int status, int errnum);
+static void add_pool_string(unsigned char* fixedPart, int stringIndex, const char* str, uint64_t* poolSize);
+static int finish_record(struct Elf_Output* output, unsigned char* fixedPart, uint64_t tableSize, \
+	                     uint64_t poolSize, size_t* padSize);
+static void output_pool_string(struct Elf_Output* output, const char* str);
+static int get_pool_string(const struct Elf_Record* record, uint32_t poolOffset, const char** str);
+static int check_table(uint32_t numEntries, uint32_t tableOffset, size_t entSize, size_t minEntSize, \
+	                   size_t fixedSize, size_t recordSize);
+
+
+// Purpose:	Append one record describing an ELF file
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			elven_file - A Elf_Details struct that contains data about an ELF file
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	The pool is sized first so the record goes out in one pass with nothing allocated
+int format_elf_record(struct Elf_Output* output, struct Elf_Details* elven_file)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	unsigned char fixedPart[RECORD_FIXED_SIZE];		// Encoded fixed part
+	unsigned char entry[RECORD_SECT_SIZE] = { 0 };	// One encoded table entry
+	uint64_t poolSize = 0;			// Bytes in the string pool
+	uint64_t tableSize = 0;			// Bytes in both tables
+	uint64_t nameCursor = 0;		// Where the next section name lands in the pool
+	uint32_t numSegs = RECORD_NOT_READ;		// Program header entries written
+	uint32_t numSects = RECORD_NOT_READ;	// Section header entries written
+	size_t padSize = 0;				// Zeroes after the pool
+	struct Elf_Prgrm_Header* currPrgmHdr = NULL;	// Program Header entry being encoded
+	struct Elf_Sectn_Header* currSectnHdr = NULL;	// Section Header entry being encoded
+	const char* sectName = NULL;	// Name of the section being encoded
+	int i = 0;						// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!output || !elven_file)
+	{
+		return ERROR_NULL_PTR;
+	}
+	else if (!elven_file->magicNum || strncmp(elven_file->magicNum, ELF_H_MAGIC_NUM, 4))
+	{
+		return format_record_unparsed(output, elven_file->fileName, 0);
+	}
+
+	/* FIXED PART */
+	start_record(fixedPart, RECORD_STATUS_ELF, 0);
+	if (elven_file->processorType == ELF_H_CLASS_32)
+	{
+		fixedPart[RECORD_OFF_BITS] = 32;
+		put_le64(fixedPart + RECORD_OFF_ENTRY, elven_file->ePnt32);
+		put_le64(fixedPart + RECORD_OFF_PHOFF, elven_file->pHdr32);
+		put_le64(fixedPart + RECORD_OFF_SHOFF, elven_file->sHdr32);
+	}
+	else if (elven_file->processorType == ELF_H_CLASS_64)
+	{
+		fixedPart[RECORD_OFF_BITS] = 64;
+		put_le64(fixedPart + RECORD_OFF_ENTRY, elven_file->ePnt64);
+		put_le64(fixedPart + RECORD_OFF_PHOFF, elven_file->pHdr64);
+		put_le64(fixedPart + RECORD_OFF_SHOFF, elven_file->sHdr64);
+	}
+	fixedPart[RECORD_OFF_BIG_ENDIAN] = elven_file->bigEndian == TRUE ? 1 : 0;
+	put_le32(fixedPart + RECORD_OFF_ELF_VERSION, (uint32_t)elven_file->elfVersion);
+	put_le32(fixedPart + RECORD_OFF_ABI_VERSION, (uint32_t)elven_file->ABIversion);
+	put_le32(fixedPart + RECORD_OFF_FLAGS, elven_file->flags);
+	put_le32(fixedPart + RECORD_OFF_EHSIZE, (uint32_t)elven_file->elfHdrSize);
+	put_le32(fixedPart + RECORD_OFF_EHSIZE + 4, (uint32_t)elven_file->prgmHdrSize);
+	put_le32(fixedPart + RECORD_OFF_EHSIZE + 8, (uint32_t)elven_file->prgmHdrEntrNum);
+	put_le32(fixedPart + RECORD_OFF_EHSIZE + 12, (uint32_t)elven_file->sectHdrSize);
+	put_le32(fixedPart + RECORD_OFF_EHSIZE + 16, (uint32_t)elven_file->sectHdrEntrNum);
+	put_le32(fixedPart + RECORD_OFF_EHSIZE + 20, (uint32_t)elven_file->sectHdrSectNms);
+	if (elven_file->pad)
+	{
+		memcpy(fixedPart + RECORD_OFF_PAD, elven_file->pad, 7);
+	}
+
+	/* SIZE THE POOL */
+	// Same order as STRING POOL below
+	add_pool_string(fixedPart, 0, elven_file->fileName, &poolSize);
+	add_pool_string(fixedPart, 1, elven_file->elfClass, &poolSize);
+	add_pool_string(fixedPart, 2, elven_file->endianness, &poolSize);
+	add_pool_string(fixedPart, 3, elven_file->targetOS, &poolSize);
+	add_pool_string(fixedPart, 4, elven_file->type, &poolSize);
+	add_pool_string(fixedPart, 5, elven_file->ISA, &poolSize);
+	add_pool_string(fixedPart, 6, elven_file->objVersion, &poolSize);
+	nameCursor = poolSize;
+
+	/* SIZE THE TABLES */
+	// Tables that weren't parsed (e.g., header only) are written as RECORD_NOT_READ
+	if (elven_file->prgmHdrs || elven_file->prgmHdrEntrNum < 1)
+	{
+		numSegs = elven_file->prgmHdrs ? (uint32_t)elven_file->numPrgmHdrs : 0;
+		tableSize += (uint64_t)numSegs * RECORD_SEG_SIZE;
+	}
+	if (elven_file->sectHdrs || elven_file->sectHdrEntrNum < 1)
+	{
+		numSects = elven_file->sectHdrs ? (uint32_t)elven_file->numSectHdrs : 0;
+		tableSize += (uint64_t)numSects * RECORD_SECT_SIZE;
+		for (i = 0; i < (int)numSects; i++)
+		{
+			sectName = get_section_name(elven_file, i);
+			poolSize += sectName ? strlen(sectName) + 1 : 0;
+		}
+	}
+	put_le32(fixedPart + RECORD_OFF_NUM_SEGS, numSegs);
+	put_le32(fixedPart + RECORD_OFF_NUM_SECTS, numSects);
+	put_le32(fixedPart + RECORD_OFF_SECT_OFFSET, RECORD_FIXED_SIZE \
+		+ (numSegs == RECORD_NOT_READ ? 0 : numSegs * RECORD_SEG_SIZE));
+
+	/* WRITE IT */
+	retVal = finish_record(output, fixedPart, tableSize, poolSize, &padSize);
+	if (retVal != ERROR_SUCCESS)
+	{
+		return retVal;
+	}
+
+	// Program Header entries
+	for (i = 0; numSegs != RECORD_NOT_READ && i < (int)numSegs; i++)
+	{
+		currPrgmHdr = elven_file->prgmHdrs + i;
+		put_le32(entry + SEG_OFF_TYPE, currPrgmHdr->type);
+		put_le32(entry + SEG_OFF_FLAGS, currPrgmHdr->flags);
+		put_le64(entry + SEG_OFF_OFFSET, currPrgmHdr->offset);
+		put_le64(entry + SEG_OFF_OFFSET + 8, currPrgmHdr->vaddr);
+		put_le64(entry + SEG_OFF_OFFSET + 16, currPrgmHdr->paddr);
+		put_le64(entry + SEG_OFF_OFFSET + 24, currPrgmHdr->filesz);
+		put_le64(entry + SEG_OFF_OFFSET + 32, currPrgmHdr->memsz);
+		put_le64(entry + SEG_OFF_OFFSET + 40, currPrgmHdr->align);
+		output_mem(output, (const char*)entry, RECORD_SEG_SIZE);
+	}
+
+	// Section Header entries
+	memset(entry, 0, sizeof(entry));
+	for (i = 0; numSects != RECORD_NOT_READ && i < (int)numSects; i++)
+	{
+		currSectnHdr = elven_file->sectHdrs + i;
+		sectName = get_section_name(elven_file, i);
+		put_le32(entry + SECT_OFF_POOL_NAME, sectName ? (uint32_t)nameCursor : RECORD_NO_STRING);
+		nameCursor += sectName ? strlen(sectName) + 1 : 0;
+		put_le32(entry + SECT_OFF_NAME, currSectnHdr->name);
+		put_le32(entry + SECT_OFF_TYPE, currSectnHdr->type);
+		put_le32(entry + SECT_OFF_LINK, currSectnHdr->link);
+		put_le32(entry + SECT_OFF_INFO, currSectnHdr->info);
+		put_le64(entry + SECT_OFF_FLAGS, currSectnHdr->flags);
+		put_le64(entry + SECT_OFF_FLAGS + 8, currSectnHdr->addr);
+		put_le64(entry + SECT_OFF_FLAGS + 16, currSectnHdr->offset);
+		put_le64(entry + SECT_OFF_FLAGS + 24, currSectnHdr->size);
+		put_le64(entry + SECT_OFF_FLAGS + 32, currSectnHdr->addralign);
+		put_le64(entry + SECT_OFF_FLAGS + 40, currSectnHdr->entsize);
+		output_mem(output, (const char*)entry, RECORD_SECT_SIZE);
+	}
+
+	// String pool
+	output_pool_string(output, elven_file->fileName);
+	output_pool_string(output, elven_file->elfClass);
+	output_pool_string(output, elven_file->endianness);
+	output_pool_string(output, elven_file->targetOS);
+	output_pool_string(output, elven_file->type);
+	output_pool_string(output, elven_file->ISA);
+	output_pool_string(output, elven_file->objVersion);
+	for (i = 0; numSects != RECORD_NOT_READ && i < (int)numSects; i++)
+	{
+		output_pool_string(output, get_section_name(elven_file, i));
+	}
+	output_repeat(output, '\0', padSize);
+
+	return retVal;
+}
+
+
+// Purpose:	Append one record for a file that wasn't parsed
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			fileName - File that wasn't parsed
+//			errnum - errno from the failure.  0 means it was read but isn't an ELF file.
+// Output:	ERROR_* as specified in Elf_Details.h
+int format_record_unparsed(struct Elf_Output* output, const char* fileName, int errnum)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	unsigned char fixedPart[RECORD_FIXED_SIZE];	// Encoded fixed part
+	uint64_t poolSize = 0;						// Bytes in the string pool
+	size_t padSize = 0;							// Zeroes after the pool
+
+	/* INPUT VALIDATION */
+	if (!output)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	/* WRITE IT */
+	start_record(fixedPart, errnum ? RECORD_STATUS_ERROR : RECORD_STATUS_NOT_ELF, errnum);
+	add_pool_string(fixedPart, 0, fileName, &poolSize);
+	retVal = finish_record(output, fixedPart, 0, poolSize, &padSize);
+	if (retVal == ERROR_SUCCESS)
+	{
+		output_pool_string(output, fileName);
+		output_repeat(output, '\0', padSize);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Read records out of a buffer
+// Input:
+//			reader - Reader to set up
+//			buff - Caller-owned stream of records.  Must outlive every record read from it.
+//			size - Bytes in buff
+// Output:	ERROR_* as specified in Elf_Details.h
+int init_record_reader(struct Elf_Record_Reader* reader, const void* buff, size_t size)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (!reader || (!buff && size > 0))
+	{
+		retVal = ERROR_NULL_PTR;
+	}
+	else
+	{
+		reader->buff = (const unsigned char*)buff;
+		reader->size = size;
+		reader->offset = 0;
+		reader->mapped = FALSE;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Read records out of a file
+// Input:
+//			reader - Reader to set up
+//			fileName - File of records
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	The file is mapped, not read.  Release it with close_record_reader().
+int open_record_reader(struct Elf_Record_Reader* reader, const char* fileName)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	int recFd = -1;				// File descriptor of fileName
+	struct stat recStat;		// Size of fileName
+	void* recGuts = NULL;		// Mapped view of fileName
+
+	/* INPUT VALIDATION */
+	if (!reader || !fileName)
+	{
+		return ERROR_NULL_PTR;
+	}
+
+	/* MAP IT */
+	init_record_reader(reader, NULL, 0);
+	recFd = open(fileName, O_RDONLY);
+	if (recFd < 0)
+	{
+		return ERROR_BAD_ARG;
+	}
+	if (fstat(recFd, &recStat) || !S_ISREG(recStat.st_mode))
+	{
+		retVal = ERROR_BAD_ARG;
+	}
+	// An empty file is an empty stream (and can't be mapped)
+	else if (recStat.st_size > 0)
+	{
+		recGuts = mmap(NULL, (size_t)recStat.st_size, PROT_READ, MAP_PRIVATE, recFd, 0);
+		if (recGuts == MAP_FAILED)
+		{
+			retVal = ERROR_BAD_ARG;
+		}
+		else
+		{
+			reader->buff = (const unsigned char*)recGuts;
+			reader->size = (size_t)recStat.st_size;
+			reader->mapped = TRUE;
+		}
+	}
+	// The mapping holds its own reference to the file
+	close(recFd);
+
+	return retVal;
+}
+
+
+// Purpose:	Decode the next record
+// Input:
+//			reader - Reader to take the record from
+//			record [out] - Decoded record
+// Output:
+//			ERROR_SUCCESS on success
+//			RECORD_END if there are no more records
+//			ERROR_* as specified in Elf_Details.h if the record is corrupt.  The reader doesn't
+//				move past a corrupt record.
+int next_elf_record(struct Elf_Record_Reader* reader, struct Elf_Record* record)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	const unsigned char* recStart = NULL;	// First byte of the record
+	size_t remaining = 0;			// Bytes left in the stream
+	size_t fixedSize = 0;			// Bytes in the record's fixed part
+	uint32_t segOffset = 0;			// Offset of the program header entries
+	uint32_t sectOffset = 0;		// Offset of the section header entries
+	uint32_t poolOffset = 0;		// Offset of the string pool
+	const char** strings[RECORD_NUM_STRINGS];	// Where each pool string is decoded to
+	int i = 0;						// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!reader || !record)
+	{
+		return ERROR_NULL_PTR;
+	}
+	remaining = reader->size - reader->offset;
+	if (remaining == 0)
+	{
+		return RECORD_END;
+	}
+	else if (remaining < RECORD_FIXED_SIZE)
+	{
+		return ERROR_BAD_OFFSET;
+	}
+	recStart = reader->buff + reader->offset;
+	if (memcmp(recStart + RECORD_OFF_MAGIC, RECORD_MAGIC, 4))
+	{
+		return ERROR_ORC_FILE;
+	}
+
+	/* SIZES */
+	memset(record, 0, sizeof(struct Elf_Record));
+	record->version = get_le16(recStart + RECORD_OFF_VERSION);
+	fixedSize = get_le16(recStart + RECORD_OFF_FIXED_SIZE);
+	record->recordSize = get_le32(recStart + RECORD_OFF_RECORD_SIZE);
+	if (record->version < 1 || fixedSize < RECORD_FIXED_SIZE)
+	{
+		return ERROR_BAD_ARG;
+	}
+	else if (record->recordSize < fixedSize || record->recordSize > remaining || record->recordSize % RECORD_ALIGN)
+	{
+		return ERROR_BAD_OFFSET;
+	}
+
+	/* TABLES */
+	record->numSegments = get_le32(recStart + RECORD_OFF_NUM_SEGS);
+	record->numSections = get_le32(recStart + RECORD_OFF_NUM_SECTS);
+	segOffset = get_le32(recStart + RECORD_OFF_SEG_OFFSET);
+	sectOffset = get_le32(recStart + RECORD_OFF_SECT_OFFSET);
+	record->segEntSize = get_le16(recStart + RECORD_OFF_SEG_SIZE);
+	record->sectEntSize = get_le16(recStart + RECORD_OFF_SECT_SIZE);
+	retVal = check_table(record->numSegments, segOffset, record->segEntSize, RECORD_SEG_SIZE, \
+		fixedSize, record->recordSize);
+	if (retVal == ERROR_SUCCESS)
+	{
+		retVal = check_table(record->numSections, sectOffset, record->sectEntSize, RECORD_SECT_SIZE, \
+			fixedSize, record->recordSize);
+	}
+	if (retVal != ERROR_SUCCESS)
+	{
+		return retVal;
+	}
+	record->segments = recStart + segOffset;
+	record->sections = recStart + sectOffset;
+
+	/* STRING POOL */
+	poolOffset = get_le32(recStart + RECORD_OFF_POOL_OFFSET);
+	record->poolSize = get_le32(recStart + RECORD_OFF_POOL_SIZE);
+	if (poolOffset < fixedSize || (uint64_t)poolOffset + record->poolSize > record->recordSize)
+	{
+		return ERROR_BAD_OFFSET;
+	}
+	record->pool = (const char*)recStart + poolOffset;
+	// With the last byte nul, any offset inside the pool is a nul-terminated string
+	if (record->poolSize > 0 && record->pool[record->poolSize - 1] != '\0')
+	{
+		return ERROR_BAD_OFFSET;
+	}
+	strings[0] = &(record->fileName);
+	strings[1] = &(record->elfClass);
+	strings[2] = &(record->endianness);
+	strings[3] = &(record->targetOS);
+	strings[4] = &(record->type);
+	strings[5] = &(record->ISA);
+	strings[6] = &(record->objVersion);
+	for (i = 0; i < RECORD_NUM_STRINGS; i++)
+	{
+		retVal = get_pool_string(record, get_le32(recStart + RECORD_OFF_STRINGS + 4 * i), strings[i]);
+		if (retVal != ERROR_SUCCESS)
+		{
+			return retVal;
+		}
+	}
+
+	/* FIXED FIELDS */
+	record->status = recStart[RECORD_OFF_STATUS];
+	record->bits = recStart[RECORD_OFF_BITS];
+	record->bigEndian = recStart[RECORD_OFF_BIG_ENDIAN] ? TRUE : FALSE;
+	record->errnum = (int32_t)get_le32(recStart + RECORD_OFF_ERRNUM);
+	record->elfVersion = (int32_t)get_le32(recStart + RECORD_OFF_ELF_VERSION);
+	record->ABIversion = (int32_t)get_le32(recStart + RECORD_OFF_ABI_VERSION);
+	record->flags = get_le32(recStart + RECORD_OFF_FLAGS);
+	record->entry = get_le64(recStart + RECORD_OFF_ENTRY);
+	record->phoff = get_le64(recStart + RECORD_OFF_PHOFF);
+	record->shoff = get_le64(recStart + RECORD_OFF_SHOFF);
+	record->elfHdrSize = (int32_t)get_le32(recStart + RECORD_OFF_EHSIZE);
+	record->prgmHdrSize = (int32_t)get_le32(recStart + RECORD_OFF_EHSIZE + 4);
+	record->prgmHdrEntrNum = (int32_t)get_le32(recStart + RECORD_OFF_EHSIZE + 8);
+	record->sectHdrSize = (int32_t)get_le32(recStart + RECORD_OFF_EHSIZE + 12);
+	record->sectHdrEntrNum = (int32_t)get_le32(recStart + RECORD_OFF_EHSIZE + 16);
+	record->sectHdrSectNms = (int32_t)get_le32(recStart + RECORD_OFF_EHSIZE + 20);
+	memcpy(record->pad, recStart + RECORD_OFF_PAD, sizeof(record->pad));
+
+	/* NEXT RECORD */
+	record->raw = recStart;
+	reader->offset += record->recordSize;
+
+	return retVal;
+}
+
+
+// Purpose:	Decode one program header entry of a record
+// Input:
+//			record - Record from next_elf_record()
+//			index - Entry to decode
+//			prgmHdr [out] - Decoded entry
+// Output:	ERROR_* as specified in Elf_Details.h
+int get_record_segment(const struct Elf_Record* record, uint32_t index, struct Elf_Prgrm_Header* prgmHdr)
+{
+	/* LOCAL VARIABLES */
+	const unsigned char* entry = NULL;	// Encoded entry
+
+	/* INPUT VALIDATION */
+	if (!record || !prgmHdr)
+	{
+		return ERROR_NULL_PTR;
+	}
+	else if (record->numSegments == RECORD_NOT_READ || index >= record->numSegments)
+	{
+		return ERROR_BAD_ARG;
+	}
+
+	/* DECODE IT */
+	entry = record->segments + (size_t)index * record->segEntSize;
+	prgmHdr->type = get_le32(entry + SEG_OFF_TYPE);
+	prgmHdr->flags = get_le32(entry + SEG_OFF_FLAGS);
+	prgmHdr->offset = get_le64(entry + SEG_OFF_OFFSET);
+	prgmHdr->vaddr = get_le64(entry + SEG_OFF_OFFSET + 8);
+	prgmHdr->paddr = get_le64(entry + SEG_OFF_OFFSET + 16);
+	prgmHdr->filesz = get_le64(entry + SEG_OFF_OFFSET + 24);
+	prgmHdr->memsz = get_le64(entry + SEG_OFF_OFFSET + 32);
+	prgmHdr->align = get_le64(entry + SEG_OFF_OFFSET + 40);
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Decode one section header entry of a record
+// Input:
+//			record - Record from next_elf_record()
+//			index - Entry to decode
+//			sectnHdr [out] - Decoded entry
+//			sectName [out] - Optional.  Name of the section (NULL if it wasn't resolved).
+// Output:	ERROR_* as specified in Elf_Details.h
+int get_record_section(const struct Elf_Record* record, uint32_t index, struct Elf_Sectn_Header* sectnHdr, \
+	                   const char** sectName)
+{
+	/* LOCAL VARIABLES */
+	const unsigned char* entry = NULL;	// Encoded entry
+	const char* tmpName = NULL;			// Decoded name
+
+	/* INPUT VALIDATION */
+	if (!record || !sectnHdr)
+	{
+		return ERROR_NULL_PTR;
+	}
+	else if (record->numSections == RECORD_NOT_READ || index >= record->numSections)
+	{
+		return ERROR_BAD_ARG;
+	}
+
+	/* DECODE IT */
+	entry = record->sections + (size_t)index * record->sectEntSize;
+	if (get_pool_string(record, get_le32(entry + SECT_OFF_POOL_NAME), &tmpName) != ERROR_SUCCESS)
+	{
+		return ERROR_BAD_OFFSET;
+	}
+	sectnHdr->name = get_le32(entry + SECT_OFF_NAME);
+	sectnHdr->type = get_le32(entry + SECT_OFF_TYPE);
+	sectnHdr->link = get_le32(entry + SECT_OFF_LINK);
+	sectnHdr->info = get_le32(entry + SECT_OFF_INFO);
+	sectnHdr->flags = get_le64(entry + SECT_OFF_FLAGS);
+	sectnHdr->addr = get_le64(entry + SECT_OFF_FLAGS + 8);
+	sectnHdr->offset = get_le64(entry + SECT_OFF_FLAGS + 16);
+	sectnHdr->size = get_le64(entry + SECT_OFF_FLAGS + 24);
+	sectnHdr->addralign = get_le64(entry + SECT_OFF_FLAGS + 32);
+	sectnHdr->entsize = get_le64(entry + SECT_OFF_FLAGS + 40);
+	if (sectName)
+	{
+		*sectName = tmpName;
+	}
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Rebuild an Elf_Details struct from a record
+// Input:
+//			record - RECORD_STATUS_ELF record from next_elf_record()
+//			fileName - Optional.  Overrides record->fileName (e.g., a hard link's path).
+// Output:	An arena-backed Elf_Details struct, NULL on error or if record isn't an ELF file
+// Note:	Every string is copied out of the record's pool into the struct's arena
+struct Elf_Details* record_to_elf(const struct Elf_Record* record, const char* fileName)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Details* retVal = NULL;	// Struct to be allocated, initialized and returned
+	struct Elf_Arena* arena = NULL;		// Everything retVal owns
+	char* pool = NULL;					// Arena copy of record->pool
+	const char* sectName = NULL;		// Name of the section being rebuilt
+	uint32_t i = 0;						// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!record)
+	{
+		return retVal;
+	}
+	else if (record->status != RECORD_STATUS_ELF)
+	{
+		return retVal;
+	}
+
+	/* ALLOCATE */
+	arena = create_arena(0);
+	if (!arena)
+	{
+		return retVal;
+	}
+	retVal = (struct Elf_Details*)arena_gimme_mem(arena, 1, sizeof(struct Elf_Details));
+	if (!retVal)
+	{
+		destroy_arena(&arena);
+		return retVal;
+	}
+	pool = (char*)arena_gimme_mem(arena, record->poolSize + 1, sizeof(char));
+	if (fileName)
+	{
+		retVal->fileName = (char*)arena_gimme_mem(arena, strlen(fileName) + 1, sizeof(char));
+	}
+	retVal->pad = (char*)arena_gimme_mem(arena, sizeof(record->pad), sizeof(char));
+	if (record->numSegments != RECORD_NOT_READ && record->numSegments > 0)
+	{
+		retVal->prgmHdrs = (struct Elf_Prgrm_Header*)arena_gimme_mem(arena, record->numSegments, \
+			sizeof(struct Elf_Prgrm_Header));
+	}
+	if (record->numSections != RECORD_NOT_READ && record->numSections > 0)
+	{
+		retVal->sectHdrs = (struct Elf_Sectn_Header*)arena_gimme_mem(arena, record->numSections, \
+			sizeof(struct Elf_Sectn_Header));
+	}
+	if (!pool || !retVal->pad || (fileName && !retVal->fileName) \
+		|| (record->numSegments != RECORD_NOT_READ && record->numSegments > 0 && !retVal->prgmHdrs) \
+		|| (record->numSections != RECORD_NOT_READ && record->numSections > 0 && !retVal->sectHdrs))
+	{
+		destroy_arena(&arena);
+		return NULL;
+	}
+	retVal->arena = arena;
+
+	/* STRINGS */
+	memcpy(pool, record->pool, record->poolSize);
+	if (fileName)
+	{
+		strcpy(retVal->fileName, fileName);
+	}
+	else if (record->fileName)
+	{
+		retVal->fileName = pool + (record->fileName - record->pool);
+	}
+	retVal->magicNum = ELF_H_MAGIC_NUM;
+	retVal->elfClass = record->elfClass ? pool + (record->elfClass - record->pool) : NULL;
+	retVal->endianness = record->endianness ? pool + (record->endianness - record->pool) : NULL;
+	retVal->targetOS = record->targetOS ? pool + (record->targetOS - record->pool) : NULL;
+	retVal->type = record->type ? pool + (record->type - record->pool) : NULL;
+	retVal->ISA = record->ISA ? pool + (record->ISA - record->pool) : NULL;
+	retVal->objVersion = record->objVersion ? pool + (record->objVersion - record->pool) : NULL;
+
+	/* ELF HEADER */
+	if (record->bits == 32)
+	{
+		retVal->processorType = ELF_H_CLASS_32;
+		retVal->ePnt32 = (uint32_t)record->entry;
+		retVal->pHdr32 = (uint32_t)record->phoff;
+		retVal->sHdr32 = (uint32_t)record->shoff;
+	}
+	else if (record->bits == 64)
+	{
+		retVal->processorType = ELF_H_CLASS_64;
+		retVal->ePnt64 = record->entry;
+		retVal->pHdr64 = record->phoff;
+		retVal->sHdr64 = record->shoff;
+	}
+	retVal->bigEndian = record->bigEndian;
+	retVal->elfVersion = record->elfVersion;
+	retVal->ABIversion = record->ABIversion;
+	memcpy(retVal->pad, record->pad, sizeof(record->pad));
+	retVal->flags = record->flags;
+	retVal->elfHdrSize = record->elfHdrSize;
+	retVal->prgmHdrSize = record->prgmHdrSize;
+	retVal->prgmHdrEntrNum = record->prgmHdrEntrNum;
+	retVal->sectHdrSize = record->sectHdrSize;
+	retVal->sectHdrEntrNum = record->sectHdrEntrNum;
+	retVal->sectHdrSectNms = record->sectHdrSectNms;
+
+	/* TABLES */
+	for (i = 0; retVal->prgmHdrs && i < record->numSegments; i++)
+	{
+		get_record_segment(record, i, retVal->prgmHdrs + i);
+	}
+	retVal->numPrgmHdrs = retVal->prgmHdrs ? (int)record->numSegments : 0;
+	// Section names are offsets into the pool, which stands in for the section name string table
+	for (i = 0; retVal->sectHdrs && i < record->numSections; i++)
+	{
+		if (get_record_section(record, i, retVal->sectHdrs + i, &sectName) != ERROR_SUCCESS)
+		{
+			kill_elf(&retVal);
+			return NULL;
+		}
+		retVal->sectHdrs[i].name = sectName ? (uint32_t)(sectName - record->pool) : (uint32_t)record->poolSize;
+	}
+	retVal->numSectHdrs = retVal->sectHdrs ? (int)record->numSections : 0;
+	retVal->sectNames = pool;
+	retVal->sectNamesSize = record->poolSize;
+
+	return retVal;
+}
+
+
+// Purpose:	Release a reader
+// Input:	reader - Reader from open_record_reader() or init_record_reader()
+// Output:	ERROR_* as specified in Elf_Details.h
+int close_record_reader(struct Elf_Record_Reader* reader)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (!reader)
+	{
+		retVal = ERROR_NULL_PTR;
+	}
+	else
+	{
+		if (reader->mapped == TRUE && munmap((void*)reader->buff, reader->size))
+		{
+			PERROR(errno);
+			retVal = ERROR_BAD_ARG;
+		}
+		init_record_reader(reader, NULL, 0);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Store little-endian integers, one byte at a time so alignment and host order don't matter
+static void put_le16(unsigned char* buff, uint16_t value)
+{
+	buff[0] = (unsigned char)value;
+	buff[1] = (unsigned char)(value >> 8);
+}
+
+
+static void put_le32(unsigned char* buff, uint32_t value)
+{
+	put_le16(buff, (uint16_t)value);
+	put_le16(buff + 2, (uint16_t)(value >> 16));
+}
+
+
+static void put_le64(unsigned char* buff, uint64_t value)
+{
+	put_le32(buff, (uint32_t)value);
+	put_le32(buff + 4, (uint32_t)(value >> 32));
+}
+
+
+// Purpose:	Load little-endian integers (see: put_le16())
+static uint16_t get_le16(const unsigned char* buff)
+{
+	return (uint16_t)(buff[0] | (buff[1] << 8));
+}
+
+
+static uint32_t get_le32(const unsigned char* buff)
+{
+	return get_le16(buff) | ((uint32_t)get_le16(buff + 2) << 16);
+}
+
+
+static uint64_t get_le64(const unsigned char* buff)
+{
+	return get_le32(buff) | ((uint64_t)get_le32(buff + 4) << 32);
+}
+
+
+// Purpose:	Encode the parts of the fixed part every record has
+// Input:
+//			fixedPart [out] - RECORD_FIXED_SIZE bytes to encode into
+//			status - RECORD_STATUS_*
+//			errnum - errno (0 if none)
+// Output:	None
+// Note:	Both tables start out RECORD_NOT_READ and every string starts out RECORD_NO_STRING
+static void start_record(unsigned char* fixedPart, int status, int errnum)
+{
+	int i = 0;	// Iterating variable
+
+	memset(fixedPart, 0, RECORD_FIXED_SIZE);
+	memcpy(fixedPart + RECORD_OFF_MAGIC, RECORD_MAGIC, 4);
+	put_le16(fixedPart + RECORD_OFF_VERSION, RECORD_VERSION);
+	put_le16(fixedPart + RECORD_OFF_FIXED_SIZE, RECORD_FIXED_SIZE);
+	fixedPart[RECORD_OFF_STATUS] = (unsigned char)status;
+	put_le32(fixedPart + RECORD_OFF_ERRNUM, (uint32_t)errnum);
+	put_le32(fixedPart + RECORD_OFF_NUM_SEGS, RECORD_NOT_READ);
+	put_le32(fixedPart + RECORD_OFF_NUM_SECTS, RECORD_NOT_READ);
+	put_le32(fixedPart + RECORD_OFF_SEG_OFFSET, RECORD_FIXED_SIZE);
+	put_le32(fixedPart + RECORD_OFF_SECT_OFFSET, RECORD_FIXED_SIZE);
+	put_le16(fixedPart + RECORD_OFF_SEG_SIZE, RECORD_SEG_SIZE);
+	put_le16(fixedPart + RECORD_OFF_SECT_SIZE, RECORD_SECT_SIZE);
+	for (i = 0; i < RECORD_NUM_STRINGS; i++)
+	{
+		put_le32(fixedPart + RECORD_OFF_STRINGS + 4 * i, RECORD_NO_STRING);
+	}
+
+	return;
+}
+
+
+// Purpose:	Reserve room for one of the fixed part's strings at the end of the pool
+// Input:
+//			fixedPart - Fixed part to store the string's offset in
+//			stringIndex - Which string (see: RECORD_NUM_STRINGS)
+//			str - String to reserve room for.  NULL stays RECORD_NO_STRING.
+//			poolSize [in/out] - Bytes in the pool so far
+// Output:	None
+static void add_pool_string(unsigned char* fixedPart, int stringIndex, const char* str, uint64_t* poolSize)
+{
+	if (str)
+	{
+		put_le32(fixedPart + RECORD_OFF_STRINGS + 4 * stringIndex, (uint32_t)(*poolSize));
+		*poolSize += strlen(str) + 1;
+	}
+
+	return;
+}
+
+
+// Purpose:	Size the record then append the fixed part
+// Input:
+//			output - Buffer to append to
+//			fixedPart - Encoded fixed part, missing only the sizes
+//			tableSize - Bytes in both tables
+//			poolSize - Bytes in the string pool
+//			padSize [out] - Zeroes the caller appends after the pool
+// Output:	ERROR_OVERFLOW if the record won't fit a uint32_t size, otherwise ERROR_SUCCESS
+static int finish_record(struct Elf_Output* output, unsigned char* fixedPart, uint64_t tableSize, \
+	                     uint64_t poolSize, size_t* padSize)
+{
+	uint64_t poolOffset = RECORD_FIXED_SIZE + tableSize;	// The pool follows the tables
+	uint64_t recordSize = poolOffset + poolSize;			// Bytes before padding
+
+	*padSize = (RECORD_ALIGN - (recordSize % RECORD_ALIGN)) % RECORD_ALIGN;
+	recordSize += *padSize;
+	if (recordSize > UINT32_MAX)
+	{
+		return ERROR_OVERFLOW;
+	}
+
+	put_le32(fixedPart + RECORD_OFF_RECORD_SIZE, (uint32_t)recordSize);
+	put_le32(fixedPart + RECORD_OFF_POOL_OFFSET, (uint32_t)poolOffset);
+	put_le32(fixedPart + RECORD_OFF_POOL_SIZE, (uint32_t)poolSize);
+	output_mem(output, (const char*)fixedPart, RECORD_FIXED_SIZE);
+
+	return ERROR_SUCCESS;
+}
+
+
+// Purpose:	Append a string and its nul terminator to the pool (nothing for NULL)
+static void output_pool_string(struct Elf_Output* output, const char* str)
+{
+	if (str)
+	{
+		output_mem(output, str, strlen(str) + 1);
+	}
+
+	return;
+}
+
+
+// Purpose:	Resolve a pool offset
+// Input:
+//			record - Record the pool belongs to
+//			poolOffset - Offset into record->pool (RECORD_NO_STRING for NULL)
+//			str [out] - The string
+// Output:	ERROR_BAD_OFFSET if poolOffset is outside of the pool, otherwise ERROR_SUCCESS
+static int get_pool_string(const struct Elf_Record* record, uint32_t poolOffset, const char** str)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (poolOffset == RECORD_NO_STRING)
+	{
+		*str = NULL;
+	}
+	else if (poolOffset >= record->poolSize)
+	{
+		retVal = ERROR_BAD_OFFSET;
+	}
+	else
+	{
+		*str = record->pool + poolOffset;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Check that a table fits between the fixed part and the end of its record
+// Input:
+//			numEntries - Entries in the table (RECORD_NOT_READ if it wasn't read)
+//			tableOffset - Offset of the table from the start of the record
+//			entSize - Bytes in each entry
+//			minEntSize - Smallest entry this version can decode
+//			fixedSize - Bytes in the record's fixed part
+//			recordSize - Bytes in the record
+// Output:	ERROR_* as specified in Elf_Details.h
+static int check_table(uint32_t numEntries, uint32_t tableOffset, size_t entSize, size_t minEntSize, \
+	                   size_t fixedSize, size_t recordSize)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (numEntries == RECORD_NOT_READ || numEntries == 0)
+	{
+		retVal = ERROR_SUCCESS;
+	}
+	else if (entSize < minEntSize)
+	{
+		retVal = ERROR_BAD_ARG;
+	}
+	else if (tableOffset < fixedSize || tableOffset + (uint64_t)numEntries * entSize > recordSize)
+	{
+		retVal = ERROR_BAD_OFFSET;
+	}
+
+	return retVal;
+}
@@ -0,0 +1,205 @@
+#ifndef __ELF_RECORD_H__
+#define __ELF_RECORD_H__
+
+#include <stddef.h>		// size_t
+#include <stdint.h>		// Fixed-width integers
+
+/*
+ *	USAGE:
+ *		Write - format_elf_record() (or format_record_unparsed()) appends one record per file
+ *		Read - open_record_reader() (or init_record_reader() for a buffer) then next_elf_record()
+ *			until it returns RECORD_END
+ *	LAYOUT:
+ *		A record stream is nothing but records back to back, so streams can be appended to and
+ *			concatenated.  Every integer is little-endian and every record is a multiple of 8 bytes.
+ *		Each record is the fixed part (RECORD_FIXED_SIZE bytes, offsets below), then the
+ *			program header entries, then the section header entries, then the string pool
+ *		Strings are offsets into that record's pool of nul-terminated strings
+ *			(RECORD_NO_STRING for NULL).  Nothing points outside of its own record.
+ *		Later versions may only grow the fixed part and the entries (their sizes are stored in
+ *			every record), so a version 1 reader can read any later record
+ *	Readers hand out pointers into the stream itself so nothing is copied or allocated
+ */
+
+#define RECORD_MAGIC		"ELFR"				// First four bytes of every record
+#define RECORD_VERSION		((uint16_t)1)		// Version written by format_elf_record()
+#define RECORD_ALIGN		((size_t)8)			// Every record is padded to a multiple of this
+#define RECORD_FIXED_SIZE	((size_t)144)		// Bytes in the version 1 fixed part
+#define RECORD_SEG_SIZE		((size_t)56)		// Bytes in a version 1 program header entry
+#define RECORD_SECT_SIZE	((size_t)72)		// Bytes in a version 1 section header entry
+#define RECORD_NO_STRING	((uint32_t)0xFFFFFFFF)	// String offset that means NULL
+#define RECORD_NOT_READ		((uint32_t)0xFFFFFFFF)	// Entry count of a table that wasn't read
+#define RECORD_END			((int)1)			// next_elf_record() ran out of records
+
+/* Elf_Record.status */
+#define RECORD_STATUS_ELF		((int)0)	// Parsed as an ELF file
+#define RECORD_STATUS_NOT_ELF	((int)1)	// Read but not an ELF file
+#define RECORD_STATUS_ERROR		((int)2)	// Could not be read (see: Elf_Record.errnum)
+
+/* Fixed part offsets (version 1) */
+#define RECORD_OFF_MAGIC		0	// char[4]
+#define RECORD_OFF_VERSION		4	// uint16_t
+#define RECORD_OFF_FIXED_SIZE	6	// uint16_t
+#define RECORD_OFF_RECORD_SIZE	8	// uint32_t, padding included
+#define RECORD_OFF_STATUS		12	// uint8_t, RECORD_STATUS_*
+#define RECORD_OFF_BITS			13	// uint8_t, 32, 64, or 0 if unknown
+#define RECORD_OFF_BIG_ENDIAN	14	// uint8_t
+#define RECORD_OFF_ERRNUM		16	// int32_t
+#define RECORD_OFF_ELF_VERSION	20	// int32_t
+#define RECORD_OFF_ABI_VERSION	24	// int32_t
+#define RECORD_OFF_FLAGS		28	// uint32_t
+#define RECORD_OFF_ENTRY		32	// uint64_t
+#define RECORD_OFF_PHOFF		40	// uint64_t
+#define RECORD_OFF_SHOFF		48	// uint64_t
+#define RECORD_OFF_EHSIZE		56	// uint32_t, then phentsize, phnum, shentsize, shnum, shstrndx
+#define RECORD_OFF_PAD			80	// uint8_t[7]
+#define RECORD_OFF_NUM_SEGS		88	// uint32_t
+#define RECORD_OFF_NUM_SECTS	92	// uint32_t
+#define RECORD_OFF_SEG_OFFSET	96	// uint32_t, from the start of the record
+#define RECORD_OFF_SECT_OFFSET	100	// uint32_t, from the start of the record
+#define RECORD_OFF_SEG_SIZE		104	// uint16_t
+#define RECORD_OFF_SECT_SIZE	106	// uint16_t
+#define RECORD_OFF_POOL_OFFSET	108	// uint32_t, from the start of the record
+#define RECORD_OFF_POOL_SIZE	112	// uint32_t
+#define RECORD_OFF_STRINGS		116	// uint32_t[RECORD_NUM_STRINGS]
+#define RECORD_NUM_STRINGS		7	// fileName, elfClass, endianness, targetOS, type, ISA, objVersion
+
+struct Elf_Details;
+struct Elf_Output;
+struct Elf_Prgrm_Header;
+struct Elf_Sectn_Header;
+
+// One decoded record.  Strings and tables point into the stream it was read from.
+struct Elf_Record
+{
+	int version;			// Version of the writer
+	int status;				// RECORD_STATUS_*
+	int errnum;				// errno if status is RECORD_STATUS_ERROR
+	int bits;				// 32, 64, or 0 if unknown
+	int bigEndian;			// If TRUE, bigEndian
+	int elfVersion;			// See: Elf_Details
+	int ABIversion;			// See: Elf_Details
+	uint32_t flags;			// See: Elf_Details
+	uint64_t entry;			// Entry point (either class)
+	uint64_t phoff;			// Program Header Table offset (either class)
+	uint64_t shoff;			// Section Header Table offset (either class)
+	int elfHdrSize;			// See: Elf_Details
+	int prgmHdrSize;		// See: Elf_Details
+	int prgmHdrEntrNum;		// See: Elf_Details
+	int sectHdrSize;		// See: Elf_Details
+	int sectHdrEntrNum;		// See: Elf_Details
+	int sectHdrSectNms;		// See: Elf_Details
+	unsigned char pad[7];	// See: Elf_Details
+	const char* fileName;	// NULL if it wasn't known
+	const char* elfClass;	// See: Elf_Details
+	const char* endianness;	// See: Elf_Details
+	const char* targetOS;	// See: Elf_Details
+	const char* type;		// See: Elf_Details
+	const char* ISA;		// See: Elf_Details
+	const char* objVersion;	// See: Elf_Details
+	uint32_t numSegments;	// Program header entries (RECORD_NOT_READ if the table wasn't read)
+	uint32_t numSections;	// Section header entries (RECORD_NOT_READ if the table wasn't read)
+	const unsigned char* segments;	// Encoded program header entries (see: get_record_segment())
+	const unsigned char* sections;	// Encoded section header entries (see: get_record_section())
+	size_t segEntSize;		// Bytes in each encoded program header entry
+	size_t sectEntSize;		// Bytes in each encoded section header entry
+	const char* pool;		// String pool
+	size_t poolSize;		// Bytes in pool
+	const unsigned char* raw;	// The whole encoded record
+	size_t recordSize;		// Bytes in the whole record
+};
+
+// A stream of records being read
+struct Elf_Record_Reader
+{
+	const unsigned char* buff;	// The whole stream
+	size_t size;				// Bytes in buff
+	size_t offset;				// Where the next record starts
+	int mapped;					// If TRUE, buff is an mmap()'d view that must be munmap()'d
+};
+
+
+// Purpose:	Append one record describing an ELF file
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			elven_file - A Elf_Details struct that contains data about an ELF file
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			Files without the ELF magic number get a RECORD_STATUS_NOT_ELF record
+//			Nothing is appended if the record would be larger than 4 GiB (ERROR_OVERFLOW)
+int format_elf_record(struct Elf_Output* output, struct Elf_Details* elven_file);
+
+// Purpose:	Append one record for a file that wasn't parsed
+// Input:
+//			output - Buffer to format into (see: get_thread_output())
+//			fileName - File that wasn't parsed
+//			errnum - errno from the failure.  0 means it was read but isn't an ELF file.
+// Output:	ERROR_* as specified in Elf_Details.h
+int format_record_unparsed(struct Elf_Output* output, const char* fileName, int errnum);
+
+// Purpose:	Read records out of a buffer
+// Input:
+//			reader - Reader to set up
+//			buff - Caller-owned stream of records.  Must outlive every record read from it.
+//			size - Bytes in buff
+// Output:	ERROR_* as specified in Elf_Details.h
+int init_record_reader(struct Elf_Record_Reader* reader, const void* buff, size_t size);
+
+// Purpose:	Read records out of a file
+// Input:
+//			reader - Reader to set up
+//			fileName - File of records
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			The file is mapped, not read.  Release it with close_record_reader().
+//			Check errno on ERROR_BAD_ARG
+int open_record_reader(struct Elf_Record_Reader* reader, const char* fileName);
+
+// Purpose:	Decode the next record
+// Input:
+//			reader - Reader to take the record from
+//			record [out] - Decoded record
+// Output:
+//			ERROR_SUCCESS on success
+//			RECORD_END if there are no more records
+//			ERROR_* as specified in Elf_Details.h if the record is corrupt.  The reader doesn't
+//				move past a corrupt record.
+// Note:	Every offset and size is checked so a corrupt stream can't send a reader out of bounds
+int next_elf_record(struct Elf_Record_Reader* reader, struct Elf_Record* record);
+
+// Purpose:	Decode one program header entry of a record
+// Input:
+//			record - Record from next_elf_record()
+//			index - Entry to decode
+//			prgmHdr [out] - Decoded entry
+// Output:	ERROR_* as specified in Elf_Details.h
+int get_record_segment(const struct Elf_Record* record, uint32_t index, struct Elf_Prgrm_Header* prgmHdr);
+
+// Purpose:	Decode one section header entry of a record
+// Input:
+//			record - Record from next_elf_record()
+//			index - Entry to decode
+//			sectnHdr [out] - Decoded entry
+//			sectName [out] - Optional.  Name of the section (NULL if it wasn't resolved).
+// Output:	ERROR_* as specified in Elf_Details.h
+int get_record_section(const struct Elf_Record* record, uint32_t index, struct Elf_Sectn_Header* sectnHdr, \
+	                   const char** sectName);
+
+// Purpose:	Rebuild an Elf_Details struct from a record
+// Input:
+//			record - RECORD_STATUS_ELF record from next_elf_record()
+//			fileName - Optional.  Overrides record->fileName (e.g., a hard link's path).
+// Output:	An arena-backed Elf_Details struct, NULL on error or if record isn't an ELF file
+// Note:
+//			Release it with kill_elf().  Nothing in it points back into the record.
+//			Only what a record holds is rebuilt.  The file contents (elfGuts) aren't, so
+//				anything that needs them (e.g., read_elf_symbols()) sees a header-only struct.
+//			sectNames is the record's string pool so get_section_name() still works
+struct Elf_Details* record_to_elf(const struct Elf_Record* record, const char* fileName);
+
+// Purpose:	Release a reader
+// Input:	reader - Reader from open_record_reader() or init_record_reader()
+// Output:	ERROR_* as specified in Elf_Details.h
+int close_record_reader(struct Elf_Record_Reader* reader);
+
+#endif // __ELF_RECORD_H__
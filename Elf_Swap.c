@@ -0,0 +1,200 @@
+#include "Elf_Swap.h"
+#include "Elf_Details.h"
+#include <string.h>		// memcpy()
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SWAP_X86
+#include <immintrin.h>	// SSSE3 and AVX2 intrinsics
+#endif // x86
+
+/* LOCAL VARIABLES */
+static int forcedIsa = SWAP_ISA_AUTO;	// See: set_swap_isa()
+
+/* LOCAL FUNCTIONS */
+static int cpu_supports_isa(int swapIsa);
+
+
+/* SHUFFLE MASKS */
+// Byte order for one 16 byte lane.  AVX2 uses the same mask in both lanes.
+#define SWAP_MASK_BYTES_16	1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+#define SWAP_MASK_BYTES_32	3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12
+#define SWAP_MASK_BYTES_64	7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8
+
+
+/* SCALAR */
+// Scalar loops also finish the tail of the vector loops
+#define DEFINE_SCALAR_SWAP(bits) \
+static void swap_##bits##_scalar(uint##bits##_t* dst, const unsigned char* src, size_t count) \
+{ \
+	uint##bits##_t value; \
+	size_t i = 0; \
+	for (i = 0; i < count; i++) \
+	{ \
+		memcpy(&value, src + (i * sizeof(value)), sizeof(value)); \
+		dst[i] = __builtin_bswap##bits(value); \
+	} \
+}
+
+DEFINE_SCALAR_SWAP(16)
+DEFINE_SCALAR_SWAP(32)
+DEFINE_SCALAR_SWAP(64)
+
+
+#ifdef SWAP_X86
+/* SSSE3 */
+#define DEFINE_SSSE3_SWAP(bits) \
+__attribute__((target("ssse3"))) \
+static void swap_##bits##_ssse3(uint##bits##_t* dst, const unsigned char* src, size_t count) \
+{ \
+	const __m128i mask = _mm_setr_epi8(SWAP_MASK_BYTES_##bits); \
+	const size_t perVector = sizeof(__m128i) / sizeof(*dst); \
+	size_t i = 0; \
+	for (i = 0; i + perVector <= count; i += perVector) \
+	{ \
+		__m128i vec = _mm_loadu_si128((const __m128i*)(src + (i * sizeof(*dst)))); \
+		_mm_storeu_si128((__m128i*)(dst + i), _mm_shuffle_epi8(vec, mask)); \
+	} \
+	swap_##bits##_scalar(dst + i, src + (i * sizeof(*dst)), count - i); \
+}
+
+DEFINE_SSSE3_SWAP(16)
+DEFINE_SSSE3_SWAP(32)
+DEFINE_SSSE3_SWAP(64)
+
+
+/* AVX2 */
+#define DEFINE_AVX2_SWAP(bits) \
+__attribute__((target("avx2"))) \
+static void swap_##bits##_avx2(uint##bits##_t* dst, const unsigned char* src, size_t count) \
+{ \
+	const __m256i mask = _mm256_setr_epi8(SWAP_MASK_BYTES_##bits, SWAP_MASK_BYTES_##bits); \
+	const size_t perVector = sizeof(__m256i) / sizeof(*dst); \
+	size_t i = 0; \
+	for (i = 0; i + perVector <= count; i += perVector) \
+	{ \
+		__m256i vec = _mm256_loadu_si256((const __m256i*)(src + (i * sizeof(*dst)))); \
+		_mm256_storeu_si256((__m256i*)(dst + i), _mm256_shuffle_epi8(vec, mask)); \
+	} \
+	swap_##bits##_scalar(dst + i, src + (i * sizeof(*dst)), count - i); \
+}
+
+DEFINE_AVX2_SWAP(16)
+DEFINE_AVX2_SWAP(32)
+DEFINE_AVX2_SWAP(64)
+#endif // SWAP_X86
+
+
+/* DISPATCH */
+#ifdef SWAP_X86
+#define DEFINE_SWAP_ARRAY(bits) \
+void swap_##bits##_array(uint##bits##_t* dst, const void* src, size_t count) \
+{ \
+	if (!dst || !src || count < 1) \
+	{ \
+		return; \
+	} \
+	switch (get_swap_isa()) \
+	{ \
+		case SWAP_ISA_AVX2: \
+			swap_##bits##_avx2(dst, (const unsigned char*)src, count); \
+			break; \
+		case SWAP_ISA_SSSE3: \
+			swap_##bits##_ssse3(dst, (const unsigned char*)src, count); \
+			break; \
+		default: \
+			swap_##bits##_scalar(dst, (const unsigned char*)src, count); \
+	} \
+}
+#else
+#define DEFINE_SWAP_ARRAY(bits) \
+void swap_##bits##_array(uint##bits##_t* dst, const void* src, size_t count) \
+{ \
+	if (dst && src) \
+	{ \
+		swap_##bits##_scalar(dst, (const unsigned char*)src, count); \
+	} \
+}
+#endif // SWAP_X86
+
+DEFINE_SWAP_ARRAY(16)
+DEFINE_SWAP_ARRAY(32)
+DEFINE_SWAP_ARRAY(64)
+
+
+// Purpose:	Force a particular swap_*_array() implementation
+// Input:	swapIsa - SWAP_ISA_* as specified in Elf_Swap.h
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			Returns ERROR_BAD_ARG if this CPU can't run swapIsa
+//			Set it once, before any other threads start swapping
+int set_swap_isa(int swapIsa)
+{
+	int retVal = ERROR_SUCCESS;
+
+	if (swapIsa != SWAP_ISA_AUTO && cpu_supports_isa(swapIsa) != TRUE)
+	{
+		retVal = ERROR_BAD_ARG;
+	}
+	else
+	{
+		forcedIsa = swapIsa;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Report the swap_*_array() implementation in use
+// Input:	None
+// Output:	SWAP_ISA_SCALAR, SWAP_ISA_SSSE3, or SWAP_ISA_AVX2
+int get_swap_isa(void)
+{
+	int retVal = forcedIsa;
+
+	if (retVal == SWAP_ISA_AUTO)
+	{
+		if (cpu_supports_isa(SWAP_ISA_AVX2) == TRUE)
+		{
+			retVal = SWAP_ISA_AVX2;
+		}
+		else if (cpu_supports_isa(SWAP_ISA_SSSE3) == TRUE)
+		{
+			retVal = SWAP_ISA_SSSE3;
+		}
+		else
+		{
+			retVal = SWAP_ISA_SCALAR;
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Determine if this CPU can run a swap_*_array() implementation
+// Input:	swapIsa - SWAP_ISA_* as specified in Elf_Swap.h
+// Output:	TRUE if it can, FALSE otherwise
+// Note:	__builtin_cpu_supports() only reads the CPU model cached at startup
+static int cpu_supports_isa(int swapIsa)
+{
+	int retVal = FALSE;
+
+	switch (swapIsa)
+	{
+		case SWAP_ISA_SCALAR:
+			retVal = TRUE;
+			break;
+#ifdef SWAP_X86
+		case SWAP_ISA_SSSE3:
+			retVal = __builtin_cpu_supports("ssse3") ? TRUE : FALSE;
+			break;
+		case SWAP_ISA_AVX2:
+			retVal = __builtin_cpu_supports("avx2") ? TRUE : FALSE;
+			break;
+#endif // SWAP_X86
+		default:
+			retVal = FALSE;
+	}
+
+	return retVal;
+}
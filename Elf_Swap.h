@@ -0,0 +1,58 @@
+#ifndef __ELF_SWAP_H__
+#define __ELF_SWAP_H__
+
+#include <stddef.h>		// size_t
+#include <stdint.h>		// Fixed-width integers
+
+/*
+ *	USAGE:
+ *		swap_*_array() reverse the bytes of every element in an array
+ *		The fastest implementation the CPU supports is chosen at runtime (see: get_swap_isa())
+ *		dst and src may be the same array (in place) but must not otherwise overlap
+ *		Neither dst nor src need to be aligned
+ */
+
+#define SWAP_ISA_AUTO		((int)0)	// Choose the best implementation the CPU supports
+#define SWAP_ISA_SCALAR		((int)1)	// One __builtin_bswap*() per element
+#define SWAP_ISA_SSSE3		((int)2)	// 16 bytes per pshufb
+#define SWAP_ISA_AVX2		((int)3)	// 32 bytes per vpshufb
+
+
+// Purpose:	Byte swap an array of 16-bit values
+// Input:
+//			dst [out] - Array to store count swapped values in
+//			src - Array of count values to swap
+//			count - Number of elements (not bytes)
+// Output:	None
+void swap_16_array(uint16_t* dst, const void* src, size_t count);
+
+// Purpose:	Byte swap an array of 32-bit values
+// Input:
+//			dst [out] - Array to store count swapped values in
+//			src - Array of count values to swap
+//			count - Number of elements (not bytes)
+// Output:	None
+void swap_32_array(uint32_t* dst, const void* src, size_t count);
+
+// Purpose:	Byte swap an array of 64-bit values
+// Input:
+//			dst [out] - Array to store count swapped values in
+//			src - Array of count values to swap
+//			count - Number of elements (not bytes)
+// Output:	None
+void swap_64_array(uint64_t* dst, const void* src, size_t count);
+
+// Purpose:	Force a particular swap_*_array() implementation
+// Input:	swapIsa - SWAP_ISA_* as specified above
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			Returns ERROR_BAD_ARG if this CPU can't run swapIsa
+//			Set it once, before any other threads start swapping
+int set_swap_isa(int swapIsa);
+
+// Purpose:	Report the swap_*_array() implementation in use
+// Input:	None
+// Output:	SWAP_ISA_SCALAR, SWAP_ISA_SSSE3, or SWAP_ISA_AVX2
+int get_swap_isa(void);
+
+#endif // __ELF_SWAP_H__
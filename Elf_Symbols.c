@@ -0,0 +1,825 @@
+#include "Elf_Symbols.h"
+#include "Elf_Details.h"
+#include "Harklehash.h"
+#include <inttypes.h>	// Print uint64_t variables
+#include <limits.h>		// INT_MAX
+#include <stdlib.h>		// qsort()
+#include <string.h>		// memchr()
+
+/* LOCAL FUNCTIONS */
+static int compare_symbol_addrs(const void* left, const void* right);
+static int is_addressable(const struct Elf_Symbol* symbol);
+static int read_symbol_hash(struct Elf_Symbol_Table* symTable, struct Elf_Details* elven_struct);
+static int read_gnu_hash(struct Elf_Symbol_Table* symTable, struct Elf_Details* elven_struct, \
+	                     const struct Elf_Sectn_Header* hashHdr);
+static int read_sysv_hash(struct Elf_Symbol_Table* symTable, struct Elf_Details* elven_struct, \
+	                      const struct Elf_Sectn_Header* hashHdr);
+static const struct Elf_Symbol* gnu_hash_lookup(const struct Elf_Symbol_Table* symTable, const char* symName);
+static const struct Elf_Symbol* sysv_hash_lookup(const struct Elf_Symbol_Table* symTable, const char* symName, \
+	                                             int definedOnly);
+
+
+// Purpose:	Decode one symbol table section and index it by address and by name
+// Input:
+//			elven_struct - Struct with a decoded Section Header Table and retained file contents
+//			sectIndex - Index of an ELF_S_TYPE_SYMTAB or ELF_S_TYPE_DYNSYM section
+// Output:	Pointer to a dynamically allocated Elf_Symbol_Table on success, NULL on failure
+// Note:	Caller is responsible for utilizing kill_symbol_table() to free the return value
+struct Elf_Symbol_Table* read_symbol_table(struct Elf_Details* elven_struct, int sectIndex)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Symbol_Table* retVal = NULL;
+	const struct Elf_Sectn_Header* symHdr = NULL;	// Symbol table section
+	const struct Elf_Sectn_Header* strHdr = NULL;	// Linked string table section
+	const unsigned char* currEntry = NULL;			// Raw entry being decoded
+	struct Elf_Symbol* currSym = NULL;				// Entry being decoded
+	void (*decodeEntry)(struct Elf_Symbol*, const unsigned char*) = NULL;	// Chosen once per file
+	uint64_t entrySize = 0;							// Size of one raw entry
+	uint64_t numSymbols = 0;						// Number of entries in the section
+	size_t numAddrs = 0;							// Number of entries in the address index
+	int pass = 0;									// Defined names first, then undefined
+	size_t i = 0;									// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!elven_struct || !elven_struct->sectHdrs || !elven_struct->elfGuts || !elven_struct->decoders)
+	{
+		return retVal;
+	}
+	else if (sectIndex < 0 || sectIndex >= elven_struct->numSectHdrs)
+	{
+		return retVal;
+	}
+
+	symHdr = elven_struct->sectHdrs + sectIndex;
+	if (symHdr->type != ELF_S_TYPE_SYMTAB && symHdr->type != ELF_S_TYPE_DYNSYM)
+	{
+		report_elf_error(elven_struct->context, "Section %d is not a symbol table!", sectIndex);
+		return retVal;
+	}
+	entrySize = elven_struct->processorType == ELF_H_CLASS_32 ? ELF_SYM_SIZE_32 : ELF_SYM_SIZE_64;
+	if (symHdr->entsize > 0 && symHdr->entsize < entrySize)
+	{
+		report_elf_error(elven_struct->context, "Symbol table entries are too small (%" PRIu64 " bytes)!", symHdr->entsize);
+		return retVal;
+	}
+	else if (symHdr->entsize > 0)
+	{
+		entrySize = symHdr->entsize;
+	}
+	if (symHdr->offset > elven_struct->elfSize || symHdr->size > (elven_struct->elfSize - symHdr->offset))
+	{
+		report_elf_error(elven_struct->context, "Symbol table runs past the end of the file!");
+		return retVal;
+	}
+	numSymbols = symHdr->size / entrySize;
+	// Symbol indexes are stored as uint32_t and HarkleTable values are int
+	if (numSymbols > INT_MAX)
+	{
+		report_elf_error(elven_struct->context, "Symbol table has too many entries (%" PRIu64 ")!", numSymbols);
+		return retVal;
+	}
+	if (symHdr->link == ELF_S_INDEX_UNDEF || symHdr->link >= (uint32_t)elven_struct->numSectHdrs)
+	{
+		report_elf_error(elven_struct->context, "Symbol table does not link to a string table!");
+		return retVal;
+	}
+	strHdr = elven_struct->sectHdrs + symHdr->link;
+	if (strHdr->type == ELF_S_TYPE_NOBITS || strHdr->offset > elven_struct->elfSize \
+		|| strHdr->size > (elven_struct->elfSize - strHdr->offset))
+	{
+		report_elf_error(elven_struct->context, "Symbol string table runs past the end of the file!");
+		return retVal;
+	}
+
+	/* ALLOCATE */
+	retVal = (struct Elf_Symbol_Table*)gimme_mem(1, sizeof(struct Elf_Symbol_Table));
+	if (!retVal)
+	{
+		PERROR(errno);
+		return retVal;
+	}
+	retVal->sectIndex = sectIndex;
+	retVal->strings = (const char*)elven_struct->elfGuts + strHdr->offset;
+	retVal->stringsSize = strHdr->size;
+	if (numSymbols > 0)
+	{
+		retVal->symbols = (struct Elf_Symbol*)gimme_mem(numSymbols, sizeof(struct Elf_Symbol));
+		if (!retVal->symbols)
+		{
+			PERROR(errno);
+			kill_symbol_table(&retVal);
+			return retVal;
+		}
+	}
+	retVal->numSymbols = numSymbols;
+
+	/* DECODE */
+	// The whole table was bounds checked above
+	decodeEntry = elven_struct->decoders->symbol;
+	currEntry = (const unsigned char*)elven_struct->elfGuts + symHdr->offset;
+	for (i = 0; i < retVal->numSymbols; i++)
+	{
+		currSym = retVal->symbols + i;
+		decodeEntry(currSym, currEntry);
+		currEntry += entrySize;
+		// The name must be nul-terminated inside the string table
+		if (currSym->name > 0 && currSym->name < retVal->stringsSize \
+			&& memchr(retVal->strings + currSym->name, '\0', retVal->stringsSize - currSym->name) \
+			&& retVal->strings[currSym->name] != '\0')
+		{
+			currSym->symName = retVal->strings + currSym->name;
+		}
+		if (is_addressable(currSym) == TRUE)
+		{
+			numAddrs++;
+		}
+	}
+
+	/* INDEX BY ADDRESS */
+	if (numAddrs > 0)
+	{
+		retVal->addrIndex = (struct Elf_Symbol_Addr*)gimme_mem(numAddrs, sizeof(struct Elf_Symbol_Addr));
+		if (!retVal->addrIndex)
+		{
+			PERROR(errno);
+			kill_symbol_table(&retVal);
+			return retVal;
+		}
+		for (i = 0; i < retVal->numSymbols; i++)
+		{
+			currSym = retVal->symbols + i;
+			if (is_addressable(currSym) == TRUE)
+			{
+				retVal->addrIndex[retVal->numAddrs].addr = currSym->value;
+				retVal->addrIndex[retVal->numAddrs].size = currSym->size;
+				retVal->addrIndex[retVal->numAddrs].symIndex = (uint32_t)i;
+				if (currSym->size > retVal->maxSize)
+				{
+					retVal->maxSize = currSym->size;
+				}
+				retVal->numAddrs++;
+			}
+		}
+		qsort(retVal->addrIndex, retVal->numAddrs, sizeof(struct Elf_Symbol_Addr), compare_symbol_addrs);
+	}
+
+	/* USE THE BINARY'S OWN HASH TABLE */
+	// A malformed hash section isn't fatal, the name index below takes over
+	if (read_symbol_hash(retVal, elven_struct) == ERROR_NULL_PTR)
+	{
+		kill_symbol_table(&retVal);
+		return retVal;
+	}
+	else if (retVal->hashType)
+	{
+		return retVal;
+	}
+
+	/* INDEX BY NAME */
+	// Lookups return the first entry added so defined symbols go in first
+	retVal->nameIndex = create_a_table(retVal->numSymbols, FALSE);
+	if (!retVal->nameIndex)
+	{
+		PERROR(errno);
+		kill_symbol_table(&retVal);
+		return retVal;
+	}
+	for (pass = 0; pass < 2; pass++)
+	{
+		for (i = 0; i < retVal->numSymbols; i++)
+		{
+			currSym = retVal->symbols + i;
+			if (!currSym->symName || (currSym->shndx == ELF_S_INDEX_UNDEF) != (pass == 1))
+			{
+				continue;
+			}
+			// Names are borrowed from the file contents
+			if (!add_table_entry(retVal->nameIndex, (char*)currSym->symName, (int)i))
+			{
+				PERROR(errno);
+				kill_symbol_table(&retVal);
+				return retVal;
+			}
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Read the most complete symbol table in an ELF file
+// Input:	elven_struct - Struct with a decoded Section Header Table and retained file contents
+// Output:	Pointer to a dynamically allocated Elf_Symbol_Table on success, NULL on failure
+// Note:
+//			Prefers .symtab and falls back to .dynsym (stripped binaries)
+//			Caller is responsible for utilizing kill_symbol_table() to free the return value
+struct Elf_Symbol_Table* read_elf_symbols(struct Elf_Details* elven_struct)
+{
+	/* LOCAL VARIABLES */
+	struct Elf_Symbol_Table* retVal = NULL;
+	int dynsymIndex = -1;	// Index of the first ELF_S_TYPE_DYNSYM section
+	int i = 0;				// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!elven_struct || !elven_struct->sectHdrs)
+	{
+		return retVal;
+	}
+
+	/* FIND A SYMBOL TABLE */
+	for (i = 0; i < elven_struct->numSectHdrs; i++)
+	{
+		if (elven_struct->sectHdrs[i].type == ELF_S_TYPE_SYMTAB)
+		{
+			retVal = read_symbol_table(elven_struct, i);
+			break;
+		}
+		else if (elven_struct->sectHdrs[i].type == ELF_S_TYPE_DYNSYM && dynsymIndex < 0)
+		{
+			dynsymIndex = i;
+		}
+	}
+
+	if (!retVal && dynsymIndex >= 0)
+	{
+		retVal = read_symbol_table(elven_struct, dynsymIndex);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Find the symbol that contains an address
+// Input:
+//			symTable - Table built by read_symbol_table()
+//			addr - Address to resolve
+//			symOffset [out] - Optional.  Offset of addr from the start of the symbol.
+// Output:	Pointer to the symbol on success, NULL if no symbol contains addr
+// Note:
+//			O(log n) binary search of symTable->addrIndex
+//			A zero-sized symbol only contains its own address
+//			When symbols overlap, the one that starts closest to addr wins
+const struct Elf_Symbol* find_symbol_by_addr(const struct Elf_Symbol_Table* symTable, uint64_t addr, \
+	                                         uint64_t* symOffset)
+{
+	/* LOCAL VARIABLES */
+	const struct Elf_Symbol* retVal = NULL;
+	const struct Elf_Symbol_Addr* currAddr = NULL;	// Index entry being checked
+	size_t low = 0;									// Binary search lower bound
+	size_t high = 0;								// Binary search upper bound
+	size_t middle = 0;								// Binary search midpoint
+
+	/* INPUT VALIDATION */
+	if (!symTable || !symTable->addrIndex || symTable->numAddrs < 1)
+	{
+		return retVal;
+	}
+
+	/* BINARY SEARCH */
+	// Find the first entry that starts after addr
+	high = symTable->numAddrs;
+	while (low < high)
+	{
+		middle = low + ((high - low) / 2);
+		if (symTable->addrIndex[middle].addr <= addr)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	/* WALK BACKWARDS */
+	// Nested symbols (e.g., a local label inside a function) can hide the symbol that
+	//	actually contains addr.  Nothing starting more than maxSize before addr can.
+	while (low > 0)
+	{
+		currAddr = symTable->addrIndex + --low;
+		if (addr - currAddr->addr > symTable->maxSize)
+		{
+			break;
+		}
+		else if (addr - currAddr->addr < currAddr->size || (currAddr->size == 0 && addr == currAddr->addr))
+		{
+			retVal = symTable->symbols + currAddr->symIndex;
+			if (symOffset)
+			{
+				*symOffset = addr - currAddr->addr;
+			}
+			break;
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Find a symbol by name
+// Input:
+//			symTable - Table built by read_symbol_table()
+//			symName - Name to find (e.g., "main")
+// Output:	Pointer to the symbol on success, NULL if not found
+// Note:
+//			Defined symbols are preferred over undefined symbols of the same name
+//			A .gnu.hash miss falls back to scanning the undefined symbols it doesn't cover.
+//				Use find_defined_symbol() to skip that scan.
+const struct Elf_Symbol* find_symbol_by_name(const struct Elf_Symbol_Table* symTable, const char* symName)
+{
+	/* LOCAL VARIABLES */
+	const struct Elf_Symbol* retVal = NULL;
+	struct HarkleDict* entry = NULL;	// Name index entry
+	size_t i = 0;						// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!symTable || !symName)
+	{
+		return retVal;
+	}
+
+	/* LOOK IT UP */
+	if (symTable->hashType == ELF_S_TYPE_GNU_HASH)
+	{
+		retVal = gnu_hash_lookup(symTable, symName);
+		// .gnu.hash leaves out everything below symOffset
+		for (i = 1; !retVal && i < symTable->symOffset && i < symTable->numSymbols; i++)
+		{
+			if (symTable->symbols[i].symName && !strcmp(symTable->symbols[i].symName, symName))
+			{
+				retVal = symTable->symbols + i;
+			}
+		}
+	}
+	else if (symTable->hashType == ELF_S_TYPE_HASH)
+	{
+		retVal = sysv_hash_lookup(symTable, symName, FALSE);
+	}
+	else if (symTable->nameIndex)
+	{
+		entry = lookup_table_name(symTable->nameIndex, (char*)symName);
+		if (entry && entry->value >= 0 && (size_t)entry->value < symTable->numSymbols)
+		{
+			retVal = symTable->symbols + entry->value;
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Find a defined (e.g., exported) symbol by name
+// Input:
+//			symTable - Table built by read_symbol_table()
+//			symName - Name to find (e.g., "malloc")
+// Output:	Pointer to the symbol on success, NULL if not found or only undefined
+// Note:
+//			Uses the binary's own .gnu.hash (bloom filter first) or .hash section when
+//				one covers the table, just like the dynamic loader.  Otherwise symTable->nameIndex.
+//			Most misses are rejected by the bloom filter without touching a bucket
+const struct Elf_Symbol* find_defined_symbol(const struct Elf_Symbol_Table* symTable, const char* symName)
+{
+	/* LOCAL VARIABLES */
+	const struct Elf_Symbol* retVal = NULL;
+
+	/* INPUT VALIDATION */
+	if (!symTable || !symName)
+	{
+		return retVal;
+	}
+
+	/* LOOK IT UP */
+	if (symTable->hashType == ELF_S_TYPE_GNU_HASH)
+	{
+		retVal = gnu_hash_lookup(symTable, symName);
+	}
+	else if (symTable->hashType == ELF_S_TYPE_HASH)
+	{
+		retVal = sysv_hash_lookup(symTable, symName, TRUE);
+	}
+	else
+	{
+		// The name index holds defined symbols first
+		retVal = find_symbol_by_name(symTable, symName);
+	}
+
+	if (retVal && retVal->shndx == ELF_S_INDEX_UNDEF)
+	{
+		retVal = NULL;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Zeroize/free an Elf_Symbol_Table
+// Input:	Pointer to an Elf_Symbol_Table pointer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	This function will modify the original variable in the calling function
+int kill_symbol_table(struct Elf_Symbol_Table** old_table)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+
+	/* INPUT VALIDATION */
+	if (!old_table || !*old_table)
+	{
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
+
+	/* ZEROIZE AND FREE (as appropriate) STRUCT MEMBERS */
+	if ((*old_table)->nameIndex)
+	{
+		destroy_a_table(&((*old_table)->nameIndex));
+	}
+	if ((*old_table)->hashBuckets)
+	{
+		retVal += take_mem_back((void**)&((*old_table)->hashBuckets), (*old_table)->numBuckets, sizeof(uint32_t));
+	}
+	if ((*old_table)->hashChains)
+	{
+		retVal += take_mem_back((void**)&((*old_table)->hashChains), (*old_table)->numChains, sizeof(uint32_t));
+	}
+	if ((*old_table)->hashBloom)
+	{
+		retVal += take_mem_back((void**)&((*old_table)->hashBloom), (*old_table)->bloomSize, sizeof(uint64_t));
+	}
+	if ((*old_table)->addrIndex)
+	{
+		retVal += take_mem_back((void**)&((*old_table)->addrIndex), (*old_table)->numAddrs, \
+			sizeof(struct Elf_Symbol_Addr));
+	}
+	if ((*old_table)->symbols)
+	{
+		retVal += take_mem_back((void**)&((*old_table)->symbols), (*old_table)->numSymbols, \
+			sizeof(struct Elf_Symbol));
+	}
+	// Pointed into the file contents
+	(*old_table)->strings = NULL;
+
+	/* ZEROIZE AND FREE THE STRUCT */
+	retVal += take_mem_back((void**)old_table, 1, sizeof(struct Elf_Symbol_Table));
+
+	return retVal;
+}
+
+
+// Purpose:	Sort Elf_Symbol_Addr entries by address, then by size
+// Input:	Pointers to two Elf_Symbol_Addr structs (see: qsort())
+// Output:	Negative, zero, or positive like strcmp()
+// Note:	Larger symbols sort last so find_symbol_by_addr() tries them first
+static int compare_symbol_addrs(const void* left, const void* right)
+{
+	const struct Elf_Symbol_Addr* leftAddr = (const struct Elf_Symbol_Addr*)left;
+	const struct Elf_Symbol_Addr* rightAddr = (const struct Elf_Symbol_Addr*)right;
+	int retVal = 0;
+
+	if (leftAddr->addr != rightAddr->addr)
+	{
+		retVal = leftAddr->addr < rightAddr->addr ? -1 : 1;
+	}
+	else if (leftAddr->size != rightAddr->size)
+	{
+		retVal = leftAddr->size < rightAddr->size ? -1 : 1;
+	}
+	else
+	{
+		// Keep the sort stable across qsort() implementations
+		retVal = leftAddr->symIndex < rightAddr->symIndex ? -1 : (leftAddr->symIndex > rightAddr->symIndex);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Determine if a symbol belongs in the address index
+// Input:	symbol - Decoded symbol
+// Output:	TRUE if it names code or data at a real address, FALSE otherwise
+// Note:	Sections, files, TLS offsets, and absolute/common/undefined symbols are left out
+static int is_addressable(const struct Elf_Symbol* symbol)
+{
+	int retVal = FALSE;
+
+	if (symbol && symbol->symName && symbol->shndx != ELF_S_INDEX_UNDEF \
+		&& (symbol->shndx < ELF_S_INDEX_LO_RESERVE || symbol->shndx == ELF_S_INDEX_XINDEX))
+	{
+		switch (ELF_SYM_TYPE(symbol->info))
+		{
+			case ELF_SYM_TYPE_NOTYPE:
+			case ELF_SYM_TYPE_OBJECT:
+			case ELF_SYM_TYPE_FUNC:
+			case ELF_SYM_TYPE_GNU_IFUNC:
+				retVal = TRUE;
+				break;
+			default:
+				retVal = FALSE;
+		}
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Decode the .gnu.hash or .hash section linked to a symbol table
+// Input:
+//			symTable - Table with decoded symbols
+//			elven_struct - Struct the table was read from
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			Sets symTable->hashType on success.  Leaves it 0 if there's no usable hash section.
+//			.gnu.hash is preferred, just like the dynamic loader
+//			Only ERROR_NULL_PTR (out of memory) should be treated as fatal
+static int read_symbol_hash(struct Elf_Symbol_Table* symTable, struct Elf_Details* elven_struct)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	const struct Elf_Sectn_Header* gnuHdr = NULL;	// .gnu.hash linked to this table
+	const struct Elf_Sectn_Header* sysvHdr = NULL;	// .hash linked to this table
+	const struct Elf_Sectn_Header* currHdr = NULL;	// Section being checked
+	int i = 0;										// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (!symTable || !elven_struct || !elven_struct->sectHdrs)
+	{
+		retVal = ERROR_BAD_ARG;
+		return retVal;
+	}
+
+	/* FIND HASH SECTIONS */
+	for (i = 0; i < elven_struct->numSectHdrs; i++)
+	{
+		currHdr = elven_struct->sectHdrs + i;
+		if (currHdr->link != (uint32_t)symTable->sectIndex)
+		{
+			continue;
+		}
+		else if (currHdr->type == ELF_S_TYPE_GNU_HASH && !gnuHdr)
+		{
+			gnuHdr = currHdr;
+		}
+		else if (currHdr->type == ELF_S_TYPE_HASH && !sysvHdr)
+		{
+			sysvHdr = currHdr;
+		}
+	}
+
+	/* DECODE ONE */
+	retVal = ERROR_BAD_ARG;
+	if (gnuHdr)
+	{
+		retVal = read_gnu_hash(symTable, elven_struct, gnuHdr);
+	}
+	if (retVal != ERROR_SUCCESS && retVal != ERROR_NULL_PTR && sysvHdr)
+	{
+		retVal = read_sysv_hash(symTable, elven_struct, sysvHdr);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Decode a .gnu.hash section
+// Input:
+//			symTable - Table with decoded symbols
+//			elven_struct - Struct the table was read from
+//			hashHdr - The .gnu.hash section
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Layout: nbuckets, symoffset, bloom_size, bloom_shift, bloom[], buckets[], chains[]
+//			Bloom filter words are as wide as the ELF Class, everything else is 32 bits
+//			The arrays are decoded in bulk (see: Elf_Swap.h)
+static int read_gnu_hash(struct Elf_Symbol_Table* symTable, struct Elf_Details* elven_struct, \
+	                     const struct Elf_Sectn_Header* hashHdr)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	const unsigned char* hashGuts = NULL;	// Start of the section
+	uint64_t bloomBytes = 0;				// Size of the bloom filter in the file
+	uint64_t fixedBytes = 0;				// Size of everything before the chains
+	uint32_t numBuckets = 0;				// Header: nbuckets
+	uint32_t symOffset = 0;					// Header: symoffset
+	uint32_t bloomSize = 0;					// Header: bloom_size
+	size_t numChains = 0;					// Chains that fit in the section
+	size_t i = 0;							// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (hashHdr->offset > elven_struct->elfSize || hashHdr->size > (elven_struct->elfSize - hashHdr->offset) \
+		|| hashHdr->size < 16)
+	{
+		report_elf_error(elven_struct->context, "GNU hash table runs past the end of the file!");
+		retVal = ERROR_BAD_OFFSET;
+		return retVal;
+	}
+	hashGuts = (const unsigned char*)elven_struct->elfGuts + hashHdr->offset;
+	numBuckets = elven_struct->decoders->word(hashGuts);
+	symOffset = elven_struct->decoders->word(hashGuts + 4);
+	bloomSize = elven_struct->decoders->word(hashGuts + 8);
+	symTable->bloomShift = elven_struct->decoders->word(hashGuts + 12);
+	symTable->bloomBits = elven_struct->processorType == ELF_H_CLASS_32 ? 32 : 64;
+	bloomBytes = (uint64_t)bloomSize * (symTable->bloomBits / 8);
+	fixedBytes = 16 + bloomBytes + ((uint64_t)numBuckets * sizeof(uint32_t));
+	// The second bloom filter bit is nameHash >> bloomShift, so anything wider is meaningless
+	if (numBuckets < 1 || bloomSize < 1 || symTable->bloomShift >= 32 || symOffset > symTable->numSymbols \
+		|| fixedBytes > hashHdr->size)
+	{
+		report_elf_error(elven_struct->context, "GNU hash table is malformed!");
+		retVal = ERROR_BAD_OFFSET;
+		return retVal;
+	}
+	// Every chain entry belongs to a symbol at or above symOffset
+	numChains = (hashHdr->size - fixedBytes) / sizeof(uint32_t);
+	if (numChains > symTable->numSymbols - symOffset)
+	{
+		numChains = symTable->numSymbols - symOffset;
+	}
+
+	/* ALLOCATE */
+	symTable->hashBloom = (uint64_t*)gimme_mem(bloomSize, sizeof(uint64_t));
+	symTable->hashBuckets = (uint32_t*)gimme_mem(numBuckets, sizeof(uint32_t));
+	symTable->hashChains = numChains ? (uint32_t*)gimme_mem(numChains, sizeof(uint32_t)) : NULL;
+	symTable->bloomSize = bloomSize;
+	symTable->numBuckets = numBuckets;
+	symTable->numChains = numChains;
+	if (!symTable->hashBloom || !symTable->hashBuckets || (numChains && !symTable->hashChains))
+	{
+		PERROR(errno);
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
+
+	/* DECODE */
+	if (symTable->bloomBits == 32)
+	{
+		// Decode into the front half then widen from the back so nothing is overwritten early
+		elven_struct->decoders->words((uint32_t*)symTable->hashBloom, hashGuts + 16, bloomSize);
+		for (i = bloomSize; i > 0; i--)
+		{
+			symTable->hashBloom[i - 1] = ((uint32_t*)symTable->hashBloom)[i - 1];
+		}
+	}
+	else
+	{
+		elven_struct->decoders->xwords(symTable->hashBloom, hashGuts + 16, bloomSize);
+	}
+	elven_struct->decoders->words(symTable->hashBuckets, hashGuts + 16 + bloomBytes, numBuckets);
+	elven_struct->decoders->words(symTable->hashChains, hashGuts + fixedBytes, numChains);
+
+	symTable->symOffset = symOffset;
+	symTable->hashType = ELF_S_TYPE_GNU_HASH;
+
+	return retVal;
+}
+
+
+// Purpose:	Decode a SysV .hash section
+// Input:
+//			symTable - Table with decoded symbols
+//			elven_struct - Struct the table was read from
+//			hashHdr - The .hash section
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	
+//			Layout: nbucket, nchain, buckets[], chains[] (all 32 bits)
+//			The arrays are decoded in bulk (see: Elf_Swap.h)
+static int read_sysv_hash(struct Elf_Symbol_Table* symTable, struct Elf_Details* elven_struct, \
+	                      const struct Elf_Sectn_Header* hashHdr)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	const unsigned char* hashGuts = NULL;	// Start of the section
+	uint32_t numBuckets = 0;				// Header: nbucket
+	uint32_t numChains = 0;					// Header: nchain
+
+	/* INPUT VALIDATION */
+	if (hashHdr->offset > elven_struct->elfSize || hashHdr->size > (elven_struct->elfSize - hashHdr->offset) \
+		|| hashHdr->size < 8)
+	{
+		report_elf_error(elven_struct->context, "SysV hash table runs past the end of the file!");
+		retVal = ERROR_BAD_OFFSET;
+		return retVal;
+	}
+	hashGuts = (const unsigned char*)elven_struct->elfGuts + hashHdr->offset;
+	numBuckets = elven_struct->decoders->word(hashGuts);
+	numChains = elven_struct->decoders->word(hashGuts + 4);
+	if (numBuckets < 1 || numChains > symTable->numSymbols \
+		|| (8 + (((uint64_t)numBuckets + numChains) * sizeof(uint32_t))) > hashHdr->size)
+	{
+		report_elf_error(elven_struct->context, "SysV hash table is malformed!");
+		retVal = ERROR_BAD_OFFSET;
+		return retVal;
+	}
+
+	/* ALLOCATE */
+	symTable->hashBuckets = (uint32_t*)gimme_mem(numBuckets, sizeof(uint32_t));
+	symTable->hashChains = numChains ? (uint32_t*)gimme_mem(numChains, sizeof(uint32_t)) : NULL;
+	symTable->numBuckets = numBuckets;
+	symTable->numChains = numChains;
+	if (!symTable->hashBuckets || (numChains && !symTable->hashChains))
+	{
+		PERROR(errno);
+		retVal = ERROR_NULL_PTR;
+		return retVal;
+	}
+
+	/* DECODE */
+	elven_struct->decoders->words(symTable->hashBuckets, hashGuts + 8, numBuckets);
+	elven_struct->decoders->words(symTable->hashChains, hashGuts + 8 + (numBuckets * sizeof(uint32_t)), numChains);
+
+	symTable->hashType = ELF_S_TYPE_HASH;
+
+	return retVal;
+}
+
+
+// Purpose:	Look a name up in a decoded .gnu.hash section
+// Input:
+//			symTable - Table with hashType == ELF_S_TYPE_GNU_HASH
+//			symName - Name to find
+// Output:	Pointer to the symbol on success, NULL if not found
+// Note:	Only finds symbols at or above symOffset (i.e., defined symbols)
+static const struct Elf_Symbol* gnu_hash_lookup(const struct Elf_Symbol_Table* symTable, const char* symName)
+{
+	/* LOCAL VARIABLES */
+	const struct Elf_Symbol* retVal = NULL;
+	const struct Elf_Symbol* currSym = NULL;	// Symbol being checked
+	uint32_t nameHash = 0;						// gnu_hash() of symName
+	uint32_t chainHash = 0;						// Hash stored in the chain
+	uint64_t bloomWord = 0;						// Bloom filter word for nameHash
+	uint64_t bloomMask = 0;						// Both bits nameHash sets in bloomWord
+	size_t symIndex = 0;						// Index into symTable->symbols
+
+	/* BLOOM FILTER */
+	nameHash = gnu_hash((char*)symName);
+	bloomWord = symTable->hashBloom[(nameHash / symTable->bloomBits) % symTable->bloomSize];
+	bloomMask = ((uint64_t)1 << (nameHash % symTable->bloomBits)) \
+		| ((uint64_t)1 << ((nameHash >> symTable->bloomShift) % symTable->bloomBits));
+	if ((bloomWord & bloomMask) != bloomMask)
+	{
+		return retVal;
+	}
+
+	/* WALK THE CHAIN */
+	// The low bit of a chain entry marks the end of the chain
+	symIndex = symTable->hashBuckets[nameHash % symTable->numBuckets];
+	if (symIndex < symTable->symOffset)
+	{
+		return retVal;
+	}
+	while (symIndex < symTable->numSymbols && (symIndex - symTable->symOffset) < symTable->numChains)
+	{
+		chainHash = symTable->hashChains[symIndex - symTable->symOffset];
+		currSym = symTable->symbols + symIndex;
+		if ((chainHash | 1) == (nameHash | 1) && currSym->symName && !strcmp(currSym->symName, symName))
+		{
+			retVal = currSym;
+			break;
+		}
+		else if (chainHash & 1)
+		{
+			break;
+		}
+		symIndex++;
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Look a name up in a decoded SysV .hash section
+// Input:
+//			symTable - Table with hashType == ELF_S_TYPE_HASH
+//			symName - Name to find
+//			definedOnly - If TRUE, skip undefined symbols
+// Output:	Pointer to the symbol on success, NULL if not found
+// Note:	Defined symbols are preferred over undefined symbols of the same name
+static const struct Elf_Symbol* sysv_hash_lookup(const struct Elf_Symbol_Table* symTable, const char* symName, \
+	                                             int definedOnly)
+{
+	/* LOCAL VARIABLES */
+	const struct Elf_Symbol* retVal = NULL;
+	const struct Elf_Symbol* currSym = NULL;	// Symbol being checked
+	size_t symIndex = 0;						// Index into symTable->symbols
+	size_t numSteps = 0;						// Guards against a chain that loops
+
+	/* WALK THE CHAIN */
+	symIndex = symTable->hashBuckets[sysv_hash((char*)symName) % symTable->numBuckets];
+	while (symIndex != 0 && symIndex < symTable->numChains && numSteps++ < symTable->numChains)
+	{
+		currSym = symTable->symbols + symIndex;
+		if (currSym->symName && !strcmp(currSym->symName, symName))
+		{
+			if (currSym->shndx != ELF_S_INDEX_UNDEF)
+			{
+				retVal = currSym;
+				break;
+			}
+			else if (!retVal && definedOnly != TRUE)
+			{
+				retVal = currSym;
+			}
+		}
+		symIndex = symTable->hashChains[symIndex];
+	}
+
+	return retVal;
+}
@@ -0,0 +1,112 @@
+#ifndef __ELF_SYMBOLS_H__
+#define __ELF_SYMBOLS_H__
+
+#include <stddef.h>		// size_t
+#include <stdint.h>		// Fixed-width integers
+
+/*
+ *	USAGE:
+ *		Start - read_elf_symbols() (or read_symbol_table()) once per file to build the indexes
+ *		Step - find_symbol_by_addr() and find_symbol_by_name() as often as needed
+ *		Stop - kill_symbol_table() before the Elf_Details struct it was read from
+ *	Symbol names are borrowed from the file contents (struct->elfGuts) so the table
+ *		must not outlive the Elf_Details struct it was read from
+ *	Name lookups use the binary's own .gnu.hash (or SysV .hash) section when one is linked
+ *		to the symbol table.  Only tables without one pay to build a HarkleTable name index.
+ */
+
+struct Elf_Details;
+struct Elf_Symbol;
+struct HarkleTable;
+
+// One address index entry.  Kept apart from the symbols so the binary search only
+//	touches this small, contiguous array.
+struct Elf_Symbol_Addr
+{
+	uint64_t addr;		// Symbol value
+	uint64_t size;		// Symbol size
+	uint32_t symIndex;	// Index into Elf_Symbol_Table.symbols
+};
+
+struct Elf_Symbol_Table
+{
+	struct Elf_Symbol* symbols;		// Contiguous array of every decoded entry (entry 0 is the null symbol)
+	size_t numSymbols;				// Number of entries in symbols
+	struct Elf_Symbol_Addr* addrIndex;	// Defined code and data symbols sorted by address
+	size_t numAddrs;				// Number of entries in addrIndex
+	uint64_t maxSize;				// Largest size in addrIndex (bounds the backwards scan)
+	struct HarkleTable* nameIndex;	// Symbol name to index into symbols (NULL if hashType is used)
+	int hashType;					// ELF_S_TYPE_GNU_HASH or ELF_S_TYPE_HASH if the binary's own hash table is used
+	uint32_t* hashBuckets;			// Decoded hash buckets (symbol indexes)
+	size_t numBuckets;				// Number of entries in hashBuckets
+	uint32_t* hashChains;			// Decoded hash chains (GNU: symbol hashes, SysV: next symbol index)
+	size_t numChains;				// Number of entries in hashChains
+	uint64_t* hashBloom;			// Decoded .gnu.hash bloom filter (ELFCLASS32 words are widened)
+	size_t bloomSize;				// Number of words in hashBloom
+	uint32_t bloomShift;			// Shift for the second bloom filter bit
+	uint32_t bloomBits;				// Bits per bloom filter word in the file (32 or 64)
+	uint32_t symOffset;				// Index of the first symbol covered by .gnu.hash
+	const char* strings;			// Linked string table (points into the parsed buffer)
+	uint64_t stringsSize;			// Number of bytes in strings
+	int sectIndex;					// Section Header Table index the symbols were read from
+};
+
+
+// Purpose:	Decode one symbol table section and index it by address and by name
+// Input:
+//			elven_struct - Struct with a decoded Section Header Table and retained file contents
+//			sectIndex - Index of an ELF_S_TYPE_SYMTAB or ELF_S_TYPE_DYNSYM section
+// Output:	Pointer to a dynamically allocated Elf_Symbol_Table on success, NULL on failure
+// Note:	Caller is responsible for utilizing kill_symbol_table() to free the return value
+struct Elf_Symbol_Table* read_symbol_table(struct Elf_Details* elven_struct, int sectIndex);
+
+// Purpose:	Read the most complete symbol table in an ELF file
+// Input:	elven_struct - Struct with a decoded Section Header Table and retained file contents
+// Output:	Pointer to a dynamically allocated Elf_Symbol_Table on success, NULL on failure
+// Note:
+//			Prefers .symtab and falls back to .dynsym (stripped binaries)
+//			Caller is responsible for utilizing kill_symbol_table() to free the return value
+struct Elf_Symbol_Table* read_elf_symbols(struct Elf_Details* elven_struct);
+
+// Purpose:	Find the symbol that contains an address
+// Input:
+//			symTable - Table built by read_symbol_table()
+//			addr - Address to resolve
+//			symOffset [out] - Optional.  Offset of addr from the start of the symbol.
+// Output:	Pointer to the symbol on success, NULL if no symbol contains addr
+// Note:
+//			O(log n) binary search of symTable->addrIndex
+//			A zero-sized symbol only contains its own address
+//			When symbols overlap, the one that starts closest to addr wins
+const struct Elf_Symbol* find_symbol_by_addr(const struct Elf_Symbol_Table* symTable, uint64_t addr, \
+	                                         uint64_t* symOffset);
+
+// Purpose:	Find a symbol by name
+// Input:
+//			symTable - Table built by read_symbol_table()
+//			symName - Name to find (e.g., "main")
+// Output:	Pointer to the symbol on success, NULL if not found
+// Note:
+//			Defined symbols are preferred over undefined symbols of the same name
+//			A .gnu.hash miss falls back to scanning the undefined symbols it doesn't cover.
+//				Use find_defined_symbol() to skip that scan.
+const struct Elf_Symbol* find_symbol_by_name(const struct Elf_Symbol_Table* symTable, const char* symName);
+
+// Purpose:	Find a defined (e.g., exported) symbol by name
+// Input:
+//			symTable - Table built by read_symbol_table()
+//			symName - Name to find (e.g., "malloc")
+// Output:	Pointer to the symbol on success, NULL if not found or only undefined
+// Note:
+//			Uses the binary's own .gnu.hash (bloom filter first) or .hash section when
+//				one covers the table, just like the dynamic loader.  Otherwise symTable->nameIndex.
+//			Most misses are rejected by the bloom filter without touching a bucket
+const struct Elf_Symbol* find_defined_symbol(const struct Elf_Symbol_Table* symTable, const char* symName);
+
+// Purpose:	Zeroize/free an Elf_Symbol_Table
+// Input:	Pointer to an Elf_Symbol_Table pointer
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:	This function will modify the original variable in the calling function
+int kill_symbol_table(struct Elf_Symbol_Table** old_table);
+
+#endif // __ELF_SYMBOLS_H__
@@ -1,8 +1,19 @@
 #include "Elf_Details.h"
+#include "Elf_Batch.h"
+#include "Elf_Cache.h"
+#include "Elf_Dedup.h"
+#include "Elf_Digest.h"
+#include "Elf_Dynamic.h"
+#include "Elf_Json.h"
+#include "Elf_Note.h"
+#include "Elf_Output.h"
+#include "Elf_Record.h"
 #include <errno.h>
+#include <inttypes.h>	// Print uint64_t variables
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>		// getopt()
 
 #ifndef NULL
 #define NULL ((void*)0)
@@ -11,6 +22,22 @@
 
 size_t file_len(FILE* openFile);
 size_t print_it(char* buff, size_t size);
+void print_usage(char* progName);
+void print_batch_result(const struct Elf_Batch_Result* result, void* userData);
+void print_batch_json(const struct Elf_Batch_Result* result, void* userData);
+void print_batch_record(const struct Elf_Batch_Result* result, void* userData);
+void print_batch_digests(const struct Elf_Batch_Result* result, void* userData);
+void index_batch_file(const struct Elf_Batch_Result* result, void* userData);
+void print_batch_build_id(const struct Elf_Batch_Result* result, void* userData);
+void add_batch_dependencies(const struct Elf_Batch_Result* result, void* userData);
+int query_dedup_index(const char* indexName, char** queryArgs, int numArgs);
+
+// userData of index_batch_file()
+struct Dedup_Job
+{
+	struct Elf_Dedup_Builder* builder;	// Index being built
+	const char* selection;				// Regions to hash (see: Elf_Digest.h)
+};
 
 
 int main(int argc, char *argv[])
@@ -22,36 +49,764 @@ int main(int argc, char *argv[])
 	// char* elfGuts = NULL;
 	// char* tmpPtr = NULL;
 	struct Elf_Details* elvenCharSheet = NULL;
+	int headerOnly = FALSE;						// -H: Only read/print the ELF header
+	int zeroPolicy = ZEROIZE_POLICY;			// -Z: Zeroization policy
+	char* symAddrStr = NULL;					// -A: Address to resolve to a symbol
+	uint64_t symAddr = 0;						// symAddrStr converted
+	uint64_t symOffset = 0;						// Offset of symAddr into its symbol
+	char* endPtr = NULL;						// Set by strtoull()
+	struct Elf_Symbol_Table* symTable = NULL;	// Symbols used to resolve symAddr
+	const struct Elf_Symbol* symbol = NULL;		// Symbol that contains symAddr
+	int batchMode = FALSE;						// -B: Scan every file under the given paths
+	int jsonMode = FALSE;						// -j: Print JSON Lines records
+	int recordMode = FALSE;						// -b: Print binary records (see: Elf_Record.h)
+	char* digestSelection = NULL;				// -D: Regions to hash (see: Elf_Digest.h)
+	struct Elf_Digest_List* digestList = NULL;	// Hashes of digestSelection
+	Elf_Batch_Callback batchCallback = print_batch_result;	// Prints each batch mode record
+	int errNum = 0;								// errno from reading the ELF file
+	struct Elf_Context elvenContext;			// Quiet context for machine-readable output (see: read_elf_ctx())
+	struct Elf_Batch_Options batchOpts = { 0 };	// -T, -f, and -C
+	struct Elf_Batch_Stats batchStats = { 0 };	// Totals reported by scan_elf_batch()
+	char* cacheName = NULL;						// -C: Batch mode cache file (see: Elf_Cache.h)
+	char* indexName = NULL;						// -I: Batch mode duplicate index to build (see: Elf_Dedup.h)
+	char* queryName = NULL;						// -Q: Duplicate index to query
+	struct Dedup_Job dedupJob = { NULL, NULL };	// userData for index_batch_file()
+	void* batchUserData = NULL;					// userData for batchCallback
+	int buildIdMode = FALSE;					// -N: Print the GNU build ID (see: Elf_Note.h)
+	struct Elf_Build_Id buildId;				// Found by read_elf_build_id()
+	int dynamicMode = FALSE;					// -L: Print the dynamic section or dependency graph (see: Elf_Dynamic.h)
+	struct Elf_Dynamic_Info dynInfo;			// Found by read_elf_dynamic()
+	struct Elf_Dep_Graph* depGraph = NULL;		// Batch mode dependency graph
+	size_t numUnresolved = 0;					// Returned by resolve_dep_graph()
+	const struct Elf_Dep_Node* depNodes = NULL;	// Nodes of depGraph
+	const struct Elf_Dep_Edge* depEdges = NULL;	// Edges of depGraph
+	size_t numDepNodes = 0;						// Number of entries in depNodes
+	int tmpRetVal = ERROR_SUCCESS;				// Holds close_elf_cache() return value
+	int opt = 0;								// Holds return value from getopt()
 
 	/* 2. INPUT VALIDATTION */
-	if (argc != 2)
+	while ((opt = getopt(argc, argv, "A:BC:D:HI:LNQ:T:Z:bf:j")) != -1)
+	{
+		switch (opt)
+		{
+			case 'A':
+				symAddrStr = optarg;
+				errno = 0;
+				symAddr = strtoull(symAddrStr, &endPtr, 0);
+				if (errno || endPtr == symAddrStr || *endPtr != '\0')
+				{
+					print_usage(argv[0]);
+					return ERROR_BAD_ARG;
+				}
+				break;
+			case 'B':
+				batchMode = TRUE;
+				break;
+			case 'C':
+				cacheName = optarg;
+				break;
+			case 'D':
+				digestSelection = optarg;
+				break;
+			case 'H':
+				headerOnly = TRUE;
+				break;
+			case 'I':
+				indexName = optarg;
+				break;
+			case 'L':
+				dynamicMode = TRUE;
+				break;
+			case 'N':
+				buildIdMode = TRUE;
+				break;
+			case 'Q':
+				queryName = optarg;
+				break;
+			case 'T':
+				batchOpts.numWorkers = atoi(optarg);
+				if (batchOpts.numWorkers < 1 || batchOpts.numWorkers > BATCH_MAX_WORKERS)
+				{
+					print_usage(argv[0]);
+					return ERROR_BAD_ARG;
+				}
+				break;
+			case 'f':
+				batchOpts.listName = optarg;
+				break;
+			case 'b':
+				recordMode = TRUE;
+				break;
+			case 'j':
+				jsonMode = TRUE;
+				break;
+			case 'Z':
+				if (!strcmp(optarg, "always"))
+				{
+					zeroPolicy = ZEROIZE_ALWAYS;
+				}
+				else if (!strcmp(optarg, "never"))
+				{
+					zeroPolicy = ZEROIZE_NEVER;
+				}
+				else if (!strcmp(optarg, "sensitive"))
+				{
+					zeroPolicy = ZEROIZE_SENSITIVE;
+				}
+				else
+				{
+					print_usage(argv[0]);
+					return ERROR_BAD_ARG;
+				}
+				break;
+			default:
+				print_usage(argv[0]);
+				return ERROR_BAD_ARG;
+		}
+	}
+
+	if (queryName)
+	{
+		if (batchMode == TRUE || indexName || digestSelection || jsonMode == TRUE || recordMode == TRUE \
+			|| headerOnly == TRUE || symAddrStr || cacheName || (argc - optind != 0 && argc - optind != 2))
+		{
+			printf("Query (-Q) takes an index and, optionally, a region and a hash\n");
+			print_usage(argv[0]);
+			return ERROR_BAD_ARG;
+		}
+		return query_dedup_index(queryName, argv + optind, argc - optind);
+	}
+	else if (buildIdMode == TRUE && (jsonMode == TRUE || recordMode == TRUE || digestSelection || symAddrStr \
+		|| headerOnly == TRUE || cacheName || indexName))
+	{
+		printf("Build IDs (-N) are read on their own, so -N can't be combined with other output options\n");
+		print_usage(argv[0]);
+		return ERROR_BAD_ARG;
+	}
+	else if (dynamicMode == TRUE && (jsonMode == TRUE || recordMode == TRUE || digestSelection || symAddrStr \
+		|| headerOnly == TRUE || cacheName || indexName || buildIdMode == TRUE))
+	{
+		// -H and -C don't keep the dynamic section around
+		printf("Dependencies (-L) print their own records, so -L can't be combined with other output options\n");
+		print_usage(argv[0]);
+		return ERROR_BAD_ARG;
+	}
+	else if (indexName && (batchMode != TRUE || jsonMode == TRUE || recordMode == TRUE \
+		|| headerOnly == TRUE || cacheName))
+	{
+		// The index hashes file contents, which -H and -C don't keep
+		printf("Indexing (-I) is batch mode (-B) only and can't be used with -j, -b, -H, or -C\n");
+		print_usage(argv[0]);
+		return ERROR_BAD_ARG;
+	}
+	else if (jsonMode == TRUE && recordMode == TRUE)
+	{
+		printf("Choose either JSON (-j) or binary (-b) records\n");
+		print_usage(argv[0]);
+		return ERROR_BAD_ARG;
+	}
+	else if (digestSelection && (jsonMode == TRUE || recordMode == TRUE || symAddrStr))
+	{
+		printf("Hashing (-D) prints its own records\n");
+		print_usage(argv[0]);
+		return ERROR_BAD_ARG;
+	}
+	else if (digestSelection && (headerOnly == TRUE || cacheName))
+	{
+		// Neither keeps the file contents around to hash
+		printf("Hashing (-D) needs the whole file, so it can't be used with -H or -C\n");
+		print_usage(argv[0]);
+		return ERROR_BAD_ARG;
+	}
+	else if (cacheName && batchMode != TRUE)
+	{
+		printf("The cache (-C) is only used in batch mode (-B)\n");
+		print_usage(argv[0]);
+		return ERROR_BAD_ARG;
+	}
+	else if (batchMode == TRUE)
+	{
+		if (argc - optind < 1 && !batchOpts.listName)
+		{
+			printf("Batch mode needs at least one path or a list file\n");
+			print_usage(argv[0]);
+			return ERROR_BAD_ARG;
+		}
+	}
+	else if (argc - optind != 1)
 	{
 		printf("Invalid number of arguments: %d\n", argc);
+		print_usage(argv[0]);
 		return ERROR_BAD_ARG;
 	}
-	else if (argv[1] == NULL)
+	else if (argv[optind] == NULL)
 	{
 		return ERROR_NULL_PTR;
 	}
-	else if (strlen(argv[1]) == 0)
+	else if (strlen(argv[optind]) == 0)
 	{
 		return ERROR_BAD_ARG;
 	}
 
 	/* 3. READ ELF FILE */
-	elvenCharSheet = read_elf(argv[1]);
+	set_zeroize_policy(zeroPolicy);
+	// One record per file, parsed on a pool of worker threads
+	if (batchMode == TRUE)
+	{
+		batchOpts.headerOnly = headerOnly;
+		if (buildIdMode == TRUE)
+		{
+			// Only the magic number is checked so the callback reads just the pages it needs
+			batchOpts.skipParse = TRUE;
+			batchCallback = print_batch_build_id;
+		}
+		else if (dynamicMode == TRUE)
+		{
+			depGraph = create_dep_graph();
+			if (!depGraph)
+			{
+				fprintf(stderr, "Unable to start the dependency graph: %s\n", strerror(errno));
+				return ERROR_NULL_PTR;
+			}
+			batchCallback = add_batch_dependencies;
+			batchUserData = depGraph;
+		}
+		else if (jsonMode == TRUE)
+		{
+			batchCallback = print_batch_json;
+		}
+		else if (recordMode == TRUE)
+		{
+			batchCallback = print_batch_record;
+		}
+		else if (indexName)
+		{
+			dedupJob.selection = digestSelection ? digestSelection : DEDUP_DEFAULT_REGIONS;
+			dedupJob.builder = create_dedup_builder(indexName, 0);
+			if (!dedupJob.builder)
+			{
+				fprintf(stderr, "Unable to start index %s: %s\n", indexName, strerror(errno));
+				return ERROR_BAD_ARG;
+			}
+			batchCallback = index_batch_file;
+			batchUserData = &dedupJob;
+		}
+		else if (digestSelection)
+		{
+			batchCallback = print_batch_digests;
+			batchUserData = digestSelection;
+		}
+		if (cacheName)
+		{
+			batchOpts.cache = open_elf_cache(cacheName);
+			if (!batchOpts.cache)
+			{
+				fprintf(stderr, "Unable to open cache %s: %s\n", cacheName, strerror(errno));
+				return ERROR_BAD_ARG;
+			}
+		}
+		retVal = scan_elf_batch(argv + optind, argc - optind, &batchOpts, batchCallback, batchUserData, &batchStats);
+		fprintf(stderr, "Scanned %zu files: %zu ELF files, %zu unreadable\n", \
+			batchStats.numFiles, batchStats.numElves, batchStats.numErrors);
+		if (batchOpts.cache)
+		{
+			fprintf(stderr, "Cache answered %zu of %zu files\n", batchStats.numCached, batchStats.numFiles);
+			tmpRetVal = close_elf_cache(&(batchOpts.cache));
+			if (retVal == ERROR_SUCCESS)
+			{
+				retVal = tmpRetVal;
+			}
+		}
+		if (depGraph)
+		{
+			// Every file is in so each DT_NEEDED entry is one lookup
+			numUnresolved = resolve_dep_graph(depGraph);
+			format_dep_graph(get_thread_output(stdout), depGraph);
+			flush_elf_output(get_thread_output(stdout));
+			get_dep_graph(depGraph, &depNodes, &numDepNodes, &depEdges);
+			fprintf(stderr, "Dependency graph: %zu dynamic files, %zu dependencies unresolved\n", \
+				numDepNodes, numUnresolved);
+			kill_dep_graph(&depGraph);
+		}
+		if (dedupJob.builder)
+		{
+			tmpRetVal = finish_dedup_builder(&(dedupJob.builder));
+			if (tmpRetVal != ERROR_SUCCESS)
+			{
+				fprintf(stderr, "Unable to write index %s\n", indexName);
+			}
+			if (retVal == ERROR_SUCCESS)
+			{
+				retVal = tmpRetVal;
+			}
+		}
+		return retVal;
+	}
+
+	// Positioned reads of the notes only, nothing else is parsed
+	if (buildIdMode == TRUE)
+	{
+		retVal = read_elf_build_id(argv[optind], &buildId);
+		if (retVal == ERROR_SUCCESS || retVal == NOTE_NOT_FOUND)
+		{
+			format_elf_build_id(get_thread_output(stdout), argv[optind], &buildId);
+			flush_elf_output(get_thread_output(stdout));
+			retVal = ERROR_SUCCESS;
+		}
+		else
+		{
+			fprintf(stderr, "Unable to read the build ID of %s: %s\n", argv[optind], \
+				retVal == ERROR_BAD_ARG ? strerror(errno) : "not a valid ELF file");
+			errno = 0;
+		}
+		return retVal;
+	}
+
+	// Everything the struct owns comes from one arena
+	if (jsonMode == TRUE || recordMode == TRUE)
+	{
+		// Nothing but records may reach stdout so the failure is reported in the record instead
+		init_elf_context(&elvenContext);
+		elvenContext.headerOnly = headerOnly;
+		tmpRetVal = read_elf_ctx(&elvenContext, argv[optind], &elvenCharSheet);
+		errNum = elvenContext.errnum;
+	}
+	else
+	{
+		elvenCharSheet = read_elf_arena(argv[optind], headerOnly);
+		tmpRetVal = ERROR_NULL_PTR;
+		errNum = errno;
+	}
 	if (!elvenCharSheet)
 	{
-		PERROR(errno);
+		if (jsonMode == TRUE || recordMode == TRUE)
+		{
+			if (jsonMode == TRUE)
+			{
+				format_json_unparsed(get_thread_output(stdout), argv[optind], errNum);
+			}
+			else
+			{
+				format_record_unparsed(get_thread_output(stdout), argv[optind], errNum);
+			}
+			flush_elf_output(get_thread_output(stdout));
+			// A file that isn't an ELF file still got its "not_elf" record
+			return tmpRetVal == ERROR_ORC_FILE ? ERROR_SUCCESS : ERROR_NULL_PTR;
+		}
+		PERROR(errNum);
 		return ERROR_NULL_PTR;
 	}
 
 	/* 4. PRINT ELF FILE DETAILS */
-	print_elf_details(elvenCharSheet, PRINT_EVERYTHING, stdout);
+	if (dynamicMode == TRUE)
+	{
+		tmpRetVal = read_elf_dynamic(elvenCharSheet, &dynInfo);
+		if (tmpRetVal == ERROR_SUCCESS)
+		{
+			format_elf_dynamic(get_thread_output(stdout), argv[optind], &dynInfo);
+			flush_elf_output(get_thread_output(stdout));
+		}
+		else if (tmpRetVal == DYNAMIC_NOT_FOUND)
+		{
+			fprintf(stderr, "%s has no dynamic section\n", argv[optind]);
+		}
+		else
+		{
+			fprintf(stderr, "Unable to read the dynamic section of %s\n", argv[optind]);
+		}
+		free_dynamic_info(&dynInfo);
+	}
+	else if (symAddrStr && headerOnly != TRUE)
+	{
+		symTable = read_elf_symbols(elvenCharSheet);
+		symbol = find_symbol_by_addr(symTable, symAddr, &symOffset);
+		if (symbol)
+		{
+			printf("0x%" PRIx64 ":\t%s+0x%" PRIx64 "\n", symAddr, symbol->symName, symOffset);
+		}
+		else
+		{
+			printf("0x%" PRIx64 ":\t??\n", symAddr);
+		}
+		if (symTable)
+		{
+			kill_symbol_table(&symTable);
+		}
+	}
+	else if (digestSelection)
+	{
+		// Hashed straight out of the contents read_elf_arena() already holds
+		digestList = digest_elf_contents(elvenCharSheet, digestSelection, DIGEST_ALL);
+		if (digestList)
+		{
+			format_elf_digests(get_thread_output(stdout), argv[optind], digestList);
+			flush_elf_output(get_thread_output(stdout));
+			kill_digest_list(&digestList);
+		}
+		else
+		{
+			fprintf(stderr, "Unable to hash %s: %s\n", argv[optind], strerror(errno));
+		}
+	}
+	else if (jsonMode == TRUE)
+	{
+		print_elf_json(elvenCharSheet, stdout);
+	}
+	else if (recordMode == TRUE)
+	{
+		format_elf_record(get_thread_output(stdout), elvenCharSheet);
+		flush_elf_output(get_thread_output(stdout));
+	}
+	else if (headerOnly == TRUE)
+	{
+		print_elf_details(elvenCharSheet, PRINT_ELF_HEADER, stdout);
+	}
+	else
+	{
+		print_elf_details(elvenCharSheet, PRINT_EVERYTHING, stdout);
+	}
 
 	/* 5. CLEAN UP */
 	// FREE Elf_Details STRUCT
-	retVal = kill_elf(&elvenCharSheet);
+	retVal = kill_elf_mapped(&elvenCharSheet);
+
+	return retVal;
+}
+
+
+// Purpose:	Print command line usage
+// Input:	Name of this program
+// Output:	None
+void print_usage(char* progName)
+{
+	fprintf(stderr, "Usage: %s [-H] [-j|-b|-D regions] [-A address] [-Z always|never|sensitive] <ELF file>\n", progName);
+	fprintf(stderr, "       %s -B [-H] [-j|-b|-D regions] [-T threads] [-f list] [-C cache] [-Z always|never|sensitive] [path...]\n", progName);
+	fprintf(stderr, "       %s -B -I index [-D regions] [-T threads] [-f list] [path...]\n", progName);
+	fprintf(stderr, "       %s -Q index [region hash]\n", progName);
+	fprintf(stderr, "       %s [-B] -N [-T threads] [-f list] [path...]\n", progName);
+	fprintf(stderr, "       %s [-B] -L [-T threads] [-f list] [path...]\n", progName);
+	fprintf(stderr, "\t-B\tBatch mode: print one record per file found under each path\n");
+	fprintf(stderr, "\t-T\tNumber of batch worker threads (default: one per core)\n");
+	fprintf(stderr, "\t-f\tFile listing one path per line (\"-\" for stdin)\n");
+	fprintf(stderr, "\t-C\tCache file: unchanged files are answered from it without being read\n");
+	fprintf(stderr, "\t-I\tBuild a duplicate index of each region (default: %s)\n", DEDUP_DEFAULT_REGIONS);
+	fprintf(stderr, "\t-L\tPrint each DT_NEEDED, SONAME, RPATH, RUNPATH, and FLAGS entry.  With -B, print\n");
+	fprintf(stderr, "\t\teach dependency resolved to a scanned file (\"-\" if none was scanned)\n");
+	fprintf(stderr, "\t-N\tPrint the GNU build ID of each file, reading only the pages that hold the notes\n");
+	fprintf(stderr, "\t-Q\tPrint the files with a region of the given XXH64, or every duplicate group\n");
+	fprintf(stderr, "\t-A\tOnly resolve address to symbol+offset\n");
+	fprintf(stderr, "\t-H\tOnly read and print the ELF header\n");
+	fprintf(stderr, "\t-j\tPrint one JSON object per file (JSON Lines)\n");
+	fprintf(stderr, "\t-b\tPrint one binary record per file (see: Elf_Record.h)\n");
+	fprintf(stderr, "\t-D\tPrint XXH64 and SHA-256 of each region (e.g., load,.text,file,sections)\n");
+	fprintf(stderr, "\t-Z\tWhen to zeroize memory before it is free()'d (default: always)\n");
+
+	return;
+}
+
+
+// Purpose:	Print one batch mode record
+// Input:
+//			result - Result for one file (see: scan_elf_batch())
+//			userData - Unused
+// Output:	None
+// Note:
+//			Runs on a worker thread so each record is written under the stdout lock
+//			Tab separated: path, status, then class, endianness, type, and ISA for ELF files
+void print_batch_result(const struct Elf_Batch_Result* result, void* userData)
+{
+	const struct Elf_Details* elven = result->elven;
+
+	(void)userData;
+	flockfile(stdout);
+	if (result->status == ERROR_SUCCESS && elven)
+	{
+		fprintf(stdout, "%s\tELF\t%s\t%s\t%s\t%s\n", result->fileName, \
+			elven->elfClass ? elven->elfClass : "?", elven->endianness ? elven->endianness : "?", \
+			elven->type ? elven->type : "?", elven->ISA ? elven->ISA : "?");
+	}
+	else if (result->errnum)
+	{
+		fprintf(stdout, "%s\tERROR\t%s\n", result->fileName, strerror(result->errnum));
+	}
+	else
+	{
+		fprintf(stdout, "%s\tNOT ELF\n", result->fileName);
+	}
+	funlockfile(stdout);
+
+	return;
+}
+
+
+// Purpose:	Print one batch mode record as JSON Lines
+// Input:
+//			result - Result for one file (see: scan_elf_batch())
+//			userData - Unused
+// Output:	None
+// Note:
+//			Runs on a worker thread.  Each record is formatted into that thread's buffer and
+//				written under the stdout lock so records never interleave.
+//			See: Elf_Json.h for the record layout
+void print_batch_json(const struct Elf_Batch_Result* result, void* userData)
+{
+	struct Elf_Output* output = get_thread_output(stdout);
+
+	(void)userData;
+	flockfile(stdout);
+	if (result->status == ERROR_SUCCESS && result->elven)
+	{
+		format_elf_json(output, result->elven);
+	}
+	else
+	{
+		format_json_unparsed(output, result->fileName, result->errnum);
+	}
+	flush_elf_output(output);
+	funlockfile(stdout);
+
+	return;
+}
+
+
+// Purpose:	Print one batch mode record in the binary record format
+// Input:
+//			result - Result for one file (see: scan_elf_batch())
+//			userData - Unused
+// Output:	None
+// Note:	Written under the stdout lock, like print_batch_json()
+void print_batch_record(const struct Elf_Batch_Result* result, void* userData)
+{
+	struct Elf_Output* output = get_thread_output(stdout);
+
+	(void)userData;
+	flockfile(stdout);
+	if (result->status == ERROR_SUCCESS && result->elven)
+	{
+		format_elf_record(output, result->elven);
+	}
+	else
+	{
+		format_record_unparsed(output, result->fileName, result->errnum);
+	}
+	flush_elf_output(output);
+	funlockfile(stdout);
+
+	return;
+}
+
+
+// Purpose:	Print the digests of one batch mode file
+// Input:
+//			result - Result for one file (see: scan_elf_batch())
+//			userData - Regions to hash (see: Elf_Digest.h)
+// Output:	None
+// Note:
+//			Runs on a worker thread so files are hashed in parallel, while their contents
+//				are still mapped from parsing.  Only the output is written under the stdout lock.
+//			Files that aren't ELF files print nothing
+void print_batch_digests(const struct Elf_Batch_Result* result, void* userData)
+{
+	struct Elf_Output* output = get_thread_output(stdout);
+	struct Elf_Digest_List* digestList = NULL;
+
+	if (result->status != ERROR_SUCCESS || !result->elven)
+	{
+		return;
+	}
+
+	digestList = digest_elf_contents(result->elven, (const char*)userData, DIGEST_ALL);
+	if (!digestList)
+	{
+		fprintf(stderr, "Unable to hash %s: %s\n", result->fileName, strerror(errno));
+		return;
+	}
+	flockfile(stdout);
+	format_elf_digests(output, result->fileName, digestList);
+	flush_elf_output(output);
+	funlockfile(stdout);
+	kill_digest_list(&digestList);
+
+	return;
+}
+
+
+// Purpose:	Add the regions of one batch mode file to a duplicate index
+// Input:
+//			result - Result for one file (see: scan_elf_batch())
+//			userData - Struct Dedup_Job
+// Output:	None
+// Note:
+//			Runs on a worker thread so files are hashed in parallel.  add_dedup_file() takes
+//				its own lock.
+//			Files that aren't ELF files are left out
+void index_batch_file(const struct Elf_Batch_Result* result, void* userData)
+{
+	struct Dedup_Job* dedupJob = (struct Dedup_Job*)userData;
+	struct Elf_Digest_List* digestList = NULL;
+
+	if (result->status != ERROR_SUCCESS || !result->elven)
+	{
+		return;
+	}
+
+	digestList = digest_elf_contents(result->elven, dedupJob->selection, DIGEST_XXH64);
+	if (!digestList)
+	{
+		fprintf(stderr, "Unable to hash %s: %s\n", result->fileName, strerror(errno));
+		return;
+	}
+	if (add_dedup_file(dedupJob->builder, result->fileName, digestList) != ERROR_SUCCESS)
+	{
+		fprintf(stderr, "Unable to index %s\n", result->fileName);
+	}
+	kill_digest_list(&digestList);
+
+	return;
+}
+
+
+// Purpose:	Answer a duplicate index query
+// Input:
+//			indexName - Index built with -I
+//			queryArgs - Region name and XXH64, or nothing
+//			numArgs - Number of entries in queryArgs (0 or 2)
+// Output:	ERROR_* as specified in Elf_Details.h
+// Note:
+//			With a region and hash, prints "size<TAB>path" for each file that has it
+//			Otherwise prints every group as "region<TAB>hash<TAB>size<TAB>count" followed by
+//				one "<TAB>path" line per member
+int query_dedup_index(const char* indexName, char** queryArgs, int numArgs)
+{
+	/* LOCAL VARIABLES */
+	int retVal = ERROR_SUCCESS;
+	struct Elf_Dedup_Index index;				// Mapped indexName
+	const struct Elf_Dedup_Entry* entry = NULL;	// Entry being printed
+	uint64_t hash = 0;			// queryArgs[1] converted
+	char* endPtr = NULL;		// Set by strtoull()
+	size_t cursor = 0;			// next_dedup_group() position
+	size_t first = 0;			// First entry of a match
+	size_t count = 0;			// Number of entries in a match
+	size_t i = 0;				// Iterating variable
+
+	/* INPUT VALIDATION */
+	if (numArgs == 2)
+	{
+		errno = 0;
+		hash = strtoull(queryArgs[1], &endPtr, 16);
+		if (errno || endPtr == queryArgs[1] || *endPtr != '\0')
+		{
+			printf("Invalid hash: %s\n", queryArgs[1]);
+			errno = 0;
+			return ERROR_BAD_ARG;
+		}
+	}
+
+	/* OPEN IT */
+	retVal = open_dedup_index(&index, indexName);
+	if (retVal != ERROR_SUCCESS)
+	{
+		fprintf(stderr, "Unable to open index %s: %s\n", indexName, \
+			retVal == ERROR_BAD_ARG ? strerror(errno) : "not a valid index");
+		errno = 0;
+		return retVal;
+	}
+
+	/* ASK IT */
+	if (numArgs == 2)
+	{
+		retVal = find_dedup_hash(&index, queryArgs[0], hash, &first, &count);
+		for (i = first; retVal == ERROR_SUCCESS && i < first + count; i++)
+		{
+			entry = index.entries + i;
+			printf("%" PRIu64 "\t%s\n", entry->size, get_dedup_file(&index, entry->fileId));
+		}
+	}
+	else
+	{
+		while ((retVal = next_dedup_group(&index, &cursor, &first, &count)) == ERROR_SUCCESS)
+		{
+			entry = index.entries + first;
+			printf("%s\t0x%016" PRIx64 "\t%" PRIu64 "\t%zu\n", get_dedup_region(&index, entry->regionId), \
+				entry->hash, entry->size, count);
+			for (i = first; i < first + count; i++)
+			{
+				printf("\t%s\n", get_dedup_file(&index, index.entries[i].fileId));
+			}
+		}
+		if (retVal == DEDUP_END)
+		{
+			retVal = ERROR_SUCCESS;
+		}
+	}
+
+	/* CLEAN UP */
+	close_dedup_index(&index);
 
 	return retVal;
 }
+
+
+// Purpose:	Print the build ID of one batch mode file
+// Input:
+//			result - Result for one file (see: scan_elf_batch())
+//			userData - Unused
+// Output:	None
+// Note:
+//			Runs on a worker thread.  The file was only checked for the magic number
+//				(Elf_Batch_Options.skipParse) so this is the only other read.
+//			Files that aren't ELF files print nothing
+void print_batch_build_id(const struct Elf_Batch_Result* result, void* userData)
+{
+	struct Elf_Output* output = get_thread_output(stdout);
+	struct Elf_Build_Id buildId;
+	int tmpRetVal = ERROR_SUCCESS;
+
+	(void)userData;
+	if (result->status != ERROR_SUCCESS)
+	{
+		return;
+	}
+
+	tmpRetVal = read_elf_build_id(result->fileName, &buildId);
+	if (tmpRetVal != ERROR_SUCCESS && tmpRetVal != NOTE_NOT_FOUND)
+	{
+		// Starts with the magic number but isn't really an ELF file, or vanished
+		return;
+	}
+	flockfile(stdout);
+	format_elf_build_id(output, result->fileName, &buildId);
+	flush_elf_output(output);
+	funlockfile(stdout);
+
+	return;
+}
+
+
+// Purpose:	Add one batch mode file to the dependency graph
+// Input:
+//			result - Result for one file (see: scan_elf_batch())
+//			userData - struct Elf_Dep_Graph* to add to
+// Output:	None
+// Note:
+//			Runs on a worker thread (add_dep_node() is thread-safe)
+//			Files without a dynamic section are left out
+void add_batch_dependencies(const struct Elf_Batch_Result* result, void* userData)
+{
+	struct Elf_Dep_Graph* depGraph = (struct Elf_Dep_Graph*)userData;
+	struct Elf_Dynamic_Info dynInfo;
+
+	if (result->status != ERROR_SUCCESS || !result->elven)
+	{
+		return;
+	}
+
+	if (read_elf_dynamic(result->elven, &dynInfo) == ERROR_SUCCESS \
+		&& add_dep_node(depGraph, result->fileName, result->elven, &dynInfo) != ERROR_SUCCESS)
+	{
+		fprintf(stderr, "Unable to add %s to the dependency graph\n", result->fileName);
+	}
+	free_dynamic_info(&dynInfo);
+
+	return;
+}
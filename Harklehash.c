@@ -37,7 +37,7 @@ struct HarkleDict* lookup_name(struct HarkleDict* headNode, char* needle)
             }
 
             retVal = retVal->next;
-        } while(retVal->next);
+        } while(retVal);
     }
     
     return NULL;  // Didn't find it
@@ -63,7 +63,7 @@ struct HarkleDict* lookup_hash(struct HarkleDict* headNode, unsigned int needle)
             }
 
             retVal = retVal->next;
-        } while(retVal->next);
+        } while(retVal);
     }
 
     return NULL;  // Didn't find it
@@ -106,9 +106,11 @@ struct HarkleDict* lookup_value(struct HarkleDict* headNode, int needle)
 // Note:    
 //          Insert at the end
 //          If this is the first node in the linked list, headNode can be blank
+//          O(1) when called with the head node: the tail is cached in headNode->tail
 struct HarkleDict* add_entry(struct HarkleDict* headNode, char* name, int value)
 {
     struct HarkleDict* retVal = NULL;
+    struct HarkleDict* tailNode = NULL;    // Node to append after
 
     /* Input Validation */
     if (name)
@@ -121,7 +123,10 @@ struct HarkleDict* add_entry(struct HarkleDict* headNode, char* name, int value)
         {
             if (headNode)
             {
-                find_last_node(headNode)->next = retVal;
+                // Lists only grow at the end so a stale tail is still a shortcut
+                tailNode = find_last_node(headNode->tail ? headNode->tail : headNode);
+                tailNode->next = retVal;
+                headNode->tail = retVal;
                 retVal = headNode;
             }
         }
@@ -250,6 +255,7 @@ int destroy_a_node(struct HarkleDict** node_ptr)
 
                 /* Clear Value */
                 (*node_ptr)->value = 0;
+                (*node_ptr)->tail = NULL;
 
                 /* Free Struct Memory */
                 free(*node_ptr);
@@ -284,3 +290,369 @@ struct HarkleDict* find_last_node(struct HarkleDict* node)
 
     return retVal;
 }
+
+
+// Purpose: Hash an input string without folding it into HASHSIZE buckets
+// Input:   Hash input
+// Output:  32-bit FNV-1a hash as unsigned int
+unsigned int full_hash(char* input)
+{
+    unsigned int retVal = 2166136261U;  // FNV offset basis
+
+    for (; *input != '\0'; input++)
+    {
+        retVal ^= (unsigned char)*input;
+        retVal *= 16777619U;  // FNV prime
+    }
+
+    return retVal;
+}
+
+
+// Purpose: Hash an input string the way .gnu.hash sections do
+// Input:   Symbol name
+// Output:  32-bit DJB hash (h * 33 + c) as unsigned int
+unsigned int gnu_hash(char* input)
+{
+    unsigned int retVal = 5381;
+
+    for (; *input != '\0'; input++)
+    {
+        retVal = (retVal << 5) + retVal + (unsigned char)*input;
+    }
+
+    return retVal;
+}
+
+
+// Purpose: Hash an input string the way SysV .hash (DT_HASH) sections do
+// Input:   Symbol name
+// Output:  28-bit ELF hash as unsigned int
+unsigned int sysv_hash(char* input)
+{
+    unsigned int retVal = 0;
+    unsigned int highBits = 0;
+
+    for (; *input != '\0'; input++)
+    {
+        retVal = (retVal << 4) + (unsigned char)*input;
+        highBits = retVal & 0xF0000000U;
+        if (highBits)
+        {
+            retVal ^= highBits >> 24;
+        }
+        retVal &= ~highBits;
+    }
+
+    return retVal;
+}
+
+
+// Purpose: Spread an int value across a HarkleTable index
+// Input:   Lookup value
+// Output:  Hash as unsigned int
+static unsigned int value_hash(int value)
+{
+    return (unsigned int)value * 2654435761U;  // Knuth's multiplicative hash
+}
+
+
+// Purpose: Insert an entry number into one HarkleTable index with linear probing
+// Input:
+//          slots - Index to insert into
+//          numSlots - Size of slots (a power of two)
+//          startSlot - Hash of the entry's key
+//          entryNum - Entry number to store
+// Output:  None
+// Note:    The caller guarantees at least one empty slot
+static void insert_slot(unsigned int* slots, size_t numSlots, unsigned int startSlot, size_t entryNum)
+{
+    size_t i = startSlot & (numSlots - 1);
+
+    while (slots[i])
+    {
+        i = (i + 1) & (numSlots - 1);
+    }
+    slots[i] = (unsigned int)(entryNum + 1);
+
+    return;
+}
+
+
+// Purpose: (Re)build both HarkleTable indices at a given size
+// Input:
+//          table - Table to rebuild
+//          numSlots - New index size (a power of two)
+// Output:  TRUE on success, FALSE on failure (the old indices are left alone)
+// Note:    Entries are reinserted in order so duplicates still find the first one added
+static int rebuild_table_index(struct HarkleTable* table, size_t numSlots)
+{
+    unsigned int* nameSlots = NULL;
+    unsigned int* valueSlots = NULL;
+    size_t i = 0;
+
+    nameSlots = (unsigned int*)calloc(numSlots, sizeof(unsigned int));
+    valueSlots = (unsigned int*)calloc(numSlots, sizeof(unsigned int));
+    if (!nameSlots || !valueSlots)
+    {
+        free(nameSlots);
+        free(valueSlots);
+        return FALSE;
+    }
+
+    for (i = 0; i < table->numEntries; i++)
+    {
+        insert_slot(nameSlots, numSlots, full_hash(table->entries[i].name), i);
+        insert_slot(valueSlots, numSlots, value_hash(table->entries[i].value), i);
+    }
+
+    free(table->nameSlots);
+    free(table->valueSlots);
+    table->nameSlots = nameSlots;
+    table->valueSlots = valueSlots;
+    table->numSlots = numSlots;
+
+    return TRUE;
+}
+
+
+// Purpose: Allocate an empty open addressing HarkleTable
+// Input:
+//          expectedEntries - Number of entries to size the table for (it grows as needed)
+//          copyNames - If TRUE, add_table_entry() copies names.  If FALSE, names are
+//              borrowed and must outlive the table (e.g., strings in a mapped file).
+// Output:  Pointer to the new table, NULL on failure
+// Note:    Caller is responsible for utilizing destroy_a_table() to free this table
+struct HarkleTable* create_a_table(size_t expectedEntries, int copyNames)
+{
+    struct HarkleTable* retVal = NULL;
+    size_t numSlots = HARKLE_TABLE_MIN_SLOTS;
+
+    // Keep the load factor at or below 3/4
+    while (numSlots * 3 < expectedEntries * 4)
+    {
+        numSlots <<= 1;
+    }
+
+    retVal = (struct HarkleTable*)calloc(1, sizeof(struct HarkleTable));
+    if (retVal)
+    {
+        retVal->copyNames = copyNames;
+        retVal->maxEntries = expectedEntries ? expectedEntries : HARKLE_TABLE_MIN_SLOTS;
+        retVal->entries = (struct HarkleDict*)calloc(retVal->maxEntries, sizeof(struct HarkleDict));
+
+        if (!retVal->entries || rebuild_table_index(retVal, numSlots) == FALSE)
+        {
+            free(retVal->entries);
+            free(retVal);
+            retVal = NULL;
+        }
+    }
+
+    return retVal;
+}
+
+
+// Purpose: Add an entry to a HarkleTable
+// Input:
+//          table - Table to add the entry to
+//          name - Name to associate with the entry
+//          value - Value to associate with the entry
+// Output:  Pointer to the new entry, NULL on failure
+// Note:    
+//          Amortized O(1).  Duplicate names and values are allowed and lookups return
+//              the first one added (just like the linked list)
+//          Entry pointers are invalidated by later calls to add_table_entry()
+struct HarkleDict* add_table_entry(struct HarkleTable* table, char* name, int value)
+{
+    struct HarkleDict* retVal = NULL;
+    struct HarkleDict* tmpEntries = NULL;   // Holds realloc() return value
+    size_t stringLength = 0;
+
+    /* Input Validation */
+    if (!table || !name)
+    {
+        return retVal;
+    }
+
+    /* Make Room */
+    if (table->numEntries == table->maxEntries)
+    {
+        tmpEntries = (struct HarkleDict*)realloc(table->entries, table->maxEntries * 2 * sizeof(struct HarkleDict));
+        if (!tmpEntries)
+        {
+            return retVal;
+        }
+        memset(tmpEntries + table->maxEntries, 0, table->maxEntries * sizeof(struct HarkleDict));
+        table->entries = tmpEntries;
+        table->maxEntries *= 2;
+    }
+    if ((table->numEntries + 1) * 4 > table->numSlots * 3)
+    {
+        if (rebuild_table_index(table, table->numSlots * 2) == FALSE)
+        {
+            return retVal;
+        }
+    }
+
+    /* Fill In The Entry */
+    retVal = table->entries + table->numEntries;
+    if (table->copyNames == TRUE)
+    {
+        stringLength = strlen(name);
+        retVal->name = (char*)calloc(stringLength + 1, sizeof(char));
+        if (!retVal->name)
+        {
+            return NULL;
+        }
+        memcpy(retVal->name, name, stringLength);
+    }
+    else
+    {
+        retVal->name = name;
+    }
+    retVal->hash = hash(name);
+    retVal->value = value;
+    retVal->next = NULL;
+
+    /* Index It */
+    insert_slot(table->nameSlots, table->numSlots, full_hash(name), table->numEntries);
+    insert_slot(table->valueSlots, table->numSlots, value_hash(value), table->numEntries);
+    table->numEntries++;
+
+    return retVal;
+}
+
+
+// Purpose: Find the entry associated with a given name
+// Input:   
+//          table - Table to search
+//          needle - String to find in the table
+// Output:  Pointer to the entry in question, NULL if not found
+struct HarkleDict* lookup_table_name(struct HarkleTable* table, char* needle)
+{
+    struct HarkleDict* tmpEntry = NULL;
+    unsigned int needleHash = 0;    // hash() of needle used to skip most strcmp() calls
+    size_t i = 0;
+
+    if (table && needle)
+    {
+        needleHash = hash(needle);
+        i = full_hash(needle) & (table->numSlots - 1);
+
+        while (table->nameSlots[i])
+        {
+            tmpEntry = table->entries + table->nameSlots[i] - 1;
+            if (tmpEntry->hash == needleHash && strcmp(needle, tmpEntry->name) == 0)
+            {
+                return tmpEntry;  // Found it
+            }
+            i = (i + 1) & (table->numSlots - 1);
+        }
+    }
+
+    return NULL;  // Didn't find it
+}
+
+
+// Purpose: Find the entry associated with a given hash
+// Input:   
+//          table - Table to search
+//          needle - hash() value to find in the table
+// Output:  Pointer to the entry in question, NULL if not found
+// Note:    hash() values are folded into HASHSIZE buckets so this is a linear scan of
+//              the contiguous entries.  Prefer lookup_table_name().
+struct HarkleDict* lookup_table_hash(struct HarkleTable* table, unsigned int needle)
+{
+    size_t i = 0;
+
+    if (table)
+    {
+        for (i = 0; i < table->numEntries; i++)
+        {
+            if (needle == table->entries[i].hash)
+            {
+                return table->entries + i;  // Found it
+            }
+        }
+    }
+
+    return NULL;  // Didn't find it
+}
+
+
+// Purpose: Find the entry associated with a given value
+// Input:   
+//          table - Table to search
+//          needle - Value to find in the table
+// Output:  Pointer to the entry in question, NULL if not found
+struct HarkleDict* lookup_table_value(struct HarkleTable* table, int needle)
+{
+    struct HarkleDict* tmpEntry = NULL;
+    size_t i = 0;
+
+    if (table)
+    {
+        i = value_hash(needle) & (table->numSlots - 1);
+
+        while (table->valueSlots[i])
+        {
+            tmpEntry = table->entries + table->valueSlots[i] - 1;
+            if (needle == tmpEntry->value)
+            {
+                return tmpEntry;  // Found it
+            }
+            i = (i + 1) & (table->numSlots - 1);
+        }
+    }
+
+    return NULL;  // Didn't find it
+}
+
+
+// Purpose: Zeroizes and deallocates a HarkleTable
+// Input:   Pointer to the table pointer
+// Output:  Number of entries destroyed
+int destroy_a_table(struct HarkleTable** table)
+{
+    int retVal = 0;
+    size_t i = 0;
+
+    if (table)
+    {
+        if (*table)
+        {
+            /* Clear Names */
+            if ((*table)->copyNames == TRUE)
+            {
+                for (i = 0; i < (*table)->numEntries; i++)
+                {
+                    if ((*table)->entries[i].name)
+                    {
+                        memset((*table)->entries[i].name, 0, strlen((*table)->entries[i].name));
+                        free((*table)->entries[i].name);
+                    }
+                }
+            }
+
+            /* Clear Entries And Indices */
+            if ((*table)->entries)
+            {
+                memset((*table)->entries, 0, (*table)->maxEntries * sizeof(struct HarkleDict));
+                free((*table)->entries);
+            }
+            free((*table)->nameSlots);
+            free((*table)->valueSlots);
+            retVal = (int)(*table)->numEntries;
+
+            /* Free Struct Memory */
+            memset(*table, 0, sizeof(struct HarkleTable));
+            free(*table);
+
+            /* Zeroize Pointer */
+            *table = NULL;
+        }
+    }
+
+    return retVal;
+}
@@ -1,11 +1,18 @@
 #ifndef __HARKLEDICT_H__
 #define __HARKLEDICT_H__
 
+#include <stddef.h>     // size_t
+
 /*
  *	USAGE:
  *		Start - add_entry() to build a list
  *		Step - Use lookup_*() functions to find data
  *		Stop - destroy_a_list() to free allocated memory
+ *
+ *	HASH TABLE USAGE (large dictionaries):
+ *		Start - create_a_table() then add_table_entry() to fill it
+ *		Step - Use lookup_table_*() functions to find data
+ *		Stop - destroy_a_table() to free allocated memory
  */
 
 struct HarkleDict 
@@ -14,10 +21,27 @@ struct HarkleDict
     char* name;					// Human readable name
     unsigned int hash; 			// Lookup hash
     int value;					// Lookup value
+    struct HarkleDict* tail;	// Head node only: last node add_entry() appended (NULL otherwise)
 };
 
 #define HASHSIZE 101
 
+// Open addressing hash table of HarkleDict entries
+// Entries live in one contiguous array (their next member is always NULL) and two
+//  index arrays map names and values to entries with linear probing
+struct HarkleTable
+{
+    struct HarkleDict* entries;     // Contiguous entry storage in insertion order
+    size_t numEntries;              // Number of entries in use
+    size_t maxEntries;              // Number of entries allocated
+    unsigned int* nameSlots;        // Name index: entry number + 1 (0 means empty)
+    unsigned int* valueSlots;       // Value index: entry number + 1 (0 means empty)
+    size_t numSlots;                // Size of both indices (always a power of two)
+    int copyNames;                  // If TRUE, entry names are dynamically allocated copies
+};
+
+#define HARKLE_TABLE_MIN_SLOTS ((size_t)16)    // Smallest index created by create_a_table()
+
 #ifndef TRUE
 #define TRUE ((int)1)
 #endif // TRUE
@@ -61,6 +85,7 @@ struct HarkleDict* lookup_value(struct HarkleDict* headNode, int needle);
 // Note:    
 //          Insert at the end
 //          If this is the first node in the linked list, headNode can be blank
+//          O(1) when called with the head node: the tail is cached in headNode->tail
 struct HarkleDict* add_entry(struct HarkleDict* headNode, char* name, int value);
 
 // Purpose: Construct one node from start to finish
@@ -90,4 +115,68 @@ int destroy_a_node(struct HarkleDict** node_ptr);
 // Output:  Pointer to the tail node
 struct HarkleDict* find_last_node(struct HarkleDict* node);
 
+// Purpose: Hash an input string without folding it into HASHSIZE buckets
+// Input:   Hash input
+// Output:  32-bit FNV-1a hash as unsigned int
+unsigned int full_hash(char* input);
+
+// Purpose: Hash an input string the way .gnu.hash sections do
+// Input:   Symbol name
+// Output:  32-bit DJB hash (h * 33 + c) as unsigned int
+unsigned int gnu_hash(char* input);
+
+// Purpose: Hash an input string the way SysV .hash (DT_HASH) sections do
+// Input:   Symbol name
+// Output:  28-bit ELF hash as unsigned int
+unsigned int sysv_hash(char* input);
+
+// Purpose: Allocate an empty open addressing HarkleTable
+// Input:
+//          expectedEntries - Number of entries to size the table for (it grows as needed)
+//          copyNames - If TRUE, add_table_entry() copies names.  If FALSE, names are
+//              borrowed and must outlive the table (e.g., strings in a mapped file).
+// Output:  Pointer to the new table, NULL on failure
+// Note:    Caller is responsible for utilizing destroy_a_table() to free this table
+struct HarkleTable* create_a_table(size_t expectedEntries, int copyNames);
+
+// Purpose: Add an entry to a HarkleTable
+// Input:
+//          table - Table to add the entry to
+//          name - Name to associate with the entry
+//          value - Value to associate with the entry
+// Output:  Pointer to the new entry, NULL on failure
+// Note:    
+//          Amortized O(1).  Duplicate names and values are allowed and lookups return
+//              the first one added (just like the linked list)
+//          Entry pointers are invalidated by later calls to add_table_entry()
+struct HarkleDict* add_table_entry(struct HarkleTable* table, char* name, int value);
+
+// Purpose: Find the entry associated with a given name
+// Input:   
+//          table - Table to search
+//          needle - String to find in the table
+// Output:  Pointer to the entry in question, NULL if not found
+struct HarkleDict* lookup_table_name(struct HarkleTable* table, char* needle);
+
+// Purpose: Find the entry associated with a given hash
+// Input:   
+//          table - Table to search
+//          needle - hash() value to find in the table
+// Output:  Pointer to the entry in question, NULL if not found
+// Note:    hash() values are folded into HASHSIZE buckets so this is a linear scan of
+//              the contiguous entries.  Prefer lookup_table_name().
+struct HarkleDict* lookup_table_hash(struct HarkleTable* table, unsigned int needle);
+
+// Purpose: Find the entry associated with a given value
+// Input:   
+//          table - Table to search
+//          needle - Value to find in the table
+// Output:  Pointer to the entry in question, NULL if not found
+struct HarkleDict* lookup_table_value(struct HarkleTable* table, int needle);
+
+// Purpose: Zeroizes and deallocates a HarkleTable
+// Input:   Pointer to the table pointer
+// Output:  Number of entries destroyed
+int destroy_a_table(struct HarkleTable** table);
+
 #endif // __HARKLEHASH_H__
\ No newline at end of file
@@ -0,0 +1,322 @@
+#include "../Elf_Details.h"
+#include "../Elf_Arena.h"
+#include <stdint.h>		// SIZE_MAX/uintptr_t
+#include <stdio.h>		// I/O
+#include <stdlib.h>		// free()
+#include <string.h>		// memset()
+
+#define PRIMER_SIZE		((size_t)1)		// Allocated before each test so the head has something in it
+#define FILL_CHAR		((unsigned char)0xA5)	// Written to every byte handed out
+#define MAX_BLOCKS		8				// Blocks watched while an arena is destroyed
+
+
+typedef struct eaTest
+{
+	char* testName;
+	size_t blockSize;		// Passed to create_arena()
+	size_t numElem;			// Passed to arena_gimme_mem()
+	size_t sizeElem;		// Passed to arena_gimme_mem()
+	int expectedNull;		// If TRUE, arena_gimme_mem() should fail
+	int expectedHeadKept;	// If TRUE, the primer's block is still the head afterwards
+	int expectedNumBlocks;	// Blocks in the arena afterwards
+	struct eaTest* nextTest;
+} unitTest;
+
+
+typedef struct eaTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+/* SCRUB CHECK */
+// The blocks destroy_arena() is expected to free, and whether each one was scrubbed first
+static struct Elf_Arena_Block* watchedBlocks[MAX_BLOCKS];
+static size_t watchedUsed[MAX_BLOCKS];
+static int watchedScrubbed[MAX_BLOCKS];
+static int numWatched = 0;
+
+void __real_free(void* ptr);
+void __wrap_free(void* ptr);
+static int count_blocks(const struct Elf_Arena* arena);
+static void watch_arena(const struct Elf_Arena* arena);
+
+
+// Linked with -Wl,--wrap=free so the blocks can be inspected before they're released
+void __wrap_free(void* ptr)
+{
+	size_t i = 0;
+	int j = 0;
+
+	for (j = 0; ptr && j < numWatched; j++)
+	{
+		if (ptr == (void*)watchedBlocks[j])
+		{
+			watchedScrubbed[j] = TRUE;
+			for (i = 0; i < watchedUsed[j]; i++)
+			{
+				if (watchedBlocks[j]->data[i] != (unsigned char)ZEROIZE_CHAR)
+				{
+					watchedScrubbed[j] = FALSE;
+					break;
+				}
+			}
+		}
+	}
+
+	__real_free(ptr);
+}
+
+
+static int count_blocks(const struct Elf_Arena* arena)
+{
+	int retVal = 0;
+	const struct Elf_Arena_Block* currBlock = arena ? arena->head : NULL;
+
+	for (; currBlock; currBlock = currBlock->next)
+	{
+		retVal++;
+	}
+
+	return retVal;
+}
+
+
+static void watch_arena(const struct Elf_Arena* arena)
+{
+	struct Elf_Arena_Block* currBlock = arena ? arena->head : NULL;
+
+	for (numWatched = 0; currBlock && numWatched < MAX_BLOCKS; currBlock = currBlock->next)
+	{
+		watchedBlocks[numWatched] = currBlock;
+		watchedUsed[numWatched] = currBlock->used;
+		watchedScrubbed[numWatched] = -1;	// Not freed yet
+		numWatched++;
+	}
+
+	return;
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	struct Elf_Arena* testArena = NULL;	// Arena being tested
+	struct Elf_Arena_Block* primerHead = NULL;	// Head after the primer was allocated
+	int headKept = FALSE;				// If TRUE, testMem didn't replace primerHead
+	int numBlocks = 0;					// Blocks in testArena after testMem
+	unsigned char* primer = NULL;		// First allocation out of testArena
+	unsigned char* testMem = NULL;		// Allocation being tested
+	unsigned char* nextMem = NULL;		// Small allocation after testMem
+	size_t testSize = 0;				// Bytes in testMem
+	size_t i = 0;						// Iterating variable
+	int j = 0;							// Iterating variable
+	int goodMem = FALSE;				// If TRUE, every check of this test passed
+
+	/* UNIT TESTS */
+	// NORMAL
+	//// Normal1 - One byte
+	unitTest Normal1 = { "Normal1", 0, 1, 1, FALSE, TRUE, 1, NULL };
+	//// Normal2 - Unaligned size
+	unitTest Normal2 = { "Normal2", 0, 3, 5, FALSE, TRUE, 1, NULL };
+	//// Normal3 - Too big for any block
+	unitTest Normal3 = { "Normal3", 0, 10, ARENA_BLOCK_SIZE, FALSE, TRUE, 2, NULL };
+	//// Normal4 - Doesn't fit in what's left of a small block
+	unitTest Normal4 = { "Normal4", 64, 1, 64, FALSE, FALSE, 2, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	Normal3.nextTest = &Normal4;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - No elements
+	unitTest Error1 = { "Error1", 0, 0, 1, TRUE, TRUE, 1, NULL };
+	//// Error2 - Empty elements
+	unitTest Error2 = { "Error2", 0, 1, 0, TRUE, TRUE, 1, NULL };
+	//// Error3 - Size overflows
+	unitTest Error3 = { "Error3", 0, SIZE_MAX / 2, 4, TRUE, TRUE, 1, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// BOUNDARY
+	//// Boundary1 - Exactly fills the rest of the head
+	unitTest Boundary1 = { "Boundary1", 0, 1, ARENA_BLOCK_SIZE - ARENA_ALIGNMENT, FALSE, TRUE, 1, NULL };
+	//// Boundary2 - One byte more than the rest of the head, but still fits in a block
+	unitTest Boundary2 = { "Boundary2", 0, 1, ARENA_BLOCK_SIZE - ARENA_ALIGNMENT + 1, FALSE, FALSE, 2, NULL };
+	//// Boundary3 - One byte larger than a block
+	unitTest Boundary3 = { "Boundary3", 0, 1, ARENA_BLOCK_SIZE + 1, FALSE, TRUE, 2, NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	Boundary2.nextTest = &Boundary3;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, &BoundaryUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\t", currTst->testName);
+			numTests++;
+
+			// Allocate it
+			testArena = create_arena(currTst->blockSize);
+			primer = (unsigned char*)arena_gimme_mem(testArena, PRIMER_SIZE, sizeof(unsigned char));
+			primerHead = testArena ? testArena->head : NULL;
+			testMem = (unsigned char*)arena_gimme_mem(testArena, currTst->numElem, currTst->sizeElem);
+			headKept = testArena && testArena->head == primerHead ? TRUE : FALSE;
+			numBlocks = count_blocks(testArena);
+			goodMem = testArena && primer && primerHead && headKept == currTst->expectedHeadKept \
+				&& numBlocks == currTst->expectedNumBlocks ? TRUE : FALSE;
+
+			// Aligned, zeroized, and writable
+			if (goodMem == TRUE && currTst->expectedNull == FALSE)
+			{
+				testSize = currTst->numElem * currTst->sizeElem;
+				goodMem = testMem && !((uintptr_t)testMem % ARENA_ALIGNMENT) ? TRUE : FALSE;
+				for (i = 0; goodMem == TRUE && i < testSize; i++)
+				{
+					goodMem = testMem[i] ? FALSE : TRUE;
+				}
+				if (goodMem == TRUE)
+				{
+					memset(testMem, FILL_CHAR, testSize);
+				}
+			}
+			else if (goodMem == TRUE)
+			{
+				goodMem = testMem ? FALSE : TRUE;
+			}
+
+			// A dedicated block leaves the rest of the head to the next request
+			nextMem = (unsigned char*)arena_gimme_mem(testArena, PRIMER_SIZE, sizeof(unsigned char));
+			if (goodMem == TRUE)
+			{
+				goodMem = nextMem && !((uintptr_t)nextMem % ARENA_ALIGNMENT) ? TRUE : FALSE;
+			}
+			if (goodMem == TRUE && currTst->expectedNumBlocks > 1 && currTst->expectedHeadKept == TRUE)
+			{
+				goodMem = nextMem == primer + ARENA_ALIGNMENT ? TRUE : FALSE;
+			}
+			// Still intact after the follow up allocation
+			for (i = 0; goodMem == TRUE && currTst->expectedNull == FALSE && i < testSize; i++)
+			{
+				goodMem = testMem[i] == FILL_CHAR ? TRUE : FALSE;
+			}
+
+			// Test results
+			if (goodMem == TRUE)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\tExpected:\t%s, head %s, %d block(s)\n", currTst->expectedNull == TRUE ? "NULL" : "memory", \
+					currTst->expectedHeadKept == TRUE ? "kept" : "replaced", currTst->expectedNumBlocks);
+				printf("\t\tReceived:\t%s, head %s, %d block(s)\n", testMem ? "memory" : "NULL", \
+					headKept == TRUE ? "kept" : "replaced", numBlocks);
+			}
+			destroy_arena(&testArena);
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* DESTROY TESTS */
+	printf("Running 'Destroy Tests'...\n");
+	//// Every block is scrubbed before it's freed
+	printf("\tScrubbed:\t");
+	numTests++;
+	set_zeroize_policy(ZEROIZE_ALWAYS);
+	testArena = create_arena(64);
+	goodMem = testArena ? TRUE : FALSE;
+	for (j = 0; goodMem == TRUE && j < 3; j++)
+	{
+		// Two regular blocks and one dedicated block
+		testSize = j == 1 ? 256 : 48;
+		testMem = (unsigned char*)arena_gimme_mem(testArena, testSize, sizeof(unsigned char));
+		goodMem = testMem ? TRUE : FALSE;
+		if (testMem)
+		{
+			memset(testMem, FILL_CHAR, testSize);
+		}
+	}
+	goodMem = goodMem == TRUE && count_blocks(testArena) == 3 ? TRUE : FALSE;
+	watch_arena(testArena);
+	goodMem = destroy_arena(&testArena) == ERROR_SUCCESS && !testArena && goodMem == TRUE ? TRUE : FALSE;
+	for (j = 0; j < numWatched; j++)
+	{
+		goodMem = goodMem == TRUE && watchedScrubbed[j] == TRUE ? TRUE : FALSE;
+	}
+	numWatched = 0;
+	printf("%s\n", goodMem ? "Pass" : "FAIL");
+	numPass += goodMem ? 1 : 0;
+	//// ZEROIZE_NEVER leaves them alone
+	printf("\tNot scrubbed:\t");
+	numTests++;
+	set_zeroize_policy(ZEROIZE_NEVER);
+	testArena = create_arena(0);
+	testMem = (unsigned char*)arena_gimme_mem(testArena, 32, sizeof(unsigned char));
+	goodMem = testMem ? TRUE : FALSE;
+	if (testMem)
+	{
+		memset(testMem, FILL_CHAR, 32);
+	}
+	watch_arena(testArena);
+	goodMem = destroy_arena(&testArena) == ERROR_SUCCESS && goodMem == TRUE && numWatched == 1 \
+		&& watchedScrubbed[0] == FALSE ? TRUE : FALSE;
+	numWatched = 0;
+	set_zeroize_policy(ZEROIZE_POLICY);
+	printf("%s\n", goodMem ? "Pass" : "FAIL");
+	numPass += goodMem ? 1 : 0;
+	//// Nothing to destroy
+	printf("\tNULL arena:\t");
+	numTests++;
+	goodMem = destroy_arena(&testArena) == ERROR_NULL_PTR && destroy_arena(NULL) == ERROR_NULL_PTR ? TRUE : FALSE;
+	printf("%s\n", goodMem ? "Pass" : "FAIL");
+	numPass += goodMem ? 1 : 0;
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
@@ -0,0 +1,296 @@
+#include "../Elf_Details.h"
+#include "../Elf_Batch.h"
+#include <limits.h>		// PATH_MAX
+#include <stdio.h>		// I/O
+#include <stdlib.h>		// mkdtemp
+#include <string.h>		// strlen
+#include <sys/stat.h>	// mkdir
+#include <unistd.h>		// rmdir, unlink
+
+#define TEMP_TEMPLATE	"/tmp/TEST_elf_batch.XXXXXX"
+#define NUM_DIR_FILES	((size_t)5)		// Regular files under the temp directory
+#define NUM_DIR_ELVES	((size_t)3)		// ELF files under the temp directory
+
+
+typedef struct ebTest
+{
+	char* testName;
+	char** inputPaths;		// Paths to scan
+	int numPaths;			// Number of entries in inputPaths
+	int numWorkers;			// Elf_Batch_Options.numWorkers
+	int headerOnly;			// Elf_Batch_Options.headerOnly
+	char* listName;			// Elf_Batch_Options.listName
+	int useCallback;		// If FALSE, pass a NULL callback
+	int expectedReturn;		// scan_elf_batch() return value
+	size_t expectedFiles;	// Elf_Batch_Stats.numFiles (and callback count)
+	size_t expectedElves;	// Elf_Batch_Stats.numElves
+	struct ebTest* nextTest;
+} unitTest;
+
+
+typedef struct ebTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// Purpose:	Count results from every worker thread
+static void count_result(const struct Elf_Batch_Result* result, void* userData)
+{
+	size_t* numResults = (size_t*)userData;
+
+	if (result && result->fileName && (result->status != ERROR_SUCCESS || result->elven))
+	{
+		__atomic_add_fetch(numResults, 1, __ATOMIC_SEQ_CST);
+	}
+
+	return;
+}
+
+
+// Purpose:	Write size bytes of buff to dirName/fileName
+static int write_test_file(const char* dirName, const char* fileName, const void* buff, size_t size)
+{
+	char filePath[PATH_MAX] = { 0 };
+	FILE* outFile = NULL;
+	int retVal = ERROR_SUCCESS;
+
+	snprintf(filePath, sizeof(filePath), "%s/%s", dirName, fileName);
+	outFile = fopen(filePath, "wb");
+	if (!outFile)
+	{
+		return ERROR_BAD_ARG;
+	}
+	if (size && fwrite(buff, 1, size, outFile) != size)
+	{
+		retVal = ERROR_BAD_ARG;
+	}
+	fclose(outFile);
+
+	return retVal;
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	struct Elf_Batch_Options options;	// Options for each test
+	struct Elf_Batch_Stats stats;		// Totals from each test
+	size_t numResults = 0;				// Callback count from each test
+	int tmpInt = 0;						// Holds scan_elf_batch() return value
+	char tempDir[] = TEMP_TEMPLATE;		// Temp directory to scan
+	char subDir[PATH_MAX] = { 0 };		// tempDir/sub
+	char deepDir[PATH_MAX] = { 0 };		// tempDir/sub/deeper
+	char elfPath[PATH_MAX] = { 0 };		// tempDir/elf64
+	char listPath[PATH_MAX] = { 0 };	// tempDir/sub/list.txt
+	char missingPath[PATH_MAX] = { 0 };	// tempDir/missing
+	char listBuff[PATH_MAX * 2] = { 0 };	// Contents of listPath
+	char* dirPaths[] = { tempDir };
+	char* twicePaths[] = { tempDir, elfPath };
+	char* missingPaths[] = { missingPath };
+	// 64-bit Little Endian x86-64 Shared object header
+	unsigned char elf64LE[] = { \
+		0x7F, 0x45, 0x4C, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x03, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, };
+	// 32-bit Big Endian MIPS Executable header
+	unsigned char elf32BE[] = { \
+		0x7F, 0x45, 0x4C, 0x46, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x20, 0x00, 0x00, 0x00, 0x28, \
+		0x00, 0x00, 0x00, 0x00, };
+
+	/* SETUP DIRECTORY */
+	// tempDir/elf64, tempDir/empty, tempDir/sub/elf32, tempDir/sub/list.txt, tempDir/sub/deeper/elf64
+	if (!mkdtemp(tempDir))
+	{
+		fprintf(stderr, "Unable to create %s\n", tempDir);
+		return -1;
+	}
+	if (snprintf(subDir, sizeof(subDir), "%s/sub", tempDir) >= (int)sizeof(subDir) \
+		|| snprintf(deepDir, sizeof(deepDir), "%s/deeper", subDir) >= (int)sizeof(deepDir) \
+		|| snprintf(elfPath, sizeof(elfPath), "%s/elf64", tempDir) >= (int)sizeof(elfPath) \
+		|| snprintf(listPath, sizeof(listPath), "%s/list.txt", subDir) >= (int)sizeof(listPath) \
+		|| snprintf(missingPath, sizeof(missingPath), "%s/missing", tempDir) >= (int)sizeof(missingPath) \
+		|| snprintf(listBuff, sizeof(listBuff), "%s\n%s\n", elfPath, listPath) >= (int)sizeof(listBuff))
+	{
+		fprintf(stderr, "Paths under %s are too long\n", tempDir);
+		rmdir(tempDir);
+		return -1;
+	}
+	mkdir(subDir, 0700);
+	mkdir(deepDir, 0700);
+	write_test_file(tempDir, "elf64", elf64LE, sizeof(elf64LE));
+	write_test_file(tempDir, "empty", NULL, 0);
+	write_test_file(subDir, "elf32", elf32BE, sizeof(elf32BE));
+	write_test_file(subDir, "list.txt", listBuff, strlen(listBuff));
+	write_test_file(deepDir, "elf64", elf64LE, sizeof(elf64LE));
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", dirPaths, 1, 1, FALSE, NULL, TRUE, ERROR_SUCCESS, NUM_DIR_FILES, NUM_DIR_ELVES, NULL };
+	unitTest Normal2 = { "Normal2", dirPaths, 1, 2, FALSE, NULL, TRUE, ERROR_SUCCESS, NUM_DIR_FILES, NUM_DIR_ELVES, NULL };
+	unitTest Normal3 = { "Normal3", dirPaths, 1, 4, FALSE, NULL, TRUE, ERROR_SUCCESS, NUM_DIR_FILES, NUM_DIR_ELVES, NULL };
+	unitTest Normal4 = { "Normal4", dirPaths, 1, 4, TRUE, NULL, TRUE, ERROR_SUCCESS, NUM_DIR_FILES, NUM_DIR_ELVES, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	Normal3.nextTest = &Normal4;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - NULL callback
+	unitTest Error1 = { "Error1", dirPaths, 1, 1, FALSE, NULL, FALSE, ERROR_NULL_PTR, 0, 0, NULL };
+	//// Error2 - NULL paths
+	unitTest Error2 = { "Error2", NULL, 1, 1, FALSE, NULL, TRUE, ERROR_NULL_PTR, 0, 0, NULL };
+	//// Error3 - Too many workers
+	unitTest Error3 = { "Error3", dirPaths, 1, BATCH_MAX_WORKERS + 1, FALSE, NULL, TRUE, ERROR_BAD_ARG, 0, 0, NULL };
+	//// Error4 - Negative workers
+	unitTest Error4 = { "Error4", dirPaths, 1, -1, FALSE, NULL, TRUE, ERROR_BAD_ARG, 0, 0, NULL };
+	//// Error5 - Missing paths are skipped
+	unitTest Error5 = { "Error5", missingPaths, 1, 2, FALSE, NULL, TRUE, ERROR_SUCCESS, 0, 0, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	Error3.nextTest = &Error4;
+	Error4.nextTest = &Error5;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// BOUNDARY
+	//// Boundary1 - Nothing to scan
+	unitTest Boundary1 = { "Boundary1", NULL, 0, 1, FALSE, NULL, TRUE, ERROR_SUCCESS, 0, 0, NULL };
+	//// Boundary2 - Default number of workers
+	unitTest Boundary2 = { "Boundary2", dirPaths, 1, 0, FALSE, NULL, TRUE, ERROR_SUCCESS, NUM_DIR_FILES, NUM_DIR_ELVES, NULL };
+	//// Boundary3 - Maximum number of workers (more workers than files)
+	unitTest Boundary3 = { "Boundary3", dirPaths, 1, BATCH_MAX_WORKERS, FALSE, NULL, TRUE, ERROR_SUCCESS, NUM_DIR_FILES, NUM_DIR_ELVES, NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	Boundary2.nextTest = &Boundary3;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// SPECIAL
+	//// Special1 - List file only
+	unitTest Special1 = { "Special1", NULL, 0, 2, FALSE, listPath, TRUE, ERROR_SUCCESS, 2, 1, NULL };
+	//// Special2 - List file plus a directory
+	unitTest Special2 = { "Special2", dirPaths, 1, 2, FALSE, listPath, TRUE, ERROR_SUCCESS, NUM_DIR_FILES + 2, NUM_DIR_ELVES + 1, NULL };
+	//// Special3 - Files named twice are scanned twice
+	unitTest Special3 = { "Special3", twicePaths, 2, 3, FALSE, NULL, TRUE, ERROR_SUCCESS, NUM_DIR_FILES + 1, NUM_DIR_ELVES + 1, NULL };
+	//// Link Tests
+	Special1.nextTest = &Special2;
+	Special2.nextTest = &Special3;
+	//// Create Test Group
+	unitTestGroup SpecialUnitTests = { "Special Unit Tests", &Special1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, \
+									  &BoundaryUnitTests, &SpecialUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\n", currTst->testName);
+			// Function call
+			memset(&options, 0, sizeof(options));
+			memset(&stats, 0, sizeof(stats));
+			numResults = 0;
+			options.numWorkers = currTst->numWorkers;
+			options.headerOnly = currTst->headerOnly;
+			options.listName = currTst->listName;
+			tmpInt = scan_elf_batch(currTst->inputPaths, currTst->numPaths, &options, \
+				                    currTst->useCallback == TRUE ? count_result : NULL, &numResults, &stats);
+
+			// Test return value
+			printf("\t\tReturn:\t\t");
+			numTests++;
+			if (tmpInt == currTst->expectedReturn)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\t\tExpected:\t%d\n", currTst->expectedReturn);
+				printf("\t\t\tReceived:\t%d\n", tmpInt);
+			}
+
+			// Test counts
+			printf("\t\tCounts:\t\t");
+			numTests++;
+			if (stats.numFiles == currTst->expectedFiles && numResults == currTst->expectedFiles \
+				&& stats.numElves == currTst->expectedElves && stats.numErrors == 0)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\t\tExpected:\t%zu files, %zu ELF files\n", currTst->expectedFiles, currTst->expectedElves);
+				printf("\t\t\tReceived:\t%zu files (%zu callbacks), %zu ELF files\n", \
+					   stats.numFiles, numResults, stats.numElves);
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* CLEAN UP */
+	if (snprintf(missingPath, sizeof(missingPath), "%s/elf64", deepDir) < (int)sizeof(missingPath))
+	{
+		unlink(missingPath);
+	}
+	rmdir(deepDir);
+	if (snprintf(missingPath, sizeof(missingPath), "%s/elf32", subDir) < (int)sizeof(missingPath))
+	{
+		unlink(missingPath);
+	}
+	unlink(listPath);
+	rmdir(subDir);
+	if (snprintf(missingPath, sizeof(missingPath), "%s/empty", tempDir) < (int)sizeof(missingPath))
+	{
+		unlink(missingPath);
+	}
+	unlink(elfPath);
+	rmdir(tempDir);
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
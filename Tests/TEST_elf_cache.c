@@ -0,0 +1,285 @@
+#include "../Elf_Details.h"
+#include "../Elf_Cache.h"
+#include "../Elf_Record.h"
+#include <fcntl.h>		// AT_FDCWD
+#include <stdio.h>		// I/O
+#include <stdlib.h>		// mkstemp()
+#include <string.h>		// memcpy
+#include <sys/stat.h>	// stat()/utimensat()
+#include <unistd.h>		// unlink()
+
+#define SELF_PATH		"/proc/self/exe"	// Always an ELF file
+#define COPY_BUFF_SIZE	65536				// Bytes copied at a time
+
+/* What happens before a test opens the cache */
+#define CHANGE_NOTHING	0	// Leave everything alone
+#define CHANGE_TOUCH	1	// New mtime, same contents
+#define CHANGE_GROW		2	// Append a byte
+#define CHANGE_CORRUPT	3	// Scribble on the cache file's header
+
+
+typedef struct ecacheTest
+{
+	char* testName;
+	int useElf;				// If TRUE, look up the ELF file.  Otherwise, the text file.
+	int headerOnly;			// Passed to lookup_elf_cache()
+	int change;				// CHANGE_*
+	int expectedReturn;		// lookup_elf_cache() return value
+	struct ecacheTest* nextTest;
+} unitTest;
+
+
+typedef struct ecacheTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// Purpose:	Copy a file
+static int copy_file(const char* srcName, const char* dstName)
+{
+	static char buff[COPY_BUFF_SIZE];
+	FILE* srcFile = fopen(srcName, "rb");
+	FILE* dstFile = fopen(dstName, "wb");
+	size_t numRead = 0;
+	int retVal = ERROR_SUCCESS;
+
+	if (!srcFile || !dstFile)
+	{
+		retVal = ERROR_BAD_ARG;
+	}
+	while (retVal == ERROR_SUCCESS && (numRead = fread(buff, 1, sizeof(buff), srcFile)) > 0)
+	{
+		if (fwrite(buff, 1, numRead, dstFile) != numRead)
+		{
+			retVal = ERROR_BAD_ARG;
+		}
+	}
+	if (srcFile)
+	{
+		fclose(srcFile);
+	}
+	if (dstFile)
+	{
+		fclose(dstFile);
+	}
+
+	return retVal;
+}
+
+
+// Purpose:	Apply one of the CHANGE_* macros
+static void make_change(int change, const char* fileName, const char* cacheName)
+{
+	struct timespec newTimes[2] = { { 0, UTIME_OMIT }, { 1234567890, 42 } };
+	FILE* tmpFile = NULL;
+
+	if (change == CHANGE_TOUCH)
+	{
+		utimensat(AT_FDCWD, fileName, newTimes, 0);
+	}
+	else if (change == CHANGE_GROW && (tmpFile = fopen(fileName, "ab")))
+	{
+		fputc('\n', tmpFile);
+		fclose(tmpFile);
+	}
+	else if (change == CHANGE_CORRUPT && (tmpFile = fopen(cacheName, "r+b")))
+	{
+		fseek(tmpFile, 6, SEEK_SET);
+		fputc(0x7F, tmpFile);
+		fclose(tmpFile);
+	}
+
+	return;
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	char elfName[] = "/tmp/TEST_elf_cache_elf.XXXXXX";		// Copy of SELF_PATH
+	char textName[] = "/tmp/TEST_elf_cache_text.XXXXXX";	// Not an ELF file
+	char cacheName[] = "/tmp/TEST_elf_cache.XXXXXX";		// The cache
+	const char* fileName = NULL;		// elfName or textName
+	int tmpFd = -1;						// File descriptor from mkstemp()
+	struct Elf_Details* elven = NULL;	// Parsed on a miss
+	struct Elf_Details* rebuilt = NULL;	// Rebuilt from a hit
+	struct Elf_Cache* cache = NULL;		// Opened by each test
+	struct stat fileStat;				// Identity of fileName
+	struct Elf_Record record;			// Cached record
+	int tmpInt = 0;						// Holds lookup_elf_cache() return value
+	int goodRecord = FALSE;				// If TRUE, a hit matched the file
+
+	/* UNIT TESTS */
+	// NORMAL
+	//// Normal1 - Cold cache
+	unitTest Normal1 = { "Normal1", TRUE, FALSE, CHANGE_NOTHING, CACHE_MISS, NULL };
+	//// Normal2 - Warm cache
+	unitTest Normal2 = { "Normal2", TRUE, FALSE, CHANGE_NOTHING, ERROR_SUCCESS, NULL };
+	//// Normal3 - Hits are carried forward
+	unitTest Normal3 = { "Normal3", TRUE, FALSE, CHANGE_NOTHING, ERROR_SUCCESS, NULL };
+	//// Normal4 - Not an ELF file, cold
+	unitTest Normal4 = { "Normal4", FALSE, FALSE, CHANGE_NOTHING, CACHE_MISS, NULL };
+	//// Normal5 - Not an ELF file, warm
+	unitTest Normal5 = { "Normal5", FALSE, FALSE, CHANGE_NOTHING, ERROR_SUCCESS, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	Normal3.nextTest = &Normal4;
+	Normal4.nextTest = &Normal5;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// BOUNDARY
+	//// Boundary1 - Header only is keyed separately
+	unitTest Boundary1 = { "Boundary1", TRUE, TRUE, CHANGE_NOTHING, CACHE_MISS, NULL };
+	//// Boundary2 - Header only, warm
+	unitTest Boundary2 = { "Boundary2", TRUE, TRUE, CHANGE_NOTHING, ERROR_SUCCESS, NULL };
+	//// Boundary3 - Files not looked up last run age out
+	unitTest Boundary3 = { "Boundary3", TRUE, FALSE, CHANGE_NOTHING, CACHE_MISS, NULL };
+	//// Boundary4 - New mtime
+	unitTest Boundary4 = { "Boundary4", TRUE, FALSE, CHANGE_TOUCH, CACHE_MISS, NULL };
+	//// Boundary5 - New mtime, warm
+	unitTest Boundary5 = { "Boundary5", TRUE, FALSE, CHANGE_NOTHING, ERROR_SUCCESS, NULL };
+	//// Boundary6 - New size
+	unitTest Boundary6 = { "Boundary6", FALSE, FALSE, CHANGE_GROW, CACHE_MISS, NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	Boundary2.nextTest = &Boundary3;
+	Boundary3.nextTest = &Boundary4;
+	Boundary4.nextTest = &Boundary5;
+	Boundary5.nextTest = &Boundary6;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// SPECIAL
+	//// Special1 - Corrupt cache is treated as empty
+	unitTest Special1 = { "Special1", TRUE, FALSE, CHANGE_CORRUPT, CACHE_MISS, NULL };
+	//// Special2 - ...and replaced
+	unitTest Special2 = { "Special2", TRUE, FALSE, CHANGE_NOTHING, ERROR_SUCCESS, NULL };
+	//// Link Tests
+	Special1.nextTest = &Special2;
+	//// Create Test Group
+	unitTestGroup SpecialUnitTests = { "Special Unit Tests", &Special1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &BoundaryUnitTests, &SpecialUnitTests, NULL };
+
+	/* SETUP */
+	close(mkstemp(elfName));
+	close(mkstemp(textName));
+	copy_file(SELF_PATH, elfName);
+	copy_file(__FILE__, textName);
+	// Start without a cache file
+	tmpFd = mkstemp(cacheName);
+	close(tmpFd);
+	unlink(cacheName);
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\t", currTst->testName);
+			numTests++;
+			fileName = currTst->useElf == TRUE ? elfName : textName;
+			make_change(currTst->change, fileName, cacheName);
+
+			// One run: look it up and add it on a miss
+			goodRecord = FALSE;
+			cache = open_elf_cache(cacheName);
+			stat(fileName, &fileStat);
+			tmpInt = lookup_elf_cache(cache, &fileStat, currTst->headerOnly, &record);
+			if (currTst->headerOnly == TRUE)
+			{
+				elven = read_elf_header((char*)fileName);
+			}
+			else
+			{
+				elven = read_elf((char*)fileName);
+			}
+			if (tmpInt == CACHE_MISS)
+			{
+				add_elf_to_cache(cache, &fileStat, currTst->headerOnly, currTst->useElf == TRUE ? elven : NULL, fileName);
+				goodRecord = TRUE;
+			}
+			else if (tmpInt == ERROR_SUCCESS && currTst->useElf != TRUE)
+			{
+				goodRecord = record.status == RECORD_STATUS_NOT_ELF ? TRUE : FALSE;
+			}
+			else if (tmpInt == ERROR_SUCCESS && (rebuilt = record_to_elf(&record, NULL)))
+			{
+				goodRecord = (!strcmp(rebuilt->ISA, elven->ISA) && rebuilt->numSectHdrs == elven->numSectHdrs \
+					&& rebuilt->ePnt64 == elven->ePnt64 && !strcmp(rebuilt->fileName, fileName) \
+					&& (rebuilt->numSectHdrs < 2 || !strcmp(get_section_name(rebuilt, 1), get_section_name(elven, 1)))) \
+					? TRUE : FALSE;
+			}
+			if (close_elf_cache(&cache) != ERROR_SUCCESS || cache)
+			{
+				goodRecord = FALSE;
+			}
+
+			// Test return value
+			if (tmpInt == currTst->expectedReturn && goodRecord == TRUE)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\tExpected:\t%d\n", currTst->expectedReturn);
+				printf("\t\tReceived:\t%d\n", tmpInt);
+			}
+
+			// Next test
+			if (elven)
+			{
+				kill_elf(&elven);
+			}
+			if (rebuilt)
+			{
+				kill_elf(&rebuilt);
+			}
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* CLEAN UP */
+	unlink(elfName);
+	unlink(textName);
+	unlink(cacheName);
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
@@ -0,0 +1,260 @@
+#include "../Elf_Details.h"
+#include <pthread.h>	// Concurrent contexts
+#include <stdio.h>		// I/O
+#include <string.h>		// strstr
+
+#define SELF_PATH		"/proc/self/exe"				// Always an ELF file
+#define NOT_ELF_PATH	"TEST_elf_context.c"			// Never an ELF file
+#define MISSING_PATH	"TEST_elf_context.missing"		// Never exists
+#define NUM_THREADS		4								// Threads parsing at once
+#define NUM_LOOPS		50								// Files each thread parses
+
+
+typedef struct ecTest
+{
+	char* testName;
+	char* fileName;			// File to read.  If NULL, parse elfBuff instead.
+	int headerOnly;			// Elf_Context.headerOnly
+	int useArena;			// If TRUE, parse out of a caller-owned arena
+	int expectedReturn;		// read_elf_ctx() return value
+	int expectedErrnum;		// Elf_Context.errnum
+	int expectedStruct;		// If TRUE, *elven_out should be set
+	char* expectedMsg;		// Substring of Elf_Context.errBuff.  NULL if it should be empty.
+	struct ecTest* nextTest;
+} unitTest;
+
+
+typedef struct ecTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// Purpose:	Parse the same files over and over with one private context
+static void* parse_loop(void* threadArg)
+{
+	int* numBad = (int*)threadArg;
+	struct Elf_Context context;
+	struct Elf_Details* elvenStruct = NULL;
+	int i = 0;
+
+	init_elf_context(&context);
+	for (i = 0; i < NUM_LOOPS; i++)
+	{
+		if (read_elf_ctx(&context, SELF_PATH, &elvenStruct) != ERROR_SUCCESS || !elvenStruct \
+			|| !elvenStruct->sectHdrs || context.errBuff[0])
+		{
+			(*numBad)++;
+		}
+		kill_elf_mapped(&elvenStruct);
+		if (read_elf_ctx(&context, MISSING_PATH, &elvenStruct) != ERROR_BAD_ARG || elvenStruct \
+			|| context.errnum != ENOENT || !strstr(context.errBuff, MISSING_PATH))
+		{
+			(*numBad)++;
+		}
+	}
+
+	return NULL;
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	struct Elf_Context context;			// Context for each test
+	struct Elf_Arena* callerArena = NULL;	// Caller-owned arena
+	struct Elf_Details* testStruct = NULL;	// Struct parsed by each test
+	int tmpInt = 0;						// Holds read_elf_ctx() return value
+	pthread_t threads[NUM_THREADS];		// Concurrent parsers
+	int numBad[NUM_THREADS] = { 0 };	// Bad results per thread
+	int i = 0;							// Iterating variable
+	// 64-bit Little Endian header that claims 0x100 bytes of Program Header Table
+	unsigned char elfBuff[] = { \
+		0x7F, 0x45, 0x4C, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x03, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, };
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", SELF_PATH, FALSE, FALSE, ERROR_SUCCESS, 0, TRUE, NULL, NULL };
+	unitTest Normal2 = { "Normal2", SELF_PATH, TRUE, FALSE, ERROR_SUCCESS, 0, TRUE, NULL, NULL };
+	unitTest Normal3 = { "Normal3", SELF_PATH, FALSE, TRUE, ERROR_SUCCESS, 0, TRUE, NULL, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - Missing file
+	unitTest Error1 = { "Error1", MISSING_PATH, FALSE, FALSE, ERROR_BAD_ARG, ENOENT, FALSE, MISSING_PATH, NULL };
+	//// Error2 - Missing file, header only
+	unitTest Error2 = { "Error2", MISSING_PATH, TRUE, TRUE, ERROR_BAD_ARG, ENOENT, FALSE, MISSING_PATH, NULL };
+	//// Error3 - Not an ELF file
+	unitTest Error3 = { "Error3", NOT_ELF_PATH, FALSE, FALSE, ERROR_ORC_FILE, 0, FALSE, NULL, NULL };
+	//// Error4 - Not an ELF file out of a caller-owned arena
+	unitTest Error4 = { "Error4", NOT_ELF_PATH, TRUE, TRUE, ERROR_ORC_FILE, 0, FALSE, NULL, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	Error3.nextTest = &Error4;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// SPECIAL
+	//// Special1 - Program Header Table runs past the end of the buffer
+	unitTest Special1 = { "Special1", NULL, FALSE, FALSE, ERROR_BAD_OFFSET, 0, TRUE, "Program Header Table", NULL };
+	//// Create Test Group
+	unitTestGroup SpecialUnitTests = { "Special Unit Tests", &Special1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, &SpecialUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\n", currTst->testName);
+			// Function call
+			init_elf_context(&context);
+			context.headerOnly = currTst->headerOnly;
+			if (currTst->useArena == TRUE)
+			{
+				callerArena = create_arena(0);
+				context.arena = callerArena;
+			}
+			if (currTst->fileName)
+			{
+				tmpInt = read_elf_ctx(&context, currTst->fileName, &testStruct);
+			}
+			else
+			{
+				testStruct = (struct Elf_Details*)gimme_mem(1, sizeof(struct Elf_Details));
+				tmpInt = parse_elf_buffer_ctx(&context, testStruct, elfBuff, sizeof(elfBuff));
+			}
+
+			// Test return value
+			printf("\t\tReturn:\t\t");
+			numTests++;
+			if (tmpInt == currTst->expectedReturn && context.status == currTst->expectedReturn)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\t\tExpected:\t%d\n", currTst->expectedReturn);
+				printf("\t\t\tReceived:\t%d (status %d)\n", tmpInt, context.status);
+			}
+
+			// Test context
+			printf("\t\tContext:\t");
+			numTests++;
+			if (context.errnum == currTst->expectedErrnum \
+				&& ((currTst->expectedStruct == TRUE && testStruct) || (currTst->expectedStruct == FALSE && !testStruct)) \
+				&& ((!currTst->expectedMsg && !context.errBuff[0]) \
+					|| (currTst->expectedMsg && strstr(context.errBuff, currTst->expectedMsg))))
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\t\tExpected:\t%d %s \"%s\"\n", currTst->expectedErrnum, \
+					   currTst->expectedStruct == TRUE ? "struct" : "NULL", currTst->expectedMsg);
+				printf("\t\t\tReceived:\t%d %s \"%s\"\n", context.errnum, testStruct ? "struct" : "NULL", context.errBuff);
+			}
+
+			// Clean up
+			if (testStruct)
+			{
+				kill_elf_mapped(&testStruct);
+			}
+			if (callerArena)
+			{
+				// Outlived the struct (the arena is zeroized as it's destroyed)
+				destroy_arena(&callerArena);
+				context.arena = NULL;
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* NULL CONTEXT */
+	printf("NULL context:\t\t");
+	numTests++;
+	if (read_elf_ctx(NULL, SELF_PATH, &testStruct) == ERROR_NULL_PTR && !testStruct \
+		&& parse_elf_buffer_ctx(NULL, NULL, elfBuff, sizeof(elfBuff)) == ERROR_NULL_PTR)
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+
+	/* CONCURRENT CONTEXTS */
+	printf("Concurrent contexts:\t");
+	numTests++;
+	for (i = 0; i < NUM_THREADS; i++)
+	{
+		pthread_create(&(threads[i]), NULL, parse_loop, &(numBad[i]));
+	}
+	tmpInt = 0;
+	for (i = 0; i < NUM_THREADS; i++)
+	{
+		pthread_join(threads[i], NULL);
+		tmpInt += numBad[i];
+	}
+	if (!tmpInt)
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+		printf("\t%d bad results\n", tmpInt);
+	}
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
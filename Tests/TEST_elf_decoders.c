@@ -0,0 +1,150 @@
+#include "../Elf_Details.h"
+#include <inttypes.h>	// Print uint64_t variables
+#include <stdio.h>		// I/O
+
+#define DEFAULT_INT		((int)1337)
+
+
+typedef struct edTest
+{
+	char* testName;
+	int elfClass;
+	int elfData;
+	int actualResult;		// TRUE if get_elf_decoders() returned decoders
+	int expectedResult;
+	uint16_t expectedHalf;	// Expected half() of testBytes
+	uint32_t expectedWord;	// Expected word() of testBytes
+	uint64_t expectedXword;	// Expected xword() of testBytes
+	uint64_t expectedAddr;	// Expected addr() of testBytes
+	struct edTest* nextTest;
+} unitTest;
+
+
+typedef struct edTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	const struct Elf_Decoders* decoders = NULL;	// Return value from get_elf_decoders()
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	// High bits set so sign extension shows up
+	const unsigned char testBytes[] = { 0xF1, 0xE2, 0xD3, 0xC4, 0xB5, 0xA6, 0x97, 0x88 };
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", ELF_H_CLASS_32, ELF_H_DATA_LITTLE, DEFAULT_INT, TRUE, \
+		0xE2F1, 0xC4D3E2F1, 0x8897A6B5C4D3E2F1, 0x00000000C4D3E2F1, NULL };
+	unitTest Normal2 = { "Normal2", ELF_H_CLASS_32, ELF_H_DATA_BIG, DEFAULT_INT, TRUE, \
+		0xF1E2, 0xF1E2D3C4, 0xF1E2D3C4B5A69788, 0x00000000F1E2D3C4, NULL };
+	unitTest Normal3 = { "Normal3", ELF_H_CLASS_64, ELF_H_DATA_LITTLE, DEFAULT_INT, TRUE, \
+		0xE2F1, 0xC4D3E2F1, 0x8897A6B5C4D3E2F1, 0x8897A6B5C4D3E2F1, NULL };
+	unitTest Normal4 = { "Normal4", ELF_H_CLASS_64, ELF_H_DATA_BIG, DEFAULT_INT, TRUE, \
+		0xF1E2, 0xF1E2D3C4, 0xF1E2D3C4B5A69788, 0xF1E2D3C4B5A69788, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	Normal3.nextTest = &Normal4;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - Invalid class
+	unitTest Error1 = { "Error1", ELF_H_CLASS_NONE, ELF_H_DATA_LITTLE, DEFAULT_INT, FALSE, 0, 0, 0, 0, NULL };
+	//// Error2 - Invalid data encoding
+	unitTest Error2 = { "Error2", ELF_H_CLASS_64, ELF_H_DATA_NONE, DEFAULT_INT, FALSE, 0, 0, 0, 0, NULL };
+	//// Error3 - Out of range
+	unitTest Error3 = { "Error3", ELF_H_CLASS_64 + 1, ELF_H_DATA_BIG + 1, DEFAULT_INT, FALSE, 0, 0, 0, 0, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\n", currTst->testName);
+			// Function call
+			decoders = get_elf_decoders(currTst->elfClass, currTst->elfData);
+			currTst->actualResult = decoders ? TRUE : FALSE;
+
+			// Test return value
+			printf("\t\tReturn:\t\t");
+			numTests++;
+			if (currTst->actualResult == currTst->expectedResult)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+			}
+
+			// Test decoded values
+			if (decoders && currTst->expectedResult == TRUE)
+			{
+				printf("\t\tDecoders:\t");
+				numTests++;
+				if (decoders->elfClass == currTst->elfClass \
+					&& decoders->half(testBytes) == currTst->expectedHalf \
+					&& decoders->word(testBytes) == currTst->expectedWord \
+					&& decoders->xword(testBytes) == currTst->expectedXword \
+					&& decoders->addr(testBytes) == currTst->expectedAddr)
+				{
+					printf("Pass\n");
+					numPass++;
+				}
+				else
+				{
+					printf("FAIL\n");
+					printf("\t\t\tReceived:\t0x%" PRIx64 "\n", decoders->addr(testBytes));
+				}
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
@@ -0,0 +1,255 @@
+#include "../Elf_Details.h"
+#include "../Elf_Dedup.h"
+#include "../Elf_Digest.h"
+#include <stdio.h>		// I/O
+#include <stdlib.h>		// mkstemp()
+#include <string.h>		// strcmp()
+#include <unistd.h>		// close()/unlink()
+
+#define SELF_PATH		"/proc/self/exe"	// Always an ELF file
+#define NUM_COPIES		12					// Files indexed with SELF_PATH's digests
+#define RUN_ENTRIES		1					// Spill every entry so the merge needs more than one pass
+
+
+typedef struct eddTest
+{
+	char* testName;
+	const char* regionName;		// Region to look in
+	int flipHash;				// If TRUE, look up SELF_PATH's hash of regionName with the low bit flipped
+	int expectedReturn;			// find_dedup_hash() return value
+	size_t expectedCount;		// Number of matches
+	struct eddTest* nextTest;
+} unitTest;
+
+
+typedef struct eddTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// Purpose:	Find the hash of a region the way add_dedup_file() names it
+static uint64_t region_hash(const struct Elf_Digest_List* digestList, const char* regionName)
+{
+	size_t i = 0;
+	const struct Elf_Digest* digest = NULL;
+
+	for (i = 0; regionName && i < digestList->numDigests; i++)
+	{
+		digest = digestList->digests + i;
+		if ((digest->kind == DIGEST_KIND_FILE && !strcmp(regionName, "file")) \
+			|| (digest->kind == DIGEST_KIND_SEGMENT && !strcmp(regionName, "load")) \
+			|| (digest->kind == DIGEST_KIND_SECTION && digest->name && !strcmp(regionName, digest->name)))
+		{
+			return digest->xxh64;
+		}
+	}
+
+	return 0;
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	int tmpInt = 0;						// Return value
+	char indexName[] = "/tmp/TEST_elf_dedup.XXXXXX";	// The index
+	char fileName[64];					// Name each copy is indexed under
+	struct Elf_Details* elvenStruct = NULL;		// SELF_PATH
+	struct Elf_Digest_List* digestList = NULL;	// Digests of elvenStruct
+	struct Elf_Dedup_Builder* builder = NULL;	// Builds indexName
+	struct Elf_Dedup_Index index;		// Mapped indexName
+	size_t first = 0;					// First match
+	size_t count = 0;					// Number of matches
+	size_t cursor = 0;					// next_dedup_group() position
+	size_t numGroups = 0;				// Groups found
+	size_t numGrouped = 0;				// Entries in those groups
+	int goodIndex = FALSE;				// If TRUE, every check of this test passed
+	FILE* indexFile = NULL;				// Used to scribble on indexName
+	uint64_t badBucket = 0;				// Scribbled over the last bucket
+	int i = 0;							// Iterating variable
+	size_t j = 0;						// Iterating variable
+
+	/* UNIT TESTS */
+	// NORMAL
+	//// Normal1 - Identical .text in every file
+	unitTest Normal1 = { "Normal1", ".text", FALSE, ERROR_SUCCESS, NUM_COPIES + 1, NULL };
+	//// Normal2 - Identical files, except the changed one
+	unitTest Normal2 = { "Normal2", "file", FALSE, ERROR_SUCCESS, NUM_COPIES, NULL };
+	//// Normal3 - Segments
+	unitTest Normal3 = { "Normal3", "load", FALSE, ERROR_SUCCESS, NUM_COPIES + 1, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - NULL region
+	unitTest Error1 = { "Error1", NULL, FALSE, ERROR_NULL_PTR, 0, NULL };
+	//// Error2 - Region nothing has
+	unitTest Error2 = { "Error2", ".nope", FALSE, ERROR_SUCCESS, 0, NULL };
+	//// Error3 - Hash nothing has
+	unitTest Error3 = { "Error3", ".text", TRUE, ERROR_SUCCESS, 0, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// BOUNDARY
+	//// Boundary1 - Only the changed file
+	unitTest Boundary1 = { "Boundary1", "file", TRUE, ERROR_SUCCESS, 1, NULL };
+	//// Link Tests
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, &BoundaryUnitTests, NULL };
+
+	/* SETUP */
+	// NUM_COPIES files with SELF_PATH's digests and one with a different whole file hash
+	close(mkstemp(indexName));
+	elvenStruct = read_elf(SELF_PATH);
+	digestList = digest_elf_contents(elvenStruct, DEDUP_DEFAULT_REGIONS, DIGEST_XXH64);
+	builder = create_dedup_builder(indexName, RUN_ENTRIES);
+	if (!digestList || !builder || digestList->digests[0].kind != DIGEST_KIND_FILE)
+	{
+		printf("Unable to set up the tests\n");
+		return ERROR_NULL_PTR;
+	}
+	for (i = 0; i < NUM_COPIES; i++)
+	{
+		sprintf(fileName, "/copy/%d", i);
+		add_dedup_file(builder, fileName, digestList);
+	}
+	digestList->digests[0].xxh64 ^= 1;
+	add_dedup_file(builder, "/changed", digestList);
+	digestList->digests[0].xxh64 ^= 1;
+	tmpInt = finish_dedup_builder(&builder);
+	if (tmpInt != ERROR_SUCCESS || open_dedup_index(&index, indexName) != ERROR_SUCCESS)
+	{
+		printf("Unable to build %s: %d\n", indexName, tmpInt);
+		return ERROR_BAD_ARG;
+	}
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\t", currTst->testName);
+			numTests++;
+
+			// Look it up
+			count = 0;
+			tmpInt = find_dedup_hash(&index, currTst->regionName, \
+				region_hash(digestList, currTst->regionName) ^ (currTst->flipHash == TRUE ? 1 : 0), &first, &count);
+
+			// Test return value
+			if (tmpInt == currTst->expectedReturn && count == currTst->expectedCount)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\tExpected:\t%d (%zu matches)\n", currTst->expectedReturn, currTst->expectedCount);
+				printf("\t\tReceived:\t%d (%zu matches)\n", tmpInt, count);
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* INDEX TESTS */
+	printf("Running 'Index Tests'...\n");
+	//// Every entry survived the spills and merges, in order
+	printf("\tMerged entries:\t");
+	numTests++;
+	goodIndex = index.numEntries == (NUM_COPIES + 1) * digestList->numDigests && index.numFiles == NUM_COPIES + 1;
+	for (j = 1; goodIndex == TRUE && j < index.numEntries; j++)
+	{
+		goodIndex = index.entries[j - 1].hash <= index.entries[j].hash ? TRUE : FALSE;
+	}
+	printf("%s\n", goodIndex ? "Pass" : "FAIL");
+	numPass += goodIndex ? 1 : 0;
+	//// One group per region, short the changed file
+	printf("\tGroups:\t\t");
+	numTests++;
+	while (next_dedup_group(&index, &cursor, &first, &count) == ERROR_SUCCESS)
+	{
+		numGroups++;
+		numGrouped += count;
+	}
+	goodIndex = numGroups == digestList->numDigests && numGrouped == index.numEntries - 1 \
+		&& !strcmp(get_dedup_file(&index, NUM_COPIES), "/changed") && !get_dedup_file(&index, NUM_COPIES + 1) \
+		&& !strcmp(get_dedup_region(&index, 0), "file") && !get_dedup_region(&index, index.numRegions);
+	printf("%s\n", goodIndex ? "Pass" : "FAIL");
+	numPass += goodIndex ? 1 : 0;
+	close_dedup_index(&index);
+	//// Scribbled directory
+	printf("\tCorrupt index:\t");
+	numTests++;
+	indexFile = fopen(indexName, "r+b");
+	if (indexFile)
+	{
+		badBucket = 1;
+		fseek(indexFile, -(long)sizeof(badBucket), SEEK_END);
+		fwrite(&badBucket, sizeof(badBucket), 1, indexFile);
+		fclose(indexFile);
+	}
+	tmpInt = open_dedup_index(&index, indexName);
+	printf("%s\n", tmpInt == ERROR_BAD_OFFSET ? "Pass" : "FAIL");
+	numPass += tmpInt == ERROR_BAD_OFFSET ? 1 : 0;
+	//// Digests without XXH64 leave the old index alone
+	printf("\tNo XXH64:\t");
+	numTests++;
+	builder = create_dedup_builder(indexName, 0);
+	digestList->algorithms = DIGEST_SHA256;
+	tmpInt = add_dedup_file(builder, "/sha256", digestList);
+	goodIndex = tmpInt == ERROR_BAD_ARG && finish_dedup_builder(&builder) == ERROR_BAD_ARG && !builder \
+		&& open_dedup_index(&index, indexName) == ERROR_BAD_OFFSET;
+	printf("%s\n", goodIndex ? "Pass" : "FAIL");
+	numPass += goodIndex ? 1 : 0;
+
+	/* CLEAN UP */
+	kill_digest_list(&digestList);
+	kill_elf(&elvenStruct);
+	unlink(indexName);
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
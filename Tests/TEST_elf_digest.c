@@ -0,0 +1,254 @@
+#include "../Elf_Details.h"
+#include "../Elf_Digest.h"
+#include <errno.h>
+#include <stdio.h>		// I/O
+#include <stdlib.h>		// malloc()
+#include <string.h>		// memcpy
+
+#define SELF_PATH		"/proc/self/exe"	// Always an ELF file
+#define MILLION_A		1000000				// Length of the "a" x 1,000,000 vector
+
+
+typedef struct edTest
+{
+	char* testName;
+	const char* input;			// Bytes to hash (NULL for MILLION_A of 'a')
+	uint64_t expectedXxh64;		// digest_xxh64() with seed 0
+	int checkXxh64;				// If FALSE, expectedXxh64 isn't known
+	const char* expectedSha256;	// digest_sha256() in hex
+	struct edTest* nextTest;
+} unitTest;
+
+
+typedef struct edTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// Purpose:	Format a SHA-256 digest as hex
+static void to_hex(const unsigned char* digest, char* hexDigest)
+{
+	size_t i = 0;
+
+	for (i = 0; i < DIGEST_SHA256_SIZE; i++)
+	{
+		sprintf(hexDigest + (i * 2), "%02x", digest[i]);
+	}
+
+	return;
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	int isaList[] = { DIGEST_ISA_SCALAR, DIGEST_ISA_SHA_NI };	// Every implementation to check
+	int numIsas = 0;					// Number of isaList entries this CPU runs
+	char* millionA = NULL;				// MILLION_A of 'a'
+	const char* input = NULL;			// Bytes being hashed
+	size_t inputLen = 0;				// Bytes in input
+	unsigned char digest[DIGEST_SHA256_SIZE];		// Binary SHA-256
+	unsigned char streamDigest[DIGEST_SHA256_SIZE];	// SHA-256 fed a byte at a time, then in odd pieces
+	char hexDigest[DIGEST_SHA256_SIZE * 2 + 1];		// SHA-256 in hex
+	struct Elf_Sha256 sha;				// Running SHA-256
+	struct Elf_Details* fullStruct = NULL;		// Contents retained
+	struct Elf_Details* headerStruct = NULL;	// Contents not retained
+	struct Elf_Digest_List* digestList = NULL;	// Digests of fullStruct
+	int numLoads = 0;					// Number of PT_LOAD segments in fullStruct
+	int goodDigests = FALSE;			// If TRUE, every check of this test passed
+	size_t i = 0;						// Iterating variable
+	int j = 0;							// Iterating variable
+
+	/* UNIT TESTS */
+	// NORMAL
+	//// Normal1 - "abc"
+	unitTest Normal1 = { "Normal1", "abc", 0x44BC2CF5AD770999ULL, TRUE, \
+		"ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", NULL };
+	//// Normal2 - Two SHA-256 blocks
+	unitTest Normal2 = { "Normal2", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 0, FALSE, \
+		"248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1", NULL };
+	//// Normal3 - XXH64 stripes
+	unitTest Normal3 = { "Normal3", "Nobody inspects the spammish repetition", 0xFBCEA83C8A378BF1ULL, TRUE, \
+		"031edd7d41651593c5fe5c006fa5752b37fddff7bc4e843aa6af0c950f4b9406", NULL };
+	//// Normal4 - Many blocks
+	unitTest Normal4 = { "Normal4", NULL, 0, FALSE, \
+		"cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0", NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	Normal3.nextTest = &Normal4;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// BOUNDARY
+	//// Boundary1 - Empty
+	unitTest Boundary1 = { "Boundary1", "", 0xEF46DB3751D8E999ULL, TRUE, \
+		"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", NULL };
+	//// Boundary2 - One byte
+	unitTest Boundary2 = { "Boundary2", "a", 0xD24EC4F1A98C6E5BULL, TRUE, \
+		"ca978112ca1bbdcafac231b39a23dc4da786eff8147c4e72b9807785afee48bb", NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &BoundaryUnitTests, NULL };
+
+	/* SETUP */
+	millionA = (char*)malloc(MILLION_A);
+	memset(millionA, 'a', MILLION_A);
+	for (j = 0; j < (int)(sizeof(isaList) / sizeof(*isaList)); j++)
+	{
+		if (set_digest_isa(isaList[j]) == ERROR_SUCCESS)
+		{
+			isaList[numIsas++] = isaList[j];
+		}
+	}
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\t", currTst->testName);
+			numTests++;
+			input = currTst->input ? currTst->input : millionA;
+			inputLen = currTst->input ? strlen(currTst->input) : MILLION_A;
+			goodDigests = TRUE;
+
+			// XXH64
+			if (currTst->checkXxh64 == TRUE && digest_xxh64(input, inputLen, 0) != currTst->expectedXxh64)
+			{
+				goodDigests = FALSE;
+			}
+			// SHA-256 on every implementation, in one piece and streamed
+			for (j = 0; j < numIsas; j++)
+			{
+				set_digest_isa(isaList[j]);
+				digest_sha256(input, inputLen, digest);
+				to_hex(digest, hexDigest);
+				init_sha256(&sha);
+				for (i = 0; i < inputLen && i < 3; i++)
+				{
+					update_sha256(&sha, input + i, 1);
+				}
+				if (inputLen > i)
+				{
+					update_sha256(&sha, input + i, (inputLen - i) / 2);
+					update_sha256(&sha, input + i + (inputLen - i) / 2, inputLen - i - (inputLen - i) / 2);
+				}
+				final_sha256(&sha, streamDigest);
+				if (strcmp(hexDigest, currTst->expectedSha256) || memcmp(digest, streamDigest, sizeof(digest)))
+				{
+					goodDigests = FALSE;
+				}
+			}
+			set_digest_isa(DIGEST_ISA_AUTO);
+
+			// Test return value
+			if (goodDigests == TRUE)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\tExpected:\t%s\n", currTst->expectedSha256);
+				printf("\t\tReceived:\t%s\n", hexDigest);
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* ELF CONTENTS */
+	printf("Running 'ELF Content Tests'...\n");
+	fullStruct = read_elf(SELF_PATH);
+	headerStruct = read_elf_header(SELF_PATH);
+	for (j = 0; fullStruct && j < fullStruct->numPrgmHdrs; j++)
+	{
+		numLoads += fullStruct->prgmHdrs[j].type == ELF_P_TYPE_LOAD ? 1 : 0;
+	}
+	//// Whole file and segments
+	printf("\tLoad segments:\t");
+	numTests++;
+	digestList = digest_elf_contents(fullStruct, "file,load", DIGEST_ALL);
+	goodDigests = FALSE;
+	if (digestList && (int)digestList->numDigests == 1 + numLoads && digestList->digests[0].kind == DIGEST_KIND_FILE)
+	{
+		digest_sha256(fullStruct->elfGuts, fullStruct->elfSize, digest);
+		goodDigests = !memcmp(digest, digestList->digests[0].sha256, sizeof(digest)) \
+			&& digestList->digests[1].kind == DIGEST_KIND_SEGMENT \
+			&& digestList->digests[1].xxh64 == digest_xxh64(fullStruct->elfGuts + digestList->digests[1].offset, \
+				digestList->digests[1].size, 0);
+	}
+	printf("%s\n", goodDigests ? "Pass" : "FAIL");
+	numPass += goodDigests ? 1 : 0;
+	if (digestList)
+	{
+		kill_digest_list(&digestList);
+	}
+	//// Named section, only XXH64
+	printf("\tNamed section:\t");
+	numTests++;
+	digestList = digest_elf_contents(fullStruct, ".nope,.text", DIGEST_XXH64);
+	goodDigests = digestList && digestList->numDigests == 1 && !strcmp(digestList->digests[0].name, ".text") \
+		&& digestList->digests[0].status == ERROR_SUCCESS && digestList->digests[0].sha256[0] == 0 \
+		&& digestList->digests[0].sha256[31] == 0;
+	printf("%s\n", goodDigests ? "Pass" : "FAIL");
+	numPass += goodDigests ? 1 : 0;
+	if (digestList)
+	{
+		kill_digest_list(&digestList);
+	}
+	//// Header only
+	printf("\tHeader only:\t");
+	numTests++;
+	digestList = digest_elf_contents(headerStruct, "file", DIGEST_ALL);
+	goodDigests = !digestList && errno == EINVAL;
+	printf("%s\n", goodDigests ? "Pass" : "FAIL");
+	numPass += goodDigests ? 1 : 0;
+	errno = 0;
+
+	/* CLEAN UP */
+	free(millionA);
+	kill_elf(&fullStruct);
+	kill_elf(&headerStruct);
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
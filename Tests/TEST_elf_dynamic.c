@@ -0,0 +1,318 @@
+#include "../Elf_Details.h"
+#include "../Elf_Dynamic.h"
+#include <errno.h>
+#include <stdio.h>		// I/O
+#include <string.h>		// memset()/strcmp()
+
+#define SELF_PATH		"/proc/self/exe"	// Always a dynamically linked ELF file
+#define NUM_FILES		11					// Entries in scannedFiles
+
+
+typedef struct edyTest
+{
+	char* testName;
+	const char* fileName;		// Needing file
+	const char* needed;			// DT_NEEDED entry of fileName
+	const char* expectedPath;	// Path it should resolve to, NULL if unresolved
+	struct edyTest* nextTest;
+} unitTest;
+
+
+typedef struct edyTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// One synthetic scanned file
+struct Test_File
+{
+	const char* path;
+	const char* soname;
+	const char* runpath;
+	const char* rpath;
+	int elfClass;
+	const char* isa;
+	const char* needed[4];
+	size_t numNeeded;
+};
+
+
+/* SCANNED FILES */
+static const struct Test_File scannedFiles[NUM_FILES] = {
+	{ "/app/bin/tool", NULL, "$ORIGIN/../lib", NULL, ELF_H_CLASS_64, "x86-64", \
+		{ "libfoo.so.1", "libbar.so.2", "libmissing.so.9", "/opt/abs/libabs.so" }, 4 },
+	{ "/usr/lib/libfoo.so.1", "libfoo.so.1", NULL, NULL, ELF_H_CLASS_64, "x86-64", { NULL }, 0 },
+	{ "/app/lib/libfoo.so.1", "libfoo.so.1", NULL, NULL, ELF_H_CLASS_64, "x86-64", { NULL }, 0 },
+	{ "/usr/lib32/libbar.so.2", "libbar.so.2", NULL, NULL, ELF_H_CLASS_32, "x86", { NULL }, 0 },
+	{ "/usr/lib/libbar.so.2.0", "libbar.so.2", NULL, NULL, ELF_H_CLASS_64, "x86-64", { "libfoo.so.1" }, 1 },
+	{ "/opt/abs/libabs.so", NULL, NULL, NULL, ELF_H_CLASS_64, "x86-64", { NULL }, 0 },
+	{ "/usr/lib/libabs.so", NULL, NULL, NULL, ELF_H_CLASS_64, "x86-64", { NULL }, 0 },
+	// DT_RUNPATH hides DT_RPATH
+	{ "/legacy/bin/old", NULL, NULL, "/nowhere:/usr/lib/", ELF_H_CLASS_64, "x86-64", { "libfoo.so.1" }, 1 },
+	{ "/masked/bin/new", NULL, "/nowhere", "/usr/lib", ELF_H_CLASS_64, "x86-64", { "libfoo.so.1" }, 1 },
+	{ "/arm/bin/y", NULL, NULL, NULL, ELF_H_CLASS_64, "AArch64", { "libbar.so.2" }, 1 },
+	{ "/app/sbin/z", NULL, "${ORIGIN}/./../lib/", NULL, ELF_H_CLASS_64, "x86-64", { "libfoo.so.1" }, 1 },
+};
+
+
+// Purpose:	Build and resolve a graph of scannedFiles, added in the given order
+static struct Elf_Dep_Graph* build_graph(int reverse, size_t* numUnresolved)
+{
+	struct Elf_Dep_Graph* retVal = create_dep_graph();
+	struct Elf_Details elven;
+	struct Elf_Dynamic_Info dynInfo;
+	const struct Test_File* file = NULL;
+	int i = 0;
+
+	for (i = 0; retVal && i < NUM_FILES; i++)
+	{
+		file = scannedFiles + (reverse ? NUM_FILES - 1 - i : i);
+		memset(&elven, 0, sizeof(elven));
+		memset(&dynInfo, 0, sizeof(dynInfo));
+		elven.processorType = file->elfClass;
+		elven.ISA = file->isa;
+		dynInfo.soname = file->soname;
+		dynInfo.runpath = file->runpath;
+		dynInfo.rpath = file->rpath;
+		dynInfo.needed = (const char**)file->needed;
+		dynInfo.numNeeded = file->numNeeded;
+		if (add_dep_node(retVal, file->path, &elven, &dynInfo) != ERROR_SUCCESS)
+		{
+			kill_dep_graph(&retVal);
+		}
+	}
+	*numUnresolved = resolve_dep_graph(retVal);
+
+	return retVal;
+}
+
+
+// Purpose:	Get the path a DT_NEEDED entry resolved to
+// Output:	The path, NULL if unresolved, "?" if the file or entry isn't in the graph
+static const char* get_resolved(struct Elf_Dep_Graph* depGraph, const char* fileName, const char* needed)
+{
+	const struct Elf_Dep_Node* nodes = NULL;
+	const struct Elf_Dep_Edge* edges = NULL;
+	size_t numNodes = 0;
+	size_t i = 0;
+	size_t j = 0;
+
+	if (get_dep_graph(depGraph, &nodes, &numNodes, &edges) != ERROR_SUCCESS)
+	{
+		return "?";
+	}
+	for (i = 0; i < numNodes; i++)
+	{
+		for (j = nodes[i].firstEdge; !strcmp(nodes[i].path, fileName) && j < nodes[i].firstEdge + nodes[i].numEdges; j++)
+		{
+			if (!strcmp(edges[j].name, needed))
+			{
+				return edges[j].target == DEP_UNRESOLVED ? NULL : nodes[edges[j].target].path;
+			}
+		}
+	}
+
+	return "?";
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	int tmpInt = 0;						// Return value
+	const char* resolved = NULL;		// Path an entry resolved to
+	const char* reverseResolved = NULL;	// Same, with the files added in reverse
+	struct Elf_Dep_Graph* depGraph = NULL;			// scannedFiles in order
+	struct Elf_Dep_Graph* reverseGraph = NULL;		// scannedFiles in reverse
+	size_t numUnresolved = 0;			// Returned by resolve_dep_graph()
+	size_t reverseUnresolved = 0;		// Same, for reverseGraph
+	struct Elf_Details* elvenStruct = NULL;		// SELF_PATH
+	struct Elf_Dynamic_Info dynInfo;	// Dynamic section of SELF_PATH
+	struct Elf_Dynamic_Info sectInfo;	// Same, found through the section headers
+	int numPrgmHdrs = 0;				// Saved elvenStruct->numPrgmHdrs
+	int numSectHdrs = 0;				// Saved elvenStruct->numSectHdrs
+	int goodInfo = FALSE;				// If TRUE, every check of this test passed
+	size_t i = 0;						// Iterating variable
+
+	/* UNIT TESTS */
+	// NORMAL
+	//// Normal1 - $ORIGIN/../lib beats /usr/lib
+	unitTest Normal1 = { "Normal1", "/app/bin/tool", "libfoo.so.1", "/app/lib/libfoo.so.1", NULL };
+	//// Normal2 - SONAME differs from the file name, other class ignored
+	unitTest Normal2 = { "Normal2", "/app/bin/tool", "libbar.so.2", "/usr/lib/libbar.so.2.0", NULL };
+	//// Normal3 - DT_RPATH with a trailing slash
+	unitTest Normal3 = { "Normal3", "/legacy/bin/old", "libfoo.so.1", "/usr/lib/libfoo.so.1", NULL };
+	//// Normal4 - Path given, no SONAME
+	unitTest Normal4 = { "Normal4", "/app/bin/tool", "/opt/abs/libabs.so", "/opt/abs/libabs.so", NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	Normal3.nextTest = &Normal4;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - Never scanned
+	unitTest Error1 = { "Error1", "/app/bin/tool", "libmissing.so.9", NULL, NULL };
+	//// Error2 - Only scanned for another ISA
+	unitTest Error2 = { "Error2", "/arm/bin/y", "libbar.so.2", NULL, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// BOUNDARY
+	//// Boundary1 - ${ORIGIN} with "." and a trailing slash
+	unitTest Boundary1 = { "Boundary1", "/app/sbin/z", "libfoo.so.1", "/app/lib/libfoo.so.1", NULL };
+	//// Boundary2 - DT_RUNPATH misses so DT_RPATH isn't used, lowest path wins
+	unitTest Boundary2 = { "Boundary2", "/masked/bin/new", "libfoo.so.1", "/app/lib/libfoo.so.1", NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, &BoundaryUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	depGraph = build_graph(FALSE, &numUnresolved);
+	reverseGraph = build_graph(TRUE, &reverseUnresolved);
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\t", currTst->testName);
+			numTests++;
+
+			// Resolve it, both ways round
+			resolved = get_resolved(depGraph, currTst->fileName, currTst->needed);
+			reverseResolved = get_resolved(reverseGraph, currTst->fileName, currTst->needed);
+
+			// Test the result (the order files were added in must not matter)
+			if (currTst->expectedPath ? resolved && reverseResolved && !strcmp(resolved, currTst->expectedPath) \
+				&& !strcmp(reverseResolved, currTst->expectedPath) : !resolved && !reverseResolved)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\tExpected:\t%s\n", currTst->expectedPath ? currTst->expectedPath : "-");
+				printf("\t\tReceived:\t%s (%s added in reverse)\n", resolved ? resolved : "-", \
+					reverseResolved ? reverseResolved : "-");
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* GRAPH TESTS */
+	printf("Running 'Graph Tests'...\n");
+	//// Only the two error entries are unresolved
+	printf("\tUnresolved:\t");
+	numTests++;
+	goodInfo = depGraph && reverseGraph && numUnresolved == 2 && reverseUnresolved == 2;
+	printf("%s\n", goodInfo ? "Pass" : "FAIL");
+	numPass += goodInfo ? 1 : 0;
+	//// Bad input
+	printf("\tNULL input:\t");
+	numTests++;
+	goodInfo = read_elf_dynamic(NULL, &dynInfo) == ERROR_NULL_PTR && add_dep_node(depGraph, NULL, NULL, NULL) \
+		== ERROR_NULL_PTR && resolve_dep_graph(NULL) == 0 && kill_dep_graph(NULL) == ERROR_NULL_PTR;
+	printf("%s\n", goodInfo ? "Pass" : "FAIL");
+	numPass += goodInfo ? 1 : 0;
+
+	/* FILE TESTS */
+	printf("Running 'File Tests'...\n");
+	elvenStruct = read_elf(SELF_PATH);
+	//// This program needs libc
+	printf("\tSegment:\t");
+	numTests++;
+	tmpInt = elvenStruct ? read_elf_dynamic(elvenStruct, &dynInfo) : ERROR_NULL_PTR;
+	goodInfo = FALSE;
+	for (i = 0; tmpInt == ERROR_SUCCESS && i < dynInfo.numNeeded; i++)
+	{
+		goodInfo = goodInfo || !strcmp(dynInfo.needed[i], "libc.so.6");
+	}
+	// Every name resolved, so all of the allocation was used
+	goodInfo = goodInfo && dynInfo.neededCapacity == dynInfo.numNeeded;
+	printf("%s\n", goodInfo ? "Pass" : "FAIL");
+	numPass += goodInfo ? 1 : 0;
+	//// Same entries from the section headers alone
+	printf("\tSection:\t");
+	numTests++;
+	numPrgmHdrs = elvenStruct ? elvenStruct->numPrgmHdrs : 0;
+	numSectHdrs = elvenStruct ? elvenStruct->numSectHdrs : 0;
+	if (elvenStruct)
+	{
+		elvenStruct->numPrgmHdrs = 0;
+	}
+	tmpInt = elvenStruct ? read_elf_dynamic(elvenStruct, &sectInfo) : ERROR_NULL_PTR;
+	goodInfo = tmpInt == ERROR_SUCCESS && sectInfo.numNeeded == dynInfo.numNeeded && sectInfo.numNeeded > 0;
+	for (i = 0; goodInfo == TRUE && i < sectInfo.numNeeded; i++)
+	{
+		goodInfo = !strcmp(sectInfo.needed[i], dynInfo.needed[i]);
+	}
+	printf("%s\n", goodInfo ? "Pass" : "FAIL");
+	numPass += goodInfo ? 1 : 0;
+	free_dynamic_info(&sectInfo);
+	//// Neither (e.g., a static executable)
+	printf("\tNo dynamic:\t");
+	numTests++;
+	if (elvenStruct)
+	{
+		elvenStruct->numSectHdrs = 0;
+	}
+	tmpInt = elvenStruct ? read_elf_dynamic(elvenStruct, &sectInfo) : ERROR_NULL_PTR;
+	goodInfo = tmpInt == DYNAMIC_NOT_FOUND && sectInfo.numNeeded == 0 && !sectInfo.needed;
+	printf("%s\n", goodInfo ? "Pass" : "FAIL");
+	numPass += goodInfo ? 1 : 0;
+	errno = 0;
+
+	/* CLEAN UP */
+	if (elvenStruct)
+	{
+		elvenStruct->numPrgmHdrs = numPrgmHdrs;
+		elvenStruct->numSectHdrs = numSectHdrs;
+		kill_elf(&elvenStruct);
+	}
+	free_dynamic_info(&dynInfo);
+	kill_dep_graph(&depGraph);
+	kill_dep_graph(&reverseGraph);
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
@@ -0,0 +1,222 @@
+#include "../Elf_Details.h"
+#include "../Elf_Json.h"
+#include <stdio.h>		// I/O
+#include <string.h>		// strcmp
+
+#define SELF_PATH		"/proc/self/exe"	// Always an ELF file
+#define READ_BUFF_SIZE	65536				// Bytes read back from the stream
+
+
+typedef struct ejTest
+{
+	char* testName;
+	char* inputStr;			// String to pass to output_json_str()
+	char* expectedOutput;	// What should come out of the stream
+	struct ejTest* nextTest;
+} unitTest;
+
+
+typedef struct ejTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// Purpose:	Flush output then read everything written to stream
+static size_t read_back(struct Elf_Output* output, FILE* stream, char* readBuff)
+{
+	size_t numRead = 0;
+
+	flush_elf_output(output);
+	rewind(stream);
+	numRead = fread(readBuff, 1, READ_BUFF_SIZE - 1, stream);
+	readBuff[numRead] = '\0';
+	fclose(stream);
+
+	return numRead;
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	struct Elf_Output output;			// Output under test
+	char buff[OUTPUT_BUFF_SIZE];		// Buffer for output
+	char readBuff[READ_BUFF_SIZE];		// What came out of the stream
+	FILE* stream = NULL;				// Temporary file the output is written to
+	struct Elf_Details* testStruct = NULL;	// Parsed SELF_PATH
+	size_t numRead = 0;					// Bytes read back
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", "/usr/bin/ls", "\"/usr/bin/ls\"", NULL };
+	unitTest Normal2 = { "Normal2", "64-bit format", "\"64-bit format\"", NULL };
+	unitTest Normal3 = { "Normal3", "¡NOT CONFIGURED!", "\"¡NOT CONFIGURED!\"", NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - NULL
+	unitTest Error1 = { "Error1", NULL, "null", NULL };
+	//// Error2 - Stray continuation byte
+	unitTest Error2 = { "Error2", ".te\x80xt", "\".te\\ufffdxt\"", NULL };
+	//// Error3 - Truncated multi-byte character
+	unitTest Error3 = { "Error3", "abc\xE2\x82", "\"abc\\ufffd\\ufffd\"", NULL };
+	//// Error4 - Overlong encoding of '/'
+	unitTest Error4 = { "Error4", "\xC0\xAF", "\"\\ufffd\\ufffd\"", NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	Error3.nextTest = &Error4;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// BOUNDARY
+	//// Boundary1 - Empty string
+	unitTest Boundary1 = { "Boundary1", "", "\"\"", NULL };
+	//// Boundary2 - Largest code point
+	unitTest Boundary2 = { "Boundary2", "\xF4\x8F\xBF\xBF", "\"\xF4\x8F\xBF\xBF\"", NULL };
+	//// Boundary3 - Just past the largest code point
+	unitTest Boundary3 = { "Boundary3", "\xF4\x90\x80\x80", "\"\\ufffd\\ufffd\\ufffd\\ufffd\"", NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	Boundary2.nextTest = &Boundary3;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// SPECIAL
+	//// Special1 - Characters JSON reserves
+	unitTest Special1 = { "Special1", "a\"b\\c", "\"a\\\"b\\\\c\"", NULL };
+	//// Special2 - Control characters
+	unitTest Special2 = { "Special2", "\t\n\r\x01\x1f", "\"\\t\\n\\r\\u0001\\u001f\"", NULL };
+	//// Link Tests
+	Special1.nextTest = &Special2;
+	//// Create Test Group
+	unitTestGroup SpecialUnitTests = { "Special Unit Tests", &Special1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, &BoundaryUnitTests, &SpecialUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\t", currTst->testName);
+			numTests++;
+			// Function call
+			stream = tmpfile();
+			init_elf_output(&output, stream, buff, sizeof(buff));
+			output_json_str(&output, currTst->inputStr);
+			read_back(&output, stream, readBuff);
+
+			// Test output
+			if (!strcmp(readBuff, currTst->expectedOutput))
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\tExpected:\t%s\n", currTst->expectedOutput);
+				printf("\t\tReceived:\t%s\n", readBuff);
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* RECORDS */
+	// Error record
+	printf("Error record:\t\t");
+	numTests++;
+	stream = tmpfile();
+	init_elf_output(&output, stream, buff, sizeof(buff));
+	format_json_unparsed(&output, "missing", ENOENT);
+	read_back(&output, stream, readBuff);
+	if (!strcmp(readBuff, "{\"file\":\"missing\",\"status\":\"error\",\"errno\":2,\"error\":\"No such file or directory\"}\n"))
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n\t%s", readBuff);
+	}
+
+	// Not ELF record
+	printf("Not ELF record:\t\t");
+	numTests++;
+	stream = tmpfile();
+	init_elf_output(&output, stream, buff, sizeof(buff));
+	format_json_unparsed(&output, "notes.txt", 0);
+	read_back(&output, stream, readBuff);
+	if (!strcmp(readBuff, "{\"file\":\"notes.txt\",\"status\":\"not_elf\"}\n"))
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n\t%s", readBuff);
+	}
+
+	// ELF record is one line holding both tables
+	printf("ELF record:\t\t");
+	numTests++;
+	testStruct = read_elf(SELF_PATH);
+	stream = tmpfile();
+	init_elf_output(&output, stream, buff, sizeof(buff));
+	format_elf_json(&output, testStruct);
+	numRead = read_back(&output, stream, readBuff);
+	if (numRead > 0 && numRead < READ_BUFF_SIZE - 1 && !strncmp(readBuff, "{\"file\":\"" SELF_PATH "\",\"status\":\"elf\",", 34) \
+		&& strchr(readBuff, '\n') == readBuff + numRead - 1 && strstr(readBuff, "\"segments\":[{") \
+		&& strstr(readBuff, "\"name\":\".text\"") && !strcmp(readBuff + numRead - 3, "]}\n"))
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n\t%s", readBuff);
+	}
+	kill_elf_mapped(&testStruct);
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
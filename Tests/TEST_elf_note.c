@@ -0,0 +1,329 @@
+#include "../Elf_Details.h"
+#include "../Elf_Decode.h"
+#include "../Elf_Note.h"
+#include <errno.h>
+#include <stdio.h>		// I/O
+#include <stdlib.h>		// mkstemp()
+#include <fcntl.h>		// open()
+#include <string.h>		// memcmp()
+#include <unistd.h>		// close()/unlink()
+
+#define SELF_PATH		"/proc/self/exe"	// Always an ELF file (linked with a build ID)
+
+
+typedef struct enTest
+{
+	char* testName;
+	const unsigned char* notes;	// Little endian note area
+	size_t size;				// Bytes in notes
+	uint64_t align;				// Passed to find_build_id_note()
+	int expectedReturn;			// find_build_id_note() return value
+	size_t expectedSize;		// Bytes of build ID found
+	struct enTest* nextTest;
+} unitTest;
+
+
+typedef struct enTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+/* NOTE AREAS */
+// namesz, descsz, type, name, descriptor
+static const unsigned char buildIdOnly[] = { 4,0,0,0, 4,0,0,0, 3,0,0,0, 'G','N','U',0, 0xDE,0xAD,0xBE,0xEF };
+static const unsigned char abiThenBuildId[] = { 4,0,0,0, 16,0,0,0, 1,0,0,0, 'G','N','U',0, \
+	0,0,0,0, 3,0,0,0, 2,0,0,0, 0,0,0,0, \
+	4,0,0,0, 4,0,0,0, 3,0,0,0, 'G','N','U',0, 0xDE,0xAD,0xBE,0xEF };
+// NT_GNU_PROPERTY_TYPE_0 padded to 8, then the build ID
+static const unsigned char propertyThenBuildId[] = { 4,0,0,0, 4,0,0,0, 5,0,0,0, 'G','N','U',0, 1,2,3,4, 0,0,0,0, \
+	4,0,0,0, 4,0,0,0, 3,0,0,0, 'G','N','U',0, 0xDE,0xAD,0xBE,0xEF };
+static const unsigned char truncatedDesc[] = { 4,0,0,0, 20,0,0,0, 3,0,0,0, 'G','N','U',0, 0xDE,0xAD,0xBE,0xEF };
+static const unsigned char wrongOwner[] = { 4,0,0,0, 4,0,0,0, 3,0,0,0, 'G','N','V',0, 0xDE,0xAD,0xBE,0xEF };
+static const unsigned char oneByteDesc[] = { 4,0,0,0, 1,0,0,0, 3,0,0,0, 'G','N','U',0, 0xAB };
+static unsigned char tooLong[12 + 4 + NOTE_MAX_BUILD_ID + 4] = { 4,0,0,0, NOTE_MAX_BUILD_ID + 4,0,0,0, 3,0,0,0, 'G','N','U',0 };
+
+
+// Purpose:	Read a whole file
+static unsigned char* slurp_file(const char* fileName, size_t* fileSize);
+static int rewrite_file(const char* fileName, const unsigned char* guts, size_t size);
+static void use_extended_numbering(unsigned char* guts, const struct Elf_Details* elven_struct);
+
+
+static unsigned char* slurp_file(const char* fileName, size_t* fileSize)
+{
+	FILE* inFile = fopen(fileName, "rb");
+	unsigned char* retVal = NULL;
+	size_t capacity = 0;
+	size_t numRead = 0;
+
+	*fileSize = 0;
+	while (inFile)
+	{
+		capacity = capacity ? capacity * 2 : 65536;
+		retVal = (unsigned char*)realloc(retVal, capacity);
+		numRead = fread(retVal + *fileSize, 1, capacity - *fileSize, inFile);
+		*fileSize += numRead;
+		if (*fileSize < capacity)
+		{
+			break;
+		}
+	}
+	if (inFile)
+	{
+		fclose(inFile);
+	}
+
+	return retVal;
+}
+
+
+static int rewrite_file(const char* fileName, const unsigned char* guts, size_t size)
+{
+	int fileFd = open(fileName, O_WRONLY | O_TRUNC);
+	int retVal = FALSE;
+
+	if (fileFd >= 0)
+	{
+		retVal = write(fileFd, guts, size) == (ssize_t)size ? TRUE : FALSE;
+		close(fileFd);
+	}
+
+	return retVal;
+}
+
+
+// Moves e_phnum and e_shnum into section 0, like a file with too many entries for the ELF header
+static void use_extended_numbering(unsigned char* guts, const struct Elf_Details* elven_struct)
+{
+	uint16_t xnum = ELF_P_NUM_XNUM;
+	uint16_t zero = 0;
+	uint32_t numPrgmHdrs = (uint32_t)elven_struct->numPrgmHdrs;
+	uint32_t numSectHdrs32 = (uint32_t)elven_struct->numSectHdrs;
+	uint64_t numSectHdrs64 = (uint64_t)elven_struct->numSectHdrs;
+
+	// SELF_PATH is in host byte order
+	if (elven_struct->processorType == ELF_H_CLASS_32)
+	{
+		memcpy(guts + 0x2C, &xnum, sizeof(xnum));
+		memcpy(guts + 0x30, &zero, sizeof(zero));
+		memcpy(guts + elven_struct->sHdr32 + 0x1C, &numPrgmHdrs, sizeof(numPrgmHdrs));
+		memcpy(guts + elven_struct->sHdr32 + 0x14, &numSectHdrs32, sizeof(numSectHdrs32));
+	}
+	else
+	{
+		memcpy(guts + 0x38, &xnum, sizeof(xnum));
+		memcpy(guts + 0x3C, &zero, sizeof(zero));
+		memcpy(guts + elven_struct->sHdr64 + 0x2C, &numPrgmHdrs, sizeof(numPrgmHdrs));
+		memcpy(guts + elven_struct->sHdr64 + 0x20, &numSectHdrs64, sizeof(numSectHdrs64));
+	}
+
+	return;
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	int tmpInt = 0;						// Return value
+	const struct Elf_Decoders* decoders = get_elf_decoders(ELF_H_CLASS_64, ELF_H_DATA_LITTLE);	// Notes above
+	struct Elf_Build_Id buildId;		// Found build ID
+	struct Elf_Build_Id selfId;			// Build ID of SELF_PATH
+	struct Elf_Details* elvenStruct = NULL;	// SELF_PATH, for its Program Header Table
+	unsigned char* selfGuts = NULL;		// Contents of SELF_PATH
+	size_t selfSize = 0;				// Bytes in selfGuts
+	char copyName[] = "/tmp/TEST_elf_note.XXXXXX";	// SELF_PATH without PT_NOTE segments
+	int copyFd = -1;					// File descriptor of copyName
+	uint64_t entryOffset = 0;			// Offset of a Program Header entry
+	int goodId = FALSE;					// If TRUE, every check of this test passed
+	int i = 0;							// Iterating variable
+
+	/* UNIT TESTS */
+	// NORMAL
+	//// Normal1 - Only a build ID
+	unitTest Normal1 = { "Normal1", buildIdOnly, sizeof(buildIdOnly), 4, ERROR_SUCCESS, 4, NULL };
+	//// Normal2 - After the ABI tag
+	unitTest Normal2 = { "Normal2", abiThenBuildId, sizeof(abiThenBuildId), 4, ERROR_SUCCESS, 4, NULL };
+	//// Normal3 - 8 byte aligned, after a property note
+	unitTest Normal3 = { "Normal3", propertyThenBuildId, sizeof(propertyThenBuildId), 8, ERROR_SUCCESS, 4, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - Descriptor runs past the note area
+	unitTest Error1 = { "Error1", truncatedDesc, sizeof(truncatedDesc), 4, NOTE_NOT_FOUND, 0, NULL };
+	//// Error2 - Someone else's note type 3
+	unitTest Error2 = { "Error2", wrongOwner, sizeof(wrongOwner), 4, NOTE_NOT_FOUND, 0, NULL };
+	//// Error3 - Longer than NOTE_MAX_BUILD_ID
+	unitTest Error3 = { "Error3", tooLong, sizeof(tooLong), 4, ERROR_OVERFLOW, 0, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// BOUNDARY
+	//// Boundary1 - Empty note area
+	unitTest Boundary1 = { "Boundary1", buildIdOnly, 0, 4, NOTE_NOT_FOUND, 0, NULL };
+	//// Boundary2 - One byte build ID, unpadded
+	unitTest Boundary2 = { "Boundary2", oneByteDesc, sizeof(oneByteDesc), 4, ERROR_SUCCESS, 1, NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, &BoundaryUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\t", currTst->testName);
+			numTests++;
+
+			// Search it
+			memset(&buildId, 0, sizeof(buildId));
+			tmpInt = find_build_id_note(currTst->notes, currTst->size, currTst->align, decoders, &buildId);
+
+			// Test return value
+			if (tmpInt == currTst->expectedReturn && buildId.size == currTst->expectedSize \
+				&& (!buildId.size || (buildId.offset + buildId.size <= currTst->size \
+				&& !memcmp(currTst->notes + buildId.offset, buildId.id, buildId.size))))
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\tExpected:\t%d (%zu bytes)\n", currTst->expectedReturn, currTst->expectedSize);
+				printf("\t\tReceived:\t%d (%zu bytes)\n", tmpInt, buildId.size);
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* FILE TESTS */
+	printf("Running 'File Tests'...\n");
+	//// The build ID is where it says it is
+	printf("\tSegment:\t");
+	numTests++;
+	selfGuts = slurp_file(SELF_PATH, &selfSize);
+	tmpInt = read_elf_build_id(SELF_PATH, &selfId);
+	goodId = tmpInt == ERROR_SUCCESS && selfId.source == NOTE_SOURCE_SEGMENT && selfId.size > 0 && selfGuts \
+		&& selfId.offset + selfId.size <= selfSize && !memcmp(selfGuts + selfId.offset, selfId.id, selfId.size);
+	printf("%s\n", goodId ? "Pass" : "FAIL");
+	numPass += goodId ? 1 : 0;
+	//// Same build ID from the sections once the PT_NOTE entries are gone
+	printf("\tSection:\t");
+	numTests++;
+	elvenStruct = read_elf(SELF_PATH);
+	copyFd = mkstemp(copyName);
+	for (i = 0; elvenStruct && selfGuts && i < elvenStruct->numPrgmHdrs; i++)
+	{
+		if (elvenStruct->prgmHdrs[i].type == ELF_P_TYPE_NOTE)
+		{
+			// p_type is the first word of the entry in either class
+			entryOffset = (elvenStruct->processorType == ELF_H_CLASS_32 ? elvenStruct->pHdr32 : elvenStruct->pHdr64) \
+				+ ((uint64_t)i * elvenStruct->prgmHdrSize);
+			memset(selfGuts + entryOffset, 0, sizeof(uint32_t));
+		}
+	}
+	goodId = copyFd >= 0 && selfGuts && write(copyFd, selfGuts, selfSize) == (ssize_t)selfSize;
+	if (copyFd >= 0)
+	{
+		close(copyFd);
+	}
+	tmpInt = read_elf_build_id(copyName, &buildId);
+	goodId = goodId && tmpInt == ERROR_SUCCESS && buildId.source == NOTE_SOURCE_SECTION \
+		&& buildId.size == selfId.size && !memcmp(buildId.id, selfId.id, selfId.size);
+	printf("%s\n", goodId ? "Pass" : "FAIL");
+	numPass += goodId ? 1 : 0;
+	//// Both counts held in section 0, so only the sections have the build ID
+	printf("\tExtended:\t");
+	numTests++;
+	if (elvenStruct && selfGuts && elvenStruct->numSectHdrs > 0)
+	{
+		use_extended_numbering(selfGuts, elvenStruct);
+	}
+	goodId = elvenStruct && selfGuts && elvenStruct->numSectHdrs > 0 && rewrite_file(copyName, selfGuts, selfSize);
+	tmpInt = read_elf_build_id(copyName, &buildId);
+	goodId = goodId && tmpInt == ERROR_SUCCESS && buildId.source == NOTE_SOURCE_SECTION \
+		&& buildId.size == selfId.size && !memcmp(buildId.id, selfId.id, selfId.size);
+	printf("%s\n", goodId ? "Pass" : "FAIL");
+	numPass += goodId ? 1 : 0;
+	//// Same, with the PT_NOTE entries back
+	printf("\tExtended segs:\t");
+	numTests++;
+	free(selfGuts);
+	selfGuts = slurp_file(SELF_PATH, &selfSize);
+	if (elvenStruct && selfGuts && elvenStruct->numSectHdrs > 0)
+	{
+		use_extended_numbering(selfGuts, elvenStruct);
+	}
+	goodId = elvenStruct && selfGuts && elvenStruct->numSectHdrs > 0 && rewrite_file(copyName, selfGuts, selfSize);
+	tmpInt = read_elf_build_id(copyName, &buildId);
+	goodId = goodId && tmpInt == ERROR_SUCCESS && buildId.source == NOTE_SOURCE_SEGMENT \
+		&& buildId.size == selfId.size && !memcmp(buildId.id, selfId.id, selfId.size);
+	printf("%s\n", goodId ? "Pass" : "FAIL");
+	numPass += goodId ? 1 : 0;
+	//// Not an ELF file
+	printf("\tNot ELF:\t");
+	numTests++;
+	tmpInt = read_elf_build_id("TEST_elf_note.c", &buildId);
+	printf("%s\n", tmpInt == ERROR_ORC_FILE ? "Pass" : "FAIL");
+	numPass += tmpInt == ERROR_ORC_FILE ? 1 : 0;
+	//// Missing file
+	printf("\tMissing:\t");
+	numTests++;
+	tmpInt = read_elf_build_id("/nonexistent/TEST_elf_note", &buildId);
+	goodId = tmpInt == ERROR_BAD_ARG && errno == ENOENT && buildId.size == 0;
+	printf("%s\n", goodId ? "Pass" : "FAIL");
+	numPass += goodId ? 1 : 0;
+	errno = 0;
+
+	/* CLEAN UP */
+	unlink(copyName);
+	free(selfGuts);
+	kill_elf(&elvenStruct);
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
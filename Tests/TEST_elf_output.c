@@ -0,0 +1,215 @@
+#include "../Elf_Details.h"
+#include <inttypes.h>	// PRIx64
+#include <stdio.h>		// I/O
+#include <string.h>		// strcmp
+
+#define TINY_BUFF_SIZE	3		// Forces a flush every few bytes
+#define READ_BUFF_SIZE	256		// Bytes read back from the stream
+
+
+typedef enum outputType
+{
+	DEC_TYPE,		// output_dec()
+	UDEC_TYPE,		// output_udec()
+	HEX_TYPE,		// output_hex()
+	BINARY_TYPE,	// output_binary()
+	REPEAT_TYPE		// output_repeat()
+} formatType;
+
+
+typedef struct eoTest
+{
+	char* testName;
+	formatType type;		// Function to test
+	uint64_t value;			// Value to format
+	int option;				// minDigits, bigEndian, or numTimes
+	size_t buffSize;		// Size of the Elf_Output buffer
+	char* expectedOutput;	// What should come out of the stream
+	struct eoTest* nextTest;
+} unitTest;
+
+
+typedef struct eoTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	struct Elf_Output output;			// Output under test
+	char buff[OUTPUT_BUFF_SIZE];		// Buffer for output
+	char readBuff[READ_BUFF_SIZE];		// What came out of the stream
+	char expectBuff[READ_BUFF_SIZE];	// What printf() says should have come out
+	FILE* stream = NULL;				// Temporary file the output is written to
+	size_t numRead = 0;					// Bytes read back
+	uint32_t flags = 0x80000102;		// Value for the binary tests
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", DEC_TYPE, 1337, 0, OUTPUT_BUFF_SIZE, "1337", NULL };
+	unitTest Normal2 = { "Normal2", DEC_TYPE, (uint64_t)-42, 0, OUTPUT_BUFF_SIZE, "-42", NULL };
+	unitTest Normal3 = { "Normal3", UDEC_TYPE, 4294967295U, 0, OUTPUT_BUFF_SIZE, "4294967295", NULL };
+	unitTest Normal4 = { "Normal4", HEX_TYPE, 0x24770, 0, OUTPUT_BUFF_SIZE, "24770", NULL };
+	unitTest Normal5 = { "Normal5", HEX_TYPE, 0x61d0, 16, OUTPUT_BUFF_SIZE, "00000000000061d0", NULL };
+	unitTest Normal6 = { "Normal6", BINARY_TYPE, 0, TRUE, OUTPUT_BUFF_SIZE, \
+		"0000 0010 0000 0001 0000 0000 1000 0000 ", NULL };
+	unitTest Normal7 = { "Normal7", BINARY_TYPE, 0, FALSE, OUTPUT_BUFF_SIZE, \
+		"1000 0000 0000 0000 0000 0001 0000 0010 ", NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	Normal3.nextTest = &Normal4;
+	Normal4.nextTest = &Normal5;
+	Normal5.nextTest = &Normal6;
+	Normal6.nextTest = &Normal7;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// BOUNDARY
+	//// Boundary1 - Zero
+	unitTest Boundary1 = { "Boundary1", DEC_TYPE, 0, 0, OUTPUT_BUFF_SIZE, "0", NULL };
+	//// Boundary2 - Largest unsigned value
+	unitTest Boundary2 = { "Boundary2", UDEC_TYPE, UINT64_MAX, 0, OUTPUT_BUFF_SIZE, "18446744073709551615", NULL };
+	//// Boundary3 - Most negative signed value
+	unitTest Boundary3 = { "Boundary3", DEC_TYPE, (uint64_t)INT64_MIN, 0, OUTPUT_BUFF_SIZE, "-9223372036854775808", NULL };
+	//// Boundary4 - Padded wider than a uint64_t
+	unitTest Boundary4 = { "Boundary4", HEX_TYPE, UINT64_MAX, 18, OUTPUT_BUFF_SIZE, "00ffffffffffffffff", NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	Boundary2.nextTest = &Boundary3;
+	Boundary3.nextTest = &Boundary4;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// SPECIAL
+	//// Special1 - Digits split across flushes
+	unitTest Special1 = { "Special1", UDEC_TYPE, UINT64_MAX, 0, TINY_BUFF_SIZE, "18446744073709551615", NULL };
+	//// Special2 - Binary split across flushes
+	unitTest Special2 = { "Special2", BINARY_TYPE, 0, TRUE, TINY_BUFF_SIZE, \
+		"0000 0010 0000 0001 0000 0000 1000 0000 ", NULL };
+	//// Special3 - Repeat split across flushes
+	unitTest Special3 = { "Special3", REPEAT_TYPE, '#', 10, TINY_BUFF_SIZE, "##########", NULL };
+	//// Link Tests
+	Special1.nextTest = &Special2;
+	Special2.nextTest = &Special3;
+	//// Create Test Group
+	unitTestGroup SpecialUnitTests = { "Special Unit Tests", &Special1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &BoundaryUnitTests, &SpecialUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\t", currTst->testName);
+			numTests++;
+			// Function call
+			stream = tmpfile();
+			init_elf_output(&output, stream, buff, currTst->buffSize);
+			switch (currTst->type)
+			{
+				case DEC_TYPE:
+					output_dec(&output, (int64_t)currTst->value);
+					break;
+				case UDEC_TYPE:
+					output_udec(&output, currTst->value);
+					break;
+				case HEX_TYPE:
+					output_hex(&output, currTst->value, currTst->option);
+					break;
+				case BINARY_TYPE:
+					output_binary(&output, &flags, sizeof(flags), currTst->option);
+					break;
+				case REPEAT_TYPE:
+					output_repeat(&output, (char)currTst->value, currTst->option);
+					break;
+			}
+			flush_elf_output(&output);
+
+			// Read it back
+			rewind(stream);
+			numRead = fread(readBuff, 1, sizeof(readBuff) - 1, stream);
+			readBuff[numRead] = '\0';
+			fclose(stream);
+
+			// Test output
+			if (!strcmp(readBuff, currTst->expectedOutput) && !output.errnum)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\tExpected:\t%s\n", currTst->expectedOutput);
+				printf("\t\tReceived:\t%s\n", readBuff);
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* MATCHES PRINTF */
+	printf("Matches printf:\t\t");
+	numTests++;
+	stream = tmpfile();
+	init_elf_output(&output, stream, buff, TINY_BUFF_SIZE);
+	output_str(&output, "Entry Point:\t0x");
+	output_hex(&output, 0xdeadbeef, 8);
+	output_str(&output, "\nSegment:\t");
+	output_dec(&output, 12);
+	output_char(&output, '\n');
+	flush_elf_output(&output);
+	rewind(stream);
+	numRead = fread(readBuff, 1, sizeof(readBuff) - 1, stream);
+	readBuff[numRead] = '\0';
+	fclose(stream);
+	snprintf(expectBuff, sizeof(expectBuff), "Entry Point:\t0x%08" PRIx64 "\nSegment:\t%d\n", (uint64_t)0xdeadbeef, 12);
+	if (!strcmp(readBuff, expectBuff))
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
@@ -0,0 +1,286 @@
+#include "../Elf_Details.h"
+#include "../Elf_Record.h"
+#include <stdio.h>		// I/O
+#include <stdlib.h>		// mkstemp()
+#include <string.h>		// memcpy
+#include <unistd.h>		// unlink()
+
+#define SELF_PATH		"/proc/self/exe"	// Always an ELF file
+#define TINY_BUFF_SIZE	7					// Forces records to span flushes
+#define CORRUPT_SIZE	65536				// Bytes available for the corrupted record
+
+
+typedef struct erTest
+{
+	char* testName;
+	size_t offset;			// Byte of the first record to overwrite
+	unsigned char value;	// What to overwrite it with
+	size_t truncateTo;		// If not 0, only hand the reader this many bytes
+	int expectedReturn;		// next_elf_record() return value
+	struct erTest* nextTest;
+} unitTest;
+
+
+typedef struct erTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// Purpose:	Compare a decoded record to the struct it was written from
+static int matches_details(struct Elf_Record* record, struct Elf_Details* elven, int expectTables)
+{
+	struct Elf_Prgrm_Header prgmHdr;
+	struct Elf_Sectn_Header sectnHdr;
+	const char* sectName = NULL;
+	uint32_t i = 0;
+
+	if (record->status != RECORD_STATUS_ELF || record->bits != 64 || record->version != RECORD_VERSION \
+		|| strcmp(record->fileName, elven->fileName) || strcmp(record->ISA, elven->ISA) \
+		|| strcmp(record->elfClass, elven->elfClass) || record->entry != elven->ePnt64 \
+		|| record->shoff != elven->sHdr64 || record->sectHdrEntrNum != elven->sectHdrEntrNum)
+	{
+		return FALSE;
+	}
+	else if (expectTables == FALSE)
+	{
+		return record->numSegments == RECORD_NOT_READ && record->numSections == RECORD_NOT_READ;
+	}
+	else if (record->numSegments != (uint32_t)elven->numPrgmHdrs || record->numSections != (uint32_t)elven->numSectHdrs)
+	{
+		return FALSE;
+	}
+
+	for (i = 0; i < record->numSegments; i++)
+	{
+		if (get_record_segment(record, i, &prgmHdr) != ERROR_SUCCESS \
+			|| memcmp(&prgmHdr, elven->prgmHdrs + i, sizeof(prgmHdr)))
+		{
+			return FALSE;
+		}
+	}
+	for (i = 0; i < record->numSections; i++)
+	{
+		if (get_record_section(record, i, &sectnHdr, &sectName) != ERROR_SUCCESS \
+			|| memcmp(&sectnHdr, elven->sectHdrs + i, sizeof(sectnHdr)) \
+			|| strcmp(sectName, get_section_name(elven, i)))
+		{
+			return FALSE;
+		}
+	}
+
+	return get_record_segment(record, i + record->numSegments, &prgmHdr) == ERROR_BAD_ARG;
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	struct Elf_Details* fullStruct = NULL;		// Every table read
+	struct Elf_Details* headerStruct = NULL;	// Only the ELF header read
+	struct Elf_Output output;			// Records are written through this
+	char buff[TINY_BUFF_SIZE];			// Buffer for output
+	char tmpName[] = "/tmp/TEST_elf_record.XXXXXX";	// Record file
+	int tmpFd = -1;						// File descriptor of tmpName
+	FILE* stream = NULL;				// Stream of tmpName
+	struct Elf_Record_Reader reader;	// Reads the records back
+	struct Elf_Record record;			// One record read back
+	static unsigned char corrupt[CORRUPT_SIZE];	// Copy of the first record
+	static unsigned char corruptCopy[CORRUPT_SIZE];	// corrupt, corrupted by each test
+	size_t firstSize = 0;				// Bytes in the first record
+	int tmpInt = 0;						// Holds return values
+
+	/* UNIT TESTS */
+	// ERROR
+	//// Error1 - Bad magic
+	unitTest Error1 = { "Error1", RECORD_OFF_MAGIC, 'X', 0, ERROR_ORC_FILE, NULL };
+	//// Error2 - Truncated fixed part
+	unitTest Error2 = { "Error2", 0, 'E', RECORD_FIXED_SIZE - 1, ERROR_BAD_OFFSET, NULL };
+	//// Error3 - Truncated record
+	unitTest Error3 = { "Error3", 0, 'E', RECORD_FIXED_SIZE + 8, ERROR_BAD_OFFSET, NULL };
+	//// Error4 - String offset past the pool
+	unitTest Error4 = { "Error4", RECORD_OFF_STRINGS + 3, 0x7F, 0, ERROR_BAD_OFFSET, NULL };
+	//// Error5 - Section table past the end of the record
+	unitTest Error5 = { "Error5", RECORD_OFF_NUM_SECTS + 2, 0x01, 0, ERROR_BAD_OFFSET, NULL };
+	//// Error6 - Entries smaller than this version can decode
+	unitTest Error6 = { "Error6", RECORD_OFF_SEG_SIZE, 0x08, 0, ERROR_BAD_ARG, NULL };
+	//// Error7 - Pool past the end of the record
+	unitTest Error7 = { "Error7", RECORD_OFF_POOL_SIZE + 2, 0x01, 0, ERROR_BAD_OFFSET, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	Error3.nextTest = &Error4;
+	Error4.nextTest = &Error5;
+	Error5.nextTest = &Error6;
+	Error6.nextTest = &Error7;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// BOUNDARY
+	//// Boundary1 - Whole record
+	unitTest Boundary1 = { "Boundary1", RECORD_OFF_STATUS, RECORD_STATUS_ELF, 0, ERROR_SUCCESS, NULL };
+	//// Boundary2 - Later version
+	unitTest Boundary2 = { "Boundary2", RECORD_OFF_VERSION, 0x02, 0, ERROR_SUCCESS, NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &ErrorUnitTests, &BoundaryUnitTests, NULL };
+
+	/* WRITE RECORDS */
+	fullStruct = read_elf(SELF_PATH);
+	headerStruct = read_elf_header(SELF_PATH);
+	tmpFd = mkstemp(tmpName);
+	stream = fdopen(tmpFd, "wb");
+	init_elf_output(&output, stream, buff, sizeof(buff));
+	format_elf_record(&output, fullStruct);
+	format_elf_record(&output, headerStruct);
+	format_record_unparsed(&output, "notes.txt", 0);
+	format_record_unparsed(&output, "missing", ENOENT);
+	flush_elf_output(&output);
+	fclose(stream);
+
+	/* ROUND TRIP */
+	printf("Running 'Round Trip'...\n");
+	open_record_reader(&reader, tmpName);
+	//// Whole file
+	printf("\tWhole file:\t");
+	numTests++;
+	if (next_elf_record(&reader, &record) == ERROR_SUCCESS && matches_details(&record, fullStruct, TRUE) \
+		&& !(record.recordSize % RECORD_ALIGN))
+	{
+		printf("Pass\n");
+		numPass++;
+		firstSize = record.recordSize < CORRUPT_SIZE ? record.recordSize : CORRUPT_SIZE;
+		memcpy(corrupt, reader.buff, firstSize);
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+	//// Header only
+	printf("\tHeader only:\t");
+	numTests++;
+	if (next_elf_record(&reader, &record) == ERROR_SUCCESS && matches_details(&record, headerStruct, FALSE))
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+	//// Not ELF
+	printf("\tNot ELF:\t");
+	numTests++;
+	if (next_elf_record(&reader, &record) == ERROR_SUCCESS && record.status == RECORD_STATUS_NOT_ELF \
+		&& !strcmp(record.fileName, "notes.txt") && !record.ISA && record.numSections == RECORD_NOT_READ)
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+	//// Error
+	printf("\tError:\t\t");
+	numTests++;
+	if (next_elf_record(&reader, &record) == ERROR_SUCCESS && record.status == RECORD_STATUS_ERROR \
+		&& record.errnum == ENOENT && !strcmp(record.fileName, "missing"))
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+	//// End
+	printf("\tEnd:\t\t");
+	numTests++;
+	if (next_elf_record(&reader, &record) == RECORD_END && close_record_reader(&reader) == ERROR_SUCCESS \
+		&& !reader.buff)
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+	unlink(tmpName);
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\t", currTst->testName);
+			numTests++;
+			// Corrupt a fresh copy of the first record
+			memcpy(corruptCopy, corrupt, firstSize);
+			corruptCopy[currTst->offset] = currTst->value;
+			// Function call
+			init_record_reader(&reader, corruptCopy, currTst->truncateTo ? currTst->truncateTo : firstSize);
+			tmpInt = next_elf_record(&reader, &record);
+
+			// Test return value
+			if (tmpInt == currTst->expectedReturn \
+				&& (tmpInt != ERROR_SUCCESS || reader.offset == firstSize) \
+				&& (tmpInt == ERROR_SUCCESS || reader.offset == 0))
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\tExpected:\t%d\n", currTst->expectedReturn);
+				printf("\t\tReceived:\t%d\n", tmpInt);
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* CLEAN UP */
+	kill_elf(&fullStruct);
+	kill_elf(&headerStruct);
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
@@ -0,0 +1,282 @@
+#include "../Elf_Details.h"
+#include <inttypes.h>	// Print uint64_t variables
+#include <stdio.h>		// I/O
+#include <string.h>		// memcpy
+
+#define BUFF_SIZE 		1024
+#define SYM_NAMES		"\0outer\0inner\0data\0dup"				// Symbol string table contents
+#define SECT_NAMES		"\0.text\0.symtab\0.strtab\0.shstrtab"	// Section name string table contents
+#define SYM_NAMES_OFF	0x40						// Symbol string table offset
+#define SECT_NAMES_OFF	0x60						// Section name string table offset
+#define SYM_TABLE_OFF	0x90						// Symbol table offset
+#define SYM_TABLE_NUM	7							// Number of symbols (including the null symbol)
+#define SECT_TABLE_OFF	(SYM_TABLE_OFF + (SYM_TABLE_NUM * ELF_SYM_SIZE_64))	// Section Header Table offset
+#define SECT_TABLE_NUM	5							// Number of Section Header entries
+
+
+typedef struct esTest
+{
+	char* testName;
+	char* symName;			// Name to look up.  If NULL, look up addr instead.
+	uint64_t addr;			// Address to look up
+	char* expectedName;		// NULL if no symbol should be found
+	uint64_t expectedValue;	// Value of the symbol found
+	uint64_t expectedOffset;	// Offset of addr into the symbol found
+	struct esTest* nextTest;
+} unitTest;
+
+
+typedef struct esTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// Purpose:	Write a little endian value into buff
+static void put_le(unsigned char* buff, size_t offset, uint64_t value, int numBytes)
+{
+	int i = 0;
+
+	for (i = 0; i < numBytes; i++)
+	{
+		buff[offset + i] = (unsigned char)(value >> (8 * i));
+	}
+
+	return;
+}
+
+
+// Purpose:	Write one ELFCLASS64 Section Header Table entry into buff
+static void put_section(unsigned char* buff, int index, uint32_t name, uint32_t type, uint64_t offset, \
+	                    uint64_t size, uint32_t link, uint64_t entsize)
+{
+	size_t entry = SECT_TABLE_OFF + (index * ELF_S_SIZE_64);
+
+	put_le(buff, entry, name, 4);
+	put_le(buff, entry + 0x04, type, 4);
+	put_le(buff, entry + 0x18, offset, 8);
+	put_le(buff, entry + 0x20, size, 8);
+	put_le(buff, entry + 0x28, link, 4);
+	put_le(buff, entry + 0x38, entsize, 8);
+
+	return;
+}
+
+
+// Purpose:	Write one ELFCLASS64 symbol table entry into buff
+static void put_symbol(unsigned char* buff, int index, uint32_t name, unsigned char info, uint16_t shndx, \
+	                   uint64_t value, uint64_t size)
+{
+	size_t entry = SYM_TABLE_OFF + (index * ELF_SYM_SIZE_64);
+
+	put_le(buff, entry, name, 4);
+	buff[entry + 0x04] = info;
+	put_le(buff, entry + 0x06, shndx, 2);
+	put_le(buff, entry + 0x08, value, 8);
+	put_le(buff, entry + 0x10, size, 8);
+
+	return;
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	struct Elf_Details* testStruct = NULL;	// Struct to parse into
+	struct Elf_Symbol_Table* symTable = NULL;	// Symbols read from testStruct
+	const struct Elf_Symbol* symbol = NULL;	// Symbol found by the test
+	uint64_t symOffset = 0;				// Offset found by the test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	int tmpInt = 0;						// Holds parse_elf_buffer() return value
+	// 64-bit Little Endian x86-64 Shared object header
+	unsigned char elf64LE[BUFF_SIZE] = { \
+		0x7F, 0x45, 0x4C, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x03, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x00, 0x00, 0x40, 0x00, SECT_TABLE_NUM, 0x00, 0x04, 0x00, };
+	size_t elfSize = SECT_TABLE_OFF + (SECT_TABLE_NUM * ELF_S_SIZE_64);
+
+	/* SETUP BUFFER */
+	put_le(elf64LE, 0x28, SECT_TABLE_OFF, 8);
+	memcpy(elf64LE + SYM_NAMES_OFF, SYM_NAMES, sizeof(SYM_NAMES));
+	memcpy(elf64LE + SECT_NAMES_OFF, SECT_NAMES, sizeof(SECT_NAMES));
+	put_section(elf64LE, 1, 0x01, ELF_S_TYPE_PROGBITS, 0, 0, 0, 0);	// .text
+	put_section(elf64LE, 2, 0x07, ELF_S_TYPE_SYMTAB, SYM_TABLE_OFF, SYM_TABLE_NUM * ELF_SYM_SIZE_64, 3, ELF_SYM_SIZE_64);
+	put_section(elf64LE, 3, 0x0F, ELF_S_TYPE_STRTAB, SYM_NAMES_OFF, sizeof(SYM_NAMES), 0, 0);
+	put_section(elf64LE, 4, 0x17, ELF_S_TYPE_STRTAB, SECT_NAMES_OFF, sizeof(SECT_NAMES), 0, 0);
+	// outer is a function with a local label (inner) inside it
+	put_symbol(elf64LE, 1, 0x01, (ELF_SYM_BIND_GLOBAL << 4) | ELF_SYM_TYPE_FUNC, 1, 0x1000, 0x100);
+	put_symbol(elf64LE, 2, 0x07, (ELF_SYM_BIND_LOCAL << 4) | ELF_SYM_TYPE_NOTYPE, 1, 0x1010, 0);
+	put_symbol(elf64LE, 3, 0x0D, (ELF_SYM_BIND_GLOBAL << 4) | ELF_SYM_TYPE_OBJECT, 1, 0x2000, 8);
+	// dup is imported before it is defined
+	put_symbol(elf64LE, 4, 0x12, (ELF_SYM_BIND_GLOBAL << 4) | ELF_SYM_TYPE_FUNC, ELF_S_INDEX_UNDEF, 0, 0);
+	put_symbol(elf64LE, 5, 0x12, (ELF_SYM_BIND_GLOBAL << 4) | ELF_SYM_TYPE_FUNC, 1, 0x3000, 0x10);
+	// Section symbols never resolve addresses
+	put_symbol(elf64LE, 6, 0x07, (ELF_SYM_BIND_LOCAL << 4) | ELF_SYM_TYPE_SECTION, 1, 0x4000, 0x10);
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", NULL, 0x1050, "outer", 0x1000, 0x50, NULL };
+	unitTest Normal2 = { "Normal2", NULL, 0x2004, "data", 0x2000, 0x4, NULL };
+	unitTest Normal3 = { "Normal3", "outer", 0, "outer", 0x1000, 0, NULL };
+	unitTest Normal4 = { "Normal4", "data", 0, "data", 0x2000, 0, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	Normal3.nextTest = &Normal4;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - Before the first symbol
+	unitTest Error1 = { "Error1", NULL, 0x0FFF, NULL, 0, 0, NULL };
+	//// Error2 - No such name
+	unitTest Error2 = { "Error2", "missing", 0, NULL, 0, 0, NULL };
+	//// Error3 - Section symbols aren't indexed by address
+	unitTest Error3 = { "Error3", NULL, 0x4000, NULL, 0, 0, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// BOUNDARY
+	//// Boundary1 - Zero-sized label contains its own address
+	unitTest Boundary1 = { "Boundary1", NULL, 0x1010, "inner", 0x1010, 0, NULL };
+	//// Boundary2 - Just past the label falls back to the function around it
+	unitTest Boundary2 = { "Boundary2", NULL, 0x1011, "outer", 0x1000, 0x11, NULL };
+	//// Boundary3 - Last byte of the function
+	unitTest Boundary3 = { "Boundary3", NULL, 0x10FF, "outer", 0x1000, 0xFF, NULL };
+	//// Boundary4 - One past the end of the function
+	unitTest Boundary4 = { "Boundary4", NULL, 0x1100, NULL, 0, 0, NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	Boundary2.nextTest = &Boundary3;
+	Boundary3.nextTest = &Boundary4;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// SPECIAL
+	//// Special1 - Defined symbol wins over an undefined symbol with the same name
+	unitTest Special1 = { "Special1", "dup", 0, "dup", 0x3000, 0, NULL };
+	//// Create Test Group
+	unitTestGroup SpecialUnitTests = { "Special Unit Tests", &Special1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, \
+									  &BoundaryUnitTests, &SpecialUnitTests, NULL };
+
+	/* PARSE THE BUFFER */
+	testStruct = (struct Elf_Details*)gimme_mem(1, sizeof(struct Elf_Details));
+	tmpInt = parse_elf_buffer(testStruct, elf64LE, elfSize);
+	// Symbols are read from the retained file contents
+	testStruct->elfGuts = (char*)elf64LE;
+	testStruct->elfSize = elfSize;
+	symTable = read_elf_symbols(testStruct);
+	printf("Reading the symbols...\n");
+	printf("\tReturn:\t\t");
+	numTests++;
+	if (tmpInt == ERROR_SUCCESS && symTable && symTable->numSymbols == SYM_TABLE_NUM && symTable->numAddrs == 4)
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+	printf("\tNot A Table:\t");
+	numTests++;
+	if (!read_symbol_table(testStruct, 1) && !read_symbol_table(testStruct, SECT_TABLE_NUM))
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\n", currTst->testName);
+			// Function call
+			symOffset = 0;
+			if (currTst->symName)
+			{
+				symbol = find_symbol_by_name(symTable, currTst->symName);
+			}
+			else
+			{
+				symbol = find_symbol_by_addr(symTable, currTst->addr, &symOffset);
+			}
+
+			// Test return value
+			printf("\t\tReturn:\t\t");
+			numTests++;
+			if (!currTst->expectedName && !symbol)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else if (currTst->expectedName && symbol && symbol->symName \
+				&& !strcmp(symbol->symName, currTst->expectedName) \
+				&& symbol->value == currTst->expectedValue && symOffset == currTst->expectedOffset)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\t\tExpected:\t%s+0x%" PRIx64 "\n", currTst->expectedName, currTst->expectedOffset);
+				printf("\t\t\tReceived:\t%s+0x%" PRIx64 "\n", symbol ? symbol->symName : NULL, symOffset);
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* CLEAN UP */
+	kill_symbol_table(&symTable);
+	// elfGuts is on the stack
+	testStruct->elfGuts = NULL;
+	testStruct->elfSize = 0;
+	kill_elf(&testStruct);
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
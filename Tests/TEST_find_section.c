@@ -0,0 +1,258 @@
+#include "../Elf_Details.h"
+#include <stdio.h>		// I/O
+#include <string.h>		// memcpy
+
+#define BUFF_SIZE 		512
+#define DEFAULT_INT		((int)1337)
+#define SECT_NAMES		"\0.text\0.shstrtab\0.bad"	// Section name string table contents
+#define SECT_NAMES_OFF	0x40						// Section name string table offset
+#define SECT_TABLE_OFF	0x58						// Section Header Table offset
+#define SECT_TABLE_NUM	4							// Number of Section Header entries
+
+
+typedef struct fsTest
+{
+	char* testName;
+	char* sectName;
+	int actualResult;
+	int expectedResult;
+	struct fsTest* nextTest;
+} unitTest;
+
+
+typedef struct fsTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// Purpose:	Write a little endian value into buff
+static void put_le(unsigned char* buff, size_t offset, uint64_t value, int numBytes)
+{
+	int i = 0;
+
+	for (i = 0; i < numBytes; i++)
+	{
+		buff[offset + i] = (unsigned char)(value >> (8 * i));
+	}
+
+	return;
+}
+
+
+// Purpose:	Write one ELFCLASS64 Section Header Table entry into buff
+static void put_section(unsigned char* buff, int index, uint32_t name, uint32_t type, uint64_t offset, uint64_t size)
+{
+	size_t entry = SECT_TABLE_OFF + (index * ELF_S_SIZE_64);
+
+	put_le(buff, entry, name, 4);
+	put_le(buff, entry + 0x04, type, 4);
+	put_le(buff, entry + 0x18, offset, 8);
+	put_le(buff, entry + 0x20, size, 8);
+
+	return;
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	struct Elf_Details* testStruct = NULL;	// Struct to parse into
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	int tmpInt = 0;						// Holds parse_elf_buffer() return value
+	const char* tmpName = NULL;			// Holds get_section_name() return value
+	// 64-bit Little Endian x86-64 Shared object header with a Section Header Table
+	unsigned char elf64LE[BUFF_SIZE] = { \
+		0x7F, 0x45, 0x4C, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x03, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, SECT_TABLE_OFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x00, 0x00, 0x40, 0x00, SECT_TABLE_NUM, 0x00, 0x02, 0x00, };
+	size_t elfSize = SECT_TABLE_OFF + (SECT_TABLE_NUM * ELF_S_SIZE_64);
+
+	/* SETUP BUFFER */
+	memcpy(elf64LE + SECT_NAMES_OFF, SECT_NAMES, sizeof(SECT_NAMES));
+	put_section(elf64LE, 1, 0x01, ELF_S_TYPE_PROGBITS, 0, 0);	// .text
+	put_section(elf64LE, 2, 0x07, ELF_S_TYPE_STRTAB, SECT_NAMES_OFF, sizeof(SECT_NAMES) - 1);	// .shstrtab
+	put_section(elf64LE, 3, 0x11, ELF_S_TYPE_PROGBITS, 0, 0);	// .bad (runs off the end of .shstrtab)
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", ".text", DEFAULT_INT, 1, NULL };
+	unitTest Normal2 = { "Normal2", ".shstrtab", DEFAULT_INT, 2, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - No such section
+	unitTest Error1 = { "Error1", ".data", DEFAULT_INT, -1, NULL };
+	//// Error2 - NULL name
+	unitTest Error2 = { "Error2", NULL, DEFAULT_INT, -1, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// BOUNDARY
+	//// Boundary1 - Empty name matches the null section first
+	unitTest Boundary1 = { "Boundary1", "", DEFAULT_INT, 0, NULL };
+	//// Boundary2 - Last string in .shstrtab isn't nul-terminated inside the table
+	unitTest Boundary2 = { "Boundary2", ".bad", DEFAULT_INT, -1, NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, \
+									  &BoundaryUnitTests, NULL };
+
+	/* PARSE THE BUFFER */
+	testStruct = (struct Elf_Details*)gimme_mem(1, sizeof(struct Elf_Details));
+	tmpInt = parse_elf_buffer(testStruct, elf64LE, elfSize);
+	printf("Parsing the buffer...\n");
+	printf("\tReturn:\t\t");
+	numTests++;
+	if (tmpInt == ERROR_SUCCESS && testStruct->numSectHdrs == SECT_TABLE_NUM)
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+	printf("\tOut of Range:\t");
+	numTests++;
+	tmpName = get_section_name(testStruct, SECT_TABLE_NUM);
+	if (!tmpName && !get_section_name(testStruct, -1) && !get_section_name(testStruct, 3))
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\n", currTst->testName);
+			// Function call
+			currTst->actualResult = find_section(testStruct, currTst->sectName);
+
+			// Test return value
+			printf("\t\tReturn:\t\t");
+			numTests++;
+			if (currTst->actualResult == currTst->expectedResult)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\t\tExpected:\t%d\n", currTst->expectedResult);
+				printf("\t\t\tReceived:\t%d\n", currTst->actualResult);
+			}
+
+			// Name points into the buffer
+			if (currTst->expectedResult > 0)
+			{
+				printf("\t\tZero Copy:\t");
+				numTests++;
+				tmpName = get_section_name(testStruct, currTst->actualResult);
+				if (tmpName == (char*)elf64LE + SECT_NAMES_OFF + testStruct->sectHdrs[currTst->actualResult].name)
+				{
+					printf("Pass\n");
+					numPass++;
+				}
+				else
+				{
+					printf("FAIL\n");
+				}
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* CLEAN UP */
+	kill_elf(&testStruct);
+
+	/* EXTENDED NUMBERING */
+	// e_shnum 0 and e_shstrndx 0xFFFF move both into section 0 (size and link)
+	printf("Running 'Extended Numbering'...\n");
+	printf("\tReturn:\t\t");
+	numTests++;
+	put_le(elf64LE, 0x3C, 0, 2);
+	put_le(elf64LE, 0x3E, ELF_S_INDEX_XINDEX, 2);
+	put_le(elf64LE, SECT_TABLE_OFF + 0x20, SECT_TABLE_NUM, 8);
+	put_le(elf64LE, SECT_TABLE_OFF + 0x28, 2, 4);
+	testStruct = (struct Elf_Details*)gimme_mem(1, sizeof(struct Elf_Details));
+	tmpInt = parse_elf_buffer(testStruct, elf64LE, elfSize);
+	if (tmpInt == ERROR_SUCCESS && testStruct->numSectHdrs == SECT_TABLE_NUM \
+		&& find_section(testStruct, ".shstrtab") == 2 && find_section(testStruct, ".text") == 1)
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+	kill_elf(&testStruct);
+	//// A count that runs past the end of the buffer
+	printf("\tTruncated:\t");
+	numTests++;
+	put_le(elf64LE, SECT_TABLE_OFF + 0x20, SECT_TABLE_NUM + 1, 8);
+	testStruct = (struct Elf_Details*)gimme_mem(1, sizeof(struct Elf_Details));
+	tmpInt = parse_elf_buffer(testStruct, elf64LE, elfSize);
+	if (tmpInt == ERROR_BAD_OFFSET && !testStruct->sectHdrs)
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+	kill_elf(&testStruct);
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
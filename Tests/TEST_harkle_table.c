@@ -0,0 +1,220 @@
+#include "../Elf_Details.h"
+#include "../Harklehash.h"
+#include <stdio.h>		// I/O
+
+#define NUM_ENTRIES		((int)50000)	// Enough entries to force several index rebuilds
+#define NOT_FOUND		((int)-1)		// Expected value when lookup should return NULL
+#define LOOKUP_NAME		((int)1)
+#define LOOKUP_VALUE	((int)2)
+#define LOOKUP_HASH		((int)3)
+#define NUM_LIST_ENTRIES	((int)5000)	// Linked list entries added with add_entry()
+
+
+typedef struct hhtTest
+{
+	char* testName;
+	int lookupType;			// LOOKUP_*
+	char* needleName;		// Used by LOOKUP_NAME and LOOKUP_HASH
+	int needleValue;		// Used by LOOKUP_VALUE
+	int actualValue;		// Value of the entry found (NOT_FOUND if NULL)
+	int expectedValue;		// Expected value of the entry found
+	struct hhtTest* nextTest;
+} unitTest;
+
+
+typedef struct hhtTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	struct HarkleTable* testTable = NULL;	// Table under test
+	struct HarkleDict* tmpEntry = NULL;	// Holds return values from lookup_table_*()
+	struct HarkleDict* testList = NULL;	// Linked list under test
+	int goodList = FALSE;				// If TRUE, every check of the list test passed
+	char tmpName[32] = { 0 };			// Holds generated entry names
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	int i = 0;							// Iterating variable
+
+	/* SETUP TABLE */
+	// Start small so the table has to grow
+	testTable = create_a_table(0, TRUE);
+	for (i = 0; testTable && i < NUM_ENTRIES; i++)
+	{
+		snprintf(tmpName, sizeof(tmpName), "symbol_%d", i);
+		if (!add_table_entry(testTable, tmpName, i * 3))
+		{
+			printf("add_table_entry() failed on entry %d\n", i);
+			break;
+		}
+	}
+	// Duplicates should return the first one added
+	add_table_entry(testTable, "symbol_7", 1337);
+	add_table_entry(testTable, "duplicate", 21);
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", LOOKUP_NAME, "symbol_0", 0, NOT_FOUND, 0, NULL };
+	unitTest Normal2 = { "Normal2", LOOKUP_NAME, "symbol_31337", 0, NOT_FOUND, 31337 * 3, NULL };
+	unitTest Normal3 = { "Normal3", LOOKUP_VALUE, NULL, 4242 * 3, NOT_FOUND, 4242 * 3, NULL };
+	unitTest Normal4 = { "Normal4", LOOKUP_HASH, "symbol_3", 0, NOT_FOUND, 3 * 3, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	Normal3.nextTest = &Normal4;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - Name not in the table
+	unitTest Error1 = { "Error1", LOOKUP_NAME, "symbol_50000", 0, NOT_FOUND, NOT_FOUND, NULL };
+	//// Error2 - Value not in the table
+	unitTest Error2 = { "Error2", LOOKUP_VALUE, NULL, 4, NOT_FOUND, NOT_FOUND, NULL };
+	//// Error3 - NULL needle
+	unitTest Error3 = { "Error3", LOOKUP_NAME, NULL, 0, NOT_FOUND, NOT_FOUND, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// SPECIAL
+	//// Special1 - Duplicate name returns the first entry
+	unitTest Special1 = { "Special1", LOOKUP_NAME, "symbol_7", 0, NOT_FOUND, 7 * 3, NULL };
+	//// Special2 - Duplicate value returns the first entry
+	unitTest Special2 = { "Special2", LOOKUP_VALUE, NULL, 21, NOT_FOUND, 21, NULL };
+	//// Special3 - Last entry added
+	unitTest Special3 = { "Special3", LOOKUP_NAME, "duplicate", 0, NOT_FOUND, 21, NULL };
+	//// Link Tests
+	Special1.nextTest = &Special2;
+	Special2.nextTest = &Special3;
+	//// Create Test Group
+	unitTestGroup SpecialUnitTests = { "Special Unit Tests", &Special1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, \
+									  &SpecialUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\n", currTst->testName);
+			// Function call
+			if (currTst->lookupType == LOOKUP_NAME)
+			{
+				tmpEntry = lookup_table_name(testTable, currTst->needleName);
+			}
+			else if (currTst->lookupType == LOOKUP_VALUE)
+			{
+				tmpEntry = lookup_table_value(testTable, currTst->needleValue);
+			}
+			else
+			{
+				tmpEntry = lookup_table_hash(testTable, hash(currTst->needleName));
+				// hash() buckets collide so only verify the name hashes the same
+				if (tmpEntry && tmpEntry->hash == hash(currTst->needleName))
+				{
+					tmpEntry = lookup_table_name(testTable, currTst->needleName);
+				}
+			}
+
+			if (tmpEntry)
+			{
+				currTst->actualValue = tmpEntry->value;
+			}
+
+			// Test value found
+			printf("\t\tLookup:\t\t");
+			numTests++;
+			if (currTst->actualValue == currTst->expectedValue)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\t\tExpected:\t%d\n", currTst->expectedValue);
+				printf("\t\t\tReceived:\t%d\n", currTst->actualValue);
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* LINKED LIST */
+	printf("Running 'Linked List'...\n");
+	//// One node: the head is also the last node
+	printf("\tOne node:\t");
+	numTests++;
+	testList = add_entry(NULL, "only", 1);
+	goodList = testList && lookup_name(testList, "only") == testList && lookup_hash(testList, hash("only")) == testList \
+		&& !lookup_name(testList, "missing");
+	printf("%s\n", goodList ? "Pass" : "FAIL");
+	numPass += goodList ? 1 : 0;
+	//// Appended through the cached tail, in order
+	printf("\tAppend:\t\t");
+	numTests++;
+	for (i = 1; testList && i < NUM_LIST_ENTRIES; i++)
+	{
+		snprintf(tmpName, sizeof(tmpName), "list_%d", i);
+		testList = add_entry(testList, tmpName, i);
+	}
+	tmpEntry = lookup_name(testList, "list_4999");
+	goodList = testList && tmpEntry && tmpEntry->value == NUM_LIST_ENTRIES - 1 && !tmpEntry->next \
+		&& find_last_node(testList) == tmpEntry && testList->tail == tmpEntry && lookup_value(testList, 2) == testList->next->next;
+	printf("%s\n", goodList ? "Pass" : "FAIL");
+	numPass += goodList ? 1 : 0;
+	destroy_a_list(&testList);
+
+	/* CLEAN UP */
+	printf("\tTest Teardown:\n\t\tDestroy:\t");
+	numTests++;
+	if (destroy_a_table(&testTable) == NUM_ENTRIES + 2 && !testTable)
+	{
+		printf("Pass\n");
+		numPass++;
+	}
+	else
+	{
+		printf("FAIL\n");
+	}
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
@@ -0,0 +1,205 @@
+#include "../Elf_Details.h"
+#include <stdio.h>		// I/O
+#include <string.h>		// memcpy
+
+#define BUFF_SIZE 		128
+#define DEFAULT_INT		((int)1337)
+
+
+typedef struct pebTest
+{
+	char* testName;
+	unsigned char* inputBuffer;
+	size_t inputSize;
+	int actualResult;
+	int expectedResult;
+	int expectedClass;		// Expected processorType (only checked on ERROR_SUCCESS)
+	int expectedHdrSize;	// Expected elfHdrSize (only checked on ERROR_SUCCESS)
+	int expectedABIversion;	// Expected ABIversion (only checked on ERROR_SUCCESS)
+	struct pebTest* nextTest;
+} unitTest;
+
+
+typedef struct pebTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	struct Elf_Details* testStruct = NULL;	// Struct to parse into
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	// 64-bit Little Endian x86-64 Shared object
+	unsigned char elf64LE[BUFF_SIZE] = { \
+		0x7F, 0x45, 0x4C, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x03, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, };
+	// 32-bit Big Endian PowerPC Executable (ABI Version 2)
+	unsigned char elf32BE[BUFF_SIZE] = { \
+		0x7F, 0x45, 0x4C, 0x46, 0x01, 0x02, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x34, \
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x20, 0x00, 0x00, 0x00, 0x28, \
+		0x00, 0x00, 0x00, 0x00, };
+	// 64-bit header claiming one program header at an offset past the end of the buffer
+	unsigned char elf64BadPH[BUFF_SIZE] = { 0 };
+	// Not an ELF file (and no nul characters for strlen() to stop on)
+	unsigned char orcFile[BUFF_SIZE] = { 0 };
+
+	/* SETUP BUFFERS */
+	memcpy(elf64BadPH, elf64LE, ELF_H_SIZE_64);
+	elf64BadPH[0x20] = 0x64;	// Program Header Table Offset: 100
+	elf64BadPH[0x38] = 0x01;	// Number of Program Header Entries: 1
+	memset(orcFile, 'M', BUFF_SIZE);
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", elf64LE, ELF_H_SIZE_64, DEFAULT_INT, ERROR_SUCCESS, ELF_H_CLASS_64, ELF_H_SIZE_64, 0, NULL };
+	unitTest Normal2 = { "Normal2", elf32BE, ELF_H_SIZE_32, DEFAULT_INT, ERROR_SUCCESS, ELF_H_CLASS_32, ELF_H_SIZE_32, 2, NULL };
+	unitTest Normal3 = { "Normal3", elf64LE, BUFF_SIZE, DEFAULT_INT, ERROR_SUCCESS, ELF_H_CLASS_64, ELF_H_SIZE_64, 0, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - Not an ELF file
+	unitTest Error1 = { "Error1", orcFile, BUFF_SIZE, DEFAULT_INT, ERROR_ORC_FILE, 0, 0, 0, NULL };
+	//// Error2 - NULL buffer
+	unitTest Error2 = { "Error2", NULL, BUFF_SIZE, DEFAULT_INT, ERROR_NULL_PTR, 0, 0, 0, NULL };
+	//// Error3 - Program Header Table past the end of the buffer
+	unitTest Error3 = { "Error3", elf64BadPH, BUFF_SIZE, DEFAULT_INT, ERROR_BAD_OFFSET, 0, 0, 0, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// BOUNDARY
+	//// Boundary1 - Shorter than the magic number
+	unitTest Boundary1 = { "Boundary1", elf64LE, 3, DEFAULT_INT, ERROR_ORC_FILE, 0, 0, 0, NULL };
+	//// Boundary2 - One byte short of an ELFCLASS32 header
+	unitTest Boundary2 = { "Boundary2", elf32BE, ELF_H_SIZE_32 - 1, DEFAULT_INT, ERROR_BAD_OFFSET, 0, 0, 0, NULL };
+	//// Boundary3 - One byte short of an ELFCLASS64 header
+	unitTest Boundary3 = { "Boundary3", elf64LE, ELF_H_SIZE_64 - 1, DEFAULT_INT, ERROR_BAD_OFFSET, 0, 0, 0, NULL };
+	//// Boundary4 - Zero length
+	unitTest Boundary4 = { "Boundary4", elf64LE, 0, DEFAULT_INT, ERROR_ORC_FILE, 0, 0, 0, NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	Boundary2.nextTest = &Boundary3;
+	Boundary3.nextTest = &Boundary4;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, \
+									  &BoundaryUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\n", currTst->testName);
+			// Function call
+			testStruct = (struct Elf_Details*)gimme_mem(1, sizeof(struct Elf_Details));
+			currTst->actualResult = parse_elf_buffer(testStruct, currTst->inputBuffer, currTst->inputSize);
+
+			// Test return value
+			printf("\t\tReturn:\t\t");
+			numTests++;
+			if (currTst->actualResult == currTst->expectedResult)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\t\tExpected:\t%d\n", currTst->expectedResult);
+				printf("\t\t\tReceived:\t%d\n", currTst->actualResult);
+			}
+
+			// Test parsed values
+			if (currTst->expectedResult == ERROR_SUCCESS)
+			{
+				printf("\t\tClass:\t\t");
+				numTests++;
+				if (testStruct && testStruct->processorType == currTst->expectedClass)
+				{
+					printf("Pass\n");
+					numPass++;
+				}
+				else
+				{
+					printf("FAIL\n");
+				}
+
+				printf("\t\tHeader Size:\t");
+				numTests++;
+				if (testStruct && testStruct->elfHdrSize == currTst->expectedHdrSize)
+				{
+					printf("Pass\n");
+					numPass++;
+				}
+				else
+				{
+					printf("FAIL\n");
+				}
+
+				printf("\t\tABI Version:\t");
+				numTests++;
+				if (testStruct && testStruct->ABIversion == currTst->expectedABIversion)
+				{
+					printf("Pass\n");
+					numPass++;
+				}
+				else
+				{
+					printf("FAIL\n");
+				}
+			}
+
+			// Clean up
+			kill_elf(&testStruct);
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
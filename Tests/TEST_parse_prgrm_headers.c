@@ -0,0 +1,189 @@
+#include "../Elf_Details.h"
+#include <stdio.h>		// I/O
+#include <string.h>		// memcpy
+
+#define BUFF_SIZE 		128
+#define DEFAULT_INT		((int)1337)
+
+
+typedef struct pphTest
+{
+	char* testName;
+	unsigned char* inputBuffer;
+	size_t inputSize;
+	int actualResult;
+	int expectedResult;
+	int expectedNum;						// Expected numPrgmHdrs
+	struct Elf_Prgrm_Header expectedHdr;	// Expected first entry (only checked if expectedNum > 0)
+	struct pphTest* nextTest;
+} unitTest;
+
+
+typedef struct pphTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	struct Elf_Details* testStruct = NULL;	// Struct to parse into
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	// 64-bit Little Endian x86-64 Shared object with one PT_LOAD entry at offset 0x40
+	unsigned char elf64LE[BUFF_SIZE] = { \
+		0x7F, 0x45, 0x4C, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x03, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x34, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
+	// 32-bit Big Endian PowerPC Executable with one PT_LOAD entry at offset 0x34
+	unsigned char elf32BE[BUFF_SIZE] = { \
+		0x7F, 0x45, 0x4C, 0x46, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x34, \
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x20, 0x00, 0x01, 0x00, 0x28, \
+		0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, };
+	// 64-bit header with no program headers
+	unsigned char elf64NoPH[BUFF_SIZE] = { 0 };
+	// 64-bit header claiming entries smaller than an ELFCLASS64 entry
+	unsigned char elf64SmallPH[BUFF_SIZE] = { 0 };
+
+	/* SETUP BUFFERS */
+	memcpy(elf64NoPH, elf64LE, BUFF_SIZE);
+	elf64NoPH[0x38] = 0x00;		// Number of Program Header Entries: 0
+	memcpy(elf64SmallPH, elf64LE, BUFF_SIZE);
+	elf64SmallPH[0x36] = 0x20;	// Program Header Entry Size: 32
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", elf64LE, ELF_H_SIZE_64 + ELF_P_SIZE_64, DEFAULT_INT, ERROR_SUCCESS, 1, \
+		{ ELF_P_TYPE_LOAD, ELF_P_FLAG_R | ELF_P_FLAG_X, 0x1000, 0x401000, 0x401000, 0x234, 0x300, 0x1000 }, NULL };
+	unitTest Normal2 = { "Normal2", elf32BE, ELF_H_SIZE_32 + ELF_P_SIZE_32, DEFAULT_INT, ERROR_SUCCESS, 1, \
+		{ ELF_P_TYPE_LOAD, ELF_P_FLAG_R | ELF_P_FLAG_W, 0x0, 0x10000000, 0x10000000, 0x1F4, 0x1F4, 0x10000 }, NULL };
+	unitTest Normal3 = { "Normal3", elf64NoPH, BUFF_SIZE, DEFAULT_INT, ERROR_SUCCESS, 0, { 0 }, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - Entry size too small for the class
+	unitTest Error1 = { "Error1", elf64SmallPH, BUFF_SIZE, DEFAULT_INT, ERROR_BAD_OFFSET, 0, { 0 }, NULL };
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// BOUNDARY
+	//// Boundary1 - Last entry one byte short
+	unitTest Boundary1 = { "Boundary1", elf64LE, ELF_H_SIZE_64 + ELF_P_SIZE_64 - 1, DEFAULT_INT, ERROR_BAD_OFFSET, 0, { 0 }, NULL };
+	//// Boundary2 - Last entry one byte short (32-bit)
+	unitTest Boundary2 = { "Boundary2", elf32BE, ELF_H_SIZE_32 + ELF_P_SIZE_32 - 1, DEFAULT_INT, ERROR_BAD_OFFSET, 0, { 0 }, NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, \
+									  &BoundaryUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\n", currTst->testName);
+			// Function call
+			testStruct = (struct Elf_Details*)gimme_mem(1, sizeof(struct Elf_Details));
+			currTst->actualResult = parse_elf_buffer(testStruct, currTst->inputBuffer, currTst->inputSize);
+
+			// Test return value
+			printf("\t\tReturn:\t\t");
+			numTests++;
+			if (currTst->actualResult == currTst->expectedResult)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\t\tExpected:\t%d\n", currTst->expectedResult);
+				printf("\t\t\tReceived:\t%d\n", currTst->actualResult);
+			}
+
+			// Test number of entries
+			printf("\t\tEntries:\t");
+			numTests++;
+			if (testStruct && testStruct->numPrgmHdrs == currTst->expectedNum)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+			}
+
+			// Test decoded entry
+			if (currTst->expectedNum > 0)
+			{
+				printf("\t\tEntry 0:\t");
+				numTests++;
+				if (testStruct && testStruct->prgmHdrs \
+					&& !memcmp(testStruct->prgmHdrs, &(currTst->expectedHdr), sizeof(struct Elf_Prgrm_Header)))
+				{
+					printf("Pass\n");
+					numPass++;
+				}
+				else
+				{
+					printf("FAIL\n");
+				}
+			}
+
+			// Clean up
+			kill_elf(&testStruct);
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
@@ -94,9 +94,9 @@ int main(void)
 	// ARRAY OF TEST GROUPS
 	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, \
 									  NULL, };
-									 // &ErrorUnitTests, \
-				 					 // &BoundaryUnitTests, \
-					 				 // &SpecialUnitTests, \
+									 // &ErrorUnitTests,
+				 					 // &BoundaryUnitTests,
+					 				 // &SpecialUnitTests,
 					 				 //	NULL };
 
 	/* RUN THE TESTS */
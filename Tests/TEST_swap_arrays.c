@@ -0,0 +1,264 @@
+#include "../Elf_Details.h"
+#include "../Elf_Swap.h"
+#include <stdio.h>		// I/O
+#include <string.h>		// memcpy()
+
+#define DEFAULT_INT		((int)1337)
+#define MAX_COUNT		((size_t)257)
+
+
+typedef struct saTest
+{
+	char* testName;
+	int swapIsa;			// SWAP_ISA_* to force
+	size_t count;			// Number of elements to swap
+	int inPlace;			// If TRUE, dst is src
+	int actualResult;		// Return value from set_swap_isa()
+	int expectedResult;
+	struct saTest* nextTest;
+} unitTest;
+
+
+typedef struct saTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// Purpose:	Swap count elements of every width and compare them to __builtin_bswap*()
+// Input:
+//			count - Number of elements
+//			inPlace - If TRUE, swap the array in place
+// Output:	TRUE if every element matched, FALSE otherwise
+int check_swaps(size_t count, int inPlace);
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", SWAP_ISA_SCALAR, 7, FALSE, DEFAULT_INT, ERROR_SUCCESS, NULL };
+	unitTest Normal2 = { "Normal2", SWAP_ISA_SCALAR, 33, TRUE, DEFAULT_INT, ERROR_SUCCESS, NULL };
+	unitTest Normal3 = { "Normal3", SWAP_ISA_AUTO, MAX_COUNT, FALSE, DEFAULT_INT, ERROR_SUCCESS, NULL };
+	unitTest Normal4 = { "Normal4", SWAP_ISA_AUTO, MAX_COUNT, TRUE, DEFAULT_INT, ERROR_SUCCESS, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	Normal3.nextTest = &Normal4;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// BOUNDARY
+	//// Boundary1 - Nothing to swap
+	unitTest Boundary1 = { "Boundary1", SWAP_ISA_AUTO, 0, FALSE, DEFAULT_INT, ERROR_SUCCESS, NULL };
+	//// Boundary2 - One element
+	unitTest Boundary2 = { "Boundary2", SWAP_ISA_AUTO, 1, FALSE, DEFAULT_INT, ERROR_SUCCESS, NULL };
+	//// Boundary3 - One element short of a full AVX2 vector of 16-bit values
+	unitTest Boundary3 = { "Boundary3", SWAP_ISA_AUTO, 15, FALSE, DEFAULT_INT, ERROR_SUCCESS, NULL };
+	//// Boundary4 - Exactly one AVX2 vector of 16-bit values
+	unitTest Boundary4 = { "Boundary4", SWAP_ISA_AUTO, 16, TRUE, DEFAULT_INT, ERROR_SUCCESS, NULL };
+	//// Link Tests
+	Boundary1.nextTest = &Boundary2;
+	Boundary2.nextTest = &Boundary3;
+	Boundary3.nextTest = &Boundary4;
+	//// Create Test Group
+	unitTestGroup BoundaryUnitTests = { "Boundary Unit Tests", &Boundary1 };
+
+	// ERROR
+	//// Error1 - Unknown ISA
+	unitTest Error1 = { "Error1", SWAP_ISA_AVX2 + 1, 7, FALSE, DEFAULT_INT, ERROR_BAD_ARG, NULL };
+	//// Error2 - Negative ISA
+	unitTest Error2 = { "Error2", -1, 7, FALSE, DEFAULT_INT, ERROR_BAD_ARG, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// SPECIAL
+	//// Special1 - Every vector implementation this CPU supports, scalar if it supports none
+	unitTest Special1 = { "Special1", SWAP_ISA_SSSE3, MAX_COUNT, FALSE, DEFAULT_INT, ERROR_SUCCESS, NULL };
+	unitTest Special2 = { "Special2", SWAP_ISA_AVX2, MAX_COUNT, TRUE, DEFAULT_INT, ERROR_SUCCESS, NULL };
+	//// Link Tests
+	Special1.nextTest = &Special2;
+	//// Create Test Group
+	unitTestGroup SpecialUnitTests = { "Special Unit Tests", &Special1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &BoundaryUnitTests, &ErrorUnitTests, &SpecialUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\n", currTst->testName);
+			// Function call
+			currTst->actualResult = set_swap_isa(currTst->swapIsa);
+			// An unsupported vector ISA is not a failure, it falls back to scalar
+			if (currTstGrp == &SpecialUnitTests && currTst->actualResult == ERROR_BAD_ARG)
+			{
+				printf("\t\t(Not supported by this CPU)\n");
+				currTst->actualResult = set_swap_isa(SWAP_ISA_SCALAR);
+			}
+
+			// Test return value
+			printf("\t\tReturn:\t\t");
+			numTests++;
+			if (currTst->actualResult == currTst->expectedResult)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+			}
+
+			// Test swapped values
+			if (currTst->actualResult == ERROR_SUCCESS)
+			{
+				printf("\t\tSwapped:\t");
+				numTests++;
+				if (check_swaps(currTst->count, currTst->inPlace) == TRUE)
+				{
+					printf("Pass\n");
+					numPass++;
+				}
+				else
+				{
+					printf("FAIL\n");
+				}
+			}
+
+			// Reset
+			set_swap_isa(SWAP_ISA_AUTO);
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
+
+
+int check_swaps(size_t count, int inPlace)
+{
+	/* LOCAL VARIABLES */
+	int retVal = TRUE;
+	// One extra byte so src can start unaligned
+	unsigned char rawBytes[(MAX_COUNT * sizeof(uint64_t)) + 1] = { 0 };
+	unsigned char* src = rawBytes + 1;
+	uint16_t dst16[MAX_COUNT] = { 0 };
+	uint32_t dst32[MAX_COUNT] = { 0 };
+	uint64_t dst64[MAX_COUNT] = { 0 };
+	uint16_t val16 = 0;
+	uint32_t val32 = 0;
+	uint64_t val64 = 0;
+	size_t i = 0;
+
+	/* INPUT VALIDATION */
+	if (count > MAX_COUNT)
+	{
+		return FALSE;
+	}
+
+	/* CHECK SWAPS */
+	// Distinct byte values so any misplaced byte shows up
+	for (i = 0; i < sizeof(rawBytes); i++)
+	{
+		rawBytes[i] = (unsigned char)((i * 37) + 11);
+	}
+
+	// 16-bit
+	if (inPlace == TRUE)
+	{
+		memcpy(dst16, src, count * sizeof(*dst16));
+		swap_16_array(dst16, dst16, count);
+	}
+	else
+	{
+		swap_16_array(dst16, src, count);
+	}
+	for (i = 0; i < count && retVal == TRUE; i++)
+	{
+		memcpy(&val16, src + (i * sizeof(val16)), sizeof(val16));
+		if (dst16[i] != __builtin_bswap16(val16))
+		{
+			retVal = FALSE;
+		}
+	}
+
+	// 32-bit
+	if (inPlace == TRUE)
+	{
+		memcpy(dst32, src, count * sizeof(*dst32));
+		swap_32_array(dst32, dst32, count);
+	}
+	else
+	{
+		swap_32_array(dst32, src, count);
+	}
+	for (i = 0; i < count && retVal == TRUE; i++)
+	{
+		memcpy(&val32, src + (i * sizeof(val32)), sizeof(val32));
+		if (dst32[i] != __builtin_bswap32(val32))
+		{
+			retVal = FALSE;
+		}
+	}
+
+	// 64-bit
+	if (inPlace == TRUE)
+	{
+		memcpy(dst64, src, count * sizeof(*dst64));
+		swap_64_array(dst64, dst64, count);
+	}
+	else
+	{
+		swap_64_array(dst64, src, count);
+	}
+	for (i = 0; i < count && retVal == TRUE; i++)
+	{
+		memcpy(&val64, src + (i * sizeof(val64)), sizeof(val64));
+		if (dst64[i] != __builtin_bswap64(val64))
+		{
+			retVal = FALSE;
+		}
+	}
+
+	return retVal;
+}
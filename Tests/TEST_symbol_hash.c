@@ -0,0 +1,305 @@
+#include "../Elf_Details.h"
+#include <stdio.h>		// I/O
+#include <string.h>		// memcpy
+
+#define BUFF_SIZE 		1024
+#define DYN_NAMES		"\0puts\0foo\0bar"		// Dynamic string table contents
+#define SECT_NAMES		"\0.dynsym\0.dynstr\0.gnu.hash\0.hash\0.shstrtab"	// Section name string table contents
+#define DYN_NAMES_OFF	0x40					// Dynamic string table offset
+#define SECT_NAMES_OFF	0x50					// Section name string table offset
+#define DYN_TABLE_OFF	0x80					// Dynamic symbol table offset
+#define DYN_TABLE_NUM	4						// Number of symbols (including the null symbol)
+#define GNU_HASH_OFF	0xE0					// .gnu.hash offset
+#define GNU_HASH_SIZE	36						// Header, 1 bloom word, 1 bucket, 2 chains
+#define GNU_HASH_SHIFT	6						// Bloom filter shift
+#define SYSV_HASH_OFF	0x108					// .hash offset
+#define SYSV_HASH_SIZE	28						// Header, 1 bucket, 4 chains
+#define SECT_TABLE_OFF	0x128					// Section Header Table offset
+#define SECT_TABLE_NUM	6						// Number of Section Header entries
+#define GNU_HASH_INDEX	3						// .gnu.hash section index
+#define SYSV_HASH_INDEX	4						// .hash section index
+
+
+typedef struct shTest
+{
+	char* testName;
+	char* symName;			// Name to look up
+	int definedOnly;		// If TRUE, find_defined_symbol().  Otherwise, find_symbol_by_name().
+	char* expectedName;		// NULL if no symbol should be found
+	struct shTest* nextTest;
+} unitTest;
+
+
+typedef struct shTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+// Purpose:	Write a little endian value into buff
+static void put_le(unsigned char* buff, size_t offset, uint64_t value, int numBytes)
+{
+	int i = 0;
+
+	for (i = 0; i < numBytes; i++)
+	{
+		buff[offset + i] = (unsigned char)(value >> (8 * i));
+	}
+
+	return;
+}
+
+
+// Purpose:	Write one ELFCLASS64 Section Header Table entry into buff
+static void put_section(unsigned char* buff, int index, uint32_t name, uint32_t type, uint64_t offset, \
+	                    uint64_t size, uint32_t link, uint64_t entsize)
+{
+	size_t entry = SECT_TABLE_OFF + (index * ELF_S_SIZE_64);
+
+	put_le(buff, entry, name, 4);
+	put_le(buff, entry + 0x04, type, 4);
+	put_le(buff, entry + 0x18, offset, 8);
+	put_le(buff, entry + 0x20, size, 8);
+	put_le(buff, entry + 0x28, link, 4);
+	put_le(buff, entry + 0x38, entsize, 8);
+
+	return;
+}
+
+
+// Purpose:	Write one ELFCLASS64 symbol table entry into buff
+static void put_symbol(unsigned char* buff, int index, uint32_t name, unsigned char info, uint16_t shndx, \
+	                   uint64_t value, uint64_t size)
+{
+	size_t entry = DYN_TABLE_OFF + (index * ELF_SYM_SIZE_64);
+
+	put_le(buff, entry, name, 4);
+	buff[entry + 0x04] = info;
+	put_le(buff, entry + 0x06, shndx, 2);
+	put_le(buff, entry + 0x08, value, 8);
+	put_le(buff, entry + 0x10, size, 8);
+
+	return;
+}
+
+
+// Purpose:	Set the bloom filter bits gnu_hash(name) checks
+static uint64_t bloom_bits(char* name)
+{
+	unsigned int nameHash = gnu_hash(name);
+
+	return ((uint64_t)1 << (nameHash % 64)) | ((uint64_t)1 << ((nameHash >> GNU_HASH_SHIFT) % 64));
+}
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	struct Elf_Details* testStruct = NULL;	// Struct to parse into
+	struct Elf_Symbol_Table* symTable = NULL;	// Symbols read from testStruct
+	const struct Elf_Symbol* symbol = NULL;	// Symbol found by the test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	int tmpInt = 0;						// Holds parse_elf_buffer() return value
+	// Hash section types to test, in the order read_symbol_table() prefers them
+	int hashTypes[] = { ELF_S_TYPE_GNU_HASH, ELF_S_TYPE_HASH, 0 };
+	int goodTable = FALSE;				// If TRUE, every check of the bad shift test passed
+	size_t i = 0;						// Iterating variable
+	// 64-bit Little Endian x86-64 Shared object header
+	unsigned char elf64LE[BUFF_SIZE] = { \
+		0x7F, 0x45, 0x4C, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x03, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x00, 0x00, 0x40, 0x00, SECT_TABLE_NUM, 0x00, 0x05, 0x00, };
+	size_t elfSize = SECT_TABLE_OFF + (SECT_TABLE_NUM * ELF_S_SIZE_64);
+
+	/* SETUP BUFFER */
+	put_le(elf64LE, 0x28, SECT_TABLE_OFF, 8);
+	memcpy(elf64LE + DYN_NAMES_OFF, DYN_NAMES, sizeof(DYN_NAMES));
+	memcpy(elf64LE + SECT_NAMES_OFF, SECT_NAMES, sizeof(SECT_NAMES));
+	put_section(elf64LE, 1, 0x01, ELF_S_TYPE_DYNSYM, DYN_TABLE_OFF, DYN_TABLE_NUM * ELF_SYM_SIZE_64, 2, ELF_SYM_SIZE_64);
+	put_section(elf64LE, 2, 0x09, ELF_S_TYPE_STRTAB, DYN_NAMES_OFF, sizeof(DYN_NAMES), 0, 0);
+	put_section(elf64LE, 5, 0x21, ELF_S_TYPE_STRTAB, SECT_NAMES_OFF, sizeof(SECT_NAMES), 0, 0);
+	// puts is imported, foo and bar are exported
+	put_symbol(elf64LE, 1, 0x01, (ELF_SYM_BIND_GLOBAL << 4) | ELF_SYM_TYPE_FUNC, ELF_S_INDEX_UNDEF, 0, 0);
+	put_symbol(elf64LE, 2, 0x06, (ELF_SYM_BIND_GLOBAL << 4) | ELF_SYM_TYPE_FUNC, 1, 0x1000, 0x10);
+	put_symbol(elf64LE, 3, 0x0A, (ELF_SYM_BIND_GLOBAL << 4) | ELF_SYM_TYPE_OBJECT, 1, 0x2000, 0x8);
+	// .gnu.hash: 1 bucket starting at foo, symoffset skips puts
+	put_le(elf64LE, GNU_HASH_OFF, 1, 4);
+	put_le(elf64LE, GNU_HASH_OFF + 4, 2, 4);
+	put_le(elf64LE, GNU_HASH_OFF + 8, 1, 4);
+	put_le(elf64LE, GNU_HASH_OFF + 12, GNU_HASH_SHIFT, 4);
+	put_le(elf64LE, GNU_HASH_OFF + 16, bloom_bits("foo") | bloom_bits("bar"), 8);
+	put_le(elf64LE, GNU_HASH_OFF + 24, 2, 4);
+	put_le(elf64LE, GNU_HASH_OFF + 28, gnu_hash("foo") & ~1U, 4);
+	put_le(elf64LE, GNU_HASH_OFF + 32, gnu_hash("bar") | 1U, 4);
+	// .hash: 1 bucket chaining bar -> foo -> puts
+	put_le(elf64LE, SYSV_HASH_OFF, 1, 4);
+	put_le(elf64LE, SYSV_HASH_OFF + 4, DYN_TABLE_NUM, 4);
+	put_le(elf64LE, SYSV_HASH_OFF + 8, 3, 4);
+	put_le(elf64LE, SYSV_HASH_OFF + 12, 0, 4);
+	put_le(elf64LE, SYSV_HASH_OFF + 16, 0, 4);
+	put_le(elf64LE, SYSV_HASH_OFF + 20, 1, 4);
+	put_le(elf64LE, SYSV_HASH_OFF + 24, 2, 4);
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", "foo", TRUE, "foo", NULL };
+	unitTest Normal2 = { "Normal2", "bar", TRUE, "bar", NULL };
+	unitTest Normal3 = { "Normal3", "bar", FALSE, "bar", NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - No such name
+	unitTest Error1 = { "Error1", "baz", TRUE, NULL, NULL };
+	//// Error2 - No such name (or undefined fallback)
+	unitTest Error2 = { "Error2", "baz", FALSE, NULL, NULL };
+	//// Error3 - Imports aren't defined
+	unitTest Error3 = { "Error3", "puts", TRUE, NULL, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	Error2.nextTest = &Error3;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// SPECIAL
+	//// Special1 - Imports are still found by name
+	unitTest Special1 = { "Special1", "puts", FALSE, "puts", NULL };
+	//// Create Test Group
+	unitTestGroup SpecialUnitTests = { "Special Unit Tests", &Special1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, &SpecialUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	// Once per hash section.  Hide the preferred one each time around.
+	for (i = 0; i < sizeof(hashTypes) / sizeof(*hashTypes); i++)
+	{
+		put_section(elf64LE, GNU_HASH_INDEX, 0x11, i < 1 ? ELF_S_TYPE_GNU_HASH : ELF_S_TYPE_PROGBITS, \
+			GNU_HASH_OFF, GNU_HASH_SIZE, 1, 0);
+		put_section(elf64LE, SYSV_HASH_INDEX, 0x1B, i < 2 ? ELF_S_TYPE_HASH : ELF_S_TYPE_PROGBITS, \
+			SYSV_HASH_OFF, SYSV_HASH_SIZE, 1, 4);
+
+		/* PARSE THE BUFFER */
+		testStruct = (struct Elf_Details*)gimme_mem(1, sizeof(struct Elf_Details));
+		tmpInt = parse_elf_buffer(testStruct, elf64LE, elfSize);
+		// Symbols are read from the retained file contents
+		testStruct->elfGuts = (char*)elf64LE;
+		testStruct->elfSize = elfSize;
+		symTable = read_elf_symbols(testStruct);
+		printf("Reading the symbols (hash type 0x%X)...\n", hashTypes[i]);
+		printf("\tReturn:\t\t");
+		numTests++;
+		if (tmpInt == ERROR_SUCCESS && symTable && symTable->hashType == hashTypes[i] \
+			&& (symTable->nameIndex ? TRUE : FALSE) == (hashTypes[i] ? FALSE : TRUE))
+		{
+			printf("Pass\n");
+			numPass++;
+		}
+		else
+		{
+			printf("FAIL\n");
+		}
+
+		tstGrpArr = arrayOfTests;
+		currTstGrp = *tstGrpArr;
+
+		while (currTstGrp)
+		{
+			printf("Running '%s'...\n", currTstGrp->testGroupName);
+			currTst = currTstGrp->headNode;
+
+			while(currTst)
+			{
+				// Header
+				printf("\tTest %s:\n", currTst->testName);
+				// Function call
+				if (currTst->definedOnly == TRUE)
+				{
+					symbol = find_defined_symbol(symTable, currTst->symName);
+				}
+				else
+				{
+					symbol = find_symbol_by_name(symTable, currTst->symName);
+				}
+
+				// Test return value
+				printf("\t\tReturn:\t\t");
+				numTests++;
+				if ((!currTst->expectedName && !symbol) || (currTst->expectedName && symbol \
+					&& symbol->symName && !strcmp(symbol->symName, currTst->expectedName)))
+				{
+					printf("Pass\n");
+					numPass++;
+				}
+				else
+				{
+					printf("FAIL\n");
+					printf("\t\t\tExpected:\t%s\n", currTst->expectedName);
+					printf("\t\t\tReceived:\t%s\n", symbol ? symbol->symName : NULL);
+				}
+
+				// Next test
+				currTst = currTst->nextTest;
+			}
+
+			// Next test group
+			tstGrpArr++;
+			currTstGrp = *tstGrpArr;
+		}
+
+		/* CLEAN UP */
+		kill_symbol_table(&symTable);
+		// elfGuts is on the stack
+		testStruct->elfGuts = NULL;
+		testStruct->elfSize = 0;
+		kill_elf(&testStruct);
+	}
+
+	/* BAD BLOOM SHIFT */
+	// Falls back to the name index instead of shifting by 32 or more
+	printf("Reading the symbols (bloom shift 32)...\n");
+	printf("\tReturn:\t\t");
+	numTests++;
+	put_le(elf64LE, GNU_HASH_OFF + 12, 32, 4);
+	put_section(elf64LE, GNU_HASH_INDEX, 0x11, ELF_S_TYPE_GNU_HASH, GNU_HASH_OFF, GNU_HASH_SIZE, 1, 0);
+	put_section(elf64LE, SYSV_HASH_INDEX, 0x1B, ELF_S_TYPE_PROGBITS, SYSV_HASH_OFF, SYSV_HASH_SIZE, 1, 4);
+	testStruct = (struct Elf_Details*)gimme_mem(1, sizeof(struct Elf_Details));
+	tmpInt = parse_elf_buffer(testStruct, elf64LE, elfSize);
+	testStruct->elfGuts = (char*)elf64LE;
+	testStruct->elfSize = elfSize;
+	symTable = read_elf_symbols(testStruct);
+	symbol = find_defined_symbol(symTable, "bar");
+	goodTable = tmpInt == ERROR_SUCCESS && symTable && symTable->hashType == 0 && symTable->nameIndex \
+		&& symbol && !strcmp(symbol->symName, "bar");
+	printf("%s\n", goodTable ? "Pass" : "FAIL");
+	numPass += goodTable ? 1 : 0;
+	kill_symbol_table(&symTable);
+	testStruct->elfGuts = NULL;
+	testStruct->elfSize = 0;
+	kill_elf(&testStruct);
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}
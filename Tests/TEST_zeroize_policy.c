@@ -0,0 +1,153 @@
+#include "../Elf_Details.h"
+#include <stdio.h>		// I/O
+
+#define DEFAULT_INT		((int)1337)
+
+
+typedef struct zpTest
+{
+	char* testName;
+	int inputPolicy;
+	int actualResult;
+	int expectedResult;
+	int expectedPolicy;		// get_zeroize_policy() after set_zeroize_policy()
+	int expectedPlain;		// should_zeroize(FALSE)
+	int expectedSensitive;	// should_zeroize(TRUE)
+	struct zpTest* nextTest;
+} unitTest;
+
+
+typedef struct zpTestGroup
+{
+	char* testGroupName;
+	unitTest* headNode;
+} unitTestGroup;
+
+
+int main(void)
+{
+	/* LOCAL VARIABLES */
+	unitTestGroup** tstGrpArr = NULL;	// Array of test group pointers
+	unitTestGroup* currTstGrp = NULL;	// Current test group pointer
+	unitTest* currTst = NULL;			// Current test
+	int numTests = 0;					// Total number of tests
+	int numPass = 0;					// Total number of tests that passed
+	char* testBuff = NULL;				// Buffer to release under each policy
+
+	/* UNIT TESTS */
+	// NORMAL
+	unitTest Normal1 = { "Normal1", ZEROIZE_ALWAYS, DEFAULT_INT, ERROR_SUCCESS, ZEROIZE_ALWAYS, TRUE, TRUE, NULL };
+	unitTest Normal2 = { "Normal2", ZEROIZE_NEVER, DEFAULT_INT, ERROR_SUCCESS, ZEROIZE_NEVER, FALSE, FALSE, NULL };
+	unitTest Normal3 = { "Normal3", ZEROIZE_SENSITIVE, DEFAULT_INT, ERROR_SUCCESS, ZEROIZE_SENSITIVE, FALSE, TRUE, NULL };
+	//// Link Tests
+	Normal1.nextTest = &Normal2;
+	Normal2.nextTest = &Normal3;
+	//// Create Test Group
+	unitTestGroup NormalUnitTests = { "Normal Unit Tests", &Normal1 };
+
+	// ERROR
+	//// Error1 - Unknown policy leaves the previous policy (ZEROIZE_SENSITIVE) in place
+	unitTest Error1 = { "Error1", ZEROIZE_SENSITIVE + 1, DEFAULT_INT, ERROR_BAD_ARG, ZEROIZE_SENSITIVE, FALSE, TRUE, NULL };
+	//// Error2 - Negative policy
+	unitTest Error2 = { "Error2", -1, DEFAULT_INT, ERROR_BAD_ARG, ZEROIZE_SENSITIVE, FALSE, TRUE, NULL };
+	//// Link Tests
+	Error1.nextTest = &Error2;
+	//// Create Test Group
+	unitTestGroup ErrorUnitTests = { "Error Unit Tests", &Error1 };
+
+	// ARRAY OF TEST GROUPS
+	unitTestGroup* arrayOfTests[] = { &NormalUnitTests, &ErrorUnitTests, NULL };
+
+	/* RUN THE TESTS */
+	tstGrpArr = arrayOfTests;
+	currTstGrp = *tstGrpArr;
+
+	while (currTstGrp)
+	{
+		printf("Running '%s'...\n", currTstGrp->testGroupName);
+		currTst = currTstGrp->headNode;
+
+		while(currTst)
+		{
+			// Header
+			printf("\tTest %s:\n", currTst->testName);
+			// Function call
+			currTst->actualResult = set_zeroize_policy(currTst->inputPolicy);
+
+			// Test return value
+			printf("\t\tReturn:\t\t");
+			numTests++;
+			if (currTst->actualResult == currTst->expectedResult)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+				printf("\t\t\tExpected:\t%d\n", currTst->expectedResult);
+				printf("\t\t\tReceived:\t%d\n", currTst->actualResult);
+			}
+
+			// Test policy
+			printf("\t\tPolicy:\t\t");
+			numTests++;
+			if (get_zeroize_policy() == currTst->expectedPolicy \
+				&& should_zeroize(FALSE) == currTst->expectedPlain \
+				&& should_zeroize(TRUE) == currTst->expectedSensitive)
+			{
+				printf("Pass\n");
+				numPass++;
+			}
+			else
+			{
+				printf("FAIL\n");
+			}
+
+			// Test both release functions under this policy
+			printf("\t\tRelease:\t");
+			numTests++;
+			testBuff = gimme_mem(8, sizeof(char));
+			if (take_mem_back((void**)&testBuff, 8, sizeof(char)) == ERROR_SUCCESS && !testBuff)
+			{
+				testBuff = gimme_mem(8, sizeof(char));
+				if (take_sensitive_mem_back((void**)&testBuff, 8, sizeof(char)) == ERROR_SUCCESS && !testBuff)
+				{
+					printf("Pass\n");
+					numPass++;
+				}
+				else
+				{
+					printf("FAIL\n");
+				}
+			}
+			else
+			{
+				printf("FAIL\n");
+			}
+
+			// Next test
+			currTst = currTst->nextTest;
+		}
+
+		// Next test group
+		tstGrpArr++;
+		currTstGrp = *tstGrpArr;
+	}
+
+	/* PRINT TEST RESULTS */
+	putchar('\n');
+	print_fancy_header(stdout, "    UNIT TEST RESULTS    ", HEADER_DELIM);
+	printf("Total Pass:\t\t%d\n", numPass);
+	printf("Total Tests:\t\t%d\n", numTests);
+	if ((100 * numPass) % numTests)
+	{
+		printf("Percent Tests Passed:\t%.1f%%\n\n", (float)numPass / numTests * 100);
+	}
+	else
+	{
+		printf("Percent Tests Passed:\t%.0f%%\n\n", (float)numPass / numTests * 100);
+	}
+
+	return 0;
+}